@@ -0,0 +1,61 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides seqan3::align_cfg::adaptive_score_width configuration.
+ */
+
+#pragma once
+
+#include <seqan3/alignment/configuration/detail.hpp>
+#include <seqan3/core/configuration/pipeable_config_element.hpp>
+
+namespace seqan3::align_cfg
+{
+/*!\brief Selects the score width of the vectorised alignment for every sequence pair.
+ * \ingroup alignment_configuration
+ *
+ * \details
+ *
+ * The \ref seqan3::align_cfg::vectorised "vectorised" alignment computes one sequence pair per SIMD lane, and the
+ * number of lanes is fixed by the score type, e.g. eight 32-bit lanes with AVX2. With this configuration, an 8, 16 or
+ * 32-bit score width is chosen for every sequence pair such that no score of the pair can overflow. Pairs whose scores
+ * fit into 8 or 16 bit are computed with four, respectively two, times as many pairs per SIMD register as with 32-bit
+ * scores. The width is chosen from the scoring scheme, the gap scores and the length of the longer sequence of the pair
+ * before the computation. The results are the same as with 32-bit scores and the reported score type is `int32_t`.
+ *
+ * This configuration cannot be combined with seqan3::align_cfg::score_type, which fixes the score width, or with
+ * seqan3::align_cfg::band_fixed_size. It requires seqan3::align_cfg::vectorised and only computes the score and the end
+ * positions; combining it with seqan3::align_cfg::output_begin_position, seqan3::align_cfg::output_alignment or
+ * seqan3::align_cfg::output_cigar, or omitting align_cfg::vectorised, makes seqan3::align_pairwise throw
+ * seqan3::invalid_alignment_configuration. It has no effect on the
+ * \ref seqan3::align_cfg::edit_scheme "edit distance", which is computed with a bit-parallel algorithm.
+ *
+ * ### Example
+ *
+ * \include test/snippet/alignment/configuration/align_cfg_adaptive_score_width_example.cpp
+ *
+ * \remark For a complete overview, take a look at \ref alignment_pairwise.
+ *
+ * \experimentalapi{Experimental since version 3.4.}
+ */
+class adaptive_score_width : private pipeable_config_element
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    constexpr adaptive_score_width() noexcept = default;                                         //!< Defaulted
+    constexpr adaptive_score_width(adaptive_score_width const &) noexcept = default;             //!< Defaulted
+    constexpr adaptive_score_width(adaptive_score_width &&) noexcept = default;                  //!< Defaulted
+    constexpr adaptive_score_width & operator=(adaptive_score_width const &) noexcept = default; //!< Defaulted
+    constexpr adaptive_score_width & operator=(adaptive_score_width &&) noexcept = default;      //!< Defaulted
+    ~adaptive_score_width() noexcept = default;                                                  //!< Defaulted
+    //!\}
+
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr seqan3::detail::align_config_id id{seqan3::detail::align_config_id::adaptive_score_width};
+};
+
+} // namespace seqan3::align_cfg
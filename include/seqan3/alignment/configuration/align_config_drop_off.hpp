@@ -0,0 +1,122 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides the seqan3::align_cfg::x_drop and seqan3::align_cfg::z_drop configurations.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include <seqan3/alignment/configuration/detail.hpp>
+#include <seqan3/core/configuration/pipeable_config_element.hpp>
+
+namespace seqan3::align_cfg
+{
+/*!\brief Turns the global alignment into a seed extension with X-drop pruning.
+ * \ingroup alignment_configuration
+ *
+ * \details
+ *
+ * A seed extension aligns both sequences starting from their first positions, e.g. the end of a seed, and ends in the
+ * matrix cell with the best score, wherever it is. The matrix is computed along its antidiagonals, and every cell
+ * whose score falls more than seqan3::align_cfg::x_drop::drop_score below the best score of the previous
+ * antidiagonals is pruned. Only the cells adjacent to a non-pruned cell are computed on the next antidiagonal, i.e.
+ * the band adapts to the alignment. The extension stops as soon as all cells of an antidiagonal are pruned.
+ *
+ * The alignment result contains the score and the end positions of the best cell. The begin positions are always
+ * the first positions of the sequences. Computing the alignment is not supported and results in a
+ * seqan3::invalid_alignment_configuration exception. The configuration requires seqan3::align_cfg::method_global,
+ * whose free end gap settings are ignored, and can be combined with seqan3::align_cfg::vectorised to compute the
+ * cells of an antidiagonal with simd instructions. It cannot be combined with seqan3::align_cfg::band_fixed_size.
+ *
+ * ### Example
+ *
+ * \include test/snippet/alignment/configuration/align_cfg_drop_off_example.cpp
+ *
+ * \see seqan3::align_cfg::z_drop
+ *
+ * \experimentalapi{Experimental since version 3.4.}
+ */
+class x_drop : private pipeable_config_element
+{
+public:
+    //!\brief The score drop below the best score at which a cell is pruned; must not be negative [default: 0].
+    int32_t drop_score{0};
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    constexpr x_drop() noexcept = default;                           //!< Defaulted
+    constexpr x_drop(x_drop const &) noexcept = default;             //!< Defaulted
+    constexpr x_drop(x_drop &&) noexcept = default;                  //!< Defaulted
+    constexpr x_drop & operator=(x_drop const &) noexcept = default; //!< Defaulted
+    constexpr x_drop & operator=(x_drop &&) noexcept = default;      //!< Defaulted
+    ~x_drop() noexcept = default;                                    //!< Defaulted
+
+    /*!\brief Initialises the drop score.
+     *
+     * \param drop_score \copybrief drop_score
+     */
+    constexpr explicit x_drop(int32_t const drop_score) noexcept : drop_score{drop_score}
+    {}
+    //!\}
+
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr seqan3::detail::align_config_id id{seqan3::detail::align_config_id::x_drop};
+};
+
+/*!\brief Turns the global alignment into a seed extension that stops with the Z-drop criterion.
+ * \ingroup alignment_configuration
+ *
+ * \details
+ *
+ * Like seqan3::align_cfg::x_drop, this configuration turns the global alignment into a seed extension. After every
+ * antidiagonal, let \f$H\f$ be the best score seen so far in cell \f$(i, j)\f$ and \f$H'\f$ the best score of the
+ * antidiagonal in cell \f$(i', j')\f$. The extension stops if
+ * \f$H - H' > Z + e \cdot |(i' - i) - (j' - j)|\f$, where \f$Z\f$ is seqan3::align_cfg::z_drop::drop_score and
+ * \f$e\f$ the absolute gap extension score (Li, 2018). In contrast to the X-drop criterion, a long gap does not stop
+ * the extension on its own, while a diverged region does.
+ *
+ * If combined with seqan3::align_cfg::x_drop, cells are pruned with the X-drop criterion and the extension stops at
+ * whichever criterion is met first. Otherwise no cells are pruned.
+ *
+ * ### Example
+ *
+ * \include test/snippet/alignment/configuration/align_cfg_drop_off_example.cpp
+ *
+ * \see seqan3::align_cfg::x_drop
+ *
+ * \experimentalapi{Experimental since version 3.4.}
+ */
+class z_drop : private pipeable_config_element
+{
+public:
+    //!\brief The score drop below the best score at which the extension stops; must not be negative [default: 0].
+    int32_t drop_score{0};
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    constexpr z_drop() noexcept = default;                           //!< Defaulted
+    constexpr z_drop(z_drop const &) noexcept = default;             //!< Defaulted
+    constexpr z_drop(z_drop &&) noexcept = default;                  //!< Defaulted
+    constexpr z_drop & operator=(z_drop const &) noexcept = default; //!< Defaulted
+    constexpr z_drop & operator=(z_drop &&) noexcept = default;      //!< Defaulted
+    ~z_drop() noexcept = default;                                    //!< Defaulted
+
+    /*!\brief Initialises the drop score.
+     *
+     * \param drop_score \copybrief drop_score
+     */
+    constexpr explicit z_drop(int32_t const drop_score) noexcept : drop_score{drop_score}
+    {}
+    //!\}
+
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr seqan3::detail::align_config_id id{seqan3::detail::align_config_id::z_drop};
+};
+
+} // namespace seqan3::align_cfg
@@ -0,0 +1,77 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides seqan3::align_cfg::linear_memory_traceback configuration.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include <seqan3/alignment/configuration/detail.hpp>
+#include <seqan3/core/configuration/pipeable_config_element.hpp>
+
+namespace seqan3::align_cfg
+{
+/*!\brief Computes the traceback in linear memory for alignment matrices above a size threshold.
+ * \ingroup alignment_configuration
+ *
+ * \details
+ *
+ * If the begin positions or the alignment are requested, the standard alignment algorithm stores a trace matrix
+ * with one entry per matrix cell, i.e. \f$(n + 1) \cdot (m + 1)\f$ entries for sequences of length \f$n\f$ and
+ * \f$m\f$. For two sequences of 200 kb this amounts to 40 GB. The linear memory traceback instead recomputes the
+ * required parts of the matrix in a divide-and-conquer fashion (Myers and Miller, 1988) and needs only
+ * \f$O(n + m)\f$ memory at roughly three to four times the computational cost of the score computation.
+ *
+ * The linear memory traceback is used for every sequence pair whose matrix has more cells than
+ * seqan3::align_cfg::linear_memory_traceback::min_matrix_size. If this configuration element is not given, it is
+ * still used for matrices with more than seqan3::align_cfg::linear_memory_traceback::default_min_matrix_size cells.
+ * It supports unbanded global and local alignments with affine gap costs and computes the same score, end positions
+ * and begin positions as the standard algorithm. If several alignments have the optimal score, it might report a
+ * different one of them than the standard algorithm. This configuration cannot be combined with
+ * seqan3::align_cfg::band_fixed_size.
+ *
+ * ### Example
+ *
+ * \include test/snippet/alignment/configuration/align_cfg_linear_memory_traceback_example.cpp
+ *
+ * \remark For a complete overview, take a look at \ref alignment_pairwise.
+ *
+ * \experimentalapi{Experimental since version 3.4.}
+ */
+class linear_memory_traceback : private pipeable_config_element
+{
+public:
+    //!\brief The number of matrix cells above which the traceback is computed in linear memory if not configured.
+    static constexpr uint64_t default_min_matrix_size{uint64_t{1} << 30};
+
+    //!\brief The number of matrix cells above which the traceback is computed in linear memory [default: 0].
+    uint64_t min_matrix_size{0};
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    constexpr linear_memory_traceback() noexcept = default;                                            //!< Defaulted
+    constexpr linear_memory_traceback(linear_memory_traceback const &) noexcept = default;             //!< Defaulted
+    constexpr linear_memory_traceback(linear_memory_traceback &&) noexcept = default;                  //!< Defaulted
+    constexpr linear_memory_traceback & operator=(linear_memory_traceback const &) noexcept = default; //!< Defaulted
+    constexpr linear_memory_traceback & operator=(linear_memory_traceback &&) noexcept = default;      //!< Defaulted
+    ~linear_memory_traceback() noexcept = default;                                                     //!< Defaulted
+
+    /*!\brief Initialises the matrix size threshold.
+     *
+     * \param min_matrix_size \copybrief min_matrix_size
+     */
+    constexpr explicit linear_memory_traceback(uint64_t const min_matrix_size) noexcept :
+        min_matrix_size{min_matrix_size}
+    {}
+    //!\}
+
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr seqan3::detail::align_config_id id{seqan3::detail::align_config_id::linear_memory};
+};
+
+} // namespace seqan3::align_cfg
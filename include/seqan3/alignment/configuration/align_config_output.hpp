@@ -161,6 +161,7 @@ public:
  * \see seqan3::align_cfg::output_score
  * \see seqan3::align_cfg::output_end_position
  * \see seqan3::align_cfg::output_begin_position
+ * \see seqan3::align_cfg::output_cigar
  * \see seqan3::align_cfg::output_sequence1_id
  * \see seqan3::align_cfg::output_sequence2_id
  */
@@ -184,6 +185,55 @@ public:
     static constexpr seqan3::detail::align_config_id id{seqan3::detail::align_config_id::output_alignment};
 };
 
+/*!\brief Configures the alignment result to output the CIGAR sequence of the alignment.
+ * \ingroup alignment_configuration
+ *
+ * \details
+ *
+ * This option forces the alignment to compute and output the alignment as a sequence of seqan3::cigar operations,
+ * e.g. to write it to a SAM file. In contrast to seqan3::align_cfg::output_alignment followed by
+ * seqan3::cigar_from_alignment, the CIGAR sequence is built directly while following the trace of the alignment
+ * and the aligned sequences are never built.
+ * The CIGAR sequence is the same as the one computed by seqan3::cigar_from_alignment for the alignment, i.e.
+ * the first sequence is treated as the reference and the second sequence as the query. It only covers the aligned
+ * slices of the sequences; clipped bases, e.g. of a local alignment, can be added using the begin and end positions.
+ *
+ * If this option is not set in the alignment configuration, accessing the CIGAR sequence via the
+ * seqan3::alignment_result object is forbidden and will lead to a compile time error.
+ *
+ * ### Example
+ *
+ * \include test/snippet/alignment/configuration/align_cfg_output_cigar.cpp
+ *
+ * \see seqan3::align_cfg::output_score
+ * \see seqan3::align_cfg::output_end_position
+ * \see seqan3::align_cfg::output_begin_position
+ * \see seqan3::align_cfg::output_alignment
+ * \see seqan3::align_cfg::output_sequence1_id
+ * \see seqan3::align_cfg::output_sequence2_id
+ *
+ * \experimentalapi{Experimental since version 3.4.}
+ */
+class output_cigar : private pipeable_config_element
+{
+public:
+    /*!\name Constructor, destructor and assignment
+     * \{
+     */
+    constexpr output_cigar() = default;                                 //!< Defaulted.
+    constexpr output_cigar(output_cigar const &) = default;             //!< Defaulted.
+    constexpr output_cigar(output_cigar &&) = default;                  //!< Defaulted.
+    constexpr output_cigar & operator=(output_cigar const &) = default; //!< Defaulted.
+    constexpr output_cigar & operator=(output_cigar &&) = default;      //!< Defaulted.
+    ~output_cigar() = default;                                          //!< Defaulted.
+
+    //!\}
+
+    //!\privatesection
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr seqan3::detail::align_config_id id{seqan3::detail::align_config_id::output_cigar};
+};
+
 /*!\brief Configures the alignment result to output the id of the first sequence.
  * \ingroup alignment_configuration
  *
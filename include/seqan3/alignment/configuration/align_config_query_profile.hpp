@@ -0,0 +1,63 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides seqan3::align_cfg::query_profile configuration.
+ */
+
+#pragma once
+
+#include <seqan3/alignment/configuration/detail.hpp>
+#include <seqan3/core/configuration/pipeable_config_element.hpp>
+
+namespace seqan3::align_cfg
+{
+/*!\brief Aligns one query against many sequences with a precomputed query profile.
+ * \ingroup alignment_configuration
+ *
+ * \details
+ *
+ * In a database search, one query is aligned against thousands of sequences, e.g. a protein against a protein
+ * database. The \ref seqan3::align_cfg::vectorised "vectorised" alignment looks up the scores of every SIMD batch
+ * anew, although the first sequence of all pairs is the same. With this configuration, the first sequence of a pair is
+ * treated as the query: a striped query profile, which stores the score of every query position against every letter,
+ * is computed once and every second sequence is aligned against it with the striped SIMD kernel of Farrar (2007).
+ * The profile is reused as long as consecutive sequence pairs share the same first sequence and computed anew
+ * otherwise, i.e. the pairs can be given as, for example,
+ * `seqan3::views::zip(seqan3::views::repeat_n(query, references.size()), references)`.
+ *
+ * The results are the same as without this configuration. This configuration requires seqan3::align_cfg::vectorised
+ * and only computes the score and the end positions; combining it with seqan3::align_cfg::output_begin_position or
+ * seqan3::align_cfg::output_alignment, or omitting align_cfg::vectorised, makes seqan3::align_pairwise throw
+ * seqan3::invalid_alignment_configuration. Since the default output contains the alignment, the output
+ * must be configured explicitly, e.g. with seqan3::align_cfg::output_score. It has no effect on the
+ * \ref seqan3::align_cfg::edit_scheme "edit distance", which is computed with a bit-parallel algorithm.
+ *
+ * ### Example
+ *
+ * \include test/snippet/alignment/configuration/align_cfg_query_profile_example.cpp
+ *
+ * \remark For a complete overview, take a look at \ref alignment_pairwise.
+ *
+ * \experimentalapi{Experimental since version 3.4.}
+ */
+class query_profile : private pipeable_config_element
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    constexpr query_profile() noexcept = default;                                  //!< Defaulted
+    constexpr query_profile(query_profile const &) noexcept = default;             //!< Defaulted
+    constexpr query_profile(query_profile &&) noexcept = default;                  //!< Defaulted
+    constexpr query_profile & operator=(query_profile const &) noexcept = default; //!< Defaulted
+    constexpr query_profile & operator=(query_profile &&) noexcept = default;      //!< Defaulted
+    ~query_profile() noexcept = default;                                           //!< Defaulted
+    //!\}
+
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr seqan3::detail::align_config_id id{seqan3::detail::align_config_id::query_profile};
+};
+
+} // namespace seqan3::align_cfg
@@ -23,6 +23,8 @@ namespace seqan3::align_cfg
  *
  * This option configures the score type of the alignment algorithm.
  * By default, the alignment algorithm will only compute the score with score type `int32_t`.
+ * To choose the score width of a \ref seqan3::align_cfg::vectorised "vectorised" alignment for every sequence pair
+ * instead, configure seqan3::align_cfg::adaptive_score_width.
  *
  * ### Example
  *
@@ -0,0 +1,73 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides seqan3::align_cfg::sort_by_length configuration.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+#include <seqan3/alignment/configuration/detail.hpp>
+#include <seqan3/core/configuration/pipeable_config_element.hpp>
+
+namespace seqan3::align_cfg
+{
+/*!\brief Groups sequence pairs of similar length into the same SIMD batch of the vectorised alignment.
+ * \ingroup alignment_configuration
+ *
+ * \details
+ *
+ * The \ref seqan3::align_cfg::vectorised "vectorised" alignment computes one sequence pair per SIMD lane and pads all
+ * sequences of a batch to the longest sequence of the batch. If the sequence lengths vary, e.g. for long reads or
+ * trimmed short reads, most lanes compute padded cells. With this configuration, the sequence pairs are read in windows
+ * of seqan3::align_cfg::sort_by_length::window_size consecutive pairs and the pairs of each window are sorted by their
+ * length before they are distributed to the SIMD batches.
+ *
+ * The results are still reported in the order of the input and carry the original sequence ids. A larger window
+ * groups the lengths better, but the results of a window are only reported after the entire window was computed.
+ * This configuration requires seqan3::align_cfg::vectorised; otherwise seqan3::align_pairwise throws
+ * seqan3::invalid_alignment_configuration.
+ *
+ * ### Example
+ *
+ * \include test/snippet/alignment/configuration/align_cfg_sort_by_length_example.cpp
+ *
+ * \remark For a complete overview, take a look at \ref alignment_pairwise.
+ *
+ * \experimentalapi{Experimental since version 3.4.}
+ */
+class sort_by_length : private pipeable_config_element
+{
+public:
+    //!\brief The number of sequence pairs sorted together if not configured otherwise.
+    static constexpr size_t default_window_size{1024};
+
+    //!\brief The number of consecutive sequence pairs that are sorted by length [default: 1024].
+    size_t window_size{default_window_size};
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    constexpr sort_by_length() noexcept = default;                                   //!< Defaulted
+    constexpr sort_by_length(sort_by_length const &) noexcept = default;             //!< Defaulted
+    constexpr sort_by_length(sort_by_length &&) noexcept = default;                  //!< Defaulted
+    constexpr sort_by_length & operator=(sort_by_length const &) noexcept = default; //!< Defaulted
+    constexpr sort_by_length & operator=(sort_by_length &&) noexcept = default;      //!< Defaulted
+    ~sort_by_length() noexcept = default;                                            //!< Defaulted
+
+    /*!\brief Initialises the window size.
+     *
+     * \param window_size \copybrief window_size
+     */
+    constexpr explicit sort_by_length(size_t const window_size) noexcept : window_size{window_size}
+    {}
+    //!\}
+
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr seqan3::detail::align_config_id id{seqan3::detail::align_config_id::sort_by_length};
+};
+
+} // namespace seqan3::align_cfg
@@ -29,6 +29,27 @@ namespace seqan3::align_cfg
  * multiple alignments and not a single alignment. This means that you should provide many sequences to compute as
  * one batch rather than computing them separately as there won't be performance gains.
  *
+ * The only exception is a single sequence pair (or the last pair of a collection that does not fill a batch):
+ * unbanded global and local alignments that output only the score and the end positions are then computed with a
+ * striped kernel that vectorises the computation of each matrix column instead. This speeds up the alignment of a
+ * single long pair, e.g. a contig against a reference region.
+ *
+ * With seqan3::align_cfg::adaptive_score_width, unbanded alignments that output only the score and the end positions
+ * choose the score width of every sequence pair: pairs whose scores fit into 8 or 16 bit are computed with four,
+ * respectively two, times as many pairs per SIMD register as with 32-bit scores. The results are the same as with
+ * 32-bit scores.
+ *
+ * All sequences of a batch are padded to the longest one. If the sequence lengths vary, configure
+ * seqan3::align_cfg::sort_by_length to compute pairs of similar length together.
+ *
+ * If many pairs share the same first sequence, e.g. one protein query against a database, configure
+ * seqan3::align_cfg::query_profile to align every pair against a profile of the first sequence that is computed once.
+ *
+ * If combined with the \ref seqan3::align_cfg::edit_scheme "edit distance", the score and the end positions of
+ * sequence pairs whose second sequence is not longer than 64 letters are computed with one sequence pair per SIMD
+ * lane. Other sequence pairs and the computation of the alignment or the begin positions fall back to the
+ * non-vectorised edit distance.
+ *
  * \sa For further information on SIMD see https://en.wikipedia.org/wiki/SIMD.
  *
  * ### Example
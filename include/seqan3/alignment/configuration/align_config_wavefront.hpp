@@ -0,0 +1,68 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides seqan3::align_cfg::wavefront configuration.
+ */
+
+#pragma once
+
+#include <seqan3/alignment/configuration/detail.hpp>
+#include <seqan3/core/configuration/pipeable_config_element.hpp>
+
+namespace seqan3::align_cfg
+{
+/*!\brief Computes global alignments with the wavefront alignment algorithm (WFA).
+ * \ingroup alignment_configuration
+ *
+ * \details
+ *
+ * The dynamic programming algorithm computes all \f$(n + 1) \cdot (m + 1)\f$ cells of the alignment matrix, even if
+ * the two sequences are almost identical, as in assembly polishing or haplotype comparison. The wavefront alignment
+ * algorithm of Marco-Sola et al. (2021) instead computes, for increasing alignment penalties \f$s\f$, the furthest
+ * reaching cell on every diagonal of the matrix and follows runs of matching letters without computing any score.
+ * It stops as soon as the last cell is reached, i.e. it needs \f$O((n + m) \cdot s)\f$ time, where \f$s\f$ is the
+ * penalty of the optimal alignment. For highly similar sequences, this is orders of magnitude faster than the
+ * dynamic programming algorithm; for dissimilar sequences, it is slower.
+ *
+ * The algorithm computes global alignments with affine gap costs and scoring schemes with one match and one
+ * mismatch score, e.g. a seqan3::nucleotide_scoring_scheme or seqan3::align_cfg::edit_scheme. The scores are
+ * converted into non-negative penalties, so the match score must be greater than the mismatch score, the gap open
+ * score must not be positive and twice the gap extension score must be smaller than the match score.
+ * It computes the same score as the dynamic programming algorithm. If the alignment is requested, all wavefronts are
+ * stored for the traceback, which needs \f$O(s^2)\f$ memory. If several alignments have the optimal score, it might
+ * report a different one of them than the dynamic programming algorithm.
+ *
+ * This configuration must be combined with seqan3::align_cfg::method_global. Free end gaps, scoring matrices and
+ * invalid scores make seqan3::align_pairwise throw seqan3::invalid_alignment_configuration. It cannot be combined
+ * with seqan3::align_cfg::band_fixed_size, seqan3::align_cfg::method_local, seqan3::align_cfg::vectorised, the
+ * seed extension configurations and the other algorithm selecting configurations.
+ *
+ * ### Example
+ *
+ * \include test/snippet/alignment/configuration/align_cfg_wavefront_example.cpp
+ *
+ * \remark For a complete overview, take a look at \ref alignment_pairwise.
+ *
+ * \experimentalapi{Experimental since version 3.4.}
+ */
+class wavefront : private pipeable_config_element
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    constexpr wavefront() noexcept = default;                              //!< Defaulted
+    constexpr wavefront(wavefront const &) noexcept = default;             //!< Defaulted
+    constexpr wavefront(wavefront &&) noexcept = default;                  //!< Defaulted
+    constexpr wavefront & operator=(wavefront const &) noexcept = default; //!< Defaulted
+    constexpr wavefront & operator=(wavefront &&) noexcept = default;      //!< Defaulted
+    ~wavefront() noexcept = default;                                       //!< Defaulted
+    //!\}
+
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr seqan3::detail::align_config_id id{seqan3::detail::align_config_id::wavefront};
+};
+
+} // namespace seqan3::align_cfg
@@ -0,0 +1,125 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides seqan3::detail::cigar_builder.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <ranges>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/matrix/detail/matrix_coordinate.hpp>
+#include <seqan3/alignment/matrix/detail/trace_directions.hpp>
+#include <seqan3/alphabet/cigar/cigar.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Builds the CIGAR sequence of an alignment directly from the respective trace path.
+ * \ingroup alignment_matrix
+ *
+ * \details
+ *
+ * In contrast to seqan3::detail::aligned_sequence_builder, this class does not build the aligned sequences, but
+ * only records the run-length encoded alignment operations while it follows the trace path. The result is the same
+ * CIGAR sequence that seqan3::cigar_from_alignment computes for the alignment without clipping and without the
+ * extended CIGAR alphabet, i.e. the first sequence is the reference and the second sequence is the query:
+ * a diagonal trace is reported as 'M', a gap in the first sequence as 'I' and a gap in the second sequence as 'D'.
+ *
+ * The trace path is followed from the end of the alignment to its begin. The operations are collected in an internal
+ * buffer, whose memory is reused if the same builder is used for several alignments, and are then copied in reverse
+ * order into the result. Thus, building the CIGAR sequence needs a single allocation for the returned
+ * std::vector once the buffer has reached its final capacity.
+ */
+class cigar_builder
+{
+public:
+    //!\brief The result type when building the CIGAR sequence.
+    struct [[nodiscard]] result_type
+    {
+        //!\brief The slice positions of the first sequence.
+        std::pair<size_t, size_t> first_sequence_slice_positions{};
+        //!\brief The slice positions of the second sequence.
+        std::pair<size_t, size_t> second_sequence_slice_positions{};
+        //!\brief The CIGAR sequence of the alignment over the slices of the first and second sequence.
+        std::vector<cigar> cigar_sequence{};
+    };
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    cigar_builder() = default;                                  //!< Defaulted.
+    cigar_builder(cigar_builder const &) = default;             //!< Defaulted.
+    cigar_builder(cigar_builder &&) = default;                  //!< Defaulted.
+    cigar_builder & operator=(cigar_builder const &) = default; //!< Defaulted.
+    cigar_builder & operator=(cigar_builder &&) = default;      //!< Defaulted.
+    ~cigar_builder() = default;                                 //!< Defaulted.
+    //!\}
+
+    /*!\brief Builds the CIGAR sequence from the given trace path.
+     * \tparam trace_path_t The type of the trace path; must model std::ranges::input_range and
+     *                      std::same_as<std::ranges::range_value_t<trace_path_t>, seqan3::detail::trace_directions>
+     *                      must evaluate to `true`.
+     * \param[in] trace_path The trace path.
+     * \returns seqan3::detail::cigar_builder::result_type with the built CIGAR sequence.
+     *
+     * \details
+     *
+     * The returned CIGAR sequence is empty if the trace path is empty.
+     */
+    template <std::ranges::input_range trace_path_t>
+    result_type operator()(trace_path_t && trace_path)
+    {
+        static_assert(std::same_as<std::ranges::range_value_t<trace_path_t>, trace_directions>,
+                      "The value type of the trace path must be seqan3::detail::trace_directions");
+
+        result_type res{};
+        auto trace_it = std::ranges::begin(trace_path);
+        std::tie(res.first_sequence_slice_positions.second, res.second_sequence_slice_positions.second) =
+            std::pair<size_t, size_t>{trace_it.coordinate()};
+
+        reverse_cigar_buffer.clear();
+        while (trace_it != std::ranges::end(trace_path))
+        {
+            trace_directions const last_dir = *trace_it;
+            uint32_t span = 0;
+            for (; trace_it != std::ranges::end(trace_path) && *trace_it == last_dir; ++trace_it, ++span)
+            {}
+
+            reverse_cigar_buffer.emplace_back(span, to_cigar_operation(last_dir));
+        }
+
+        std::tie(res.first_sequence_slice_positions.first, res.second_sequence_slice_positions.first) =
+            std::pair<size_t, size_t>{trace_it.coordinate()};
+
+        res.cigar_sequence.assign(reverse_cigar_buffer.rbegin(), reverse_cigar_buffer.rend());
+        return res;
+    }
+
+private:
+    /*!\brief Maps a trace direction to the corresponding CIGAR operation.
+     * \param[in] dir The trace direction; must be seqan3::detail::trace_directions::diagonal, up or left.
+     * \returns The seqan3::cigar::operation representing the trace direction.
+     */
+    static constexpr cigar::operation to_cigar_operation(trace_directions const dir) noexcept
+    {
+        assert(dir == trace_directions::up || dir == trace_directions::left || dir == trace_directions::diagonal);
+
+        if (dir == trace_directions::up) // gap in the first sequence
+            return 'I'_cigar_operation;
+        else if (dir == trace_directions::left) // gap in the second sequence
+            return 'D'_cigar_operation;
+        else
+            return 'M'_cigar_operation;
+    }
+
+    //!\brief The buffer storing the CIGAR operations from the end to the begin of the alignment.
+    std::vector<cigar> reverse_cigar_buffer{};
+};
+
+} // namespace seqan3::detail
@@ -0,0 +1,292 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \author Marcel Ehrhardt <marcel.ehrhardt AT fu-berlin.de>
+ * \brief Provides seqan3::detail::edit_distance_trace_matrix_banded.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <ranges>
+#include <stdexcept>
+#include <vector>
+
+#include <seqan3/alignment/matrix/detail/matrix_coordinate.hpp>
+#include <seqan3/alignment/matrix/detail/trace_directions.hpp>
+#include <seqan3/utility/detail/bits_of.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief The underlying data structure of seqan3::detail::edit_distance_banded that represents the trace matrix.
+ * \ingroup alignment_matrix
+ * \tparam word_t         The type of one machine word.
+ * \tparam is_semi_global Whether the first row of the matrix is free.
+ *
+ * \details
+ *
+ * Only the cells within the band are stored. Column `j > 0` stores `band_size` bits per direction, where bit `k`
+ * corresponds to the row `j - upper_diagonal + k`. For each cell the bits for seqan3::detail::trace_directions::left
+ * and seqan3::detail::trace_directions::up are stored. If none of both is set, the cell is reached via
+ * seqan3::detail::trace_directions::diagonal. Cells outside of the band return seqan3::detail::trace_directions::none.
+ */
+template <typename word_t, bool is_semi_global>
+class edit_distance_trace_matrix_banded
+{
+public:
+    //!\brief This friend allows the edit distance algorithm to fill the trace matrix via add_column.
+    template <std::ranges::viewable_range database_t,
+              std::ranges::viewable_range query_t,
+              typename align_config_t,
+              typename edit_traits>
+    friend class edit_distance_banded;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    edit_distance_trace_matrix_banded() = default;                                                      //!< Defaulted
+    edit_distance_trace_matrix_banded(edit_distance_trace_matrix_banded const &) = default;             //!< Defaulted
+    edit_distance_trace_matrix_banded(edit_distance_trace_matrix_banded &&) = default;                  //!< Defaulted
+    edit_distance_trace_matrix_banded & operator=(edit_distance_trace_matrix_banded const &) = default; //!< Defaulted
+    edit_distance_trace_matrix_banded & operator=(edit_distance_trace_matrix_banded &&) = default;      //!< Defaulted
+    ~edit_distance_trace_matrix_banded() = default;                                                     //!< Defaulted
+
+protected:
+    /*!\brief Construct the trace matrix by giving the number of rows and the band.
+     * \param rows_size      \copydoc rows_size
+     * \param upper_diagonal \copydoc upper_diagonal
+     * \param band_size      \copydoc band_size
+     */
+    edit_distance_trace_matrix_banded(size_t const rows_size, int64_t const upper_diagonal, size_t const band_size) :
+        rows_size{rows_size},
+        upper_diagonal{upper_diagonal},
+        band_size{band_size},
+        block_count{(band_size + word_size - 1u) / word_size}
+    {}
+    //!\}
+
+private:
+    struct trace_path_iterator;
+
+public:
+    //!\copydoc default_edit_distance_trait_type::word_type
+    using word_type = word_t;
+
+    //!\copydoc default_edit_distance_trait_type::word_size
+    static constexpr auto word_size = bits_of<word_type>;
+
+    //!\copydoc seqan3::detail::matrix::value_type
+    using value_type = detail::trace_directions;
+
+    //!\copydoc seqan3::detail::matrix::reference
+    using reference = value_type;
+
+    //!\copydoc seqan3::detail::matrix::size_type
+    using size_type = size_t;
+
+    /*!\brief Increase the capacity of the columns to a value that's greater or equal to `new_capacity`.
+     * \param new_capacity The new capacity.
+     * \details
+     *
+     * ### Exception
+     *
+     * Strong exception guarantee.
+     */
+    void reserve(size_t const new_capacity)
+    {
+        left.reserve(new_capacity * block_count);
+        up.reserve(new_capacity * block_count);
+    }
+
+    //!\copydoc seqan3::detail::matrix::at
+    reference at(matrix_coordinate const & coordinate) const noexcept
+    {
+        size_t const row = coordinate.row;
+        size_t const col = coordinate.col;
+
+        assert(row < rows());
+        assert(col < cols());
+
+        if (row == 0u)
+        {
+            if constexpr (is_semi_global)
+                return detail::trace_directions::none;
+
+            if (col == 0u)
+                return detail::trace_directions::none;
+
+            return detail::trace_directions::left;
+        }
+
+        if (col == 0u)
+            return detail::trace_directions::up;
+
+        int64_t const band_row = static_cast<int64_t>(row) + upper_diagonal - static_cast<int64_t>(col);
+
+        if (band_row < 0 || band_row >= static_cast<int64_t>(band_size))
+            return detail::trace_directions::none;
+
+        size_t const idx = (col - 1u) * block_count + band_row / word_size;
+        word_type const mask = word_type{1u} << (band_row % word_size);
+
+        if (left[idx] & mask)
+            return detail::trace_directions::left;
+        else if (up[idx] & mask)
+            return detail::trace_directions::up;
+        else
+            return detail::trace_directions::diagonal;
+    }
+
+    //!\copydoc seqan3::detail::matrix::rows
+    size_t rows() const noexcept
+    {
+        return rows_size;
+    }
+
+    //!\copydoc seqan3::detail::matrix::cols
+    size_t cols() const noexcept
+    {
+        return (block_count == 0u) ? 0u : left.size() / block_count + 1u;
+    }
+
+    /*!\brief Returns a trace path starting from the given coordinate and ending in the cell with
+     *        seqan3::detail::trace_directions::none.
+     * \param[in] trace_begin A seqan3::matrix_coordinate pointing to the begin of the trace to follow.
+     * \returns A std::ranges::subrange over the corresponding trace path.
+     * \throws std::invalid_argument if the specified coordinate is out of range.
+     */
+    auto trace_path(matrix_coordinate const & trace_begin) const
+    {
+        if (trace_begin.row >= rows() || trace_begin.col >= cols())
+            throw std::invalid_argument{"The given coordinate exceeds the matrix in vertical or horizontal direction."};
+
+        using path_t = std::ranges::subrange<trace_path_iterator, std::default_sentinel_t>;
+        return path_t{trace_path_iterator{this, trace_begin}, std::default_sentinel};
+    }
+
+protected:
+    /*!\brief Adds a column to the trace matrix.
+     * \param left_column The machine words which represent the trace_direction::left of the band.
+     * \param up_column   The machine words which represent the trace_direction::up of the band.
+     */
+    void add_column(std::vector<word_type> const & left_column, std::vector<word_type> const & up_column)
+    {
+        assert(left_column.size() == block_count);
+        assert(up_column.size() == block_count);
+
+        left.insert(left.end(), left_column.begin(), left_column.end());
+        up.insert(up.end(), up_column.begin(), up_column.end());
+    }
+
+private:
+    //!\copydoc seqan3::detail::matrix::rows
+    size_t rows_size{};
+    //!\brief The upper diagonal of the band.
+    int64_t upper_diagonal{};
+    //!\brief The number of rows of the band within one column.
+    size_t band_size{};
+    //!\brief The number of machine words per column.
+    size_t block_count{};
+    //!\brief Machine words which represent the trace_direction::left; stored column by column.
+    std::vector<word_type> left{};
+    //!\brief Machine words which represent the trace_direction::up; stored column by column.
+    std::vector<word_type> up{};
+};
+
+/*!\brief The iterator needed to implement seqan3::detail::edit_distance_trace_matrix_banded::trace_path.
+ *
+ * \details
+ *
+ * This iterator follows the trace matrix from a starting coordinate until it finds a
+ * seqan3::detail::trace_directions::none. Like seqan3::detail::edit_distance_trace_matrix_full::trace_path_iterator
+ * it returns exactly one direction per cell and prefers seqan3::detail::trace_directions::left over
+ * seqan3::detail::trace_directions::up over seqan3::detail::trace_directions::diagonal.
+ * \extends std::input_iterator
+ */
+template <typename word_t, bool is_semi_global>
+struct edit_distance_trace_matrix_banded<word_t, is_semi_global>::trace_path_iterator
+{
+    /*!\name Associated types
+     * \{
+     */
+    //!\brief Input iterator tag.
+    using iterator_category = std::input_iterator_tag;
+    //!\copydoc seqan3::detail::trace_iterator_base::value_type
+    using value_type = detail::trace_directions;
+    //!\copydoc seqan3::detail::trace_iterator_base::difference_type
+    using difference_type = std::ptrdiff_t;
+    //!\}
+
+    /*!\name Element access
+     * \{
+     */
+    //!\copydoc seqan3::detail::trace_iterator_base::operator*
+    constexpr value_type operator*() const
+    {
+        return parent->at(coordinate());
+    }
+
+    //!\copydoc seqan3::detail::trace_iterator_base::coordinate
+    [[nodiscard]] constexpr matrix_coordinate const & coordinate() const
+    {
+        return coordinate_;
+    }
+    //!\}
+
+    /*!\name Arithmetic operators
+     * \{
+     */
+    //!\copydoc seqan3::detail::trace_iterator_base::operator++
+    constexpr trace_path_iterator & operator++()
+    {
+        value_type const dir = *(*this);
+
+        if (dir == value_type::left)
+        {
+            coordinate_.col = std::max<size_t>(coordinate_.col, 1) - 1;
+        }
+        else if (dir == value_type::up)
+        {
+            coordinate_.row = std::max<size_t>(coordinate_.row, 1) - 1;
+        }
+        else if (dir == value_type::diagonal)
+        {
+            coordinate_.row = std::max<size_t>(coordinate_.row, 1) - 1;
+            coordinate_.col = std::max<size_t>(coordinate_.col, 1) - 1;
+        }
+
+        // The trace never leaves the band, i.e. seqan3::detail::trace_directions::none can only be found in the
+        // first row or the first column.
+        assert(dir != value_type::none || coordinate_.row == 0 || coordinate_.col == 0);
+
+        return *this;
+    }
+
+    //!\copydoc seqan3::detail::trace_iterator_base::operator++
+    constexpr void operator++(int)
+    {
+        ++(*this);
+    }
+    //!\}
+
+    /*!\name Comparison operators
+     * \{
+     */
+    //!\copydoc seqan3::detail::trace_iterator_base::operator==(derived_t const &, std::default_sentinel_t const &)
+    friend bool operator==(trace_path_iterator const & it, std::default_sentinel_t)
+    {
+        return *it == value_type::none;
+    }
+    //!\}
+
+    //!\brief The parent trace matrix.
+    edit_distance_trace_matrix_banded const * parent{nullptr};
+    //!\brief The current coordinate.
+    matrix_coordinate coordinate_{};
+};
+
+} // namespace seqan3::detail
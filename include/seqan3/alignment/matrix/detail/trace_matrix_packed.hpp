@@ -0,0 +1,536 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides seqan3::detail::trace_matrix_packed.
+ */
+
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <ranges>
+#include <span>
+#include <vector>
+
+#include <seqan3/alignment/matrix/detail/matrix_coordinate.hpp>
+#include <seqan3/alignment/matrix/detail/trace_directions.hpp>
+#include <seqan3/alignment/matrix/detail/trace_iterator.hpp>
+#include <seqan3/alignment/matrix/detail/two_dimensional_matrix_iterator_base.hpp>
+#include <seqan3/utility/views/repeat_n.hpp>
+#include <seqan3/utility/views/zip.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Trace matrix for the pairwise alignment that stores four bits per cell.
+ * \ingroup alignment_matrix
+ * \implements std::ranges::input_range
+ *
+ * \tparam trace_t The type of the trace; must be the same as seqan3::detail::trace_directions.
+ *
+ * \details
+ *
+ * The seqan3::detail::trace_matrix_full stores one seqan3::detail::trace_directions byte per cell, although the
+ * traceback only needs to know which direction it has to follow first and whether a gap was opened in the vertical or
+ * horizontal direction. This matrix stores exactly this information in four bits per cell, i.e. it needs half of the
+ * memory of the seqan3::detail::trace_matrix_full and more alignment matrices fit into the cache.
+ *
+ * Two bits of a packed cell encode the direction that is followed first (seqan3::detail::trace_directions::none,
+ * seqan3::detail::trace_directions::diagonal, seqan3::detail::trace_directions::up or
+ * seqan3::detail::trace_directions::left). If more than one direction is set for a cell, only the one that would be
+ * followed by the seqan3::detail::trace_iterator is stored, i.e. diagonal before up before left.
+ * The other two bits store seqan3::detail::trace_directions::carry_up_open and
+ * seqan3::detail::trace_directions::carry_left_open. Hence, the traceback follows the same path as in the
+ * seqan3::detail::trace_matrix_full. Every column starts at a new byte of the packed matrix.
+ *
+ * ### Range interface
+ *
+ * The matrix offers the same input range interface over the columns of the matrix as the
+ * seqan3::detail::trace_matrix_full. The alignment algorithm writes the traces of the current column into an unpacked
+ * column buffer, which is packed into the matrix when the iterator is advanced to the next column. The traces of the
+ * column that was not yet packed are read from the buffer.
+ */
+template <typename trace_t>
+    requires std::same_as<trace_t, trace_directions>
+class trace_matrix_packed
+{
+private:
+    //!\brief The type to store the complete packed trace matrix in column major order.
+    using packed_matrix_t = std::vector<uint8_t>;
+    //!\brief The type of the trace column which allocates memory for the entire column.
+    using physical_column_t = std::vector<trace_t>;
+    //!\brief The type of the virtual trace column which only stores one value.
+    using virtual_column_t = decltype(views::repeat_n(trace_t{}, 1));
+
+    class iterator;
+    class matrix_iterator;
+
+    //!\brief The number of bits used to store the trace of one cell.
+    static constexpr size_t bits_per_cell = 4;
+    //!\brief The number of cells stored in one byte of the packed matrix.
+    static constexpr size_t cells_per_byte = 8 / bits_per_cell;
+    //!\brief The mask to extract the trace of one cell.
+    static constexpr uint8_t cell_mask = (1 << bits_per_cell) - 1;
+    //!\brief The carry bits, which are stored at the same bit positions as in seqan3::detail::trace_directions.
+    static constexpr uint8_t carry_mask =
+        static_cast<uint8_t>(trace_directions::carry_up_open | trace_directions::carry_left_open);
+
+    //!\brief Maps every packed cell to the seqan3::detail::trace_directions it represents.
+    static constexpr std::array<trace_directions, 16> unpack_table = []() constexpr
+    {
+        constexpr std::array<trace_directions, 4> directions{trace_directions::none,
+                                                             trace_directions::diagonal,
+                                                             trace_directions::up,
+                                                             trace_directions::left};
+        std::array<trace_directions, 16> table{};
+
+        for (uint8_t packed_trace = 0; packed_trace < table.size(); ++packed_trace)
+        {
+            uint8_t const carry_bits = packed_trace & carry_mask;
+            table[packed_trace] =
+                directions[(packed_trace & 0b0001) | ((packed_trace & 0b0100) >> 1)] | trace_directions{carry_bits};
+        }
+
+        return table;
+    }();
+
+    //!\brief The packed trace matrix.
+    packed_matrix_t packed_matrix{};
+    //!\brief The unpacked traces of the column that is currently computed.
+    physical_column_t current_column{};
+    //!\brief The column over the horizontal traces.
+    physical_column_t horizontal_column{};
+    //!\brief The virtual column over the vertical traces.
+    virtual_column_t vertical_column{};
+    //!\brief The number of columns for this matrix.
+    size_t column_count{};
+    //!\brief The number of rows for this matrix.
+    size_t row_count{};
+    //!\brief The number of cells reserved for one column, such that every column starts at a new byte.
+    size_t column_stride{};
+    //!\brief The number of columns that are already packed; the next column is stored in the current column.
+    size_t packed_column_count{};
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    trace_matrix_packed() = default;                                        //!< Defaulted.
+    trace_matrix_packed(trace_matrix_packed const &) = default;             //!< Defaulted.
+    trace_matrix_packed(trace_matrix_packed &&) = default;                  //!< Defaulted.
+    trace_matrix_packed & operator=(trace_matrix_packed const &) = default; //!< Defaulted.
+    trace_matrix_packed & operator=(trace_matrix_packed &&) = default;      //!< Defaulted.
+    ~trace_matrix_packed() = default;                                       //!< Defaulted.
+
+    //!\}
+
+    /*!\brief Resizes the matrix.
+     * \tparam column_index_t The column index type; must model std::integral.
+     * \tparam row_index_t The row index type; must model std::integral.
+     *
+     * \param[in] column_count The number of columns for this matrix.
+     * \param[in] row_count The number of rows for this matrix.
+     *
+     * \details
+     *
+     * Resizes the packed trace matrix as well as the current and the horizontal trace column.
+     * Note the trace matrix requires the number of columns and rows to be one bigger than the size of sequence1,
+     * respectively sequence2 for the initialisation of the matrix.
+     * Reallocation happens only if the new size exceeds the current capacity of the underlying trace matrix.
+     *
+     * ### Complexity
+     *
+     * In worst case `column_count` times `row_count` times four bits of memory are allocated.
+     *
+     * ### Exception
+     *
+     * Basic exception guarantee. Might throw std::bad_alloc on resizing the internal matrices.
+     */
+    template <std::integral column_index_t, std::integral row_index_t>
+    void resize(column_index_type<column_index_t> const column_count, row_index_type<row_index_t> const row_count)
+    {
+        this->column_count = column_count.get();
+        this->row_count = row_count.get();
+        column_stride = (this->row_count + cells_per_byte - 1) / cells_per_byte * cells_per_byte;
+        packed_column_count = 0;
+        packed_matrix.resize(this->column_count * column_stride / cells_per_byte);
+        current_column.resize(column_stride);
+        horizontal_column.resize(this->row_count);
+        vertical_column = views::repeat_n(trace_t{}, this->row_count);
+    }
+
+    /*!\brief Returns a trace path starting from the given coordinate and ending in the cell with
+     *        seqan3::detail::trace_directions::none.
+     * \param[in] trace_begin A seqan3::matrix_coordinate pointing to the begin of the trace to follow.
+     * \returns A std::ranges::subrange over the corresponding trace path.
+     * \throws std::invalid_argument if the specified coordinate is out of range.
+     */
+    auto trace_path(matrix_coordinate const & trace_begin) const
+    {
+        using trace_iterator_t = trace_iterator<matrix_iterator>;
+        using path_t = std::ranges::subrange<trace_iterator_t, std::default_sentinel_t>;
+
+        if (trace_begin.row >= row_count || trace_begin.col >= column_count)
+            throw std::invalid_argument{"The given coordinate exceeds the matrix in vertical or horizontal direction."};
+
+        return path_t{trace_iterator_t{matrix_iterator{*this, 0} + matrix_offset{trace_begin}}, std::default_sentinel};
+    }
+
+    /*!\name Iterators
+     * \{
+     */
+    //!\brief Returns the iterator pointing to the first column.
+    iterator begin()
+    {
+        return iterator{*this, 0u};
+    }
+
+    //!\brief This trace matrix is not const-iterable.
+    iterator begin() const = delete;
+
+    //!\brief Returns the iterator pointing behind the last column.
+    iterator end()
+    {
+        return iterator{*this, column_count};
+    }
+
+    //!\brief This trace matrix is not const-iterable.
+    iterator end() const = delete;
+    //!\}
+
+private:
+    /*!\brief Packs a single trace into four bits.
+     * \param[in] trace The trace to pack.
+     * \returns The packed trace.
+     *
+     * \details
+     *
+     * The carry bits are kept at their positions. The bits of seqan3::detail::trace_directions::diagonal and
+     * seqan3::detail::trace_directions::up encode the direction that is followed first: diagonal (`0b0001`),
+     * up (`0b0100`), left (`0b0101`) or none (`0b0000`). The function uses only bit operations such that the
+     * compiler can vectorise the packing of a column.
+     */
+    static constexpr uint8_t pack(trace_t const trace) noexcept
+    {
+        uint8_t const bits = static_cast<uint8_t>(trace);
+        uint8_t const diagonal = bits & 0b0'0001;
+        uint8_t const up = (bits >> 2) & ~diagonal & 0b1;
+        uint8_t const left = (bits >> 4) & ~(diagonal | up) & 0b1;
+
+        return (diagonal | left) | ((up | left) << 2) | (bits & carry_mask);
+    }
+
+    /*!\brief Packs the traces of the current column into the column with the given index.
+     * \details Kept out of line, such that the compiler still inlines the column computation of the alignment.
+     */
+    [[gnu::noinline]] void pack_current_column(size_t const column_id) noexcept
+    {
+        assert(column_id < column_count);
+
+        trace_t const * trace_it = current_column.data();
+        uint8_t * packed_it = packed_matrix.data() + column_id * column_stride / cells_per_byte;
+        uint8_t * const packed_end = packed_it + column_stride / cells_per_byte;
+
+        for (; packed_it != packed_end; ++packed_it, trace_it += cells_per_byte)
+        {
+            uint8_t packed_cells{};
+            for (size_t cell = 0; cell < cells_per_byte; ++cell)
+                packed_cells |= pack(trace_it[cell]) << (cell * bits_per_cell);
+
+            *packed_it = packed_cells;
+        }
+
+        packed_column_count = column_id + 1;
+    }
+
+    //!\brief Returns the trace of the cell at the given position of the column major matrix.
+    trace_t trace_at(size_t const position) const noexcept
+    {
+        size_t const current_column_begin = packed_column_count * column_stride;
+
+        if (position >= current_column_begin && position < current_column_begin + column_stride)
+            return current_column[position - current_column_begin];
+
+        size_t const shift = (position % cells_per_byte) * bits_per_cell;
+        return unpack_table[(packed_matrix[position / cells_per_byte] >> shift) & cell_mask];
+    }
+};
+
+/*!\brief Trace matrix iterator for the pairwise alignment using the packed trace matrix.
+ * \implements std::input_iterator
+ *
+ * \details
+ *
+ * Implements a counted iterator to keep track of the current column within the matrix. When dereferenced, the
+ * iterator returns a view over the unpacked current column zipped with the horizontal and vertical trace column.
+ * Advancing the iterator packs the current column into the matrix.
+ */
+template <typename trace_t>
+    requires std::same_as<trace_t, trace_directions>
+class trace_matrix_packed<trace_t>::iterator
+{
+private:
+    //!\brief A lightweight representation of the current column.
+    using single_trace_column_type = std::span<trace_t>;
+    //!\brief The type of the zipped trace column.
+    using matrix_column_type = decltype(views::zip(std::declval<single_trace_column_type>(),
+                                                   std::declval<physical_column_t &>(),
+                                                   std::declval<virtual_column_t &>()));
+    //!\brief The column type as value type.
+    using matrix_column_value_t = std::vector<std::ranges::range_value_t<matrix_column_type>>;
+
+    // Defines a proxy that can be converted to the value type.
+    class column_proxy;
+
+    //!\brief The pointer to the underlying matrix.
+    trace_matrix_packed * host_ptr{nullptr};
+    //!\brief The current column index.
+    size_t current_column_id{};
+
+public:
+    /*!\name Associated types
+     * \{
+     */
+    //!\brief The value type.
+    using value_type = matrix_column_value_t;
+    //!\brief The reference type.
+    using reference = column_proxy;
+    //!\brief The pointer type.
+    using pointer = void;
+    //!\brief The difference type.
+    using difference_type = std::ptrdiff_t;
+    //!\brief The iterator category.
+    using iterator_category = std::input_iterator_tag;
+    //!\}
+
+    /*!\name Constructor, assignment and destructor
+     * \{
+     */
+    iterator() noexcept = default;                             //!< Defaulted.
+    iterator(iterator const &) noexcept = default;             //!< Defaulted.
+    iterator(iterator &&) noexcept = default;                  //!< Defaulted.
+    iterator & operator=(iterator const &) noexcept = default; //!< Defaulted.
+    iterator & operator=(iterator &&) noexcept = default;      //!< Defaulted.
+    ~iterator() = default;                                     //!< Defaulted.
+
+    /*!\brief Initialises the iterator from the underlying matrix.
+     *
+     * \param[in] host_matrix The underlying matrix.
+     * \param[in] initial_column_id The initial column index.
+     */
+    explicit iterator(trace_matrix_packed & host_matrix, size_t const initial_column_id) noexcept :
+        host_ptr{std::addressof(host_matrix)},
+        current_column_id{initial_column_id}
+    {}
+    //!\}
+
+    /*!\name Element access
+     * \{
+     */
+    //!\brief Returns the range over the current column.
+    reference operator*() const
+    {
+        return column_proxy{views::zip(single_trace_column_type{host_ptr->current_column.data(), host_ptr->row_count},
+                                       host_ptr->horizontal_column,
+                                       host_ptr->vertical_column)};
+    }
+    //!\}
+
+    /*!\name Arithmetic operators
+     * \{
+     */
+    //!\brief Packs the current column and moves `this` to the next column.
+    iterator & operator++()
+    {
+        host_ptr->pack_current_column(current_column_id);
+        ++current_column_id;
+        return *this;
+    }
+
+    //!\brief Packs the current column and moves `this` to the next column.
+    void operator++(int)
+    {
+        ++(*this);
+    }
+    //!\}
+
+    /*!\name Comparison operators
+     * \{
+     */
+    //!\brief Tests whether `lhs == rhs`.
+    friend bool operator==(iterator const & lhs, iterator const & rhs) noexcept
+    {
+        return lhs.current_column_id == rhs.current_column_id;
+    }
+
+    //!\brief Tests whether `lhs != rhs`.
+    friend bool operator!=(iterator const & lhs, iterator const & rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+    //!\}
+};
+
+/*!\brief The proxy returned as reference type.
+ * \implements std::ranges::view
+ *
+ * \details
+ *
+ * The proxy stores the column view of the current iterator and offers a dedicated conversion operator to
+ * assign it to the value type of the iterator.
+ */
+template <typename trace_t>
+    requires std::same_as<trace_t, trace_directions>
+class trace_matrix_packed<trace_t>::iterator::column_proxy : public std::ranges::view_interface<column_proxy>
+{
+private:
+    //!\brief The represented column.
+    matrix_column_type column;
+
+public:
+    /*!\name Constructor, assignment and destructor
+     * \{
+     */
+    column_proxy() = default;                                 //!< Defaulted.
+    column_proxy(column_proxy const &) = default;             //!< Defaulted.
+    column_proxy(column_proxy &&) = default;                  //!< Defaulted.
+    column_proxy & operator=(column_proxy const &) = default; //!< Defaulted.
+    column_proxy & operator=(column_proxy &&) = default;      //!< Defaulted.
+    ~column_proxy() = default;                                //!< Defaulted.
+
+    /*!\brief Initialises the proxy with the respective column.
+    *
+    * \param[in] column The column to set.
+    */
+    explicit column_proxy(matrix_column_type && column) noexcept : column{std::move(column)}
+    {}
+    //!\}
+
+    /*!\name Iterators
+     * \{
+     */
+    //!\brief Returns an iterator to the begin of the column.
+    std::ranges::iterator_t<matrix_column_type> begin()
+    {
+        return column.begin();
+    }
+    //!\brief Const iterator is not accessible.
+    std::ranges::iterator_t<matrix_column_type> begin() const = delete;
+
+    //!\brief Returns a sentinel marking the end of the column.
+    std::ranges::sentinel_t<matrix_column_type> end()
+    {
+        return column.end();
+    }
+
+    //!\brief Const sentinel is not accessible.
+    std::ranges::sentinel_t<matrix_column_type> end() const = delete;
+    //!\}
+
+    //!\brief Implicitly converts the column proxy into the value type of the iterator.
+    constexpr operator matrix_column_value_t() const
+    {
+        matrix_column_value_t target{};
+        std::ranges::copy(column, std::back_inserter(target));
+        return target;
+    }
+};
+
+/*!\brief A two-dimensional iterator over the cells of the packed trace matrix.
+ * \implements seqan3::detail::two_dimensional_matrix_iterator
+ *
+ * \details
+ *
+ * Stores the position of the cell within the column major matrix and unpacks the trace of the cell when
+ * dereferenced. The iterator is used by the seqan3::detail::trace_iterator and the
+ * seqan3::detail::trace_iterator_banded to follow the trace path.
+ */
+template <typename trace_t>
+    requires std::same_as<trace_t, trace_directions>
+class trace_matrix_packed<trace_t>::matrix_iterator :
+    public two_dimensional_matrix_iterator_base<matrix_iterator, matrix_major_order::column>
+{
+private:
+    //!\brief The base class type.
+    using base_t = two_dimensional_matrix_iterator_base<matrix_iterator, matrix_major_order::column>;
+
+    //!\brief Befriend the base crtp class.
+    template <typename derived_t, matrix_major_order other_order>
+    friend class two_dimensional_matrix_iterator_base;
+
+    //!\brief The pointer to the underlying matrix.
+    trace_matrix_packed const * matrix_ptr{nullptr};
+    //!\brief The position of the current cell in the column major matrix.
+    std::ptrdiff_t host_iter{};
+
+public:
+    /*!\name Associated types
+     * \{
+     */
+    //!\brief The value type.
+    using value_type = trace_t;
+    //!\brief The reference type; the trace is returned by value.
+    using reference = trace_t;
+    //!\brief The pointer type.
+    using pointer = void;
+    //!\brief The difference type.
+    using difference_type = std::ptrdiff_t;
+    //!\brief The iterator category.
+    using iterator_category = std::random_access_iterator_tag;
+    //!\}
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    constexpr matrix_iterator() = default;                                    //!< Defaulted.
+    constexpr matrix_iterator(matrix_iterator const &) = default;             //!< Defaulted.
+    constexpr matrix_iterator(matrix_iterator &&) = default;                  //!< Defaulted.
+    constexpr matrix_iterator & operator=(matrix_iterator const &) = default; //!< Defaulted.
+    constexpr matrix_iterator & operator=(matrix_iterator &&) = default;      //!< Defaulted.
+    ~matrix_iterator() = default;                                             //!< Defaulted.
+
+    /*!\brief Construction from the underlying matrix and the position of the cell.
+     * \param[in] matrix The underlying packed matrix.
+     * \param[in] position The position of the cell in the column major matrix.
+     */
+    constexpr matrix_iterator(trace_matrix_packed const & matrix, std::ptrdiff_t const position) noexcept :
+        matrix_ptr{std::addressof(matrix)},
+        host_iter{position}
+    {}
+    //!\}
+
+    //!\brief Returns the unpacked trace of the current cell.
+    reference operator*() const noexcept
+    {
+        assert(matrix_ptr != nullptr);
+
+        return matrix_ptr->trace_at(host_iter);
+    }
+
+    // Import advance operator from base class.
+    using base_t::operator+=;
+
+    //!\brief Advances the iterator by the given `offset`.
+    constexpr matrix_iterator & operator+=(matrix_offset const & offset) noexcept
+    {
+        assert(matrix_ptr != nullptr);
+
+        host_iter += offset.col * static_cast<std::ptrdiff_t>(matrix_ptr->column_stride) + offset.row;
+        return *this;
+    }
+
+    //!\copydoc seqan3::detail::two_dimensional_matrix_iterator::coordinate()
+    matrix_coordinate coordinate() const noexcept
+    {
+        assert(matrix_ptr != nullptr);
+
+        size_t const position = host_iter;
+        return {row_index_type{position % matrix_ptr->column_stride},
+                column_index_type{position / matrix_ptr->column_stride}};
+    }
+};
+
+} // namespace seqan3::detail
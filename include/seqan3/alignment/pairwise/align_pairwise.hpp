@@ -22,6 +22,7 @@
 #include <seqan3/alignment/pairwise/detail/type_traits.hpp>
 #include <seqan3/core/algorithm/algorithm_result_generator_range.hpp>
 #include <seqan3/core/algorithm/detail/algorithm_executor_blocking.hpp>
+#include <seqan3/core/algorithm/detail/algorithm_executor_streaming.hpp>
 #include <seqan3/utility/simd/simd.hpp>
 #include <seqan3/utility/simd/simd_traits.hpp>
 #include <seqan3/utility/type_traits/basic.hpp>
@@ -66,8 +67,11 @@ namespace seqan3
  * For each sequence pair one or more \ref seqan3::alignment_result "seqan3::alignment_result"s can be computed.
  * The seqan3::align_pairwise function returns an seqan3::algorithm_result_generator_range which can be used to iterate
  * over the alignments. If the `vectorised` configurations are omitted the alignments are computed on-demand when
- * iterating over the results. In case of a parallel execution all alignments are computed at once in parallel when
- * calling `begin` on the associated seqan3::algorithm_result_generator_range.
+ * iterating over the results. In case of a parallel execution the alignments are computed in the background while
+ * iterating over the results. At most seqan3::align_cfg::parallel::buffer_size invocations of the alignment algorithm
+ * are computed or buffered at once, such that the memory does not grow with the number of sequence pairs. The
+ * results are reported in the order of the input unless seqan3::align_cfg::parallel::order is set to
+ * `result_order::completion`.
  *
  * The following snippets demonstrate the single element and the range based interface.
  *
@@ -170,22 +174,27 @@ constexpr auto align_pairwise(sequence_t && sequences, alignment_config_t const
     using complete_config_t = std::remove_cvref_t<decltype(complete_config)>;
     using traits_t = detail::alignment_configuration_traits<complete_config_t>;
 
-    auto indexed_sequence_chunk_view =
-        views::zip(seq_view, std::views::iota(0)) | views::chunk(traits_t::alignments_per_vector);
+    // The pairs sorted by length are passed in chunks of the window size, which are split into simd batches later.
+    size_t chunk_size = traits_t::alignments_per_vector;
+    if constexpr (traits_t::is_length_sorted)
+        chunk_size *= (get<align_cfg::sort_by_length>(complete_config).window_size + chunk_size - 1) / chunk_size;
+
+    auto indexed_sequence_chunk_view = views::zip(seq_view, std::views::iota(0)) | views::chunk(chunk_size);
 
     using indexed_sequences_t = decltype(indexed_sequence_chunk_view);
     using alignment_result_t = typename traits_t::alignment_result_type;
     using execution_handler_t = std::conditional_t<complete_config_t::template exists<align_cfg::parallel>(),
                                                    detail::execution_handler_parallel,
                                                    detail::execution_handler_sequential>;
-    using executor_t = detail::
-        algorithm_executor_blocking<indexed_sequences_t, decltype(algorithm), alignment_result_t, execution_handler_t>;
 
     // Select the execution handler for the alignment configuration.
     auto select_execution_handler = [parallel = complete_config.get_or(align_cfg::parallel{})]()
     {
         if constexpr (std::same_as<execution_handler_t, detail::execution_handler_parallel>)
         {
+            if (parallel.pool != nullptr)
+                return execution_handler_t{*parallel.pool};
+
             auto thread_count = parallel.thread_count;
             if (!thread_count)
                 throw std::runtime_error{"You must configure the number of threads in seqan3::align_cfg::parallel."};
@@ -199,14 +208,40 @@ constexpr auto align_pairwise(sequence_t && sequences, alignment_config_t const
     };
 
     if constexpr (traits_t::is_one_way_execution) // Just compute alignment and wait until all alignments are computed.
+    {
         select_execution_handler().bulk_execute(algorithm,
                                                 indexed_sequence_chunk_view,
                                                 get<align_cfg::on_result>(complete_config).callback);
+    }
+    else if constexpr (std::same_as<execution_handler_t, detail::execution_handler_parallel>)
+    { // Stream the results of the parallel execution through a bounded buffer.
+        using executor_t =
+            detail::algorithm_executor_streaming<indexed_sequences_t, decltype(algorithm), alignment_result_t>;
+
+        auto const & parallel = get<align_cfg::parallel>(complete_config);
+        auto exec_handler = select_execution_handler();
+        size_t const buffer_size =
+            parallel.buffer_size.value_or(*parallel.thread_count * align_cfg::parallel::default_buffer_size_per_thread);
+
+        return algorithm_result_generator_range{executor_t{std::move(indexed_sequence_chunk_view),
+                                                           std::move(algorithm),
+                                                           alignment_result_t{},
+                                                           std::move(exec_handler),
+                                                           buffer_size,
+                                                           parallel.order}};
+    }
     else // Require two way execution: return the range over the alignments.
+    {
+        using executor_t = detail::algorithm_executor_blocking<indexed_sequences_t,
+                                                               decltype(algorithm),
+                                                               alignment_result_t,
+                                                               execution_handler_t>;
+
         return algorithm_result_generator_range{executor_t{std::move(indexed_sequence_chunk_view),
                                                            std::move(algorithm),
                                                            alignment_result_t{},
                                                            select_execution_handler()}};
+    }
 }
 //!\endcond
 
@@ -9,22 +9,28 @@
 
 #pragma once
 
+#include <concepts>
 #include <iterator>
 #include <memory>
 #include <optional>
 #include <ranges>
 #include <type_traits>
+#include <vector>
 
 #include <seqan3/alignment/configuration/align_config_band.hpp>
 #include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
 #include <seqan3/alignment/exception.hpp>
 #include <seqan3/alignment/matrix/detail/aligned_sequence_builder.hpp>
+#include <seqan3/alignment/matrix/detail/cigar_builder.hpp>
 #include <seqan3/alignment/matrix/detail/trace_directions.hpp>
 #include <seqan3/alignment/pairwise/align_result_selector.hpp>
 #include <seqan3/alignment/pairwise/detail/concept.hpp>
 #include <seqan3/alignment/pairwise/detail/type_traits.hpp>
+#include <seqan3/alignment/scoring/detail/simd_match_mismatch_scoring_scheme.hpp>
 #include <seqan3/core/detail/deferred_crtp_base.hpp>
 #include <seqan3/core/detail/empty_type.hpp>
+#include <seqan3/core/detail/template_inspection.hpp>
+#include <seqan3/utility/concept.hpp>
 #include <seqan3/utility/container/aligned_allocator.hpp>
 #include <seqan3/utility/simd/concept.hpp>
 #include <seqan3/utility/simd/simd.hpp>
@@ -217,8 +223,9 @@ public:
                                              this->scoring_scheme.padding_match_score());
 
         // Convert batch of sequences to sequence of simd vectors.
-        auto simd_sequences1 = convert_batch_of_sequences_to_simd_vector(sequence1_range);
-        auto simd_sequences2 = convert_batch_of_sequences_to_simd_vector(sequence2_range);
+        auto simd_sequences1 =
+            convert_batch_of_sequences_to_simd_vector(sequence1_range, this->scoring_scheme.padding_symbol);
+        auto simd_sequences2 = convert_batch_of_sequences_to_simd_vector(sequence2_range, second_padding_symbol());
 
         max_size_in_collection = std::pair{simd_sequences1.size(), simd_sequences2.size()};
         // Reset the alignment state's optimum between executions of the alignment algorithm.
@@ -235,6 +242,7 @@ private:
      * \tparam sequence_range_t The type of the range over sequences; must model std::ranges::forward_range.
      *
      * \param[in] sequences The batch of sequences to transform.
+     * \param[in] padding_symbol The symbol used to fill up smaller sequences.
      *
      * \returns a sequence over simd vectors.
      *
@@ -244,22 +252,67 @@ private:
      * simd vector. Applies an Array-of-Structures (AoS) to Structure-of-Arrays (SoA) transformation by storing one
      * column of the batch as a simd vector.
      */
-    template <typename sequence_range_t>
-    constexpr auto convert_batch_of_sequences_to_simd_vector(sequence_range_t & sequences)
+    template <typename sequence_range_t, typename padding_symbol_t>
+    constexpr auto convert_batch_of_sequences_to_simd_vector(sequence_range_t & sequences,
+                                                             padding_symbol_t const padding_symbol)
     {
         assert(static_cast<size_t>(std::ranges::distance(sequences)) <= traits_t::alignments_per_vector);
 
         using simd_score_t = typename traits_t::score_type;
+        using sequence_alphabet_t = std::ranges::range_value_t<std::ranges::range_value_t<sequence_range_t>>;
+        using scoring_scheme_alphabet_t = typename traits_t::scoring_scheme_alphabet_type;
 
         std::vector<simd_score_t, aligned_allocator<simd_score_t, alignof(simd_score_t)>> simd_sequence{};
 
-        for (auto && simd_vector_chunk : sequences | views::to_simd<simd_score_t>(this->scoring_scheme.padding_symbol))
-            for (auto && simd_vector : simd_vector_chunk)
-                simd_sequence.push_back(std::move(simd_vector));
+        auto append_simd_vectors = [&](auto & sequences_with_ranks)
+        {
+            for (auto && simd_vector_chunk : sequences_with_ranks | views::to_simd<simd_score_t>(padding_symbol))
+                for (auto && simd_vector : simd_vector_chunk)
+                    simd_sequence.push_back(std::move(simd_vector));
+        };
+
+        // A scoring matrix expects the ranks of the scoring scheme's alphabet; match and mismatch scores do not.
+        if constexpr (!std::same_as<sequence_alphabet_t, scoring_scheme_alphabet_t>
+                      && explicitly_convertible_to<sequence_alphabet_t, scoring_scheme_alphabet_t>)
+        {
+            if (this->scoring_scheme.uses_scoring_matrix())
+            {
+                std::vector<std::vector<scoring_scheme_alphabet_t>> converted_sequences{};
+                for (auto && sequence : sequences)
+                {
+                    auto & converted_sequence = converted_sequences.emplace_back();
+                    for (auto && letter : sequence)
+                        converted_sequence.push_back(static_cast<scoring_scheme_alphabet_t>(letter));
+                }
+                append_simd_vectors(converted_sequences);
+                return simd_sequence;
+            }
+        }
+
+        append_simd_vectors(sequences);
 
         return simd_sequence;
     }
 
+    /*!\brief Returns the symbol used to fill up the smaller sequences of the second batch.
+     *
+     * \details
+     *
+     * The match/mismatch scoring scheme scores two padding symbols as mismatch in the local alignment only if they
+     * differ. Otherwise, the padded parts of the matrix of a short sequence pair would form a local alignment of
+     * matches. The scoring matrices already score the padding symbol as mismatch with itself.
+     */
+    constexpr auto second_padding_symbol() const noexcept
+    {
+        using scoring_scheme_t = std::remove_cvref_t<decltype(this->scoring_scheme)>;
+
+        if constexpr (traits_t::is_local
+                      && is_type_specialisation_of_v<scoring_scheme_t, simd_match_mismatch_scoring_scheme>)
+            return static_cast<decltype(this->scoring_scheme.padding_symbol)>(this->scoring_scheme.padding_symbol + 1);
+        else
+            return this->scoring_scheme.padding_symbol;
+    }
+
     /*!\brief Computes the pairwise sequence alignment for a single pair of sequences.
      * \tparam sequence1_t The type of the first sequence; must model std::ranges::forward_range.
      * \tparam sequence2_t The type of the second sequence; must model std::ranges::forward_range.
@@ -626,7 +679,8 @@ private:
             }
         }
 
-        if constexpr (traits_t::compute_begin_positions)
+        if constexpr (traits_t::compute_begin_positions
+                      && (traits_t::compute_sequence_alignment || !traits_t::compute_cigar))
         {
             // Get a aligned sequence builder for banded or un-banded case.
             aligned_sequence_builder builder{sequence1, sequence2};
@@ -644,6 +698,24 @@ private:
                 res.alignment = std::move(trace_res.alignment);
         }
 
+        if constexpr (traits_t::compute_cigar)
+        {
+            detail::matrix_coordinate const optimum_coordinate{
+                detail::row_index_type{this->alignment_state.optimum.row_index},
+                detail::column_index_type{this->alignment_state.optimum.column_index}};
+            auto trace_res = cigar_sequence_builder(this->trace_matrix.trace_path(optimum_coordinate));
+            res.cigar_sequence = std::move(trace_res.cigar_sequence);
+
+            // Without the aligned sequences the begin positions are taken from the same traceback.
+            if constexpr (traits_t::compute_begin_positions && !traits_t::compute_sequence_alignment)
+            {
+                res.begin_positions.first =
+                    this->to_original_sequence1_position(trace_res.first_sequence_slice_positions.first);
+                res.begin_positions.second =
+                    this->to_original_sequence2_position(trace_res.second_sequence_slice_positions.first);
+            }
+        }
+
         // Store the matrices in debug mode.
         if constexpr (traits_t::is_debug)
         {
@@ -784,6 +856,8 @@ private:
     trace_debug_matrix_t trace_debug_matrix{};
     //!\brief The maximal size within the first and the second sequence collection.
     std::pair<size_t, size_t> max_size_in_collection{};
+    //!\brief Builds the CIGAR sequence from the trace matrix and keeps its buffer between the pairs.
+    cigar_builder cigar_sequence_builder{};
 };
 
 } // namespace seqan3::detail
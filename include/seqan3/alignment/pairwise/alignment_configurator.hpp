@@ -9,26 +9,37 @@
 
 #pragma once
 
+#include <cstdint>
 #include <functional>
+#include <stdexcept>
 #include <tuple>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 #include <seqan3/alignment/configuration/align_config_output.hpp>
 #include <seqan3/alignment/configuration/align_config_result_type.hpp>
+#include <seqan3/alignment/configuration/align_config_wavefront.hpp>
 #include <seqan3/alignment/matrix/detail/alignment_score_matrix_one_column.hpp>
 #include <seqan3/alignment/matrix/detail/alignment_score_matrix_one_column_banded.hpp>
 #include <seqan3/alignment/matrix/detail/alignment_trace_matrix_full.hpp>
 #include <seqan3/alignment/matrix/detail/alignment_trace_matrix_full_banded.hpp>
 #include <seqan3/alignment/matrix/detail/combined_score_and_trace_matrix.hpp>
 #include <seqan3/alignment/matrix/detail/score_matrix_single_column.hpp>
-#include <seqan3/alignment/matrix/detail/trace_matrix_full.hpp>
+#include <seqan3/alignment/matrix/detail/trace_matrix_packed.hpp>
 #include <seqan3/alignment/pairwise/align_result_selector.hpp>
 #include <seqan3/alignment/pairwise/alignment_algorithm.hpp>
 #include <seqan3/alignment/pairwise/alignment_result.hpp>
 #include <seqan3/alignment/pairwise/detail/concept.hpp>
 #include <seqan3/alignment/pairwise/detail/pairwise_alignment_algorithm.hpp>
+#include <seqan3/alignment/pairwise/detail/pairwise_alignment_algorithm_adaptive_width.hpp>
 #include <seqan3/alignment/pairwise/detail/pairwise_alignment_algorithm_banded.hpp>
+#include <seqan3/alignment/pairwise/detail/pairwise_alignment_algorithm_length_sorted.hpp>
+#include <seqan3/alignment/pairwise/detail/pairwise_alignment_algorithm_linear_memory.hpp>
+#include <seqan3/alignment/pairwise/detail/pairwise_alignment_algorithm_query_profile.hpp>
+#include <seqan3/alignment/pairwise/detail/pairwise_alignment_algorithm_striped.hpp>
+#include <seqan3/alignment/pairwise/detail/pairwise_alignment_algorithm_wavefront.hpp>
+#include <seqan3/alignment/pairwise/detail/pairwise_alignment_algorithm_x_drop.hpp>
 #include <seqan3/alignment/pairwise/detail/policy_affine_gap_recursion.hpp>
 #include <seqan3/alignment/pairwise/detail/policy_affine_gap_recursion_banded.hpp>
 #include <seqan3/alignment/pairwise/detail/policy_affine_gap_with_trace_recursion.hpp>
@@ -53,6 +64,7 @@
 #include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
 #include <seqan3/core/detail/deferred_crtp_base.hpp>
 #include <seqan3/core/detail/template_inspection.hpp>
+#include <seqan3/utility/detail/bits_of.hpp>
 #include <seqan3/utility/simd/simd.hpp>
 #include <seqan3/utility/tuple/concept.hpp>
 #include <seqan3/utility/type_traits/lazy_conditional.hpp>
@@ -137,7 +149,7 @@ private:
     private:
         //!\brief Indicates whether only the coordinate is required to compute the alignment.
         static constexpr bool only_coordinates =
-            !(traits_t::compute_begin_positions || traits_t::compute_sequence_alignment);
+            !(traits_t::compute_begin_positions || traits_t::compute_sequence_alignment || traits_t::compute_cigar);
 
         //!\brief The selected score matrix for either banded or unbanded alignments.
         using score_matrix_t =
@@ -194,6 +206,52 @@ private:
                                         deferred_crtp_base<find_optimum_policy>>;
     };
 
+    /*!\brief Transformation trait that chooses the scoring scheme used by the alignment algorithm.
+     * \tparam traits_t The alignment configuration traits type.
+     * \tparam has_matrix_scores Whether the configured scoring scheme assigns more than one match or mismatch score.
+     *
+     * \details
+     *
+     * If no vectorisation is enabled, the scoring scheme is the one configured in seqan3::align_cfg::scoring_scheme.
+     * If vectorisation is enabled, a matrix or a match/mismatch simd scoring scheme is selected depending on the
+     * configured scoring scheme.
+     */
+    template <typename traits_t, bool has_matrix_scores = false>
+    struct select_alignment_scoring_scheme
+    {
+    private:
+        //!\brief The configured scoring scheme type.
+        using scoring_scheme_t = typename traits_t::scoring_scheme_type;
+        //!\brief Whether the configured scoring scheme is a scoring matrix.
+        static constexpr bool is_aminoacid_scheme =
+            is_type_specialisation_of_v<scoring_scheme_t, aminoacid_scoring_scheme> || has_matrix_scores;
+        //!\brief The alignment method.
+        using alignment_type_t = typename std::
+            conditional_t<traits_t::is_global, seqan3::align_cfg::method_global, seqan3::align_cfg::method_local>;
+
+        //!\brief The simd scoring scheme for match/mismatch scores.
+        using simple_simd_scheme_t = lazy_conditional_t<traits_t::is_vectorised,
+                                                        lazy<simd_match_mismatch_scoring_scheme,
+                                                             typename traits_t::score_type,
+                                                             typename traits_t::scoring_scheme_alphabet_type,
+                                                             alignment_type_t>,
+                                                        void>;
+        //!\brief The simd scoring scheme for scoring matrices.
+        using matrix_simd_scheme_t = lazy_conditional_t<traits_t::is_vectorised,
+                                                        lazy<simd_matrix_scoring_scheme,
+                                                             typename traits_t::score_type,
+                                                             typename traits_t::scoring_scheme_alphabet_type,
+                                                             alignment_type_t>,
+                                                        void>;
+
+    public:
+        //!\brief The scoring scheme used by the alignment algorithm.
+        using type =
+            std::conditional_t<traits_t::is_vectorised,
+                               std::conditional_t<is_aminoacid_scheme, matrix_simd_scheme_t, simple_simd_scheme_t>,
+                               scoring_scheme_t>;
+    };
+
     //!\brief Selects either the banded or the unbanded alignment algorithm based on the given traits type.
     template <typename traits_t, typename... args_t>
     using select_alignment_algorithm_t = lazy_conditional_t<traits_t::is_banded,
@@ -312,12 +370,56 @@ public:
         // Configure the algorithm
         // ----------------------------------------------------------------------------
 
+        if constexpr (config_t::template exists<align_cfg::sort_by_length>())
+        {
+            if (!alignment_configuration_traits<config_t>::is_vectorised)
+                throw invalid_alignment_configuration{"The align_cfg::sort_by_length configuration requires "
+                                                      "align_cfg::vectorised."};
+
+            if (get<align_cfg::sort_by_length>(cfg).window_size == 0)
+                throw invalid_alignment_configuration{"The window size of align_cfg::sort_by_length must be greater "
+                                                      "than 0."};
+        }
+
+        if constexpr (config_t::template exists<align_cfg::adaptive_score_width>())
+        {
+            if (!alignment_configuration_traits<config_t>::is_vectorised)
+                throw invalid_alignment_configuration{"The align_cfg::adaptive_score_width configuration requires "
+                                                      "align_cfg::vectorised."};
+
+            if (alignment_configuration_traits<config_with_output_t>::requires_trace_information)
+                throw invalid_alignment_configuration{"The align_cfg::adaptive_score_width configuration cannot be "
+                                                      "combined with align_cfg::output_begin_position, "
+                                                      "align_cfg::output_alignment or align_cfg::output_cigar."};
+        }
+
+        if constexpr (config_t::template exists<align_cfg::query_profile>())
+        {
+            if (!alignment_configuration_traits<config_t>::is_vectorised)
+                throw invalid_alignment_configuration{"The align_cfg::query_profile configuration requires "
+                                                      "align_cfg::vectorised."};
+
+            if (alignment_configuration_traits<config_with_output_t>::requires_trace_information)
+                throw invalid_alignment_configuration{"The align_cfg::query_profile configuration cannot be combined "
+                                                      "with align_cfg::output_begin_position, "
+                                                      "align_cfg::output_alignment or align_cfg::output_cigar."};
+        }
+
+        // The wavefront alignment algorithm replaces the dynamic programming algorithm, including the edit distance.
+        if constexpr (config_t::template exists<align_cfg::wavefront>())
+        {
+            using wavefront_algorithm_t = pairwise_alignment_algorithm_wavefront<decltype(config_with_result_type)>;
+            return std::pair{function_wrapper_t{wavefront_algorithm_t{config_with_result_type}},
+                             config_with_result_type};
+        }
+
         // Use default edit distance if gaps are not set.
         align_cfg::gap_cost_affine edit_gap_cost{};
         auto const & gap_cost = config_with_result_type.get_or(edit_gap_cost);
         auto const & scoring_scheme = get<align_cfg::scoring_scheme>(cfg).scheme;
 
-        if constexpr (config_t::template exists<seqan3::align_cfg::method_global>())
+        if constexpr (config_t::template exists<seqan3::align_cfg::method_global>()
+                      && !alignment_configuration_traits<config_t>::is_extension)
         {
             // Only use edit distance if ...
             if constexpr (std::same_as<std::remove_cvref_t<decltype(scoring_scheme)>, hamming_scoring_scheme>)
@@ -332,7 +434,12 @@ public:
 
                 if (has_edit_distance_gaps && has_no_free_end_gaps_sequence2 && has_equal_free_end_gaps_sequence1)
                 {
-                    return std::pair{configure_edit_distance<function_wrapper_t>(config_with_result_type),
+                    return std::pair{configure_length_sorted<function_wrapper_t>(
+                                         config_with_result_type,
+                                         [&]<typename wrapper_t>(std::type_identity<wrapper_t>)
+                                         {
+                                             return configure_edit_distance<wrapper_t>(config_with_result_type);
+                                         }),
                                      config_with_result_type};
                 }
             }
@@ -346,8 +453,26 @@ public:
         if (config_t::template exists<align_cfg::min_score>())
             throw invalid_alignment_configuration{"The align_cfg::min_score configuration is only allowed for the "
                                                   "specific edit distance computation."};
+        if constexpr (alignment_configuration_traits<config_t>::is_extension)
+        {
+            if (alignment_configuration_traits<decltype(config_with_result_type)>::compute_sequence_alignment
+                || alignment_configuration_traits<decltype(config_with_result_type)>::compute_cigar)
+                throw invalid_alignment_configuration{"The align_cfg::x_drop and align_cfg::z_drop configurations "
+                                                      "cannot be combined with align_cfg::output_alignment or "
+                                                      "align_cfg::output_cigar."};
+
+            if (cfg.get_or(align_cfg::x_drop{}).drop_score < 0 || cfg.get_or(align_cfg::z_drop{}).drop_score < 0)
+                throw invalid_alignment_configuration{"The drop score of align_cfg::x_drop and align_cfg::z_drop "
+                                                      "must not be negative."};
+        }
+
         // Configure the alignment algorithm.
-        return std::pair{configure_scoring_scheme<function_wrapper_t>(config_with_result_type),
+        return std::pair{configure_length_sorted<function_wrapper_t>(
+                             config_with_result_type,
+                             [&]<typename wrapper_t>(std::type_identity<wrapper_t>)
+                             {
+                                 return configure_scoring_scheme<wrapper_t>(config_with_result_type);
+                             }),
                          config_with_result_type};
     }
 
@@ -374,6 +499,89 @@ private:
                  | align_cfg::output_sequence2_id{};
     }
 
+    /*!\brief Sorts the sequence pairs by length before the configured algorithm computes them, if requested.
+     *
+     * \tparam function_wrapper_t The invocable alignment function type-erased via std::function.
+     * \tparam config_t The alignment configuration type.
+     * \tparam configure_algorithm_t The type of the function configuring the algorithm.
+     *
+     * \param[in] cfg The passed configuration object.
+     * \param[in] configure_algorithm Configures the algorithm for the function wrapper passed as std::type_identity.
+     *
+     * \returns the configured algorithm, wrapped in seqan3::detail::pairwise_alignment_algorithm_length_sorted if
+     *          seqan3::align_cfg::sort_by_length is configured for the vectorised alignment.
+     */
+    template <typename function_wrapper_t, typename config_t, typename configure_algorithm_t>
+    static constexpr function_wrapper_t configure_length_sorted(config_t const & cfg,
+                                                                configure_algorithm_t && configure_algorithm)
+    {
+        if constexpr (alignment_configuration_traits<config_t>::is_length_sorted)
+        {
+            using algorithm_t = pairwise_alignment_algorithm_length_sorted<config_t, function_wrapper_t>;
+            using batch_algorithm_t = typename algorithm_t::batch_algorithm_type;
+
+            return algorithm_t{cfg, configure_algorithm(std::type_identity<batch_algorithm_t>{})};
+        }
+        else
+        {
+            return configure_algorithm(std::type_identity<function_wrapper_t>{});
+        }
+    }
+
+    /*!\brief Selects the scoring scheme of the alignment algorithm from the scores of the configured scoring scheme.
+     *
+     * \tparam function_wrapper_t The invocable alignment function type-erased via std::function.
+     * \tparam config_t The alignment configuration type.
+     * \tparam configure_algorithm_t The type of the function configuring the algorithm.
+     *
+     * \param[in] cfg The passed configuration object.
+     * \param[in] configure_algorithm Configures the algorithm for the scoring scheme passed as std::type_identity.
+     *
+     * \returns the algorithm configured with the selected scoring scheme.
+     *
+     * \throws std::invalid_argument if the configured scoring scheme needs a scoring matrix whose indices cannot be
+     *         represented by the configured score type.
+     *
+     * \details
+     *
+     * The vectorised match/mismatch scoring scheme computes a cell without looking up the scores of the letter pair.
+     * If the configured scoring scheme assigns more than one match or mismatch score, e.g. the IUPAC scores of
+     * seqan3::nucleotide_scoring_scheme, the vectorised scoring matrix is selected instead. The scores are checked once
+     * here, hence the selected scoring scheme does not branch while computing the cells.
+     */
+    template <typename function_wrapper_t, typename config_t, typename configure_algorithm_t>
+    static constexpr function_wrapper_t configure_simd_scoring_scheme(config_t const & cfg,
+                                                                      configure_algorithm_t && configure_algorithm)
+    {
+        using traits_t = alignment_configuration_traits<config_t>;
+        using alignment_scoring_scheme_t = typename select_alignment_scoring_scheme<traits_t>::type;
+
+        if constexpr (traits_t::is_vectorised)
+        {
+            if constexpr (!alignment_scoring_scheme_t::uses_scoring_matrix())
+            {
+                auto const & scoring_scheme = get<align_cfg::scoring_scheme>(cfg).scheme;
+
+                if (!alignment_scoring_scheme_t::has_only_match_and_mismatch_scores(scoring_scheme))
+                {
+                    using alphabet_t = typename traits_t::scoring_scheme_alphabet_type;
+                    using scalar_score_t = typename traits_t::original_score_type;
+
+                    // The matrix is indexed with the unsigned score type, including one padding symbol.
+                    if constexpr ((alphabet_size<alphabet_t> + 1) * (alphabet_size<alphabet_t> + 1)
+                                  <= (int64_t{1} << bits_of<scalar_score_t>))
+                        return configure_algorithm(
+                            std::type_identity<typename select_alignment_scoring_scheme<traits_t, true>::type>{});
+                    else
+                        throw std::invalid_argument{"The scoring matrix of the configured scoring scheme cannot be "
+                                                    "indexed with the configured score type."};
+                }
+            }
+        }
+
+        return configure_algorithm(std::type_identity<alignment_scoring_scheme_t>{});
+    }
+
     /*!\brief Configures the edit distance algorithm.
      * \tparam function_wrapper_t The invocable alignment function type-erased via std::function.
      * \tparam config_t           The alignment configuration type.
@@ -382,15 +590,6 @@ private:
     template <typename function_wrapper_t, typename config_t>
     static constexpr function_wrapper_t configure_edit_distance(config_t const & cfg)
     {
-        using traits_t = alignment_configuration_traits<config_t>;
-
-        // ----------------------------------------------------------------------------
-        // Unsupported configurations
-        // ----------------------------------------------------------------------------
-
-        if constexpr (traits_t::is_banded)
-            throw invalid_alignment_configuration{"Banded alignments are yet not supported."};
-
         // ----------------------------------------------------------------------------
         // Configure semi-global alignment
         // ----------------------------------------------------------------------------
@@ -451,10 +650,27 @@ private:
     template <typename function_wrapper_t, typename config_t>
     static constexpr function_wrapper_t configure_scoring_scheme(config_t const & cfg);
 
+    /*!\brief Configures the vectorised alignment that selects the score width per sequence pair.
+     *
+     * \tparam function_wrapper_t The invocable alignment function type-erased via std::function.
+     * \tparam config_t The alignment configuration type.
+     *
+     * \param[in] cfg The passed configuration object.
+     *
+     * \returns the configured seqan3::detail::pairwise_alignment_algorithm_adaptive_width.
+     *
+     * \details
+     *
+     * Configures one inter-sequence algorithm for each of the 8, 16 and 32 bit score widths. A narrow width is left
+     * out if the scoring scheme or the gap scores cannot be represented by it.
+     */
+    template <typename function_wrapper_t, typename config_t>
+    static constexpr auto configure_adaptive_score_width(config_t const & cfg);
+
     /*!\brief Constructs the actual alignment algorithm wrapped in the passed std::function object.
      *
      * \tparam function_wrapper_t The invocable alignment function type-erased via std::function.
-     * \tparam policies_t A template parameter pack for the already configured policy types.
+     * \tparam alignment_scoring_scheme_t The scoring scheme used by the alignment algorithm.
      * \tparam config_t The alignment configuration type.
      *
      * \param[in] cfg The passed configuration object.
@@ -463,9 +679,10 @@ private:
      *
      * \details
      *
-     * Configures the matrix and the gap policy and constructs the algorithm with the configured policies.
+     * Configures the matrix, the gap and the scoring scheme policy and constructs the algorithm with the configured
+     * policies.
      */
-    template <typename function_wrapper_t, typename... policies_t, typename config_t>
+    template <typename function_wrapper_t, typename alignment_scoring_scheme_t, typename config_t>
     static constexpr function_wrapper_t make_algorithm(config_t const & cfg)
     {
         using traits_t = alignment_configuration_traits<config_t>;
@@ -478,6 +695,7 @@ private:
         if constexpr (traits_t::is_local ||                   // it is a local alignment,
                       traits_t::is_debug ||                   // it runs in debug mode,
                       traits_t::compute_sequence_alignment || // it computes more than the begin position.
+                      traits_t::compute_cigar ||              // it computes the cigar sequence of the alignment.
                       (traits_t::is_banded && traits_t::compute_begin_positions)
                       || // banded && more than end positions.
                       (traits_t::is_vectorised && traits_t::compute_end_positions)) // simd and more than the score.
@@ -486,13 +704,14 @@ private:
             using gap_policy_t = typename select_gap_policy<traits_t>::type;
             using find_optimum_t = typename select_find_optimum_policy<traits_t>::type;
             using gap_init_policy_t = deferred_crtp_base<affine_gap_init_policy>;
+            using scoring_scheme_policy_t = deferred_crtp_base<scoring_scheme_policy, alignment_scoring_scheme_t>;
 
             return alignment_algorithm<config_t,
                                        matrix_policy_t,
                                        gap_policy_t,
                                        find_optimum_t,
                                        gap_init_policy_t,
-                                       policies_t...>{cfg};
+                                       scoring_scheme_policy_t>{cfg};
         }
         else // Use new alignment algorithm implementation.
         {
@@ -524,40 +743,14 @@ private:
             // Configure the scoring scheme policy.
             //----------------------------------------------------------------------------------------------------------
 
-            using alignment_method_t = std::
-                conditional_t<traits_t::is_global, seqan3::align_cfg::method_global, seqan3::align_cfg::method_local>;
-
-            using score_t = typename traits_t::score_type;
-            using scoring_scheme_t = typename traits_t::scoring_scheme_type;
-            constexpr bool is_aminoacid_scheme =
-                is_type_specialisation_of_v<scoring_scheme_t, aminoacid_scoring_scheme>;
-
-            using simple_simd_scheme_t = lazy_conditional_t<traits_t::is_vectorised,
-                                                            lazy<simd_match_mismatch_scoring_scheme,
-                                                                 score_t,
-                                                                 typename traits_t::scoring_scheme_alphabet_type,
-                                                                 alignment_method_t>,
-                                                            void>;
-            using matrix_simd_scheme_t = lazy_conditional_t<traits_t::is_vectorised,
-                                                            lazy<simd_matrix_scoring_scheme,
-                                                                 score_t,
-                                                                 typename traits_t::scoring_scheme_alphabet_type,
-                                                                 alignment_method_t>,
-                                                            void>;
-
-            using alignment_scoring_scheme_t =
-                std::conditional_t<traits_t::is_vectorised,
-                                   std::conditional_t<is_aminoacid_scheme, matrix_simd_scheme_t, simple_simd_scheme_t>,
-                                   scoring_scheme_t>;
-
             using scoring_scheme_policy_t = policy_scoring_scheme<config_t, alignment_scoring_scheme_t>;
 
             //----------------------------------------------------------------------------------------------------------
             // Configure the alignment matrix policy.
             //----------------------------------------------------------------------------------------------------------
 
-            using score_matrix_t = score_matrix_single_column<score_t>;
-            using trace_matrix_t = trace_matrix_full<trace_directions>;
+            using score_matrix_t = score_matrix_single_column<typename traits_t::score_type>;
+            using trace_matrix_t = trace_matrix_packed<trace_directions>;
 
             using alignment_matrix_t =
                 std::conditional_t<traits_t::requires_trace_information,
@@ -587,31 +780,84 @@ constexpr function_wrapper_t alignment_configurator::configure_scoring_scheme(co
 {
     using traits_t = alignment_configuration_traits<config_t>;
 
-    using scoring_scheme_t = typename traits_t::scoring_scheme_type;
-    constexpr bool is_aminoacid_scheme = is_type_specialisation_of_v<scoring_scheme_t, aminoacid_scoring_scheme>;
-    using alignment_type_t = typename std::
-        conditional_t<traits_t::is_global, seqan3::align_cfg::method_global, seqan3::align_cfg::method_local>;
-
-    using simple_simd_scheme_t = lazy_conditional_t<traits_t::is_vectorised,
-                                                    lazy<simd_match_mismatch_scoring_scheme,
-                                                         typename traits_t::score_type,
-                                                         typename traits_t::scoring_scheme_alphabet_type,
-                                                         alignment_type_t>,
-                                                    void>;
-    using matrix_simd_scheme_t = lazy_conditional_t<traits_t::is_vectorised,
-                                                    lazy<simd_matrix_scoring_scheme,
-                                                         typename traits_t::score_type,
-                                                         typename traits_t::scoring_scheme_alphabet_type,
-                                                         alignment_type_t>,
-                                                    void>;
-
-    using alignment_scoring_scheme_t =
-        std::conditional_t<traits_t::is_vectorised,
-                           std::conditional_t<is_aminoacid_scheme, matrix_simd_scheme_t, simple_simd_scheme_t>,
-                           scoring_scheme_t>;
-
-    using scoring_scheme_policy_t = deferred_crtp_base<scoring_scheme_policy, alignment_scoring_scheme_t>;
-    return make_algorithm<function_wrapper_t, scoring_scheme_policy_t>(cfg);
+    auto configure_algorithm = [&]<typename alignment_scoring_scheme_t>(
+                                   std::type_identity<alignment_scoring_scheme_t>) -> function_wrapper_t
+    {
+        // The seed extension prunes cells while computing the matrix and is implemented separately.
+        if constexpr (traits_t::is_extension)
+        {
+            return pairwise_alignment_algorithm_x_drop<config_t, alignment_scoring_scheme_t>{cfg};
+        }
+        // Many pairs sharing the first sequence are computed against a striped profile of the first sequence.
+        else if constexpr (traits_t::is_query_profile)
+        {
+            // The remaining pairs are computed by the inter-sequence algorithm.
+            return pairwise_alignment_algorithm_query_profile<config_t, function_wrapper_t>{
+                cfg,
+                make_algorithm<function_wrapper_t, alignment_scoring_scheme_t>(cfg)};
+        }
+        // A single long pair would only occupy one lane of the inter-sequence algorithm; use the striped kernel instead.
+        else if constexpr (traits_t::is_vectorised && !traits_t::is_banded && !traits_t::is_debug
+                           && !traits_t::requires_trace_information)
+        {
+            // All other chunks are computed by the inter-sequence algorithm.
+            return pairwise_alignment_algorithm_striped<config_t, function_wrapper_t>{
+                cfg,
+                make_algorithm<function_wrapper_t, alignment_scoring_scheme_t>(cfg)};
+        }
+        // The full trace matrix of long pairs does not fit into memory; compute the traceback in linear memory instead.
+        else if constexpr (!traits_t::is_banded && !traits_t::is_debug && traits_t::requires_trace_information)
+        {
+            return pairwise_alignment_algorithm_linear_memory<config_t, function_wrapper_t>{
+                cfg,
+                make_algorithm<function_wrapper_t, alignment_scoring_scheme_t>(cfg)};
+        }
+        else
+        {
+            return make_algorithm<function_wrapper_t, alignment_scoring_scheme_t>(cfg);
+        }
+    };
+
+    // The adaptive score width configures the scoring scheme of every width separately.
+    if constexpr (traits_t::is_adaptive_score_width && traits_t::is_query_profile)
+        return pairwise_alignment_algorithm_query_profile<config_t, function_wrapper_t>{
+            cfg,
+            configure_adaptive_score_width<function_wrapper_t>(cfg)};
+    else if constexpr (traits_t::is_adaptive_score_width)
+        return pairwise_alignment_algorithm_striped<config_t, function_wrapper_t>{
+            cfg,
+            configure_adaptive_score_width<function_wrapper_t>(cfg)};
+    else
+        return configure_simd_scoring_scheme<function_wrapper_t>(cfg, configure_algorithm);
+}
+
+template <typename function_wrapper_t, typename config_t>
+constexpr auto alignment_configurator::configure_adaptive_score_width(config_t const & cfg)
+{
+    using algorithm_t = pairwise_alignment_algorithm_adaptive_width<config_t, function_wrapper_t>;
+    using batch_algorithm_t = typename algorithm_t::batch_algorithm_type;
+
+    auto configure_score_width = [&]<typename score_t>(std::type_identity<score_t>) -> batch_algorithm_t
+    {
+        if (algorithm_t::template max_sequence_length<score_t>(cfg) < 0)
+            return {};
+
+        // The score type fixes the width; it cannot be combined with align_cfg::adaptive_score_width.
+        auto score_width_cfg =
+            cfg.template remove<align_cfg::adaptive_score_width>() | align_cfg::score_type<score_t>{};
+
+        return configure_simd_scoring_scheme<batch_algorithm_t>(
+            score_width_cfg,
+            [&]<typename alignment_scoring_scheme_t>(std::type_identity<alignment_scoring_scheme_t>)
+            {
+                return make_algorithm<batch_algorithm_t, alignment_scoring_scheme_t>(score_width_cfg);
+            });
+    };
+
+    return algorithm_t{cfg,
+                       configure_score_width(std::type_identity<int8_t>{}),
+                       configure_score_width(std::type_identity<int16_t>{}),
+                       configure_score_width(std::type_identity<int32_t>{})};
 }
 //!\endcond
 } // namespace seqan3::detail
@@ -36,6 +36,7 @@ class policy_alignment_result_builder;
  * \tparam alignment_t           The type of the alignment, can be omitted.
  * \tparam score_debug_matrix_t  The type of the score matrix. Only present if seqan3::align_cfg::detail::debug is enabled.
  * \tparam trace_debug_matrix_t  The type of the trace matrix. Only present if seqan3::align_cfg::detail::debug is enabled.
+ * \tparam cigar_sequence_t      The type of the CIGAR sequence, can be omitted.
  */
 template <typename sequence1_id_t,
           typename sequence2_id_t,
@@ -44,7 +45,8 @@ template <typename sequence1_id_t,
           typename begin_positions_t = std::nullopt_t *,
           typename alignment_t = std::nullopt_t *,
           typename score_debug_matrix_t = std::nullopt_t *,
-          typename trace_debug_matrix_t = std::nullopt_t *>
+          typename trace_debug_matrix_t = std::nullopt_t *,
+          typename cigar_sequence_t = std::nullopt_t *>
 struct alignment_result_value_type
 {
     //!\brief The alignment identifier for the first sequence.
@@ -64,6 +66,9 @@ struct alignment_result_value_type
     score_debug_matrix_t score_debug_matrix{};
     //!\brief The trace matrix. Only accessible with seqan3::align_cfg::detail::debug.
     trace_debug_matrix_t trace_debug_matrix{};
+
+    //!\brief The CIGAR sequence of the alignment.
+    cigar_sequence_t cigar_sequence{};
 };
 
 /*!\name Type deduction guides
@@ -165,6 +170,8 @@ private:
     using begin_positions_t = decltype(data.begin_positions);
     //!\brief The type for the alignment.
     using alignment_t = decltype(data.alignment);
+    //!\brief The type for the CIGAR sequence.
+    using cigar_sequence_t = decltype(data.cigar_sequence);
     //!\}
 
     //!\brief Befriend alignment result builder.
@@ -338,6 +345,27 @@ public:
                       "Trying to access the alignment, although it was not requested in the alignment configuration.");
         return data.alignment;
     }
+
+    /*!\brief Returns the CIGAR sequence of the alignment.
+     * \return A std::vector over seqan3::cigar representing the alignment.
+     *
+     * \details
+     *
+     * The first sequence is treated as the reference and the second sequence as the query. The CIGAR sequence
+     * only covers the aligned slices of the sequences, see seqan3::align_cfg::output_cigar.
+     *
+     * \note This function is only available if the CIGAR sequence was requested via the alignment configuration
+     * (see seqan3::align_cfg::output_cigar).
+     *
+     * \experimentalapi{Experimental since version 3.4.}
+     */
+    constexpr cigar_sequence_t const & cigar_sequence() const noexcept
+    {
+        static_assert(
+            !std::is_same_v<cigar_sequence_t, std::nullopt_t *>,
+            "Trying to access the CIGAR sequence, although it was not requested in the alignment configuration.");
+        return data.cigar_sequence;
+    }
     //!\}
 
     //!\cond DEV
@@ -433,6 +461,7 @@ struct alignment_result_printer<alignment_result<result_value_t>>
         constexpr bool has_end_positions = !std::is_same_v<typename result_t::end_positions_t, disabled_t>;
         constexpr bool has_begin_positions = !std::is_same_v<typename result_t::begin_positions_t, disabled_t>;
         constexpr bool has_alignment = !std::is_same_v<typename result_t::alignment_t, disabled_t>;
+        constexpr bool has_cigar_sequence = !std::is_same_v<typename result_t::cigar_sequence_t, disabled_t>;
 
         bool prepend_comma = false;
         auto append_to_stream = [&](auto &&... args)
@@ -453,6 +482,8 @@ struct alignment_result_printer<alignment_result<result_value_t>>
             append_to_stream("begin: (", arg.sequence1_begin_position(), ",", arg.sequence2_begin_position(), ")");
         if constexpr (has_end_positions)
             append_to_stream("end: (", arg.sequence1_end_position(), ",", arg.sequence2_end_position(), ")");
+        if constexpr (has_cigar_sequence)
+            append_to_stream("cigar: ", arg.cigar_sequence());
         if constexpr (has_alignment)
             append_to_stream("\nalignment:\n", arg.alignment());
         stream << '}';
@@ -134,23 +134,31 @@
  * into one alignment configuration. In general, the same configuration element cannot occur more than once inside of
  * a configuration specification. The following table shows which combinations are possible.
  *
- * | **Config**                                                                  | **0** | **1** | **2** | **3** | **4** | **5** | **6** | **7** | **8** | **9** | **10** | **11** | **12** | **13** | **14** |
- * |:----------------------------------------------------------------------------|:-----:|:-----:|:-----:|:-----:|:-----:|:-----:|:-----:|:-----:|:-----:|:-----:|:------:|:------:|:------:|:------:|:------:|
- * | \ref seqan3::align_cfg::band_fixed_size "0: Band"                           |  ❌   |   ✅   |  ✅   |  ✅   |  ✅   |   ✅   |  ✅   |  ✅   |   ✅   |  ✅   |    ✅   |   ✅   |   ✅   |    ✅   |   ✅   |
- * | \ref seqan3::align_cfg::gap_cost_affine "1: Gap scheme affine"              |  ✅   |   ❌   |  ✅   |  ✅   |  ✅   |   ✅   |  ✅   |  ✅   |   ✅   |  ✅   |    ✅   |   ✅   |   ✅   |    ✅   |   ✅   |
- * | \ref seqan3::align_cfg::min_score "2: Min score"                            |  ✅   |   ✅   |  ❌   |  ✅   |  ❌   |   ✅   |  ✅   |  ✅   |   ✅   |  ✅   |    ✅   |   ✅   |   ✅   |    ✅   |   ✅   |
- * | \ref seqan3::align_cfg::method_global "3: Method global"                    |  ✅   |   ✅   |  ✅   |  ❌   |  ❌   |   ✅   |  ✅   |  ✅   |   ✅   |  ✅   |    ✅   |   ✅   |   ✅   |    ✅   |   ✅   |
- * | \ref seqan3::align_cfg::method_local "4: Method local"                      |  ✅   |   ✅   |  ❌   |  ❌   |  ❌   |   ✅   |  ✅   |  ✅   |   ✅   |  ✅   |    ✅   |   ✅   |   ✅   |    ✅   |   ✅   |
- * | \ref seqan3::align_cfg::output_alignment "5: Alignment output"              |  ✅   |   ✅   |  ✅   |  ✅   |  ✅   |   ❌   |  ✅   |  ✅   |   ✅   |  ✅   |    ✅   |   ✅   |   ✅   |    ✅   |   ✅   |
- * | \ref seqan3::align_cfg::output_end_position "6: End positions output"       |  ✅   |   ✅   |  ✅   |  ✅   |  ✅   |   ✅   |  ❌   |  ✅   |   ✅   |  ✅   |    ✅   |   ✅   |   ✅   |    ✅   |   ✅   |
- * | \ref seqan3::align_cfg::output_begin_position "7: Begin positions output"   |  ✅   |   ✅   |  ✅   |  ✅   |  ✅   |   ✅   |  ✅   |  ❌   |   ✅   |  ✅   |    ✅   |   ✅   |   ✅   |    ✅   |   ✅   |
- * | \ref seqan3::align_cfg::output_score "8: Score output"                      |  ✅   |   ✅   |  ✅   |  ✅   |  ✅   |   ✅   |  ✅   |  ✅   |   ❌   |  ✅   |    ✅   |   ✅   |   ✅   |    ✅   |   ✅   |
- * | \ref seqan3::align_cfg::output_sequence1_id "9: Sequence1 id output"        |  ✅   |   ✅   |  ✅   |  ✅   |  ✅   |   ✅   |  ✅   |  ✅   |   ✅   |  ❌   |    ✅   |   ✅   |   ✅   |    ✅   |   ✅   |
- * | \ref seqan3::align_cfg::output_sequence2_id "10: Sequence2 id output"       |  ✅   |   ✅   |  ✅   |  ✅   |  ✅   |   ✅   |  ✅   |  ✅   |   ✅   |  ✅   |    ❌   |   ✅   |   ✅   |    ✅   |   ✅   |
- * | \ref seqan3::align_cfg::parallel "11: Parallel"                             |  ✅   |   ✅   |  ✅   |  ✅   |  ✅   |   ✅   |  ✅   |  ✅   |   ✅   |  ✅   |    ✅   |   ❌   |   ✅   |    ✅   |   ✅   |
- * | \ref seqan3::align_cfg::score_type "12: Score type"                         |  ✅   |   ✅   |  ✅   |  ✅   |  ✅   |   ✅   |  ✅   |  ✅   |   ✅   |  ✅   |    ✅   |   ✅   |   ❌   |    ✅   |   ✅   |
- * | \ref seqan3::align_cfg::scoring_scheme "13: Scoring scheme"                 |  ✅   |   ✅   |  ✅   |  ✅   |  ✅   |   ✅   |  ✅   |  ✅   |   ✅   |  ✅   |    ✅   |   ✅   |   ✅   |    ❌   |   ✅   |
- * | \ref seqan3::align_cfg::vectorised "14: Vectorised"                         |  ✅   |   ✅   |  ✅   |  ✅   |  ✅   |   ✅   |  ✅   |  ✅   |   ✅   |  ✅   |    ✅   |   ✅   |   ✅   |    ✅   |   ❌   |
+ * | **Config**                                                                  | **0** | **1** | **2** | **3** | **4** | **5** | **6** | **7** | **8** | **9** | **10** | **11** | **12** | **13** | **14** | **15** | **16** | **17** | **18** | **19** | **20** | **21** | **22** |
+ * |:----------------------------------------------------------------------------|:-----:|:-----:|:-----:|:-----:|:-----:|:-----:|:-----:|:-----:|:-----:|:-----:|:------:|:------:|:------:|:------:|:------:|:------:|:------:|:------:|:------:|:------:|:------:|:------:|:------:|
+ * | \ref seqan3::align_cfg::band_fixed_size "0: Band"                           |  ❌   |   ✅   |  ✅   |  ✅   |  ✅   |   ✅   |  ✅   |  ✅   |   ✅   |  ✅   |    ✅   |   ✅   |   ✅   |    ✅   |   ✅   |   ❌   |   ❌   |   ❌   |   ✅   |    ❌   |    ❌   |    ✅   |    ❌   |
+ * | \ref seqan3::align_cfg::gap_cost_affine "1: Gap scheme affine"              |  ✅   |   ❌   |  ✅   |  ✅   |  ✅   |   ✅   |  ✅   |  ✅   |   ✅   |  ✅   |    ✅   |   ✅   |   ✅   |    ✅   |   ✅   |   ✅   |   ✅   |   ✅   |   ✅   |    ✅   |    ✅   |    ✅   |    ✅   |
+ * | \ref seqan3::align_cfg::min_score "2: Min score"                            |  ✅   |   ✅   |  ❌   |  ✅   |  ❌   |   ✅   |  ✅   |  ✅   |   ✅   |  ✅   |    ✅   |   ✅   |   ✅   |    ✅   |   ✅   |   ✅   |   ✅   |   ✅   |   ✅   |    ✅   |    ❌   |    ✅   |    ✅   |
+ * | \ref seqan3::align_cfg::method_global "3: Method global"                    |  ✅   |   ✅   |  ✅   |  ❌   |  ❌   |   ✅   |  ✅   |  ✅   |   ✅   |  ✅   |    ✅   |   ✅   |   ✅   |    ✅   |   ✅   |   ✅   |   ✅   |   ✅   |   ✅   |    ✅   |    ✅   |    ✅   |    ✅   |
+ * | \ref seqan3::align_cfg::method_local "4: Method local"                      |  ✅   |   ✅   |  ❌   |  ❌   |  ❌   |   ✅   |  ✅   |  ✅   |   ✅   |  ✅   |    ✅   |   ✅   |   ✅   |    ✅   |   ✅   |   ✅   |   ❌   |   ❌   |   ✅   |    ✅   |    ❌   |    ✅   |    ✅   |
+ * | \ref seqan3::align_cfg::output_alignment "5: Alignment output"              |  ✅   |   ✅   |  ✅   |  ✅   |  ✅   |   ❌   |  ✅   |  ✅   |   ✅   |  ✅   |    ✅   |   ✅   |   ✅   |    ✅   |   ✅   |   ✅   |   ✅   |   ✅   |   ✅   |    ✅   |    ✅   |    ✅   |    ✅   |
+ * | \ref seqan3::align_cfg::output_end_position "6: End positions output"       |  ✅   |   ✅   |  ✅   |  ✅   |  ✅   |   ✅   |  ❌   |  ✅   |   ✅   |  ✅   |    ✅   |   ✅   |   ✅   |    ✅   |   ✅   |   ✅   |   ✅   |   ✅   |   ✅   |    ✅   |    ✅   |    ✅   |    ✅   |
+ * | \ref seqan3::align_cfg::output_begin_position "7: Begin positions output"   |  ✅   |   ✅   |  ✅   |  ✅   |  ✅   |   ✅   |  ✅   |  ❌   |   ✅   |  ✅   |    ✅   |   ✅   |   ✅   |    ✅   |   ✅   |   ✅   |   ✅   |   ✅   |   ✅   |    ✅   |    ✅   |    ✅   |    ✅   |
+ * | \ref seqan3::align_cfg::output_score "8: Score output"                      |  ✅   |   ✅   |  ✅   |  ✅   |  ✅   |   ✅   |  ✅   |  ✅   |   ❌   |  ✅   |    ✅   |   ✅   |   ✅   |    ✅   |   ✅   |   ✅   |   ✅   |   ✅   |   ✅   |    ✅   |    ✅   |    ✅   |    ✅   |
+ * | \ref seqan3::align_cfg::output_sequence1_id "9: Sequence1 id output"        |  ✅   |   ✅   |  ✅   |  ✅   |  ✅   |   ✅   |  ✅   |  ✅   |   ✅   |  ❌   |    ✅   |   ✅   |   ✅   |    ✅   |   ✅   |   ✅   |   ✅   |   ✅   |   ✅   |    ✅   |    ✅   |    ✅   |    ✅   |
+ * | \ref seqan3::align_cfg::output_sequence2_id "10: Sequence2 id output"       |  ✅   |   ✅   |  ✅   |  ✅   |  ✅   |   ✅   |  ✅   |  ✅   |   ✅   |  ✅   |    ❌   |   ✅   |   ✅   |    ✅   |   ✅   |   ✅   |   ✅   |   ✅   |   ✅   |    ✅   |    ✅   |    ✅   |    ✅   |
+ * | \ref seqan3::align_cfg::parallel "11: Parallel"                             |  ✅   |   ✅   |  ✅   |  ✅   |  ✅   |   ✅   |  ✅   |  ✅   |   ✅   |  ✅   |    ✅   |   ❌   |   ✅   |    ✅   |   ✅   |   ✅   |   ✅   |   ✅   |   ✅   |    ✅   |    ✅   |    ✅   |    ✅   |
+ * | \ref seqan3::align_cfg::score_type "12: Score type"                         |  ✅   |   ✅   |  ✅   |  ✅   |  ✅   |   ✅   |  ✅   |  ✅   |   ✅   |  ✅   |    ✅   |   ✅   |   ❌   |    ✅   |   ✅   |   ✅   |   ✅   |   ✅   |   ✅   |    ✅   |    ✅   |    ✅   |    ❌   |
+ * | \ref seqan3::align_cfg::scoring_scheme "13: Scoring scheme"                 |  ✅   |   ✅   |  ✅   |  ✅   |  ✅   |   ✅   |  ✅   |  ✅   |   ✅   |  ✅   |    ✅   |   ✅   |   ✅   |    ❌   |   ✅   |   ✅   |   ✅   |   ✅   |   ✅   |    ✅   |    ✅   |    ✅   |    ✅   |
+ * | \ref seqan3::align_cfg::vectorised "14: Vectorised"                         |  ✅   |   ✅   |  ✅   |  ✅   |  ✅   |   ✅   |  ✅   |  ✅   |   ✅   |  ✅   |    ✅   |   ✅   |   ✅   |    ✅   |   ❌   |   ✅   |   ✅   |   ✅   |   ✅   |    ✅   |    ❌   |    ✅   |    ✅   |
+ * | \ref seqan3::align_cfg::linear_memory_traceback "15: Linear memory"         |  ❌   |   ✅   |  ✅   |  ✅   |  ✅   |   ✅   |  ✅   |  ✅   |   ✅   |  ✅   |    ✅   |   ✅   |   ✅   |    ✅   |   ✅   |   ❌   |   ❌   |   ❌   |   ✅   |    ❌   |    ❌   |    ✅   |    ✅   |
+ * | \ref seqan3::align_cfg::x_drop "16: X-drop"                                 |  ❌   |   ✅   |  ✅   |  ✅   |  ❌   |   ✅   |  ✅   |  ✅   |   ✅   |  ✅   |    ✅   |   ✅   |   ✅   |    ✅   |   ✅   |   ❌   |   ❌   |   ✅   |   ✅   |    ❌   |    ❌   |    ✅   |    ❌   |
+ * | \ref seqan3::align_cfg::z_drop "17: Z-drop"                                 |  ❌   |   ✅   |  ✅   |  ✅   |  ❌   |   ✅   |  ✅   |  ✅   |   ✅   |  ✅   |    ✅   |   ✅   |   ✅   |    ✅   |   ✅   |   ❌   |   ✅   |   ❌   |   ✅   |    ❌   |    ❌   |    ✅   |    ❌   |
+ * | \ref seqan3::align_cfg::sort_by_length "18: Sort by length"                 |  ✅   |   ✅   |  ✅   |  ✅   |  ✅   |   ✅   |  ✅   |  ✅   |   ✅   |  ✅   |    ✅   |   ✅   |   ✅   |    ✅   |   ✅   |   ✅   |   ✅   |   ✅   |   ❌   |    ✅   |    ❌   |    ✅   |    ✅   |
+ * | \ref seqan3::align_cfg::query_profile "19: Query profile"                   |  ❌   |   ✅   |  ✅   |  ✅   |  ✅   |   ✅   |  ✅   |  ✅   |   ✅   |  ✅   |    ✅   |   ✅   |   ✅   |    ✅   |   ✅   |   ❌   |   ❌   |   ❌   |   ✅   |    ❌   |    ❌   |    ✅   |    ✅   |
+ * | \ref seqan3::align_cfg::wavefront "20: Wavefront"                           |  ❌   |   ✅   |  ❌   |  ✅   |  ❌   |   ✅   |  ✅   |  ✅   |   ✅   |  ✅   |    ✅   |   ✅   |   ✅   |    ✅   |   ❌   |   ❌   |   ❌   |   ❌   |   ❌   |    ❌   |    ❌   |    ✅   |    ❌   |
+ * | \ref seqan3::align_cfg::output_cigar "21: CIGAR output"                     |  ✅   |   ✅   |  ✅   |  ✅   |  ✅   |   ✅   |  ✅   |  ✅   |   ✅   |  ✅   |    ✅   |   ✅   |   ✅   |    ✅   |   ✅   |   ✅   |   ✅   |   ✅   |   ✅   |    ✅   |    ✅   |    ❌   |    ✅   |
+ * | \ref seqan3::align_cfg::adaptive_score_width "22: Adaptive score width"     |  ❌   |   ✅   |  ✅   |  ✅   |  ✅   |   ✅   |  ✅   |  ✅   |   ✅   |  ✅   |    ✅   |   ✅   |   ❌   |    ✅   |   ✅   |   ✅   |   ❌   |   ❌   |   ✅   |    ✅   |    ❌   |    ✅   |    ❌   |
  *
  * \if DEV
  * There is an additional configuration element \ref seqan3::align_cfg::detail::debug "Debug", which enables the output
@@ -176,6 +184,7 @@
  * | \ref seqan3::align_cfg::output_end_position "seqan3::align_cfg::output_end_position"     | end positions of the aligned sequences   |
  * | \ref seqan3::align_cfg::output_begin_position "seqan3::align_cfg::output_begin_position" | begin positions of the aligned sequences |
  * | \ref seqan3::align_cfg::output_alignment "seqan3::align_cfg::output_alignment"           | alignment of the two sequences           |
+ * | \ref seqan3::align_cfg::output_cigar "seqan3::align_cfg::output_cigar"                   | CIGAR operations of the alignment        |
  * | \ref seqan3::align_cfg::output_sequence1_id "seqan3::align_cfg::output_sequence1_id"     | id of the first sequence                 |
  * | \ref seqan3::align_cfg::output_sequence2_id "seqan3::align_cfg::output_sequence2_id"     | id of the second sequence                |
  *
@@ -186,6 +195,8 @@
  * In this case, the begin and end positions denote the begin and end of the slices of the original sequences that are
  * aligned.
  * To obtain the actual alignment the option seqan3::align_cfg::output_alignment has to be specified.
+ * If only the CIGAR representation of the alignment is needed, e.g. to write SAM records, the option
+ * seqan3::align_cfg::output_cigar computes it directly from the traceback without building the aligned sequences.
  * The options can be combiend with each other in order to customise the alignment algorithm and the respective output
  * of the alignment. For example computing the alignment will always incur some run time penalty compared to just
  * computing the score.
@@ -256,6 +267,15 @@
  *
  * \include test/snippet/alignment/pairwise/parallel_align_pairwise_with_callback.cpp
  *
+ * # Ungapped seed extension
+ *
+ * Read mappers often extend many seeds without gaps before computing a gapped alignment for the promising ones.
+ * The free function seqan3::extend_ungapped extends an anchor of two sequences to both sides along its diagonal
+ * until the score drops too far below the best score (X-drop). It compares whole blocks of letters at once and
+ * reads the letters of a seqan3::bitpacked_sequence directly from its packed words.
+ *
+ * \include test/snippet/alignment/pairwise/extend_ungapped.cpp
+ *
  * \see
  *  - [lecture script - pairwise alignment](https://www.mi.fu-berlin.de/en/inf/groups/abi/teaching/lectures/lectures_past/WS0910/V___Algorithmen_und_Datenstrukturen/scripts/alignment.pdf)\n
  *  - alignment
@@ -269,6 +289,9 @@
 #include <seqan3/alignment/pairwise/alignment_configurator.hpp>
 #include <seqan3/alignment/pairwise/alignment_result.hpp>
 #include <seqan3/alignment/pairwise/edit_distance_algorithm.hpp>
+#include <seqan3/alignment/pairwise/edit_distance_banded.hpp>
 #include <seqan3/alignment/pairwise/edit_distance_fwd.hpp>
+#include <seqan3/alignment/pairwise/edit_distance_simd.hpp>
 #include <seqan3/alignment/pairwise/edit_distance_unbanded.hpp>
+#include <seqan3/alignment/pairwise/extend_ungapped.hpp>
 #include <seqan3/alignment/pairwise/policy/all.hpp>
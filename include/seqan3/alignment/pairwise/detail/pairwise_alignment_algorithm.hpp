@@ -11,9 +11,11 @@
 
 #include <concepts>
 #include <ranges>
+#include <vector>
 
 #include <seqan3/alignment/pairwise/detail/type_traits.hpp>
 #include <seqan3/core/detail/empty_type.hpp>
+#include <seqan3/utility/concept.hpp>
 #include <seqan3/utility/container/aligned_allocator.hpp>
 #include <seqan3/utility/detail/type_name_as_string.hpp>
 #include <seqan3/utility/simd/views/to_simd.hpp>
@@ -211,6 +213,11 @@ protected:
      * column of the collection as a simd vector. The resulting simd sequence has the size of the longest sequence in
      * the collection. For all sequences with a smaller size the padding symbol will be appended during the simd
      * transformation to fill up the remaining size difference.
+     *
+     * If the scores are looked up in a scoring matrix, the simd scoring scheme expects the ranks of the scoring
+     * scheme's alphabet. Sequences over a different alphabet, e.g. seqan3::dna4 sequences scored with a
+     * seqan3::nucleotide_scoring_scheme over seqan3::dna15, are then converted to this alphabet first, like the scalar
+     * scoring scheme does for every letter. Match and mismatch scores only compare the ranks and need no conversion.
      */
     template <typename simd_sequence_t, std::ranges::forward_range sequence_collection_t, arithmetic padding_symbol_t>
         requires std::ranges::output_range<simd_sequence_t, score_type>
@@ -220,7 +227,29 @@ protected:
     {
         assert(static_cast<size_t>(std::ranges::distance(sequences)) <= traits_type::alignments_per_vector);
 
+        using sequence_alphabet_t = std::ranges::range_value_t<std::ranges::range_value_t<sequence_collection_t>>;
+        using scoring_scheme_alphabet_t = typename traits_type::scoring_scheme_alphabet_type;
+
         simd_sequence.clear();
+        if constexpr (!std::same_as<sequence_alphabet_t, scoring_scheme_alphabet_t>
+                      && explicitly_convertible_to<sequence_alphabet_t, scoring_scheme_alphabet_t>)
+        {
+            if (this->scoring_scheme.uses_scoring_matrix())
+            {
+                std::vector<std::vector<scoring_scheme_alphabet_t>> converted_sequences{};
+                for (auto && sequence : sequences)
+                {
+                    auto & converted_sequence = converted_sequences.emplace_back();
+                    for (auto && letter : sequence)
+                        converted_sequence.push_back(static_cast<scoring_scheme_alphabet_t>(letter));
+                }
+
+                for (auto && simd_vector_chunk : converted_sequences | views::to_simd<score_type>(padding_symbol))
+                    std::ranges::move(simd_vector_chunk, std::back_inserter(simd_sequence));
+                return;
+            }
+        }
+
         for (auto && simd_vector_chunk : sequences | views::to_simd<score_type>(padding_symbol))
             std::ranges::move(simd_vector_chunk, std::back_inserter(simd_sequence));
     }
@@ -0,0 +1,219 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides seqan3::detail::pairwise_alignment_algorithm_adaptive_width.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <ranges>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
+#include <seqan3/alignment/pairwise/detail/concept.hpp>
+#include <seqan3/alignment/pairwise/detail/pairwise_alignment_batches.hpp>
+#include <seqan3/alignment/pairwise/detail/type_traits.hpp>
+#include <seqan3/alignment/scoring/aminoacid_scoring_scheme.hpp>
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/utility/detail/bits_of.hpp>
+#include <seqan3/utility/simd/simd.hpp>
+#include <seqan3/utility/simd/simd_traits.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Computes vectorised alignments with the narrowest score width that cannot overflow.
+ * \ingroup alignment_pairwise
+ * \implements std::invocable
+ *
+ * \tparam alignment_configuration_t The configuration type; must be of type seqan3::configuration.
+ * \tparam function_wrapper_t The type-erased alignment function the chunks are passed to.
+ *
+ * \details
+ *
+ * The inter-sequence alignment computes one sequence pair per simd lane, so the number of pairs computed at once
+ * depends on the score width: an AVX2 register holds 32 8-bit, 16 16-bit or 8 32-bit scores. If the user configures
+ * seqan3::align_cfg::adaptive_score_width, the chunks are sized for 8-bit scores and every sequence pair is computed
+ * with the narrowest score width that can represent all scores of its alignment matrix. The pairs of each width are
+ * computed in batches of the respective simd length by one of three inter-sequence algorithms. The results are
+ * reported in the order of the chunk.
+ *
+ * The inter-sequence algorithms neither saturate nor detect an overflow. Instead, the width is chosen by bounding
+ * the scores before the computation. All sequences of a batch are padded to the longest sequence of the batch, so
+ * each cell of its matrix lies between \f$3o + 2e \cdot L\f$ (the path consisting of gaps only) and
+ * \f$s \cdot L\f$, where \f$L\f$ is the length of the longest sequence, \f$s\f$ the largest substitution score,
+ * \f$o\f$ the score of the first gap and \f$e\f$ the score of every further gap. A width is used for a sequence pair if
+ * both bounds lie within half the range of the score type, which leaves room for the minus infinity of the
+ * recursions. The bound only depends on \f$L\f$, so a batch of pairs that fit a width also fits it.
+ */
+template <typename alignment_configuration_t, typename function_wrapper_t>
+    requires is_type_specialisation_of_v<alignment_configuration_t, configuration>
+class pairwise_alignment_algorithm_adaptive_width
+{
+private:
+    //!\brief The alignment configuration traits type.
+    using traits_type = alignment_configuration_traits<alignment_configuration_t>;
+    //!\brief The configured alignment result type.
+    using alignment_result_type = typename traits_type::alignment_result_type;
+    //!\brief The buffer distributing the sequence pairs of a chunk to the batches.
+    using batches_type = pairwise_alignment_batches<alignment_configuration_t, function_wrapper_t>;
+
+    static_assert(traits_type::is_adaptive_score_width,
+                  "The adaptive score width requires align_cfg::adaptive_score_width and a vectorised alignment.");
+
+    //!\brief The number of score widths, i.e. 8, 16 and 32 bit.
+    static constexpr size_t width_count = 3;
+
+public:
+    //!\brief The type-erased inter-sequence alignment algorithm computing a batch of one score width.
+    using batch_algorithm_type = typename batches_type::batch_algorithm_type;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    pairwise_alignment_algorithm_adaptive_width() = default; //!< Defaulted.
+    pairwise_alignment_algorithm_adaptive_width(pairwise_alignment_algorithm_adaptive_width const &) =
+        default; //!< Defaulted.
+    pairwise_alignment_algorithm_adaptive_width(pairwise_alignment_algorithm_adaptive_width &&) =
+        default; //!< Defaulted.
+    pairwise_alignment_algorithm_adaptive_width &
+    operator=(pairwise_alignment_algorithm_adaptive_width const &) = default; //!< Defaulted.
+    pairwise_alignment_algorithm_adaptive_width &
+    operator=(pairwise_alignment_algorithm_adaptive_width &&) = default; //!< Defaulted.
+    ~pairwise_alignment_algorithm_adaptive_width() = default;            //!< Defaulted.
+
+    /*!\brief Constructs the algorithm from the configuration and the inter-sequence algorithm of every width.
+     * \param[in] config The alignment configuration.
+     * \param[in] int8_algorithm The algorithm computing 8-bit scores; empty if the scores do not fit.
+     * \param[in] int16_algorithm The algorithm computing 16-bit scores; empty if the scores do not fit.
+     * \param[in] int32_algorithm The algorithm computing 32-bit scores.
+     */
+    pairwise_alignment_algorithm_adaptive_width(alignment_configuration_t const & config,
+                                                batch_algorithm_type int8_algorithm,
+                                                batch_algorithm_type int16_algorithm,
+                                                batch_algorithm_type int32_algorithm) :
+        algorithms{std::move(int8_algorithm), std::move(int16_algorithm), std::move(int32_algorithm)},
+        max_sequence_lengths{max_sequence_length<int8_t>(config), max_sequence_length<int16_t>(config), -1}
+    {}
+    //!\}
+
+    /*!\brief Returns the length of the longest sequence whose alignment fits the given score width.
+     * \tparam score_t The signed integral score type of one simd lane.
+     * \param[in] config The alignment configuration.
+     * \returns The maximal length or `-1` if the scoring scheme or the gap scores cannot be represented.
+     */
+    template <std::signed_integral score_t>
+    static int64_t max_sequence_length(alignment_configuration_t const & config)
+    {
+        using alphabet_t = typename traits_type::scoring_scheme_alphabet_type;
+
+        auto const & scheme = get<align_cfg::scoring_scheme>(config).scheme;
+        auto const & gap_scheme =
+            config.get_or(align_cfg::gap_cost_affine{align_cfg::open_score{-10}, align_cfg::extension_score{-1}});
+
+        // The padding symbols of the vectorised scoring schemes score 1 at most.
+        int64_t max_score = 1;
+        int64_t min_score = 0;
+        [[maybe_unused]] bool has_matrix_scores = false;
+        int64_t const match = scheme.score(assign_rank_to(0, alphabet_t{}), assign_rank_to(0, alphabet_t{}));
+        int64_t const mismatch = scheme.score(assign_rank_to(0, alphabet_t{}), assign_rank_to(1, alphabet_t{}));
+        for (size_t rank1 = 0; rank1 < alphabet_size<alphabet_t>; ++rank1)
+        {
+            for (size_t rank2 = 0; rank2 < alphabet_size<alphabet_t>; ++rank2)
+            {
+                int64_t const score =
+                    scheme.score(assign_rank_to(rank1, alphabet_t{}), assign_rank_to(rank2, alphabet_t{}));
+                max_score = std::max(max_score, score);
+                min_score = std::min(min_score, score);
+                has_matrix_scores |= score != ((rank1 == rank2) ? match : mismatch);
+            }
+        }
+
+        int64_t const gap_extension = gap_scheme.extension_score;
+        int64_t const gap_open = gap_scheme.open_score + gap_extension;
+        int64_t const limit = std::numeric_limits<score_t>::max() / 2;
+
+        if (gap_open > 0 || gap_extension > 0 || min_score < std::numeric_limits<score_t>::lowest()
+            || -3 * gap_open > limit)
+            return -1;
+
+        // The vectorised scoring matrix computes the index of a letter pair within the linearised matrix in the score
+        // type, including one padding symbol.
+        if constexpr (is_type_specialisation_of_v<std::remove_cvref_t<typename traits_type::scoring_scheme_type>,
+                                                  aminoacid_scoring_scheme>)
+        {
+            if ((alphabet_size<alphabet_t> + 1) * (alphabet_size<alphabet_t> + 1) > std::numeric_limits<score_t>::max())
+                return -1;
+        }
+        else if (has_matrix_scores) // Other scoring schemes index the matrix with the unsigned score type.
+        {
+            if ((alphabet_size<alphabet_t> + 1) * (alphabet_size<alphabet_t> + 1) > (int64_t{1} << bits_of<score_t>))
+                return -1;
+        }
+
+        int64_t length = limit / max_score;
+        if (gap_extension < 0)
+            length = std::min(length, (limit + 3 * gap_open) / (-2 * gap_extension));
+
+        return length;
+    }
+
+    /*!\brief Computes the alignments of the given chunk of indexed sequence pairs.
+     * \tparam indexed_sequence_pairs_t The type of indexed_sequence_pairs; must model
+     *                                  seqan3::detail::indexed_sequence_pair_range.
+     * \tparam callback_t The type of the callback function; must model std::invocable with the alignment result.
+     *
+     * \param[in] indexed_sequence_pairs The chunk of indexed sequence pairs to be aligned.
+     * \param[in] callback The callback function to be invoked with each computed alignment result.
+     */
+    template <indexed_sequence_pair_range indexed_sequence_pairs_t, typename callback_t>
+        requires std::invocable<callback_t, alignment_result_type>
+    void operator()(indexed_sequence_pairs_t && indexed_sequence_pairs, callback_t && callback)
+    {
+        using std::get;
+
+        batches.assign(std::forward<indexed_sequence_pairs_t>(indexed_sequence_pairs));
+
+        for (std::vector<size_t> & width_positions : positions)
+            width_positions.clear();
+
+        for (size_t position = 0; position < batches.pairs().size(); ++position)
+        {
+            auto const & sequence_pair = get<0>(batches.pairs()[position]);
+            int64_t const length =
+                std::max(std::ranges::distance(get<0>(sequence_pair)), std::ranges::distance(get<1>(sequence_pair)));
+
+            size_t width = 0;
+            while (!algorithms[width] || (width + 1 < width_count && length > max_sequence_lengths[width]))
+                ++width;
+
+            positions[width].push_back(position);
+        }
+
+        batches.compute(positions[0], simd_traits<simd_type_t<int8_t>>::length, algorithms[0]);
+        batches.compute(positions[1], simd_traits<simd_type_t<int16_t>>::length, algorithms[1]);
+        batches.compute(positions[2], simd_traits<simd_type_t<int32_t>>::length, algorithms[2]);
+        batches.report(std::forward<callback_t>(callback));
+    }
+
+private:
+    //!\brief The inter-sequence algorithms of every score width.
+    std::array<batch_algorithm_type, width_count> algorithms{};
+    //!\brief The length of the longest sequence fitting each score width.
+    std::array<int64_t, width_count> max_sequence_lengths{};
+    //!\brief The sequence pairs and results of the current chunk.
+    batches_type batches{};
+    //!\brief The positions within the chunk of the sequence pairs assigned to every score width.
+    std::array<std::vector<size_t>, width_count> positions{};
+};
+
+} // namespace seqan3::detail
@@ -244,7 +244,7 @@ protected:
         {
             this->compute_column(*++alignment_matrix_it,
                                  *++indexed_matrix_it,
-                                 alphabet1,
+                                 this->scoring_scheme_profile_column(alphabet1),
                                  std::views::take(sequence2, ++row_size));
         }
 
@@ -257,7 +257,7 @@ protected:
         {
             compute_band_column(*++alignment_matrix_it,
                                 std::views::drop(*++indexed_matrix_it, first_row_index + 1),
-                                alphabet1,
+                                this->scoring_scheme_profile_column(alphabet1),
                                 views::slice(sequence2, first_row_index, ++row_size));
             ++first_row_index;
         }
@@ -0,0 +1,131 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides seqan3::detail::pairwise_alignment_algorithm_length_sorted.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <numeric>
+#include <ranges>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/pairwise/detail/concept.hpp>
+#include <seqan3/alignment/pairwise/detail/pairwise_alignment_batches.hpp>
+#include <seqan3/alignment/pairwise/detail/type_traits.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Sorts the sequence pairs of a chunk by length before they are distributed to the simd batches.
+ * \ingroup alignment_pairwise
+ * \implements std::invocable
+ *
+ * \tparam alignment_configuration_t The configuration type; must be of type seqan3::configuration.
+ * \tparam function_wrapper_t The type-erased alignment function the chunks are passed to.
+ *
+ * \details
+ *
+ * The inter-sequence alignment pads all sequences of a batch to the longest sequence of the batch. If
+ * seqan3::align_cfg::sort_by_length is configured, seqan3::align_pairwise passes chunks of the configured window size
+ * to this algorithm. The sequence pairs of a chunk are stably sorted by the length of their longer sequence and
+ * passed in batches of seqan3::detail::alignment_configuration_traits::alignments_per_vector pairs to the wrapped
+ * algorithm, such that every batch contains pairs of similar length. The results are reported in the order of the
+ * chunk.
+ */
+template <typename alignment_configuration_t, typename function_wrapper_t>
+    requires is_type_specialisation_of_v<alignment_configuration_t, configuration>
+class pairwise_alignment_algorithm_length_sorted
+{
+private:
+    //!\brief The alignment configuration traits type.
+    using traits_type = alignment_configuration_traits<alignment_configuration_t>;
+    //!\brief The configured alignment result type.
+    using alignment_result_type = typename traits_type::alignment_result_type;
+    //!\brief The buffer distributing the sequence pairs of a chunk to the batches.
+    using batches_type = pairwise_alignment_batches<alignment_configuration_t, function_wrapper_t>;
+
+    static_assert(traits_type::is_length_sorted, "Sorting by length requires align_cfg::sort_by_length.");
+
+public:
+    //!\copydoc seqan3::detail::pairwise_alignment_batches::batch_algorithm_type
+    using batch_algorithm_type = typename batches_type::batch_algorithm_type;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    pairwise_alignment_algorithm_length_sorted() = default; //!< Defaulted.
+    pairwise_alignment_algorithm_length_sorted(pairwise_alignment_algorithm_length_sorted const &) =
+        default; //!< Defaulted.
+    pairwise_alignment_algorithm_length_sorted(pairwise_alignment_algorithm_length_sorted &&) =
+        default; //!< Defaulted.
+    pairwise_alignment_algorithm_length_sorted &
+    operator=(pairwise_alignment_algorithm_length_sorted const &) = default; //!< Defaulted.
+    pairwise_alignment_algorithm_length_sorted &
+    operator=(pairwise_alignment_algorithm_length_sorted &&) = default; //!< Defaulted.
+    ~pairwise_alignment_algorithm_length_sorted() = default;            //!< Defaulted.
+
+    /*!\brief Constructs the algorithm from the configuration and the algorithm computing the batches.
+     * \param[in] config The alignment configuration.
+     * \param[in] batch_algorithm The algorithm computing a batch of sequence pairs of similar length.
+     */
+    pairwise_alignment_algorithm_length_sorted([[maybe_unused]] alignment_configuration_t const & config,
+                                               batch_algorithm_type batch_algorithm) :
+        batch_algorithm{std::move(batch_algorithm)}
+    {}
+    //!\}
+
+    /*!\brief Computes the alignments of the given chunk of indexed sequence pairs.
+     * \tparam indexed_sequence_pairs_t The type of indexed_sequence_pairs; must model
+     *                                  seqan3::detail::indexed_sequence_pair_range.
+     * \tparam callback_t The type of the callback function; must model std::invocable with the alignment result.
+     *
+     * \param[in] indexed_sequence_pairs The chunk of indexed sequence pairs to be aligned.
+     * \param[in] callback The callback function to be invoked with each computed alignment result.
+     */
+    template <indexed_sequence_pair_range indexed_sequence_pairs_t, typename callback_t>
+        requires std::invocable<callback_t, alignment_result_type>
+    void operator()(indexed_sequence_pairs_t && indexed_sequence_pairs, callback_t && callback)
+    {
+        using std::get;
+
+        batches.assign(std::forward<indexed_sequence_pairs_t>(indexed_sequence_pairs));
+
+        lengths.clear();
+        for (auto const & indexed_sequence_pair : batches.pairs())
+        {
+            size_t const size1 = std::ranges::distance(get<0>(get<0>(indexed_sequence_pair)));
+            size_t const size2 = std::ranges::distance(get<1>(get<0>(indexed_sequence_pair)));
+            lengths.emplace_back(std::max(size1, size2), std::min(size1, size2));
+        }
+
+        order.resize(lengths.size());
+        std::iota(order.begin(), order.end(), 0u);
+        std::ranges::stable_sort(order,
+                                 [&](size_t const lhs, size_t const rhs)
+                                 {
+                                     return lengths[lhs] < lengths[rhs];
+                                 });
+
+        batches.compute(order, traits_type::alignments_per_vector, batch_algorithm);
+        batches.report(std::forward<callback_t>(callback));
+    }
+
+private:
+    //!\brief The algorithm computing a batch of sequence pairs of similar length.
+    batch_algorithm_type batch_algorithm{};
+    //!\brief The sequence pairs and results of the current chunk.
+    batches_type batches{};
+    //!\brief The lengths of the longer and the shorter sequence of every pair of the current chunk.
+    std::vector<std::pair<size_t, size_t>> lengths{};
+    //!\brief The positions of the sequence pairs of the current chunk sorted by length.
+    std::vector<size_t> order{};
+};
+
+} // namespace seqan3::detail
@@ -0,0 +1,770 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides seqan3::detail::pairwise_alignment_algorithm_linear_memory.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <concepts>
+#include <iterator>
+#include <limits>
+#include <ranges>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_linear_memory_traceback.hpp>
+#include <seqan3/alignment/configuration/align_config_method.hpp>
+#include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
+#include <seqan3/alignment/matrix/detail/aligned_sequence_builder.hpp>
+#include <seqan3/alignment/matrix/detail/cigar_builder.hpp>
+#include <seqan3/alignment/matrix/detail/matrix_coordinate.hpp>
+#include <seqan3/alignment/matrix/detail/trace_directions.hpp>
+#include <seqan3/alignment/pairwise/detail/concept.hpp>
+#include <seqan3/alignment/pairwise/detail/type_traits.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief An iterator over a trace path that is stored as a sequence of trace directions.
+ * \ingroup alignment_pairwise
+ * \implements std::input_iterator
+ *
+ * \details
+ *
+ * Iterates the trace directions from the end of the alignment to its begin and keeps track of the current matrix
+ * coordinate, which is required by seqan3::detail::aligned_sequence_builder and seqan3::detail::cigar_builder.
+ */
+class linear_memory_trace_iterator
+{
+public:
+    //!\brief The value type.
+    using value_type = trace_directions;
+    //!\brief The reference type.
+    using reference = trace_directions;
+    //!\brief The difference type.
+    using difference_type = std::ptrdiff_t;
+    //!\brief The iterator concept.
+    using iterator_concept = std::input_iterator_tag;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    linear_memory_trace_iterator() = default;                                                 //!< Defaulted.
+    linear_memory_trace_iterator(linear_memory_trace_iterator const &) = default;             //!< Defaulted.
+    linear_memory_trace_iterator(linear_memory_trace_iterator &&) = default;                  //!< Defaulted.
+    linear_memory_trace_iterator & operator=(linear_memory_trace_iterator const &) = default; //!< Defaulted.
+    linear_memory_trace_iterator & operator=(linear_memory_trace_iterator &&) = default;      //!< Defaulted.
+    ~linear_memory_trace_iterator() = default;                                                //!< Defaulted.
+
+    /*!\brief Constructs the iterator from the trace directions in alignment order and the end coordinate.
+     * \param[in] directions The trace directions from the begin to the end of the alignment.
+     * \param[in] end_coordinate The matrix coordinate of the alignment end.
+     */
+    linear_memory_trace_iterator(std::vector<trace_directions> const & directions,
+                                 matrix_coordinate const end_coordinate) noexcept :
+        current{directions.rbegin()},
+        last{directions.rend()},
+        current_coordinate{end_coordinate}
+    {}
+    //!\}
+
+    //!\brief Returns the current trace direction.
+    reference operator*() const noexcept
+    {
+        return *current;
+    }
+
+    //!\brief Moves to the preceding matrix cell on the trace path.
+    linear_memory_trace_iterator & operator++() noexcept
+    {
+        if (*current != trace_directions::left)
+            --current_coordinate.row;
+        if (*current != trace_directions::up)
+            --current_coordinate.col;
+
+        ++current;
+        return *this;
+    }
+
+    //!\brief Moves to the preceding matrix cell on the trace path.
+    void operator++(int) noexcept
+    {
+        ++(*this);
+    }
+
+    //!\brief Returns the matrix coordinate of the current cell.
+    matrix_coordinate coordinate() const noexcept
+    {
+        return current_coordinate;
+    }
+
+    //!\brief Returns whether the begin of the alignment was reached.
+    friend bool operator==(linear_memory_trace_iterator const & it, std::default_sentinel_t const &) noexcept
+    {
+        return it.current == it.last;
+    }
+
+private:
+    //!\brief The current trace direction.
+    std::vector<trace_directions>::const_reverse_iterator current{};
+    //!\brief The end of the trace directions.
+    std::vector<trace_directions>::const_reverse_iterator last{};
+    //!\brief The current matrix coordinate.
+    matrix_coordinate current_coordinate{};
+};
+
+/*!\brief Computes alignments with traceback in linear memory (Myers and Miller, 1988).
+ * \ingroup alignment_pairwise
+ * \implements std::invocable
+ *
+ * \tparam alignment_configuration_t The configuration type; must be of type seqan3::configuration.
+ * \tparam full_algorithm_t The alignment algorithm storing the full trace matrix.
+ *
+ * \details
+ *
+ * Chunks in which every sequence pair has a matrix of at most
+ * seqan3::align_cfg::linear_memory_traceback::min_matrix_size cells are forwarded to `full_algorithm_t`. Otherwise
+ * every pair of the chunk is computed in \f$O(n + m)\f$ memory in up to three steps:
+ *
+ * 1. A score-only pass over the matrix determines the score and the end position. It tracks the optimum in the same
+ *    order and with the same tie breaking as the algorithm it replaces.
+ * 2. If the alignment may start anywhere but in the origin (local alignment or free leading gaps), a score-only pass
+ *    over the reversed prefixes, anchored at the end position, determines the begin position closest to the end.
+ * 3. If the alignment is requested, the global alignment between the begin and the end position is computed by the
+ *    divide-and-conquer algorithm of Myers and Miller for affine gap costs.
+ */
+template <typename alignment_configuration_t, typename full_algorithm_t>
+    requires is_type_specialisation_of_v<alignment_configuration_t, configuration>
+class pairwise_alignment_algorithm_linear_memory
+{
+private:
+    //!\brief The alignment configuration traits type.
+    using traits_type = alignment_configuration_traits<alignment_configuration_t>;
+    //!\brief The scalar score type.
+    using score_type = typename traits_type::original_score_type;
+    //!\brief The configured alignment result type.
+    using alignment_result_type = typename traits_type::alignment_result_type;
+    //!\brief The scalar scoring scheme type.
+    using scoring_scheme_type = std::remove_cvref_t<typename traits_type::scoring_scheme_type>;
+
+    static_assert(!traits_type::is_banded && traits_type::requires_trace_information,
+                  "The linear memory traceback is only computed for unbanded alignments with trace back.");
+
+    /*!\brief Whether the replaced algorithm is seqan3::detail::alignment_algorithm.
+     *
+     * \details
+     *
+     * It reports the first optimal cell instead of the last one and, in the scalar case, uses a gap open score of 0
+     * if no gap costs are configured.
+     */
+    static constexpr bool replaces_alignment_algorithm =
+        traits_type::is_local || traits_type::compute_sequence_alignment || traits_type::compute_cigar
+        || traits_type::is_vectorised;
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    pairwise_alignment_algorithm_linear_memory() = default; //!< Defaulted.
+    pairwise_alignment_algorithm_linear_memory(pairwise_alignment_algorithm_linear_memory const &) =
+        default; //!< Defaulted.
+    pairwise_alignment_algorithm_linear_memory(pairwise_alignment_algorithm_linear_memory &&) =
+        default; //!< Defaulted.
+    pairwise_alignment_algorithm_linear_memory &
+    operator=(pairwise_alignment_algorithm_linear_memory const &) = default; //!< Defaulted.
+    pairwise_alignment_algorithm_linear_memory &
+    operator=(pairwise_alignment_algorithm_linear_memory &&) = default; //!< Defaulted.
+    ~pairwise_alignment_algorithm_linear_memory() = default;            //!< Defaulted.
+
+    /*!\brief Constructs the algorithm from the configuration and the algorithm storing the full trace matrix.
+     * \param[in] config The alignment configuration.
+     * \param[in] full_algorithm The algorithm computing the chunks with small matrices.
+     */
+    pairwise_alignment_algorithm_linear_memory(alignment_configuration_t const & config,
+                                               full_algorithm_t full_algorithm) :
+        full_algorithm{std::move(full_algorithm)},
+        scoring_scheme{seqan3::get<align_cfg::scoring_scheme>(config).scheme}
+    {
+        align_cfg::linear_memory_traceback const default_linear_memory{
+            align_cfg::linear_memory_traceback::default_min_matrix_size};
+        min_matrix_size = config.get_or(default_linear_memory).min_matrix_size;
+
+        int32_t const default_open_score = (replaces_alignment_algorithm && !traits_type::is_vectorised) ? 0 : -10;
+        auto const & gap_scheme = config.get_or(
+            align_cfg::gap_cost_affine{align_cfg::open_score{default_open_score}, align_cfg::extension_score{-1}});
+        gap_open_score = static_cast<score_type>(gap_scheme.open_score);
+        gap_extension_score = static_cast<score_type>(gap_scheme.extension_score);
+
+        if constexpr (traits_type::is_global)
+        {
+            auto const & method_global_config = config.get_or(align_cfg::method_global{});
+            first_row_is_free = method_global_config.free_end_gaps_sequence1_leading;
+            first_column_is_free = method_global_config.free_end_gaps_sequence2_leading;
+            last_row_is_free = method_global_config.free_end_gaps_sequence1_trailing;
+            last_column_is_free = method_global_config.free_end_gaps_sequence2_trailing;
+        }
+    }
+    //!\}
+
+    /*!\brief Computes the alignments of the given chunk of indexed sequence pairs.
+     * \tparam indexed_sequence_pairs_t The type of indexed_sequence_pairs; must model
+     *                                  seqan3::detail::indexed_sequence_pair_range.
+     * \tparam callback_t The type of the callback function; must model std::invocable with the alignment result.
+     *
+     * \param[in] indexed_sequence_pairs The chunk of indexed sequence pairs to be aligned.
+     * \param[in] callback The callback function to be invoked with each computed alignment result.
+     *
+     * \details
+     *
+     * If the matrix of any pair in the chunk exceeds the size threshold, all pairs of the chunk are computed in linear
+     * memory one after another. Otherwise the chunk is forwarded to the algorithm storing the full trace matrix.
+     */
+    template <indexed_sequence_pair_range indexed_sequence_pairs_t, typename callback_t>
+        requires std::invocable<callback_t, alignment_result_type>
+    void operator()(indexed_sequence_pairs_t && indexed_sequence_pairs, callback_t && callback)
+    {
+        using std::get;
+
+        bool exceeds_threshold = false;
+        for (auto && [sequence_pair, idx] : indexed_sequence_pairs)
+        {
+            uint64_t const sequence1_size = std::ranges::distance(get<0>(sequence_pair));
+            uint64_t const sequence2_size = std::ranges::distance(get<1>(sequence_pair));
+            exceeds_threshold |= (sequence1_size + 1) * (sequence2_size + 1) > min_matrix_size;
+        }
+
+        if (!exceeds_threshold)
+        {
+            full_algorithm(std::forward<indexed_sequence_pairs_t>(indexed_sequence_pairs),
+                           std::forward<callback_t>(callback));
+            return;
+        }
+
+        for (auto && [sequence_pair, idx] : indexed_sequence_pairs)
+        {
+            compute_pair(get<0>(sequence_pair), get<1>(sequence_pair));
+            make_result_and_invoke(get<0>(sequence_pair), get<1>(sequence_pair), std::move(idx), callback);
+        }
+    }
+
+private:
+    /*!\brief Computes score, end and begin position and, if requested, the trace of a single pair.
+     * \param[in] sequence1 The first sequence (horizontal).
+     * \param[in] sequence2 The second sequence (vertical).
+     */
+    template <typename sequence1_t, typename sequence2_t>
+    void compute_pair(sequence1_t && sequence1, sequence2_t && sequence2)
+    {
+        std::vector<std::ranges::range_value_t<sequence1_t>> letters1(std::ranges::begin(sequence1),
+                                                                      std::ranges::end(sequence1));
+        std::vector<std::ranges::range_value_t<sequence2_t>> letters2(std::ranges::begin(sequence2),
+                                                                      std::ranges::end(sequence2));
+
+        compute_optimum(letters1, letters2);
+
+        begin_column = 0;
+        begin_row = 0;
+        if (traits_type::is_local || first_row_is_free || first_column_is_free)
+            compute_begin(letters1, letters2);
+
+        trace.clear();
+        if constexpr (traits_type::compute_sequence_alignment || traits_type::compute_cigar)
+        {
+            size_t const column_count = end_column - begin_column;
+            cc.resize(column_count + 1);
+            dd.resize(column_count + 1);
+            rr.resize(column_count + 1);
+            ss.resize(column_count + 1);
+            compute_trace(letters1, letters2, begin_row, end_row - begin_row, begin_column, column_count,
+                          gap_open_score, gap_open_score);
+        }
+    }
+
+    /*!\brief Computes the optimal score and the end position with a score-only pass over the matrix.
+     * \param[in] sequence1 The first sequence.
+     * \param[in] sequence2 The second sequence.
+     */
+    template <typename sequence1_t, typename sequence2_t>
+    void compute_optimum(sequence1_t const & sequence1, sequence2_t const & sequence2)
+    {
+        size_t const sequence1_size = sequence1.size();
+        size_t const sequence2_size = sequence2.size();
+        score_type const gap_first = gap_open_score + gap_extension_score;
+
+        h_column.resize(sequence2_size + 1);
+        e_column.resize(sequence2_size + 1);
+
+        optimal_score = std::numeric_limits<score_type>::lowest();
+        end_column = 0;
+        end_row = 0;
+
+        h_column[0] = 0;
+        for (size_t row = 1; row <= sequence2_size; ++row)
+        {
+            h_column[row] = (traits_type::is_local || first_column_is_free) ? 0 : gap_score(row);
+            e_column[row] = h_column[row] + gap_first;
+        }
+
+        if constexpr (traits_type::is_local)
+        {
+            for (size_t row = 0; row <= sequence2_size; ++row)
+                update_optimum(h_column[row], 0, row);
+        }
+        else if (last_row_is_free)
+        {
+            update_optimum(h_column[sequence2_size], 0, sequence2_size);
+        }
+
+        for (size_t column = 1; column <= sequence1_size; ++column)
+        {
+            auto const & letter1 = sequence1[column - 1];
+            score_type diagonal = h_column[0];
+            h_column[0] = (traits_type::is_local || first_row_is_free) ? 0 : gap_score(column);
+            score_type vertical = h_column[0] + gap_first;
+
+            for (size_t row = 1; row <= sequence2_size; ++row)
+            {
+                score_type best = diagonal + static_cast<score_type>(scoring_scheme.score(letter1, sequence2[row - 1]));
+                best = std::max(best, std::max(e_column[row], vertical));
+                if constexpr (traits_type::is_local)
+                {
+                    best = std::max<score_type>(best, 0);
+                    update_optimum(best, column, row);
+                }
+
+                diagonal = h_column[row];
+                h_column[row] = best;
+                e_column[row] = std::max<score_type>(e_column[row] + gap_extension_score, best + gap_first);
+                vertical = std::max<score_type>(vertical + gap_extension_score, best + gap_first);
+            }
+
+            if (!traits_type::is_local && last_row_is_free)
+                update_optimum(h_column[sequence2_size], column, sequence2_size);
+        }
+
+        if constexpr (traits_type::is_global)
+        {
+            if (last_column_is_free)
+            {
+                for (size_t row = 0; row <= sequence2_size; ++row)
+                    update_optimum(h_column[row], sequence1_size, row);
+            }
+
+            if (!last_row_is_free && !last_column_is_free)
+            {
+                optimal_score = h_column[sequence2_size];
+                end_column = sequence1_size;
+                end_row = sequence2_size;
+            }
+        }
+    }
+
+    /*!\brief Computes the begin position with a score-only pass over the reversed prefixes ending in the end position.
+     * \param[in] sequence1 The first sequence.
+     * \param[in] sequence2 The second sequence.
+     *
+     * \details
+     *
+     * Every cell whose alignment to the end position reaches the optimal score is a valid begin position. Of all valid
+     * begin positions, the one visited first, i.e. the one closest to the end position, is chosen. For global
+     * alignments, only cells in the first row or column (if leading gaps are free there) or the origin are valid.
+     */
+    template <typename sequence1_t, typename sequence2_t>
+    void compute_begin(sequence1_t const & sequence1, sequence2_t const & sequence2)
+    {
+        score_type const gap_first = gap_open_score + gap_extension_score;
+
+        auto is_begin = [&](score_type const score, size_t const column, size_t const row)
+        {
+            if (score != optimal_score)
+                return false;
+
+            if constexpr (traits_type::is_local)
+                return true;
+            else
+                return (row == 0 && (first_row_is_free || column == 0)) || (column == 0 && first_column_is_free);
+        };
+
+        h_column[0] = 0;
+        for (size_t offset = 1; offset <= end_row; ++offset)
+        {
+            h_column[offset] = gap_score(offset);
+            e_column[offset] = h_column[offset] + gap_first;
+        }
+
+        for (size_t offset = 0; offset <= end_row; ++offset)
+        {
+            if (is_begin(h_column[offset], end_column, end_row - offset))
+            {
+                begin_column = end_column;
+                begin_row = end_row - offset;
+                return;
+            }
+        }
+
+        for (size_t column_offset = 1; column_offset <= end_column; ++column_offset)
+        {
+            size_t const column = end_column - column_offset;
+            auto const & letter1 = sequence1[column];
+            score_type diagonal = h_column[0];
+            h_column[0] = gap_score(column_offset);
+            score_type vertical = h_column[0] + gap_first;
+
+            if (is_begin(h_column[0], column, end_row))
+            {
+                begin_column = column;
+                begin_row = end_row;
+                return;
+            }
+
+            for (size_t offset = 1; offset <= end_row; ++offset)
+            {
+                size_t const row = end_row - offset;
+                score_type best = diagonal + static_cast<score_type>(scoring_scheme.score(letter1, sequence2[row]));
+                best = std::max(best, std::max(e_column[offset], vertical));
+
+                diagonal = h_column[offset];
+                h_column[offset] = best;
+                e_column[offset] = std::max<score_type>(e_column[offset] + gap_extension_score, best + gap_first);
+                vertical = std::max<score_type>(vertical + gap_extension_score, best + gap_first);
+
+                if (is_begin(best, column, row))
+                {
+                    begin_column = column;
+                    begin_row = row;
+                    return;
+                }
+            }
+        }
+    }
+
+    /*!\brief Appends the trace of an optimal global alignment of two infixes (Myers and Miller, 1988).
+     * \param[in] sequence1 The first sequence.
+     * \param[in] sequence2 The second sequence.
+     * \param[in] row_begin The begin of the infix of the second sequence.
+     * \param[in] row_count The length of the infix of the second sequence.
+     * \param[in] column_begin The begin of the infix of the first sequence.
+     * \param[in] column_count The length of the infix of the first sequence.
+     * \param[in] open_begin The gap open score of a vertical gap at the begin (0 if it continues a gap).
+     * \param[in] open_end The gap open score of a vertical gap at the end (0 if it continues a gap).
+     *
+     * \details
+     *
+     * Splits the second infix in the middle row, computes the forward scores of the upper half and the backward
+     * scores of the lower half and splits the first infix in the column that maximises the sum. If the optimum is a
+     * vertical gap that spans the middle row, the two letters around the middle row are aligned to gaps and the gap
+     * open score is only counted once.
+     */
+    template <typename sequence1_t, typename sequence2_t>
+    void compute_trace(sequence1_t const & sequence1,
+                       sequence2_t const & sequence2,
+                       size_t const row_begin,
+                       size_t const row_count,
+                       size_t const column_begin,
+                       size_t const column_count,
+                       score_type const open_begin,
+                       score_type const open_end)
+    {
+        score_type const g = gap_open_score;
+        score_type const h = gap_extension_score;
+
+        if (column_count == 0)
+        {
+            trace.insert(trace.end(), row_count, trace_directions::up);
+            return;
+        }
+
+        if (row_count == 0)
+        {
+            trace.insert(trace.end(), column_count, trace_directions::left);
+            return;
+        }
+
+        auto const score = [&](size_t const row, size_t const column)
+        {
+            return static_cast<score_type>(scoring_scheme.score(sequence1[column], sequence2[row]));
+        };
+
+        if (row_count == 1)
+        {
+            // Either the single letter is aligned to a gap or to one of the letters of the first infix.
+            score_type best = std::max(open_begin, open_end) + h + gap_score(column_count);
+            size_t best_column = 0;
+            for (size_t column = 1; column <= column_count; ++column)
+            {
+                score_type const current = gap_score(column - 1) + score(row_begin, column_begin + column - 1)
+                                         + gap_score(column_count - column);
+                if (current > best)
+                {
+                    best = current;
+                    best_column = column;
+                }
+            }
+
+            if (best_column == 0)
+            {
+                if (open_begin >= open_end)
+                    trace.push_back(trace_directions::up);
+                trace.insert(trace.end(), column_count, trace_directions::left);
+                if (open_begin < open_end)
+                    trace.push_back(trace_directions::up);
+            }
+            else
+            {
+                trace.insert(trace.end(), best_column - 1, trace_directions::left);
+                trace.push_back(trace_directions::diagonal);
+                trace.insert(trace.end(), column_count - best_column, trace_directions::left);
+            }
+            return;
+        }
+
+        size_t const middle_row = row_count / 2;
+
+        // Forward scores of the upper half: cc is the best score, dd the best score ending in a vertical gap.
+        score_type t = g;
+        cc[0] = 0;
+        for (size_t column = 1; column <= column_count; ++column)
+        {
+            t += h;
+            cc[column] = t;
+            dd[column] = t + g;
+        }
+
+        t = open_begin;
+        for (size_t row = 1; row <= middle_row; ++row)
+        {
+            score_type diagonal = cc[0];
+            t += h;
+            score_type current = t;
+            cc[0] = current;
+            score_type horizontal = t + g;
+
+            for (size_t column = 1; column <= column_count; ++column)
+            {
+                horizontal = std::max<score_type>(horizontal, current + g) + h;
+                dd[column] = std::max<score_type>(dd[column], cc[column] + g) + h;
+                score_type const match = diagonal + score(row_begin + row - 1, column_begin + column - 1);
+                current = std::max(std::max(dd[column], horizontal), match);
+                diagonal = cc[column];
+                cc[column] = current;
+            }
+        }
+        dd[0] = cc[0];
+
+        // Backward scores of the lower half: rr is the best score, ss the best score starting with a vertical gap.
+        t = g;
+        rr[column_count] = 0;
+        for (size_t column = column_count; column-- > 0;)
+        {
+            t += h;
+            rr[column] = t;
+            ss[column] = t + g;
+        }
+
+        t = open_end;
+        for (size_t row = row_count; row > middle_row; --row)
+        {
+            score_type diagonal = rr[column_count];
+            t += h;
+            score_type current = t;
+            rr[column_count] = current;
+            score_type horizontal = t + g;
+
+            for (size_t column = column_count; column-- > 0;)
+            {
+                horizontal = std::max<score_type>(horizontal, current + g) + h;
+                ss[column] = std::max<score_type>(ss[column], rr[column] + g) + h;
+                score_type const match = diagonal + score(row_begin + row - 1, column_begin + column);
+                current = std::max(std::max(ss[column], horizontal), match);
+                diagonal = rr[column];
+                rr[column] = current;
+            }
+        }
+        ss[column_count] = rr[column_count];
+
+        // Find the column in which the optimal alignment crosses the middle row.
+        score_type best = cc[0] + rr[0];
+        size_t best_column = 0;
+        bool spans_middle_row = false;
+        for (size_t column = 0; column <= column_count; ++column)
+        {
+            if (score_type const current = cc[column] + rr[column]; current > best)
+            {
+                best = current;
+                best_column = column;
+                spans_middle_row = false;
+            }
+
+            if (score_type const current = dd[column] + ss[column] - g; current > best)
+            {
+                best = current;
+                best_column = column;
+                spans_middle_row = true;
+            }
+        }
+
+        if (!spans_middle_row)
+        {
+            compute_trace(sequence1, sequence2, row_begin, middle_row, column_begin, best_column, open_begin, g);
+            compute_trace(sequence1,
+                          sequence2,
+                          row_begin + middle_row,
+                          row_count - middle_row,
+                          column_begin + best_column,
+                          column_count - best_column,
+                          g,
+                          open_end);
+        }
+        else
+        {
+            compute_trace(sequence1, sequence2, row_begin, middle_row - 1, column_begin, best_column, open_begin, 0);
+            trace.insert(trace.end(), 2, trace_directions::up);
+            compute_trace(sequence1,
+                          sequence2,
+                          row_begin + middle_row + 1,
+                          row_count - middle_row - 1,
+                          column_begin + best_column,
+                          column_count - best_column,
+                          0,
+                          open_end);
+        }
+    }
+
+    /*!\brief Builds the alignment result of the last computed pair and invokes the callback.
+     * \param[in] sequence1 The first sequence.
+     * \param[in] sequence2 The second sequence.
+     * \param[in] id The id of the sequence pair.
+     * \param[in] callback The callback to invoke with the result.
+     */
+    template <typename sequence1_t, typename sequence2_t, typename index_t, typename callback_t>
+    void make_result_and_invoke(sequence1_t && sequence1,
+                                sequence2_t && sequence2,
+                                [[maybe_unused]] index_t && id,
+                                callback_t & callback)
+    {
+        using result_value_type = typename alignment_result_value_type_accessor<alignment_result_type>::type;
+
+        result_value_type result{};
+
+        if constexpr (traits_type::output_sequence1_id)
+            result.sequence1_id = id;
+
+        if constexpr (traits_type::output_sequence2_id)
+            result.sequence2_id = id;
+
+        if constexpr (traits_type::compute_score)
+            result.score = optimal_score;
+
+        if constexpr (traits_type::compute_end_positions)
+        {
+            result.end_positions.first = end_column;
+            result.end_positions.second = end_row;
+        }
+
+        if constexpr (traits_type::compute_begin_positions)
+        {
+            result.begin_positions.first = begin_column;
+            result.begin_positions.second = begin_row;
+        }
+
+        if constexpr (traits_type::compute_sequence_alignment)
+        {
+            matrix_coordinate const end_coordinate{row_index_type{end_row}, column_index_type{end_column}};
+            std::ranges::subrange<linear_memory_trace_iterator, std::default_sentinel_t> trace_path{
+                linear_memory_trace_iterator{trace, end_coordinate},
+                std::default_sentinel};
+
+            aligned_sequence_builder builder{sequence1, sequence2};
+            result.alignment = std::move(builder(trace_path).alignment);
+        }
+
+        if constexpr (traits_type::compute_cigar)
+        {
+            matrix_coordinate const end_coordinate{row_index_type{end_row}, column_index_type{end_column}};
+            std::ranges::subrange<linear_memory_trace_iterator, std::default_sentinel_t> trace_path{
+                linear_memory_trace_iterator{trace, end_coordinate},
+                std::default_sentinel};
+
+            result.cigar_sequence = std::move(cigar_sequence_builder(trace_path).cigar_sequence);
+        }
+
+        callback(std::move(result));
+    }
+
+    /*!\brief Replaces the optimum with the given cell according to the tie breaking of the replaced algorithm.
+     * \param[in] score The score of the cell.
+     * \param[in] column The column index of the cell.
+     * \param[in] row The row index of the cell.
+     */
+    void update_optimum(score_type const score, size_t const column, size_t const row) noexcept
+    {
+        if (replaces_alignment_algorithm ? (score > optimal_score) : (score >= optimal_score))
+        {
+            optimal_score = score;
+            end_column = column;
+            end_row = row;
+        }
+    }
+
+    /*!\brief Returns the score of a gap of the given length.
+     * \param[in] length The length of the gap.
+     */
+    score_type gap_score(size_t const length) const noexcept
+    {
+        return (length == 0) ? 0 : gap_open_score + static_cast<score_type>(length) * gap_extension_score;
+    }
+
+    //!\brief The algorithm computing the chunks with small matrices.
+    full_algorithm_t full_algorithm{};
+    //!\brief The scalar scoring scheme.
+    scoring_scheme_type scoring_scheme{};
+    //!\brief The number of matrix cells above which the traceback is computed in linear memory.
+    uint64_t min_matrix_size{};
+    //!\brief The gap open score (without the gap extension score).
+    score_type gap_open_score{};
+    //!\brief The gap extension score.
+    score_type gap_extension_score{};
+    //!\brief Whether leading gaps in the first sequence are free.
+    bool first_row_is_free{false};
+    //!\brief Whether leading gaps in the second sequence are free.
+    bool first_column_is_free{false};
+    //!\brief Whether trailing gaps in the first sequence are free.
+    bool last_row_is_free{false};
+    //!\brief Whether trailing gaps in the second sequence are free.
+    bool last_column_is_free{false};
+
+    //!\brief The optimal scores of the current column of the score-only passes.
+    std::vector<score_type> h_column{};
+    //!\brief The horizontal gap scores of the current column of the score-only passes.
+    std::vector<score_type> e_column{};
+    //!\brief The forward scores of the divide-and-conquer step.
+    std::vector<score_type> cc{};
+    //!\brief The forward scores ending in a vertical gap of the divide-and-conquer step.
+    std::vector<score_type> dd{};
+    //!\brief The backward scores of the divide-and-conquer step.
+    std::vector<score_type> rr{};
+    //!\brief The backward scores starting with a vertical gap of the divide-and-conquer step.
+    std::vector<score_type> ss{};
+    //!\brief The trace directions from the begin to the end of the alignment.
+    std::vector<trace_directions> trace{};
+    //!\brief Builds the CIGAR sequence from the trace and keeps its buffer between the pairs.
+    cigar_builder cigar_sequence_builder{};
+
+    //!\brief The optimal score.
+    score_type optimal_score{};
+    //!\brief The column index of the alignment end.
+    size_t end_column{};
+    //!\brief The row index of the alignment end.
+    size_t end_row{};
+    //!\brief The column index of the alignment begin.
+    size_t begin_column{};
+    //!\brief The row index of the alignment begin.
+    size_t begin_row{};
+};
+
+} // namespace seqan3::detail
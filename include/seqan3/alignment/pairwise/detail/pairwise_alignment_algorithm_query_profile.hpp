@@ -0,0 +1,357 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides seqan3::detail::pairwise_alignment_algorithm_query_profile.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <concepts>
+#include <limits>
+#include <ranges>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
+#include <seqan3/alignment/matrix/detail/matrix_coordinate.hpp>
+#include <seqan3/alignment/pairwise/detail/concept.hpp>
+#include <seqan3/alignment/pairwise/detail/policy_alignment_result_builder.hpp>
+#include <seqan3/alignment/pairwise/detail/policy_striped_kernel.hpp>
+#include <seqan3/alignment/pairwise/detail/type_traits.hpp>
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/core/detail/empty_type.hpp>
+#include <seqan3/utility/simd/algorithm.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Aligns the second sequences of many pairs against a striped query profile of their shared first sequence.
+ * \ingroup alignment_pairwise
+ * \implements std::invocable
+ *
+ * \tparam alignment_configuration_t The configuration type; must be of type seqan3::configuration.
+ * \tparam batch_algorithm_t The inter-sequence alignment algorithm used for chunks containing an empty sequence.
+ *
+ * \details
+ *
+ * This algorithm is used if seqan3::align_cfg::query_profile is configured. The first sequence of a pair is the
+ * query. It is split into seqan3::simd::simd_traits::length segments, one per lane, and a striped query profile stores
+ * for every letter of the second sequence `ceil(n / length)` vectors with the scores of the query positions against
+ * this letter. The profile is computed lazily per letter and kept as long as the following pairs share the same first
+ * sequence, such that aligning the query against many second sequences only loads precomputed score vectors.
+ *
+ * Compared to seqan3::detail::pairwise_alignment_algorithm_striped the matrix is computed row by row, i.e. once per
+ * letter of the second sequence, by the same seqan3::detail::policy_striped_kernel. The recursion is symmetric, hence all cells have the same scores as in the column-wise computation. The optimum is
+ * selected like in the scalar algorithms: in the local alignment the cell with the smallest column and then the
+ * smallest row among all optimal cells, in the global alignment with free end-gaps the last of the tracked cells in
+ * the order of the scalar algorithm.
+ *
+ * The kernel supports global and local alignments with affine gap costs that output the score and the end positions.
+ * Every chunk containing an empty sequence is forwarded to `batch_algorithm_t`.
+ */
+template <typename alignment_configuration_t, typename batch_algorithm_t>
+    requires is_type_specialisation_of_v<alignment_configuration_t, configuration>
+class pairwise_alignment_algorithm_query_profile :
+    protected policy_alignment_result_builder<alignment_configuration_t>,
+    protected policy_striped_kernel<alignment_configuration_t>
+{
+private:
+    //!\brief The striped kernel type.
+    using kernel_type = policy_striped_kernel<alignment_configuration_t>;
+    //!\brief The alignment configuration traits type.
+    using typename kernel_type::traits_type;
+    //!\brief The simd vector type holding the scores of one segment of the query.
+    using typename kernel_type::score_type;
+    //!\brief The scalar score type.
+    using typename kernel_type::scalar_score_type;
+    //!\brief The type of a row of simd vectors.
+    using score_row_type = typename kernel_type::score_line_type;
+    //!\brief The configured alignment result type.
+    using alignment_result_type = typename traits_type::alignment_result_type;
+    //!\brief The scalar scoring scheme type used to build the query profile.
+    using scoring_scheme_type = std::remove_cvref_t<typename traits_type::scoring_scheme_type>;
+
+    static_assert(traits_type::is_query_profile, "The query profile requires align_cfg::query_profile.");
+
+    using kernel_type::lanes;
+    //!\brief Marks a letter of the second sequence without query profile.
+    static constexpr size_t no_profile = std::numeric_limits<size_t>::max();
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    pairwise_alignment_algorithm_query_profile() = default; //!< Defaulted.
+    pairwise_alignment_algorithm_query_profile(pairwise_alignment_algorithm_query_profile const &) =
+        default; //!< Defaulted.
+    pairwise_alignment_algorithm_query_profile(pairwise_alignment_algorithm_query_profile &&) =
+        default; //!< Defaulted.
+    pairwise_alignment_algorithm_query_profile &
+    operator=(pairwise_alignment_algorithm_query_profile const &) = default; //!< Defaulted.
+    pairwise_alignment_algorithm_query_profile &
+    operator=(pairwise_alignment_algorithm_query_profile &&) = default; //!< Defaulted.
+    ~pairwise_alignment_algorithm_query_profile() = default;            //!< Defaulted.
+
+    /*!\brief Constructs the algorithm from the configuration and the inter-sequence algorithm.
+     * \param[in] config The alignment configuration.
+     * \param[in] batch_algorithm The algorithm computing the chunks that contain an empty sequence.
+     */
+    pairwise_alignment_algorithm_query_profile(alignment_configuration_t const & config,
+                                               batch_algorithm_t batch_algorithm) :
+        policy_alignment_result_builder<alignment_configuration_t>{config},
+        kernel_type{config},
+        batch_algorithm{std::move(batch_algorithm)},
+        scoring_scheme{seqan3::get<align_cfg::scoring_scheme>(config).scheme}
+    {}
+    //!\}
+
+    /*!\brief Computes the alignments of the given chunk of indexed sequence pairs.
+     * \tparam indexed_sequence_pairs_t The type of indexed_sequence_pairs; must model
+     *                                  seqan3::detail::indexed_sequence_pair_range.
+     * \tparam callback_t The type of the callback function; must model std::invocable with the alignment result.
+     *
+     * \param[in] indexed_sequence_pairs The chunk of indexed sequence pairs to be aligned.
+     * \param[in] callback The callback function to be invoked with each computed alignment result.
+     *
+     * \details
+     *
+     * The pairs are aligned one after another against the query profile of their first sequence. A chunk containing
+     * an empty sequence is forwarded to the inter-sequence algorithm.
+     */
+    template <indexed_sequence_pair_range indexed_sequence_pairs_t, typename callback_t>
+        requires std::invocable<callback_t, alignment_result_type>
+    void operator()(indexed_sequence_pairs_t && indexed_sequence_pairs, callback_t && callback)
+    {
+        using std::get;
+        using sequence_pair_t = std::remove_cvref_t<decltype(get<0>(*std::ranges::begin(indexed_sequence_pairs)))>;
+        using alphabet1_t = std::ranges::range_value_t<std::tuple_element_t<0, sequence_pair_t>>;
+        using alphabet2_t = std::ranges::range_value_t<std::tuple_element_t<1, sequence_pair_t>>;
+
+        if constexpr (writable_semialphabet<alphabet1_t> && semialphabet<alphabet2_t>
+                      && alphabet_size<alphabet2_t> <= 256)
+        {
+            auto has_empty_sequence = [](auto && indexed_sequence_pair)
+            {
+                auto && sequence_pair = get<0>(indexed_sequence_pair);
+                return std::ranges::empty(get<0>(sequence_pair)) || std::ranges::empty(get<1>(sequence_pair));
+            };
+
+            if (std::ranges::none_of(indexed_sequence_pairs, has_empty_sequence))
+            {
+                for (auto && [sequence_pair, idx] : indexed_sequence_pairs)
+                {
+                    compute_against_profile(get<0>(sequence_pair), get<1>(sequence_pair));
+                    matrix_coordinate coordinate{row_index_type{this->optimal_row},
+                                                 column_index_type{this->optimal_column}};
+                    this->make_result_and_invoke(std::forward<decltype(sequence_pair)>(sequence_pair),
+                                                 std::move(idx),
+                                                 this->optimal_score,
+                                                 std::move(coordinate),
+                                                 empty_type{},
+                                                 callback);
+                }
+                return;
+            }
+        }
+
+        batch_algorithm(std::forward<indexed_sequence_pairs_t>(indexed_sequence_pairs),
+                        std::forward<callback_t>(callback));
+    }
+
+private:
+    /*!\brief Computes the matrix row by row and tracks the optimum.
+     * \param[in] sequence1 The first sequence, i.e. the query (horizontal, split into the striped segments).
+     * \param[in] sequence2 The second sequence (vertical).
+     */
+    template <typename sequence1_t, typename sequence2_t>
+    void compute_against_profile(sequence1_t && sequence1, sequence2_t && sequence2)
+    {
+        initialise_query(sequence1);
+        initialise_first_row();
+
+        // Updates the maximum of a segment vector and the row in which it was reached first.
+        score_type row{};
+        auto track_column_maximum = [&](size_t const k, score_type const & score)
+        {
+            auto const is_better = column_maximum[k] < score;
+            column_maximum[k] = is_better ? score : column_maximum[k];
+            column_maximum_row[k] = is_better ? row : column_maximum_row[k];
+        };
+
+        size_t row_index = 0;
+        for (auto const & letter : sequence2)
+        {
+            ++row_index;
+            row = simd::fill<score_type>(static_cast<scalar_score_type>(row_index));
+            size_t const offset = profile_offset<sequence1_t>(letter); // Might reallocate the profile.
+            this->compute_line(profile.data() + offset,
+                               this->first_column_score(row_index - 1),
+                               this->first_column_score(row_index),
+                               track_column_maximum);
+
+            if constexpr (traits_type::is_global)
+            {
+                if (this->last_column_is_free)
+                    last_column_scores.push_back(this->line_score(query_size - 1));
+            }
+        }
+
+        if constexpr (traits_type::is_local)
+            select_local_optimum();
+        else
+            select_global_optimum(row_index);
+    }
+
+    /*!\brief Selects the cell with the smallest column and then the smallest row among all cells with optimal score.
+     *
+     * \details
+     *
+     * This is the first optimal cell in the column-wise order of the scalar algorithm. The maximum of every column is
+     * tracked together with the first row reaching it; the padding columns are ignored.
+     */
+    void select_local_optimum() noexcept
+    {
+        for (size_t position = 0; position < query_size; ++position)
+        {
+            size_t const k = position % this->segment_count;
+            size_t const lane = position / this->segment_count;
+            if (column_maximum[k][lane] > this->optimal_score)
+            {
+                this->optimal_score = column_maximum[k][lane];
+                this->optimal_column = position + 1;
+                this->optimal_row = column_maximum_row[k][lane];
+            }
+        }
+    }
+
+    /*!\brief Selects the optimum of the global alignment in the same order as the scalar algorithm.
+     * \param[in] last_row The index of the last row.
+     */
+    void select_global_optimum(size_t const last_row) noexcept
+    {
+        this->optimal_score = std::numeric_limits<scalar_score_type>::lowest();
+
+        if (this->last_row_is_free)
+        {
+            this->update_optimum(this->first_column_score(last_row), 0, last_row);
+            for (size_t position = 0; position < query_size; ++position)
+                this->update_optimum(this->line_score(position), position + 1, last_row);
+        }
+
+        if (this->last_column_is_free)
+        {
+            this->update_optimum(this->first_row_score(query_size), query_size, 0);
+            for (size_t row = 0; row < last_column_scores.size(); ++row)
+                this->update_optimum(last_column_scores[row], query_size, row + 1);
+        }
+
+        if (!this->last_row_is_free && !this->last_column_is_free)
+        {
+            this->optimal_score = this->line_score(query_size - 1);
+            this->optimal_column = query_size;
+            this->optimal_row = last_row;
+        }
+    }
+
+    /*!\brief Stores the query and discards the profile if the query differs from the previous one.
+     * \param[in] sequence1 The first sequence.
+     */
+    template <typename sequence1_t>
+    void initialise_query(sequence1_t & sequence1)
+    {
+        auto ranks = sequence1
+                   | std::views::transform(
+                         [](auto const & letter)
+                         {
+                             return static_cast<size_t>(seqan3::to_rank(letter));
+                         });
+
+        if (!profile_offsets.empty() && std::ranges::equal(query_ranks, ranks))
+            return;
+
+        query_ranks.assign(std::ranges::begin(ranks), std::ranges::end(ranks));
+        query_size = query_ranks.size();
+        this->segment_count = (query_size + lanes - 1) / lanes;
+
+        profile.clear();
+        profile_offsets.clear();
+    }
+
+    /*!\brief Returns the offset of the profile of the given letter and computes the profile if necessary.
+     * \tparam sequence1_t The type of the first sequence.
+     * \param[in] letter The letter of the second sequence.
+     *
+     * \details
+     *
+     * The profile of a letter stores `segment_count` vectors, where lane `l` of vector `k` holds the score of the
+     * `l * segment_count + k`-th letter of the query against the letter. The padding columns score 0.
+     */
+    template <typename sequence1_t, typename alphabet2_t>
+    size_t profile_offset(alphabet2_t const & letter)
+    {
+        using alphabet1_t = std::ranges::range_value_t<sequence1_t>;
+
+        if (profile_offsets.empty())
+            profile_offsets.assign(alphabet_size<alphabet2_t>, no_profile);
+
+        size_t & offset = profile_offsets[seqan3::to_rank(letter)];
+        if (offset != no_profile)
+            return offset;
+
+        offset = profile.size();
+        profile.resize(offset + this->segment_count, simd::fill<score_type>(0));
+        for (size_t position = 0; position < query_size; ++position)
+        {
+            alphabet1_t const query_letter = seqan3::assign_rank_to(query_ranks[position], alphabet1_t{});
+            profile[offset + position % this->segment_count][position / this->segment_count] =
+                static_cast<scalar_score_type>(scoring_scheme.score(query_letter, letter));
+        }
+        return offset;
+    }
+
+    //!\brief Initialises the first row and the optimum.
+    void initialise_first_row()
+    {
+        this->initialise_first_line(
+            [&](size_t const column)
+            {
+                return this->first_row_score(column);
+            });
+
+        last_column_scores.clear();
+        if constexpr (traits_type::is_local)
+        {
+            column_maximum.assign(this->segment_count, simd::fill<score_type>(0));
+            column_maximum_row.assign(this->segment_count, simd::fill<score_type>(0));
+        }
+
+        this->optimal_score = 0;
+        this->optimal_row = 0;
+        this->optimal_column = 0;
+    }
+
+    //!\brief The algorithm computing the chunks that contain an empty sequence.
+    batch_algorithm_t batch_algorithm{};
+    //!\brief The scalar scoring scheme.
+    scoring_scheme_type scoring_scheme{};
+
+    //!\brief The ranks of the query the profile was computed for.
+    std::vector<size_t> query_ranks{};
+    //!\brief The size of the query.
+    size_t query_size{};
+    //!\brief The striped query profile; the vectors of every letter are stored consecutively.
+    score_row_type profile{};
+    //!\brief Maps the rank of a letter of the second sequence to the offset of its profile.
+    std::vector<size_t> profile_offsets{};
+    //!\brief The maximal score of every column; only tracked in the local alignment.
+    score_row_type column_maximum{};
+    //!\brief The first row reaching the maximal score of every column; only tracked in the local alignment.
+    score_row_type column_maximum_row{};
+    //!\brief The scores of the last column in every row; only tracked if trailing gaps in the second sequence are free.
+    std::vector<scalar_score_type> last_column_scores{};
+};
+
+} // namespace seqan3::detail
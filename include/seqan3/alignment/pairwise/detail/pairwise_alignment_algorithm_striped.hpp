@@ -0,0 +1,305 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides seqan3::detail::pairwise_alignment_algorithm_striped.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <concepts>
+#include <limits>
+#include <ranges>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
+#include <seqan3/alignment/matrix/detail/matrix_coordinate.hpp>
+#include <seqan3/alignment/pairwise/detail/concept.hpp>
+#include <seqan3/alignment/pairwise/detail/policy_alignment_result_builder.hpp>
+#include <seqan3/alignment/pairwise/detail/policy_striped_kernel.hpp>
+#include <seqan3/alignment/pairwise/detail/type_traits.hpp>
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/core/detail/empty_type.hpp>
+#include <seqan3/utility/simd/algorithm.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Computes a single long pairwise alignment with a striped intra-sequence simd kernel.
+ * \ingroup alignment_pairwise
+ * \implements std::invocable
+ *
+ * \tparam alignment_configuration_t The configuration type; must be of type seqan3::configuration.
+ * \tparam batch_algorithm_t The inter-sequence alignment algorithm used for all other chunks.
+ *
+ * \details
+ *
+ * The vectorised alignment algorithms compute one alignment per simd lane. When only a single sequence pair is
+ * given, e.g. a long contig against a reference region, all but one lane would stay idle. In this case the pair is
+ * computed with the striped kernel of Farrar (2007) instead: the second sequence is split into
+ * seqan3::simd::simd_traits::length segments, one per lane, such that a column of the matrix is computed with
+ * `ceil(m / length)` simd operations by seqan3::detail::policy_striped_kernel. A query profile with one score vector
+ * per segment and letter of the first sequence avoids any scoring scheme lookup in the inner loop.
+ *
+ * The kernel supports global and local alignments with affine gap costs (including all free end-gap
+ * configurations) that output the score and the end positions. The results are identical to the scalar
+ * algorithms, including which cell is reported if several cells share the optimal score. Every chunk with more
+ * than one sequence pair or with an empty sequence is forwarded to `batch_algorithm_t`.
+ */
+template <typename alignment_configuration_t, typename batch_algorithm_t>
+    requires is_type_specialisation_of_v<alignment_configuration_t, configuration>
+class pairwise_alignment_algorithm_striped :
+    protected policy_alignment_result_builder<alignment_configuration_t>,
+    protected policy_striped_kernel<alignment_configuration_t>
+{
+private:
+    //!\brief The striped kernel type.
+    using kernel_type = policy_striped_kernel<alignment_configuration_t>;
+    //!\brief The alignment configuration traits type.
+    using typename kernel_type::traits_type;
+    //!\brief The simd vector type holding the scores of one segment row.
+    using typename kernel_type::score_type;
+    //!\brief The scalar score type.
+    using typename kernel_type::scalar_score_type;
+    //!\brief The type of a column of simd vectors.
+    using score_column_type = typename kernel_type::score_line_type;
+    //!\brief The configured alignment result type.
+    using alignment_result_type = typename traits_type::alignment_result_type;
+    //!\brief The scalar scoring scheme type used to build the query profile.
+    using scoring_scheme_type = std::remove_cvref_t<typename traits_type::scoring_scheme_type>;
+
+    static_assert(traits_type::is_vectorised && !traits_type::is_banded && !traits_type::requires_trace_information,
+                  "The striped alignment only computes unbanded, vectorised alignments without trace back.");
+
+    using kernel_type::lanes;
+    //!\brief Marks a letter of the first sequence without query profile.
+    static constexpr size_t no_profile = std::numeric_limits<size_t>::max();
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    pairwise_alignment_algorithm_striped() = default;                                             //!< Defaulted.
+    pairwise_alignment_algorithm_striped(pairwise_alignment_algorithm_striped const &) = default; //!< Defaulted.
+    pairwise_alignment_algorithm_striped(pairwise_alignment_algorithm_striped &&) = default;      //!< Defaulted.
+    pairwise_alignment_algorithm_striped &
+    operator=(pairwise_alignment_algorithm_striped const &) = default;                                   //!< Defaulted.
+    pairwise_alignment_algorithm_striped & operator=(pairwise_alignment_algorithm_striped &&) = default; //!< Defaulted.
+    ~pairwise_alignment_algorithm_striped() = default;                                                   //!< Defaulted.
+
+    /*!\brief Constructs the algorithm from the configuration and the inter-sequence algorithm.
+     * \param[in] config The alignment configuration.
+     * \param[in] batch_algorithm The algorithm computing all chunks that are not handled by the striped kernel.
+     */
+    pairwise_alignment_algorithm_striped(alignment_configuration_t const & config, batch_algorithm_t batch_algorithm) :
+        policy_alignment_result_builder<alignment_configuration_t>{config},
+        kernel_type{config},
+        batch_algorithm{std::move(batch_algorithm)},
+        scoring_scheme{seqan3::get<align_cfg::scoring_scheme>(config).scheme}
+    {}
+    //!\}
+
+    /*!\brief Computes the alignments of the given chunk of indexed sequence pairs.
+     * \tparam indexed_sequence_pairs_t The type of indexed_sequence_pairs; must model
+     *                                  seqan3::detail::indexed_sequence_pair_range.
+     * \tparam callback_t The type of the callback function; must model std::invocable with the alignment result.
+     *
+     * \param[in] indexed_sequence_pairs The chunk of indexed sequence pairs to be aligned.
+     * \param[in] callback The callback function to be invoked with each computed alignment result.
+     *
+     * \details
+     *
+     * A chunk consisting of a single pair of non-empty sequences is computed with the striped kernel. All other chunks
+     * are forwarded to the inter-sequence algorithm.
+     */
+    template <indexed_sequence_pair_range indexed_sequence_pairs_t, typename callback_t>
+        requires std::invocable<callback_t, alignment_result_type>
+    void operator()(indexed_sequence_pairs_t && indexed_sequence_pairs, callback_t && callback)
+    {
+        using std::get;
+        using sequence1_t = std::remove_cvref_t<decltype(get<0>(get<0>(*std::ranges::begin(indexed_sequence_pairs))))>;
+        using alphabet1_t = std::ranges::range_value_t<sequence1_t>;
+
+        if constexpr (semialphabet<alphabet1_t> && alphabet_size<alphabet1_t> <= 256)
+        {
+            if (std::ranges::distance(indexed_sequence_pairs) == 1)
+            {
+                auto && [sequence_pair, idx] = *std::ranges::begin(indexed_sequence_pairs);
+
+                if (!std::ranges::empty(get<0>(sequence_pair)) && !std::ranges::empty(get<1>(sequence_pair)))
+                {
+                    compute_striped(get<0>(sequence_pair), get<1>(sequence_pair));
+                    matrix_coordinate coordinate{row_index_type{this->optimal_row},
+                                                 column_index_type{this->optimal_column}};
+                    this->make_result_and_invoke(std::forward<decltype(sequence_pair)>(sequence_pair),
+                                                 std::move(idx),
+                                                 this->optimal_score,
+                                                 std::move(coordinate),
+                                                 empty_type{},
+                                                 callback);
+                    return;
+                }
+            }
+        }
+
+        batch_algorithm(std::forward<indexed_sequence_pairs_t>(indexed_sequence_pairs),
+                        std::forward<callback_t>(callback));
+    }
+
+private:
+    /*!\brief Computes the matrix column by column and tracks the optimum.
+     * \param[in] sequence1 The first sequence (horizontal).
+     * \param[in] sequence2 The second sequence (vertical, split into the striped segments).
+     */
+    template <typename sequence1_t, typename sequence2_t>
+    void compute_striped(sequence1_t && sequence1, sequence2_t && sequence2)
+    {
+        sequence2_size = std::ranges::distance(sequence2);
+        this->segment_count = (sequence2_size + lanes - 1) / lanes;
+
+        initialise_profile(sequence1, sequence2);
+        initialise_first_column();
+
+        score_type column_max{};
+        auto track_column_max = [&](size_t, score_type const & best)
+        {
+            column_max = (column_max < best) ? best : column_max;
+        };
+
+        size_t column_index = 0;
+        for (auto const & letter : sequence1)
+        {
+            ++column_index;
+            column_max = simd::fill<score_type>(0);
+            this->compute_line(profile.data() + rank_to_profile[seqan3::to_rank(letter)],
+                               this->first_row_score(column_index - 1),
+                               this->first_row_score(column_index),
+                               track_column_max);
+
+            if constexpr (traits_type::is_local)
+            {
+                // The first (top-most, left-most) cell with a strictly better score is the optimum.
+                // The cells of the padding rows never exceed the best real cell since their profile score is 0.
+                if (this->any_lane(column_max > simd::fill<score_type>(this->optimal_score)))
+                {
+                    for (size_t lane = 0; lane < lanes; ++lane)
+                        this->optimal_score = std::max<scalar_score_type>(this->optimal_score, column_max[lane]);
+                    this->optimal_column = column_index;
+                    optimal_h_column = this->h_previous;
+                }
+            }
+            else
+            {
+                if (this->last_row_is_free)
+                    this->update_optimum(this->line_score(sequence2_size - 1), column_index, sequence2_size);
+            }
+        }
+
+        if constexpr (traits_type::is_local)
+        {
+            this->optimal_row = 0;
+            for (size_t row = 0; this->optimal_column != 0 && row < sequence2_size; ++row)
+            {
+                if (optimal_h_column[row % this->segment_count][row / this->segment_count] == this->optimal_score)
+                {
+                    this->optimal_row = row + 1;
+                    break;
+                }
+            }
+        }
+        else
+        {
+            if (this->last_column_is_free)
+            {
+                this->update_optimum(this->first_row_score(column_index), column_index, 0);
+                for (size_t row = 0; row < sequence2_size; ++row)
+                    this->update_optimum(this->line_score(row), column_index, row + 1);
+            }
+
+            if (!this->last_row_is_free && !this->last_column_is_free)
+            {
+                this->optimal_score = this->line_score(sequence2_size - 1);
+                this->optimal_column = column_index;
+                this->optimal_row = sequence2_size;
+            }
+        }
+    }
+
+    /*!\brief Builds the striped query profile for every letter occurring in the first sequence.
+     * \param[in] sequence1 The first sequence.
+     * \param[in] sequence2 The second sequence.
+     *
+     * \details
+     *
+     * The profile of a letter stores `segment_count` vectors, where lane `l` of vector `k` holds the score of the
+     * letter against the `l * segment_count + k`-th letter of the second sequence. The padding rows score 0.
+     */
+    template <typename sequence1_t, typename sequence2_t>
+    void initialise_profile(sequence1_t & sequence1, sequence2_t & sequence2)
+    {
+        using alphabet1_t = std::ranges::range_value_t<sequence1_t>;
+
+        rank_to_profile.assign(alphabet_size<alphabet1_t>, no_profile);
+        profile.clear();
+
+        for (auto const & letter : sequence1)
+        {
+            size_t & profile_offset = rank_to_profile[seqan3::to_rank(letter)];
+            if (profile_offset != no_profile)
+                continue;
+
+            profile_offset = profile.size();
+            profile.resize(profile_offset + this->segment_count, simd::fill<score_type>(0));
+
+            size_t row = 0;
+            for (auto const & letter2 : sequence2)
+            {
+                profile[profile_offset + row % this->segment_count][row / this->segment_count] =
+                    static_cast<scalar_score_type>(scoring_scheme.score(letter, letter2));
+                ++row;
+            }
+        }
+    }
+
+    //!\brief Initialises the first column and the optimum.
+    void initialise_first_column()
+    {
+        this->initialise_first_line(
+            [&](size_t const row)
+            {
+                return this->first_column_score(row);
+            });
+
+        this->optimal_row = 0;
+        this->optimal_column = 0;
+        if constexpr (traits_type::is_local)
+        {
+            this->optimal_score = 0;
+        }
+        else
+        {
+            this->optimal_score = std::numeric_limits<scalar_score_type>::lowest();
+            if (this->last_row_is_free)
+                this->update_optimum(this->line_score(sequence2_size - 1), 0, sequence2_size);
+        }
+    }
+
+    //!\brief The algorithm computing the chunks that are not handled by the striped kernel.
+    batch_algorithm_t batch_algorithm{};
+    //!\brief The scalar scoring scheme.
+    scoring_scheme_type scoring_scheme{};
+
+    //!\brief The size of the second sequence.
+    size_t sequence2_size{};
+    //!\brief The striped query profile; the vectors of every letter are stored consecutively.
+    score_column_type profile{};
+    //!\brief Maps the rank of a letter of the first sequence to the offset of its profile.
+    std::vector<size_t> rank_to_profile{};
+    //!\brief A copy of the column containing the local optimum.
+    score_column_type optimal_h_column{};
+};
+
+} // namespace seqan3::detail
@@ -0,0 +1,671 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides seqan3::detail::pairwise_alignment_algorithm_wavefront.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <numeric>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_method.hpp>
+#include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
+#include <seqan3/alignment/exception.hpp>
+#include <seqan3/alignment/matrix/detail/aligned_sequence_builder.hpp>
+#include <seqan3/alignment/matrix/detail/cigar_builder.hpp>
+#include <seqan3/alignment/matrix/detail/matrix_coordinate.hpp>
+#include <seqan3/alignment/matrix/detail/trace_directions.hpp>
+#include <seqan3/alignment/pairwise/detail/concept.hpp>
+#include <seqan3/alignment/pairwise/detail/pairwise_alignment_algorithm_linear_memory.hpp>
+#include <seqan3/alignment/pairwise/detail/type_traits.hpp>
+#include <seqan3/alignment/scoring/hamming_scoring_scheme.hpp>
+#include <seqan3/alphabet/adaptation/char.hpp>
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/utility/concept.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Computes global alignments with the gap-affine wavefront alignment algorithm (Marco-Sola et al., 2021).
+ * \ingroup alignment_pairwise
+ * \implements std::invocable
+ *
+ * \tparam alignment_configuration_t The configuration type; must be of type seqan3::configuration.
+ *
+ * \details
+ *
+ * The scores are converted into penalties with a match penalty of 0. For a match score \f$a\f$, a mismatch score
+ * \f$b\f$, a gap open score \f$g_o\f$ and a gap extension score \f$g_e\f$, the penalties
+ * \f$x = 2(a - b)\f$, \f$o = -2g_o\f$ and \f$e = a - 2g_e\f$ are used, divided by their greatest common divisor.
+ * An alignment of two sequences of length \f$n\f$ and \f$m\f$ with the penalty \f$p\f$ has the score
+ * \f$(a(n + m) - p) / 2\f$ (Eizenga and Paten, 2022), i.e. the alignment with the minimal penalty has the maximal
+ * score.
+ *
+ * The wavefront of penalty \f$s\f$ stores for every diagonal \f$k = j - i\f$ the largest column index \f$j\f$
+ * reachable with penalty \f$s\f$, once for alignments ending with a match or mismatch, with a horizontal gap and with a
+ * vertical gap. It is computed from the wavefronts of penalty \f$s - x\f$, \f$s - o - e\f$ and \f$s - e\f$, after
+ * which every diagonal is extended along the run of matching letters. The algorithm stops with the first wavefront
+ * that reaches the last cell. Without traceback only the last \f$\max(x, o + e)\f$ wavefronts are kept; otherwise all
+ * wavefronts are kept and the alignment is recovered by going back from the last cell.
+ */
+template <typename alignment_configuration_t>
+    requires is_type_specialisation_of_v<alignment_configuration_t, configuration>
+class pairwise_alignment_algorithm_wavefront
+{
+private:
+    //!\brief The alignment configuration traits type.
+    using traits_type = alignment_configuration_traits<alignment_configuration_t>;
+    //!\brief The scalar score type.
+    using score_type = typename traits_type::original_score_type;
+    //!\brief The configured alignment result type.
+    using alignment_result_type = typename traits_type::alignment_result_type;
+    //!\brief The scalar scoring scheme type.
+    using scoring_scheme_type = std::remove_cvref_t<typename traits_type::scoring_scheme_type>;
+    //!\brief The alphabet type of the scoring scheme.
+    using scoring_scheme_alphabet_type = typename traits_type::scoring_scheme_alphabet_type;
+    //!\brief The type of the column index stored in the wavefronts.
+    using offset_type = int32_t;
+
+    static_assert(traits_type::is_global && !traits_type::is_banded && !traits_type::is_vectorised,
+                  "The wavefront alignment algorithm only computes unbanded global alignments.");
+
+    //!\brief Whether the traceback is computed, i.e. the alignment or its CIGAR sequence is requested.
+    static constexpr bool computes_trace = traits_type::compute_sequence_alignment || traits_type::compute_cigar;
+
+    //!\brief The offset of cells that cannot be reached; stays negative if incremented.
+    static constexpr offset_type null_offset = std::numeric_limits<offset_type>::lowest() / 2;
+
+    //!\brief The furthest reaching column indices of one penalty for the diagonals `low` to `high`.
+    struct wavefront_type
+    {
+        //!\brief The lowest diagonal.
+        offset_type low{0};
+        //!\brief The highest diagonal; smaller than `low` if no cell can be reached with this penalty.
+        offset_type high{-1};
+        //!\brief The column indices of alignments ending with a match or mismatch.
+        std::vector<offset_type> match{};
+        //!\brief The column indices of alignments ending with a horizontal gap.
+        std::vector<offset_type> horizontal{};
+        //!\brief The column indices of alignments ending with a vertical gap.
+        std::vector<offset_type> vertical{};
+
+        /*!\brief Returns the column index of the given component and diagonal or the null offset.
+         * \param[in] component The component, i.e. one of the member vectors.
+         * \param[in] diagonal The diagonal.
+         */
+        offset_type at(std::vector<offset_type> wavefront_type::*component, offset_type const diagonal) const noexcept
+        {
+            return (diagonal < low || diagonal > high) ? null_offset : (this->*component)[diagonal - low];
+        }
+    };
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    pairwise_alignment_algorithm_wavefront() = default;                                           //!< Defaulted.
+    pairwise_alignment_algorithm_wavefront(pairwise_alignment_algorithm_wavefront const &) = default; //!< Defaulted.
+    pairwise_alignment_algorithm_wavefront(pairwise_alignment_algorithm_wavefront &&) = default;      //!< Defaulted.
+    pairwise_alignment_algorithm_wavefront &
+    operator=(pairwise_alignment_algorithm_wavefront const &) = default; //!< Defaulted.
+    pairwise_alignment_algorithm_wavefront &
+    operator=(pairwise_alignment_algorithm_wavefront &&) = default; //!< Defaulted.
+    ~pairwise_alignment_algorithm_wavefront() = default;            //!< Defaulted.
+
+    /*!\brief Constructs the algorithm from the configuration and converts the scores into penalties.
+     * \param[in] config The alignment configuration.
+     * \throws seqan3::invalid_alignment_configuration if free end gaps are configured, the scoring scheme has more
+     *         than one match or mismatch score, or the scores cannot be converted into valid penalties.
+     */
+    explicit pairwise_alignment_algorithm_wavefront(alignment_configuration_t const & config) :
+        scoring_scheme{seqan3::get<align_cfg::scoring_scheme>(config).scheme}
+    {
+        auto const & method_global_config = config.get_or(align_cfg::method_global{});
+        if (method_global_config.free_end_gaps_sequence1_leading || method_global_config.free_end_gaps_sequence2_leading
+            || method_global_config.free_end_gaps_sequence1_trailing
+            || method_global_config.free_end_gaps_sequence2_trailing)
+        {
+            throw invalid_alignment_configuration{"The align_cfg::wavefront configuration cannot be combined with "
+                                                  "free end gaps."};
+        }
+
+        // Use the same default gap costs as the dynamic programming algorithm that is replaced.
+        int32_t const default_open_score = computes_trace ? 0 : -10;
+        auto const & gap_scheme = config.get_or(
+            align_cfg::gap_cost_affine{align_cfg::open_score{default_open_score}, align_cfg::extension_score{-1}});
+
+        initialise_match_and_mismatch_score();
+
+        int64_t const mismatch = 2 * (match_score - mismatch_score);
+        int64_t const gap_open = -2 * static_cast<int64_t>(gap_scheme.open_score);
+        int64_t const gap_extension = match_score - 2 * static_cast<int64_t>(gap_scheme.extension_score);
+
+        if (mismatch <= 0 || gap_open < 0 || gap_extension <= 0)
+        {
+            throw invalid_alignment_configuration{"The align_cfg::wavefront configuration requires a match score "
+                                                  "greater than the mismatch score, a gap open score that is not "
+                                                  "positive and a gap extension score smaller than half of the match "
+                                                  "score."};
+        }
+
+        if (std::max(mismatch, gap_open + gap_extension) > std::numeric_limits<offset_type>::max())
+            throw invalid_alignment_configuration{"The scores are too large for the align_cfg::wavefront "
+                                                  "configuration."};
+
+        penalty_scale = std::gcd(mismatch, std::gcd(gap_open, gap_extension));
+        mismatch_penalty = mismatch / penalty_scale;
+        gap_open_penalty = (gap_open + gap_extension) / penalty_scale;
+        gap_extension_penalty = gap_extension / penalty_scale;
+    }
+    //!\}
+
+    /*!\brief Computes the alignments of the given chunk of indexed sequence pairs.
+     * \tparam indexed_sequence_pairs_t The type of indexed_sequence_pairs; must model
+     *                                  seqan3::detail::indexed_sequence_pair_range.
+     * \tparam callback_t The type of the callback function; must model std::invocable with the alignment result.
+     *
+     * \param[in] indexed_sequence_pairs The chunk of indexed sequence pairs to be aligned.
+     * \param[in] callback The callback function to be invoked with each computed alignment result.
+     */
+    template <indexed_sequence_pair_range indexed_sequence_pairs_t, typename callback_t>
+        requires std::invocable<callback_t, alignment_result_type>
+    void operator()(indexed_sequence_pairs_t && indexed_sequence_pairs, callback_t && callback)
+    {
+        using std::get;
+
+        for (auto && [sequence_pair, idx] : indexed_sequence_pairs)
+        {
+            compute_pair(get<0>(sequence_pair), get<1>(sequence_pair));
+            make_result_and_invoke(get<0>(sequence_pair), get<1>(sequence_pair), std::move(idx), callback);
+        }
+    }
+
+private:
+    /*!\brief Determines the match and the mismatch score of the scoring scheme.
+     * \throws seqan3::invalid_alignment_configuration if the scoring scheme has more than one match or mismatch score.
+     */
+    void initialise_match_and_mismatch_score()
+    {
+        if constexpr (std::same_as<scoring_scheme_type, hamming_scoring_scheme>)
+        {
+            match_score = 0;
+            mismatch_score = -1;
+        }
+        else
+        {
+            constexpr size_t alphabet_size = seqan3::alphabet_size<scoring_scheme_alphabet_type>;
+            auto score = [&](size_t const rank1, size_t const rank2) -> int64_t
+            {
+                return scoring_scheme.score(seqan3::assign_rank_to(rank1, scoring_scheme_alphabet_type{}),
+                                            seqan3::assign_rank_to(rank2, scoring_scheme_alphabet_type{}));
+            };
+
+            match_score = score(0, 0);
+            mismatch_score = score(0, std::min<size_t>(1, alphabet_size - 1));
+
+            for (size_t rank1 = 0; rank1 < alphabet_size; ++rank1)
+            {
+                for (size_t rank2 = 0; rank2 < alphabet_size; ++rank2)
+                {
+                    if (score(rank1, rank2) != ((rank1 == rank2) ? match_score : mismatch_score))
+                        throw invalid_alignment_configuration{"The align_cfg::wavefront configuration supports only "
+                                                              "scoring schemes with one match and one mismatch "
+                                                              "score."};
+                }
+            }
+        }
+    }
+
+    /*!\brief Copies the letters of a sequence, converted into the alphabet of the scoring scheme if possible.
+     * \param[in] sequence The sequence.
+     * \returns a std::vector over the letters.
+     *
+     * \details
+     *
+     * Two converted letters match if and only if they are equal, since the scoring scheme has one match and one
+     * mismatch score. The letters of sequences that cannot be converted are compared with the scoring scheme.
+     */
+    template <typename sequence_t>
+    static auto copy_letters(sequence_t && sequence)
+    {
+        using letter_t = std::ranges::range_value_t<sequence_t>;
+
+        if constexpr (explicitly_convertible_to<letter_t, scoring_scheme_alphabet_type>)
+        {
+            std::vector<scoring_scheme_alphabet_type> letters{};
+            for (auto && letter : sequence)
+                letters.push_back(static_cast<scoring_scheme_alphabet_type>(letter));
+            return letters;
+        }
+        else
+        {
+            return std::vector<letter_t>(std::ranges::begin(sequence), std::ranges::end(sequence));
+        }
+    }
+
+    /*!\brief Computes the score and, if requested, the alignment of a single pair.
+     * \param[in] sequence1 The first sequence (horizontal).
+     * \param[in] sequence2 The second sequence (vertical).
+     */
+    template <typename sequence1_t, typename sequence2_t>
+    void compute_pair(sequence1_t && sequence1, sequence2_t && sequence2)
+    {
+        auto letters1 = copy_letters(sequence1);
+        auto letters2 = copy_letters(sequence2);
+
+        sequence1_size = letters1.size();
+        sequence2_size = letters2.size();
+        offset_type const last_diagonal =
+            static_cast<offset_type>(sequence1_size) - static_cast<offset_type>(sequence2_size);
+
+        if constexpr (computes_trace)
+            used_wavefronts = 0;
+        else
+            used_wavefronts = std::max(mismatch_penalty, gap_open_penalty) + 1;
+
+        // The penalty 0 reaches the cells of the run of matches starting in the origin.
+        wavefront_type & first = wavefront_at(0);
+        first.low = 0;
+        first.high = 0;
+        first.match.assign(1, extend(letters1, letters2, 0, 0));
+        first.horizontal.assign(1, null_offset);
+        first.vertical.assign(1, null_offset);
+
+        optimal_penalty = 0;
+        while (wavefront_at(optimal_penalty).at(&wavefront_type::match, last_diagonal)
+               != static_cast<offset_type>(sequence1_size))
+        {
+            ++optimal_penalty;
+            compute_wavefront(letters1, letters2);
+        }
+
+        trace.clear();
+        if constexpr (computes_trace)
+            compute_trace(last_diagonal);
+    }
+
+    /*!\brief Computes the wavefront of the current penalty and extends it along the runs of matches.
+     * \param[in] letters1 The letters of the first sequence.
+     * \param[in] letters2 The letters of the second sequence.
+     */
+    template <typename letters1_t, typename letters2_t>
+    void compute_wavefront(letters1_t const & letters1, letters2_t const & letters2)
+    {
+        wavefront_type & current = wavefront_at(optimal_penalty);
+        wavefront_type const & mismatch_source = source_wavefront(mismatch_penalty);
+        wavefront_type const & open_source = source_wavefront(gap_open_penalty);
+        wavefront_type const & extension_source = source_wavefront(gap_extension_penalty);
+
+        // A gap moves one diagonal up or down.
+        auto is_null = [](wavefront_type const & wavefront)
+        {
+            return wavefront.high < wavefront.low;
+        };
+        current.low = std::numeric_limits<offset_type>::max();
+        current.high = std::numeric_limits<offset_type>::lowest();
+        if (!is_null(mismatch_source))
+        {
+            current.low = mismatch_source.low;
+            current.high = mismatch_source.high;
+        }
+        for (wavefront_type const * gap_source : {&open_source, &extension_source})
+        {
+            if (!is_null(*gap_source))
+            {
+                current.low = std::min(current.low, gap_source->low - 1);
+                current.high = std::max(current.high, gap_source->high + 1);
+            }
+        }
+        current.low = std::max<offset_type>(current.low, -static_cast<offset_type>(sequence2_size));
+        current.high = std::min<offset_type>(current.high, sequence1_size);
+
+        if (current.high < current.low)
+            return;
+
+        size_t const diagonal_count = current.high - current.low + 1;
+        current.match.resize(diagonal_count);
+        current.horizontal.resize(diagonal_count);
+        current.vertical.resize(diagonal_count);
+
+        for (offset_type diagonal = current.low; diagonal <= current.high; ++diagonal)
+        {
+            size_t const index = diagonal - current.low;
+            offset_type const horizontal = std::max(open_source.at(&wavefront_type::match, diagonal - 1),
+                                                    extension_source.at(&wavefront_type::horizontal, diagonal - 1))
+                                         + 1;
+            offset_type const vertical = std::max(open_source.at(&wavefront_type::match, diagonal + 1),
+                                                  extension_source.at(&wavefront_type::vertical, diagonal + 1));
+            offset_type const mismatch = mismatch_source.at(&wavefront_type::match, diagonal) + 1;
+
+            current.horizontal[index] = valid_or_null(horizontal, diagonal);
+            current.vertical[index] = valid_or_null(vertical, diagonal);
+
+            offset_type const column = std::max({valid_or_null(mismatch, diagonal),
+                                                 current.horizontal[index],
+                                                 current.vertical[index]});
+            current.match[index] = (column == null_offset) ? null_offset
+                                                           : extend(letters1, letters2, column, column - diagonal);
+        }
+    }
+
+    /*!\brief Whether letters of the given types match if and only if they are equal.
+     * \tparam letter1_t The letter type of the first sequence.
+     * \tparam letter2_t The letter type of the second sequence.
+     *
+     * \details
+     *
+     * This holds for letters of the scoring scheme's alphabet, since the scoring scheme has one match and one mismatch
+     * score, and for the hamming scoring scheme, which compares the letters.
+     */
+    template <typename letter1_t, typename letter2_t>
+    static constexpr bool compares_letters =
+        std::same_as<letter1_t, letter2_t>
+        && (std::same_as<letter1_t, scoring_scheme_alphabet_type>
+            || std::same_as<scoring_scheme_type, hamming_scoring_scheme>);
+
+    /*!\brief Returns the column index of the end of the run of matches starting in the given cell.
+     * \param[in] letters1 The letters of the first sequence.
+     * \param[in] letters2 The letters of the second sequence.
+     * \param[in] column The column index of the cell.
+     * \param[in] row The row index of the cell.
+     *
+     * \details
+     *
+     * Letters of one byte that are compared with `==` are compared eight at a time.
+     */
+    template <typename letters1_t, typename letters2_t>
+    offset_type
+    extend(letters1_t const & letters1, letters2_t const & letters2, offset_type column, offset_type row) const noexcept
+    {
+        using letter1_t = std::ranges::range_value_t<letters1_t>;
+        using letter2_t = std::ranges::range_value_t<letters2_t>;
+
+        size_t const length = std::min(letters1.size() - column, letters2.size() - row);
+        size_t matches = 0;
+
+        if constexpr (compares_letters<letter1_t, letter2_t> && sizeof(letter1_t) == 1
+                      && std::has_unique_object_representations_v<letter1_t>
+                      && std::endian::native == std::endian::little)
+        {
+            for (; matches + sizeof(uint64_t) <= length; matches += sizeof(uint64_t))
+            {
+                uint64_t word1{};
+                uint64_t word2{};
+                std::memcpy(&word1, letters1.data() + column + matches, sizeof(uint64_t));
+                std::memcpy(&word2, letters2.data() + row + matches, sizeof(uint64_t));
+                if (uint64_t const difference = word1 ^ word2; difference != 0)
+                    return column + static_cast<offset_type>(matches + std::countr_zero(difference) / 8);
+            }
+        }
+
+        while (matches < length && is_match(letters1[column + matches], letters2[row + matches]))
+            ++matches;
+
+        return column + static_cast<offset_type>(matches);
+    }
+
+    /*!\brief Returns whether two letters match.
+     * \param[in] letter1 The letter of the first sequence.
+     * \param[in] letter2 The letter of the second sequence.
+     */
+    template <typename letter1_t, typename letter2_t>
+    bool is_match(letter1_t const & letter1, letter2_t const & letter2) const noexcept
+    {
+        if constexpr (compares_letters<letter1_t, letter2_t>)
+            return letter1 == letter2;
+        else
+            return scoring_scheme.score(letter1, letter2) == match_score;
+    }
+
+    /*!\brief Returns the column index if the cell lies within the matrix and the null offset otherwise.
+     * \param[in] column The column index.
+     * \param[in] diagonal The diagonal.
+     */
+    offset_type valid_or_null(offset_type const column, offset_type const diagonal) const noexcept
+    {
+        bool const is_valid = column >= 0 && column <= static_cast<offset_type>(sequence1_size)
+                           && column - diagonal >= 0 && column - diagonal <= static_cast<offset_type>(sequence2_size);
+        return is_valid ? column : null_offset;
+    }
+
+    /*!\brief Returns the wavefront of the given penalty.
+     * \param[in] penalty The penalty.
+     *
+     * \details
+     *
+     * Without traceback the wavefronts are stored in a ring buffer. Otherwise all wavefronts are stored and a new one
+     * is appended if required; references to other wavefronts are invalidated in this case.
+     */
+    wavefront_type & wavefront_at(size_t const penalty)
+    {
+        if constexpr (computes_trace)
+        {
+            used_wavefronts = std::max(used_wavefronts, penalty + 1);
+            if (wavefronts.size() < used_wavefronts)
+                wavefronts.resize(used_wavefronts);
+            return wavefronts[penalty];
+        }
+        else
+        {
+            if (wavefronts.size() < used_wavefronts)
+                wavefronts.resize(used_wavefronts);
+            return wavefronts[penalty % used_wavefronts];
+        }
+    }
+
+    /*!\brief Returns the wavefront of the current penalty minus the given difference.
+     * \param[in] difference The difference to the current penalty.
+     */
+    wavefront_type const & source_wavefront(size_t const difference) const noexcept
+    {
+        if (difference > optimal_penalty)
+            return null_wavefront;
+
+        size_t const penalty = optimal_penalty - difference;
+        return computes_trace ? wavefronts[penalty] : wavefronts[penalty % used_wavefronts];
+    }
+
+    /*!\brief Recovers the alignment by going back from the last cell through the stored wavefronts.
+     * \param[in] last_diagonal The diagonal of the last cell.
+     */
+    void compute_trace(offset_type const last_diagonal)
+    {
+        enum struct component
+        {
+            match,
+            horizontal,
+            vertical
+        };
+
+        component current_component = component::match;
+        size_t penalty = optimal_penalty;
+        offset_type diagonal = last_diagonal;
+        offset_type column = sequence1_size;
+
+        auto match_at = [&](size_t const difference, offset_type const source_diagonal)
+        {
+            return (difference > penalty) ? null_offset
+                                          : wavefronts[penalty - difference].at(&wavefront_type::match,
+                                                                                source_diagonal);
+        };
+
+        while (true)
+        {
+            wavefront_type const & wavefront = wavefronts[penalty];
+
+            if (current_component == component::match)
+            {
+                if (penalty == 0)
+                {
+                    trace.insert(trace.end(), column, trace_directions::diagonal);
+                    break;
+                }
+
+                offset_type const mismatch = valid_or_null(match_at(mismatch_penalty, diagonal) + 1, diagonal);
+                offset_type const horizontal = wavefront.at(&wavefront_type::horizontal, diagonal);
+                offset_type const vertical = wavefront.at(&wavefront_type::vertical, diagonal);
+                offset_type const begin_of_matches = std::max(mismatch, std::max(horizontal, vertical));
+
+                trace.insert(trace.end(), column - begin_of_matches, trace_directions::diagonal);
+                column = begin_of_matches;
+
+                if (mismatch == begin_of_matches)
+                {
+                    trace.push_back(trace_directions::diagonal);
+                    --column;
+                    penalty -= mismatch_penalty;
+                }
+                else
+                {
+                    current_component = (horizontal == begin_of_matches) ? component::horizontal : component::vertical;
+                }
+            }
+            else if (current_component == component::horizontal)
+            {
+                trace.push_back(trace_directions::left);
+                --column;
+                --diagonal;
+
+                if (match_at(gap_open_penalty, diagonal) == column)
+                {
+                    penalty -= gap_open_penalty;
+                    current_component = component::match;
+                }
+                else
+                {
+                    penalty -= gap_extension_penalty;
+                }
+            }
+            else
+            {
+                trace.push_back(trace_directions::up);
+                ++diagonal;
+
+                if (match_at(gap_open_penalty, diagonal) == column)
+                {
+                    penalty -= gap_open_penalty;
+                    current_component = component::match;
+                }
+                else
+                {
+                    penalty -= gap_extension_penalty;
+                }
+            }
+        }
+
+        std::ranges::reverse(trace);
+    }
+
+    /*!\brief Builds the alignment result of the last computed pair and invokes the callback.
+     * \param[in] sequence1 The first sequence.
+     * \param[in] sequence2 The second sequence.
+     * \param[in] id The id of the sequence pair.
+     * \param[in] callback The callback to invoke with the result.
+     */
+    template <typename sequence1_t, typename sequence2_t, typename index_t, typename callback_t>
+    void make_result_and_invoke([[maybe_unused]] sequence1_t && sequence1,
+                                [[maybe_unused]] sequence2_t && sequence2,
+                                [[maybe_unused]] index_t && id,
+                                callback_t & callback)
+    {
+        using result_value_type = typename alignment_result_value_type_accessor<alignment_result_type>::type;
+
+        result_value_type result{};
+
+        if constexpr (traits_type::output_sequence1_id)
+            result.sequence1_id = id;
+
+        if constexpr (traits_type::output_sequence2_id)
+            result.sequence2_id = id;
+
+        if constexpr (traits_type::compute_score)
+        {
+            int64_t const penalty = static_cast<int64_t>(optimal_penalty) * penalty_scale;
+            int64_t const size_sum = sequence1_size + sequence2_size;
+            result.score = static_cast<score_type>((match_score * size_sum - penalty) / 2);
+        }
+
+        if constexpr (traits_type::compute_end_positions)
+        {
+            result.end_positions.first = sequence1_size;
+            result.end_positions.second = sequence2_size;
+        }
+
+        if constexpr (traits_type::compute_begin_positions)
+        {
+            result.begin_positions.first = 0;
+            result.begin_positions.second = 0;
+        }
+
+        if constexpr (traits_type::compute_sequence_alignment)
+        {
+            matrix_coordinate const end_coordinate{row_index_type{sequence2_size}, column_index_type{sequence1_size}};
+            std::ranges::subrange<linear_memory_trace_iterator, std::default_sentinel_t> trace_path{
+                linear_memory_trace_iterator{trace, end_coordinate},
+                std::default_sentinel};
+
+            aligned_sequence_builder builder{sequence1, sequence2};
+            result.alignment = std::move(builder(trace_path).alignment);
+        }
+
+        if constexpr (traits_type::compute_cigar)
+        {
+            matrix_coordinate const end_coordinate{row_index_type{sequence2_size}, column_index_type{sequence1_size}};
+            std::ranges::subrange<linear_memory_trace_iterator, std::default_sentinel_t> trace_path{
+                linear_memory_trace_iterator{trace, end_coordinate},
+                std::default_sentinel};
+
+            result.cigar_sequence = std::move(cigar_sequence_builder(trace_path).cigar_sequence);
+        }
+
+        callback(std::move(result));
+    }
+
+    //!\brief The scalar scoring scheme.
+    scoring_scheme_type scoring_scheme{};
+    //!\brief The match score.
+    int64_t match_score{};
+    //!\brief The mismatch score.
+    int64_t mismatch_score{};
+    //!\brief The factor by which the penalties were divided.
+    int64_t penalty_scale{1};
+    //!\brief The penalty of a mismatch.
+    size_t mismatch_penalty{};
+    //!\brief The penalty of the first position of a gap.
+    size_t gap_open_penalty{};
+    //!\brief The penalty of every further position of a gap.
+    size_t gap_extension_penalty{};
+
+    //!\brief The wavefronts.
+    std::vector<wavefront_type> wavefronts{};
+    //!\brief The number of used wavefronts; the size of the ring buffer if no traceback is computed.
+    size_t used_wavefronts{};
+    //!\brief A wavefront in which no cell can be reached.
+    wavefront_type null_wavefront{};
+    //!\brief The trace directions from the begin to the end of the alignment.
+    std::vector<trace_directions> trace{};
+    //!\brief Builds the CIGAR sequence from the trace and keeps its buffer between the pairs.
+    cigar_builder cigar_sequence_builder{};
+
+    //!\brief The length of the first sequence.
+    size_t sequence1_size{};
+    //!\brief The length of the second sequence.
+    size_t sequence2_size{};
+    //!\brief The penalty of the optimal alignment; the penalty of the current wavefront during the computation.
+    size_t optimal_penalty{};
+};
+
+} // namespace seqan3::detail
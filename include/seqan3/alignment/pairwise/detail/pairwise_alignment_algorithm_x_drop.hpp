@@ -0,0 +1,444 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides seqan3::detail::pairwise_alignment_algorithm_x_drop.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <concepts>
+#include <cstdlib>
+#include <iterator>
+#include <limits>
+#include <ranges>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_drop_off.hpp>
+#include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
+#include <seqan3/alignment/pairwise/detail/concept.hpp>
+#include <seqan3/alignment/pairwise/detail/type_traits.hpp>
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/utility/container/aligned_allocator.hpp>
+#include <seqan3/utility/simd/algorithm.hpp>
+#include <seqan3/utility/simd/simd_traits.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Computes seed extensions with X-drop pruning and Z-drop termination.
+ * \ingroup alignment_pairwise
+ * \implements std::invocable
+ *
+ * \tparam alignment_configuration_t The configuration type; must be of type seqan3::configuration.
+ * \tparam alignment_scoring_scheme_t The scoring scheme used inside the kernel; the simd scoring scheme in
+ *                                    vectorised mode, otherwise the scalar scoring scheme.
+ *
+ * \details
+ *
+ * The matrix is computed along its antidiagonals, starting in the origin. The cells of one antidiagonal are stored
+ * by their row index and only depend on the two previous antidiagonals, so the kernel needs memory linear in the
+ * length of the second sequence. A cell is pruned (set to minus infinity) if its score falls more than the X-drop
+ * score below the best score of the previous antidiagonals. The next antidiagonal only covers the rows between the
+ * first and the last non-pruned cell, extended by one row downwards. The extension stops if all cells of an
+ * antidiagonal are pruned or if the Z-drop criterion holds for the best cell of the antidiagonal.
+ *
+ * In vectorised mode, the cells of an antidiagonal are computed with simd instructions. Because the rows increase and
+ * the columns decrease along an antidiagonal, the first sequence is stored in reverse such that the letters of both
+ * sequences can be loaded with contiguous simd loads. Scalar and vectorised mode compute identical results.
+ */
+template <typename alignment_configuration_t, typename alignment_scoring_scheme_t>
+    requires is_type_specialisation_of_v<alignment_configuration_t, configuration>
+class pairwise_alignment_algorithm_x_drop
+{
+private:
+    //!\brief The alignment configuration traits type.
+    using traits_type = alignment_configuration_traits<alignment_configuration_t>;
+    //!\brief The scalar score type.
+    using score_type = typename traits_type::original_score_type;
+    //!\brief The score type of the kernel: a simd vector in vectorised mode, otherwise the scalar score type.
+    using kernel_score_type = typename traits_type::score_type;
+    //!\brief The configured alignment result type.
+    using alignment_result_type = typename traits_type::alignment_result_type;
+    //!\brief The alphabet of the scoring scheme.
+    using scoring_scheme_alphabet_type = typename traits_type::scoring_scheme_alphabet_type;
+    //!\brief The type of an antidiagonal.
+    using antidiagonal_type = std::vector<score_type, aligned_allocator<score_type, alignof(kernel_score_type)>>;
+
+    static_assert(traits_type::is_global && traits_type::is_extension && !traits_type::is_banded,
+                  "The X-drop extension is only computed for unbanded global alignments with a drop-off.");
+
+    //!\brief The number of cells computed at once.
+    static constexpr size_t lanes = []()
+    {
+        if constexpr (traits_type::is_vectorised)
+            return simd_traits<kernel_score_type>::length;
+        else
+            return 1;
+    }();
+
+    //!\brief The score of pruned cells and cells outside the matrix. Leaves room for adding scores without overflow.
+    static constexpr score_type minus_infinity = std::numeric_limits<score_type>::lowest() / 2;
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    pairwise_alignment_algorithm_x_drop() = default;                                            //!< Defaulted.
+    pairwise_alignment_algorithm_x_drop(pairwise_alignment_algorithm_x_drop const &) = default; //!< Defaulted.
+    pairwise_alignment_algorithm_x_drop(pairwise_alignment_algorithm_x_drop &&) = default;      //!< Defaulted.
+    pairwise_alignment_algorithm_x_drop &
+    operator=(pairwise_alignment_algorithm_x_drop const &) = default;                                  //!< Defaulted.
+    pairwise_alignment_algorithm_x_drop & operator=(pairwise_alignment_algorithm_x_drop &&) = default; //!< Defaulted.
+    ~pairwise_alignment_algorithm_x_drop() = default;                                                  //!< Defaulted.
+
+    /*!\brief Constructs and initialises the algorithm using the alignment configuration.
+     * \param config The configuration passed into the algorithm.
+     */
+    pairwise_alignment_algorithm_x_drop(alignment_configuration_t const & config) :
+        scoring_scheme{seqan3::get<align_cfg::scoring_scheme>(config).scheme}
+    {
+        auto const & gap_scheme =
+            config.get_or(align_cfg::gap_cost_affine{align_cfg::open_score{-10}, align_cfg::extension_score{-1}});
+        gap_open_score = static_cast<score_type>(gap_scheme.open_score + gap_scheme.extension_score);
+        gap_extension_score = static_cast<score_type>(gap_scheme.extension_score);
+
+        if constexpr (alignment_configuration_t::template exists<align_cfg::x_drop>())
+            x_drop_score = config.get_or(align_cfg::x_drop{}).drop_score;
+
+        if constexpr (alignment_configuration_t::template exists<align_cfg::z_drop>())
+            z_drop_score = config.get_or(align_cfg::z_drop{}).drop_score;
+    }
+    //!\}
+
+    /*!\brief Computes the seed extensions of the given chunk of indexed sequence pairs.
+     * \tparam indexed_sequence_pairs_t The type of indexed_sequence_pairs; must model
+     *                                  seqan3::detail::indexed_sequence_pair_range.
+     * \tparam callback_t The type of the callback function; must model std::invocable with the alignment result.
+     *
+     * \param[in] indexed_sequence_pairs The chunk of indexed sequence pairs to be extended.
+     * \param[in] callback The callback function to be invoked with each computed alignment result.
+     */
+    template <indexed_sequence_pair_range indexed_sequence_pairs_t, typename callback_t>
+        requires std::invocable<callback_t, alignment_result_type>
+    void operator()(indexed_sequence_pairs_t && indexed_sequence_pairs, callback_t && callback)
+    {
+        using std::get;
+
+        for (auto && [sequence_pair, idx] : indexed_sequence_pairs)
+        {
+            compute_extension(get<0>(sequence_pair), get<1>(sequence_pair));
+            make_result_and_invoke(std::move(idx), callback);
+        }
+    }
+
+private:
+    /*!\brief Computes the extension of a single sequence pair.
+     * \param[in] sequence1 The first sequence (horizontal).
+     * \param[in] sequence2 The second sequence (vertical).
+     */
+    template <typename sequence1_t, typename sequence2_t>
+    void compute_extension(sequence1_t && sequence1, sequence2_t && sequence2)
+    {
+        initialise(sequence1, sequence2);
+
+        optimal_score = 0;
+        optimal_row = 0;
+        optimal_column = 0;
+
+        size_t first_row = 0;
+        size_t last_row = 0;
+
+        for (size_t antidiagonal = 1; antidiagonal <= sequence1_length + sequence2_length; ++antidiagonal)
+        {
+            first_row = std::max(first_row, antidiagonal - std::min(antidiagonal, sequence1_length));
+            last_row = std::min(last_row + 1, sequence2_length);
+
+            if (first_row > last_row)
+                break;
+
+            // Cells below this score are pruned. The bound keeps cells derived from pruned cells from surviving.
+            score_type const threshold = static_cast<score_type>(
+                std::max<int64_t>(int64_t{optimal_score} - x_drop_score, int64_t{minus_infinity} / 2));
+
+            compute_antidiagonal(antidiagonal, first_row, last_row, threshold);
+
+            // Shrink the row range to the non-pruned cells.
+            while (first_row <= last_row && h_current[first_row + 1] == minus_infinity)
+                ++first_row;
+            while (last_row > first_row && h_current[last_row + 1] == minus_infinity)
+                --last_row;
+
+            if (first_row > last_row || h_current[first_row + 1] == minus_infinity)
+                break;
+
+            if (!update_optimum_and_check_z_drop(antidiagonal, first_row, last_row))
+                break;
+
+            std::swap(h_before_previous, h_previous);
+            std::swap(h_previous, h_current);
+            std::swap(e_previous, e_current);
+            std::swap(f_previous, f_current);
+        }
+    }
+
+    /*!\brief Initialises the antidiagonals and the rank vectors for a new sequence pair.
+     * \param[in] sequence1 The first sequence.
+     * \param[in] sequence2 The second sequence.
+     *
+     * \details
+     *
+     * Row \f$i\f$ of an antidiagonal is stored at index \f$i + 1\f$, such that the row \f$-1\f$ above the matrix is
+     * a valid index holding minus infinity. All vectors are padded with seqan3::simd::simd_traits::length additional
+     * entries for the simd loads and stores beyond the last row.
+     */
+    template <typename sequence1_t, typename sequence2_t>
+    void initialise(sequence1_t & sequence1, sequence2_t & sequence2)
+    {
+        auto to_scoring_scheme_letter = [](auto const & letter)
+        {
+            return static_cast<scoring_scheme_alphabet_type>(letter);
+        };
+        auto to_scoring_scheme_rank = [&](auto const & letter)
+        {
+            return static_cast<score_type>(seqan3::to_rank(to_scoring_scheme_letter(letter)));
+        };
+
+        sequence1_length = std::ranges::distance(sequence1);
+        sequence2_length = std::ranges::distance(sequence2);
+
+        size_t const antidiagonal_size = sequence2_length + 2 + lanes;
+        for (antidiagonal_type * antidiagonal :
+             {&h_before_previous, &h_previous, &h_current, &e_previous, &e_current, &f_previous, &f_current})
+            antidiagonal->assign(antidiagonal_size, minus_infinity);
+
+        h_previous[1] = 0; // The origin.
+
+        if constexpr (traits_type::is_vectorised)
+        {
+            // ranks2[i] is the rank of the letter in row i, ranks1_reversed[n - j] the one of the letter in column j.
+            ranks2.assign(antidiagonal_size, 0);
+            std::ranges::transform(sequence2, ranks2.begin() + 1, to_scoring_scheme_rank);
+
+            ranks1_reversed.assign(sequence1_length + 1 + lanes, 0);
+            std::ranges::transform(sequence1, ranks1_reversed.rend() - sequence1_length, to_scoring_scheme_rank);
+        }
+        else
+        {
+            letters1.clear();
+            letters2.clear();
+            std::ranges::transform(sequence1, std::back_inserter(letters1), to_scoring_scheme_letter);
+            std::ranges::transform(sequence2, std::back_inserter(letters2), to_scoring_scheme_letter);
+        }
+    }
+
+    /*!\brief Computes the cells of an antidiagonal within the given row range.
+     * \param[in] antidiagonal The index of the antidiagonal, i.e. the sum of the row and the column index.
+     * \param[in] first_row The first row to compute.
+     * \param[in] last_row The last row to compute.
+     * \param[in] threshold The score below which a cell is pruned.
+     *
+     * \details
+     *
+     * For cell \f$(i, j)\f$, the horizontal gap continues from cell \f$(i, j - 1)\f$ and the vertical gap from cell
+     * \f$(i - 1, j)\f$, both on the previous antidiagonal, and the diagonal predecessor is cell \f$(i - 1, j - 1)\f$ on
+     * the antidiagonal before. Afterwards, the rows adjacent to the computed range are set to minus infinity.
+     */
+    void compute_antidiagonal(size_t const antidiagonal,
+                              size_t const first_row,
+                              size_t const last_row,
+                              score_type const threshold)
+    {
+        if constexpr (traits_type::is_vectorised)
+        {
+            kernel_score_type const gap_open = simd::fill<kernel_score_type>(gap_open_score);
+            kernel_score_type const gap_extension = simd::fill<kernel_score_type>(gap_extension_score);
+            kernel_score_type const pruned = simd::fill<kernel_score_type>(minus_infinity);
+            kernel_score_type const threshold_vector = simd::fill<kernel_score_type>(threshold);
+            for (size_t row = first_row; row <= last_row; row += lanes)
+            {
+                auto max = [](kernel_score_type const & lhs, kernel_score_type const & rhs)
+                {
+                    return (lhs < rhs) ? rhs : lhs;
+                };
+
+                kernel_score_type const horizontal =
+                    max(simd::load<kernel_score_type>(h_previous.data() + row + 1) + gap_open,
+                        simd::load<kernel_score_type>(e_previous.data() + row + 1) + gap_extension);
+                kernel_score_type const vertical =
+                    max(simd::load<kernel_score_type>(h_previous.data() + row) + gap_open,
+                        simd::load<kernel_score_type>(f_previous.data() + row) + gap_extension);
+
+                kernel_score_type const ranks1 =
+                    simd::load<kernel_score_type>(ranks1_reversed.data() + (row + sequence1_length - antidiagonal));
+                kernel_score_type const ranks2_vector = simd::load<kernel_score_type>(ranks2.data() + row);
+                kernel_score_type const diagonal =
+                    simd::load<kernel_score_type>(h_before_previous.data() + row)
+                    + scoring_scheme.score(scoring_scheme.make_score_profile(ranks1), ranks2_vector);
+
+                // Lanes beyond the last row are pruned as well.
+                size_t const row_count = std::min(lanes, last_row - row + 1);
+                kernel_score_type const best = max(diagonal, max(horizontal, vertical));
+                auto const is_pruned = (best < threshold_vector)
+                                     | (simd::iota<kernel_score_type>(0) >= simd::fill<kernel_score_type>(row_count));
+
+                simd::store(h_current.data() + row + 1, is_pruned ? pruned : best);
+                simd::store(e_current.data() + row + 1, is_pruned ? pruned : horizontal);
+                simd::store(f_current.data() + row + 1, is_pruned ? pruned : vertical);
+            }
+        }
+        else
+        {
+            for (size_t row = first_row; row <= last_row; ++row)
+            {
+                size_t const column = antidiagonal - row;
+                score_type const horizontal = std::max<score_type>(h_previous[row + 1] + gap_open_score,
+                                                                   e_previous[row + 1] + gap_extension_score);
+                score_type const vertical =
+                    std::max<score_type>(h_previous[row] + gap_open_score, f_previous[row] + gap_extension_score);
+                score_type diagonal = minus_infinity;
+                if (row > 0 && column > 0)
+                    diagonal = h_before_previous[row] + scoring_scheme.score(letters1[column - 1], letters2[row - 1]);
+
+                score_type const best = std::max(diagonal, std::max(horizontal, vertical));
+                bool const is_pruned = best < threshold;
+
+                h_current[row + 1] = is_pruned ? minus_infinity : best;
+                e_current[row + 1] = is_pruned ? minus_infinity : horizontal;
+                f_current[row + 1] = is_pruned ? minus_infinity : vertical;
+            }
+        }
+
+        for (antidiagonal_type * current : {&h_current, &e_current, &f_current})
+        {
+            (*current)[first_row] = minus_infinity;
+            (*current)[last_row + 2] = minus_infinity;
+        }
+    }
+
+    /*!\brief Updates the optimum with the best cell of the antidiagonal and checks the Z-drop criterion.
+     * \param[in] antidiagonal The index of the antidiagonal.
+     * \param[in] first_row The first non-pruned row.
+     * \param[in] last_row The last non-pruned row.
+     * \returns `false` if the extension stops, `true` otherwise.
+     *
+     * \details
+     *
+     * If several cells share the best score, the one on the first antidiagonal and with the smallest row index is
+     * the optimum.
+     */
+    bool update_optimum_and_check_z_drop(size_t const antidiagonal, size_t const first_row, size_t const last_row)
+    {
+        auto const first = h_current.begin() + first_row + 1;
+        auto const best_it = std::ranges::max_element(first, h_current.begin() + last_row + 2);
+        score_type const best = *best_it;
+        size_t const best_row = first_row + (best_it - first);
+
+        if (best > optimal_score)
+        {
+            optimal_score = best;
+            optimal_row = best_row;
+            optimal_column = antidiagonal - best_row;
+            return true;
+        }
+
+        if (z_drop_score == std::numeric_limits<int64_t>::max())
+            return true;
+
+        // The distance between the diagonals of both cells, i.e. the minimal length of a gap connecting them.
+        int64_t const row_difference = static_cast<int64_t>(best_row) - static_cast<int64_t>(optimal_row);
+        int64_t const column_difference =
+            static_cast<int64_t>(antidiagonal - best_row) - static_cast<int64_t>(optimal_column);
+        int64_t const diagonal_distance = std::abs(row_difference - column_difference);
+
+        return int64_t{optimal_score} - best <= z_drop_score - int64_t{gap_extension_score} * diagonal_distance;
+    }
+
+    /*!\brief Builds the alignment result of the last extension and invokes the callback.
+     * \param[in] id The id of the sequence pair.
+     * \param[in] callback The callback to invoke with the result.
+     */
+    template <typename index_t, typename callback_t>
+    void make_result_and_invoke([[maybe_unused]] index_t && id, callback_t & callback)
+    {
+        using result_value_type = typename alignment_result_value_type_accessor<alignment_result_type>::type;
+
+        result_value_type result{};
+
+        if constexpr (traits_type::output_sequence1_id)
+            result.sequence1_id = id;
+
+        if constexpr (traits_type::output_sequence2_id)
+            result.sequence2_id = id;
+
+        if constexpr (traits_type::compute_score)
+            result.score = optimal_score;
+
+        if constexpr (traits_type::compute_end_positions)
+        {
+            result.end_positions.first = optimal_column;
+            result.end_positions.second = optimal_row;
+        }
+
+        if constexpr (traits_type::compute_begin_positions)
+        {
+            result.begin_positions.first = 0;
+            result.begin_positions.second = 0;
+        }
+
+        callback(std::move(result));
+    }
+
+    //!\brief The scoring scheme.
+    alignment_scoring_scheme_t scoring_scheme{};
+    //!\brief The score for opening a gap, including the extension of its first position.
+    score_type gap_open_score{};
+    //!\brief The score for extending a gap.
+    score_type gap_extension_score{};
+    //!\brief The X-drop score; no cell is pruned if not configured.
+    int64_t x_drop_score{std::numeric_limits<int64_t>::max()};
+    //!\brief The Z-drop score; the criterion is not checked if not configured.
+    int64_t z_drop_score{std::numeric_limits<int64_t>::max()};
+
+    //!\brief The best scores of the antidiagonal before the previous one.
+    antidiagonal_type h_before_previous{};
+    //!\brief The best scores of the previous antidiagonal.
+    antidiagonal_type h_previous{};
+    //!\brief The best scores of the current antidiagonal.
+    antidiagonal_type h_current{};
+    //!\brief The horizontal gap scores of the previous antidiagonal.
+    antidiagonal_type e_previous{};
+    //!\brief The horizontal gap scores of the current antidiagonal.
+    antidiagonal_type e_current{};
+    //!\brief The vertical gap scores of the previous antidiagonal.
+    antidiagonal_type f_previous{};
+    //!\brief The vertical gap scores of the current antidiagonal.
+    antidiagonal_type f_current{};
+
+    //!\brief The ranks of the first sequence in reverse order (vectorised mode).
+    antidiagonal_type ranks1_reversed{};
+    //!\brief The ranks of the second sequence, starting at index 1 (vectorised mode).
+    antidiagonal_type ranks2{};
+    //!\brief The letters of the first sequence (scalar mode).
+    std::vector<scoring_scheme_alphabet_type> letters1{};
+    //!\brief The letters of the second sequence (scalar mode).
+    std::vector<scoring_scheme_alphabet_type> letters2{};
+
+    //!\brief The length of the first sequence.
+    size_t sequence1_length{};
+    //!\brief The length of the second sequence.
+    size_t sequence2_length{};
+
+    //!\brief The best score of the extension.
+    score_type optimal_score{};
+    //!\brief The row index of the best cell.
+    size_t optimal_row{};
+    //!\brief The column index of the best cell.
+    size_t optimal_column{};
+};
+
+} // namespace seqan3::detail
@@ -0,0 +1,139 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides seqan3::detail::pairwise_alignment_batches.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <ranges>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/pairwise/detail/concept.hpp>
+#include <seqan3/alignment/pairwise/detail/type_traits.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Distributes the sequence pairs of a chunk to batches and reports the results in the order of the chunk.
+ * \ingroup alignment_pairwise
+ *
+ * \tparam alignment_configuration_t The configuration type; must be of type seqan3::configuration.
+ * \tparam function_wrapper_t The type-erased alignment function the chunks are passed to.
+ *
+ * \details
+ *
+ * The algorithms regrouping the sequence pairs of a chunk, i.e. seqan3::detail::pairwise_alignment_algorithm_length_sorted
+ * and seqan3::detail::pairwise_alignment_algorithm_adaptive_width, store the pairs of the current chunk in this
+ * buffer, pass them in batches of chosen positions to a wrapped algorithm and collect the results until the whole
+ * chunk is computed. The buffers are reused for every chunk.
+ */
+template <typename alignment_configuration_t, typename function_wrapper_t>
+    requires is_type_specialisation_of_v<alignment_configuration_t, configuration>
+class pairwise_alignment_batches
+{
+private:
+    //!\brief The configured alignment result type.
+    using alignment_result_type =
+        typename alignment_configuration_traits<alignment_configuration_t>::alignment_result_type;
+    //!\brief The type of a chunk of indexed sequence pairs.
+    using chunk_type = typename alignment_function_traits<function_wrapper_t>::sequence_input_type;
+    //!\brief The type of the callback invoked with every result.
+    using callback_type = typename alignment_function_traits<function_wrapper_t>::callback_type;
+    //!\brief The reference type of an indexed sequence pair within a chunk.
+    using chunk_reference_type = std::ranges::range_reference_t<chunk_type>;
+    //!\brief The reference type of a sequence pair within a chunk.
+    using sequence_pair_type = decltype(std::get<0>(std::declval<chunk_reference_type &>()));
+    //!\brief The type of the index of a sequence pair.
+    using index_type = std::remove_cvref_t<decltype(std::get<1>(std::declval<chunk_reference_type &>()))>;
+
+public:
+    //!\brief A batch of indexed sequence pairs; the sequences are stored as references.
+    using batch_type = std::vector<std::tuple<std::tuple<decltype(std::get<0>(std::declval<sequence_pair_type>())),
+                                                         decltype(std::get<1>(std::declval<sequence_pair_type>()))>,
+                                              index_type>>;
+    //!\brief The type-erased alignment algorithm computing one batch.
+    using batch_algorithm_type = std::function<void(batch_type &, callback_type)>;
+
+    /*!\brief Stores the sequence pairs of the given chunk and discards the results of the previous chunk.
+     * \tparam indexed_sequence_pairs_t The type of indexed_sequence_pairs; must model
+     *                                  seqan3::detail::indexed_sequence_pair_range.
+     * \param[in] indexed_sequence_pairs The chunk of indexed sequence pairs to be aligned.
+     */
+    template <indexed_sequence_pair_range indexed_sequence_pairs_t>
+    void assign(indexed_sequence_pairs_t && indexed_sequence_pairs)
+    {
+        using std::get;
+
+        sequence_pairs.clear();
+        for (auto && [sequence_pair, index] : indexed_sequence_pairs)
+            sequence_pairs.emplace_back(std::forward_as_tuple(get<0>(sequence_pair), get<1>(sequence_pair)), index);
+
+        results.clear();
+        results.resize(sequence_pairs.size());
+    }
+
+    //!\brief Returns the sequence pairs of the current chunk.
+    batch_type const & pairs() const noexcept
+    {
+        return sequence_pairs;
+    }
+
+    /*!\brief Computes the sequence pairs at the given positions of the chunk in batches of the given size.
+     * \param[in] positions The positions within the chunk of the sequence pairs to compute.
+     * \param[in] batch_size The maximal number of sequence pairs of one batch.
+     * \param[in] batch_algorithm The algorithm computing a batch.
+     */
+    void compute(std::vector<size_t> const & positions,
+                 size_t const batch_size,
+                 batch_algorithm_type const & batch_algorithm)
+    {
+        for (size_t first = 0; first < positions.size(); first += batch_size)
+        {
+            size_t const last = std::min(first + batch_size, positions.size());
+
+            // The tuples hold references, hence the batch must not assign to existing elements.
+            batch.clear();
+            for (size_t position = first; position < last; ++position)
+                batch.push_back(sequence_pairs[positions[position]]);
+
+            size_t position = first;
+            batch_algorithm(batch,
+                            [&](alignment_result_type result)
+                            {
+                                results[positions[position++]] = std::move(result);
+                            });
+        }
+    }
+
+    /*!\brief Invokes the callback with the results of the current chunk in the order of the chunk.
+     * \tparam callback_t The type of the callback function; must model std::invocable with the alignment result.
+     * \param[in] callback The callback function to be invoked with each computed alignment result.
+     */
+    template <typename callback_t>
+        requires std::invocable<callback_t, alignment_result_type>
+    void report(callback_t && callback)
+    {
+        for (std::optional<alignment_result_type> & result : results)
+            callback(std::move(*result));
+    }
+
+private:
+    //!\brief The sequence pairs of the current chunk.
+    batch_type sequence_pairs{};
+    //!\brief The batch that is currently computed.
+    batch_type batch{};
+    //!\brief The results of the current chunk in the order of the chunk.
+    std::vector<std::optional<alignment_result_type>> results{};
+};
+
+} // namespace seqan3::detail
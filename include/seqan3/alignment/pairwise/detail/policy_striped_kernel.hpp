@@ -0,0 +1,306 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides seqan3::detail::policy_striped_kernel.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_method.hpp>
+#include <seqan3/alignment/pairwise/detail/type_traits.hpp>
+#include <seqan3/utility/container/aligned_allocator.hpp>
+#include <seqan3/utility/simd/algorithm.hpp>
+#include <seqan3/utility/simd/simd_traits.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Implements the striped intra-sequence simd kernel of Farrar (2007) for affine gap costs.
+ * \ingroup alignment_pairwise
+ *
+ * \tparam alignment_configuration_t The type of the alignment configuration.
+ *
+ * \details
+ *
+ * The matrix is computed line by line, where a line is either a column
+ * (seqan3::detail::pairwise_alignment_algorithm_striped) or a row
+ * (seqan3::detail::pairwise_alignment_algorithm_query_profile). The sequence along a line is split into
+ * seqan3::simd::simd_traits::length segments, one per lane, such that the position `p` of a line is stored in lane
+ * `p / segment_count` of the vector `p % segment_count`. The recursion is symmetric, hence both orientations compute
+ * the same scores.
+ *
+ * The gaps running across the lines (E) are stored for the whole line. The gaps running along a line (F) cross the
+ * segment boundaries and are fixed by the lazy-F loop after the line was computed. The algorithms inheriting from
+ * this policy provide the striped profile of every line and select the optimum.
+ *
+ * \note For more information, please refer to the original article:
+ *       FARRAR, Michael. Striped Smith-Waterman speeds database searches six times over other SIMD implementations.
+ *       Bioinformatics, 2007, 23. Jg., Nr. 2, S. 156-161.
+ */
+template <typename alignment_configuration_t>
+class policy_striped_kernel
+{
+protected:
+    //!\brief The configuration traits type.
+    using traits_type = alignment_configuration_traits<alignment_configuration_t>;
+    //!\brief The simd vector type holding the scores of one segment row.
+    using score_type = typename traits_type::score_type;
+    //!\brief The scalar score type.
+    using scalar_score_type = typename traits_type::original_score_type;
+    //!\brief The type of a line of simd vectors.
+    using score_line_type = std::vector<score_type, aligned_allocator<score_type, alignof(score_type)>>;
+
+    //!\brief The number of segments a line is split into.
+    static constexpr size_t lanes = simd_traits<score_type>::length;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    policy_striped_kernel() = default;                                          //!< Defaulted.
+    policy_striped_kernel(policy_striped_kernel const &) = default;             //!< Defaulted.
+    policy_striped_kernel(policy_striped_kernel &&) = default;                  //!< Defaulted.
+    policy_striped_kernel & operator=(policy_striped_kernel const &) = default; //!< Defaulted.
+    policy_striped_kernel & operator=(policy_striped_kernel &&) = default;      //!< Defaulted.
+    ~policy_striped_kernel() = default;                                         //!< Defaulted.
+
+    /*!\brief Construction and initialisation using the alignment configuration.
+     * \param[in] config The alignment configuration.
+     *
+     * \details
+     *
+     * Initialises the gap scores and the free end-gaps. If no gap cost model was provided by the user the default gap
+     * costs `-10` and `-1` are set for the gap open score and the gap extension score respectively.
+     */
+    explicit policy_striped_kernel(alignment_configuration_t const & config)
+    {
+        auto const & gap_scheme =
+            config.get_or(align_cfg::gap_cost_affine{align_cfg::open_score{-10}, align_cfg::extension_score{-1}});
+        gap_extension_score = static_cast<scalar_score_type>(gap_scheme.extension_score);
+        gap_open_score = static_cast<scalar_score_type>(gap_scheme.open_score) + gap_extension_score;
+
+        if constexpr (traits_type::is_global)
+        {
+            auto const & method_global_config = config.get_or(align_cfg::method_global{});
+            first_row_is_free = method_global_config.free_end_gaps_sequence1_leading;
+            first_column_is_free = method_global_config.free_end_gaps_sequence2_leading;
+            last_row_is_free = method_global_config.free_end_gaps_sequence1_trailing;
+            last_column_is_free = method_global_config.free_end_gaps_sequence2_trailing;
+        }
+    }
+    //!\}
+
+    /*!\brief Initialises the first line from the scores of its cells.
+     * \tparam boundary_score_t The type of the function returning the score of a cell of the first line.
+     * \param[in] boundary_score Returns the score of the cell at the given (1-based) position of the first line.
+     *
+     * \details
+     *
+     * The member segment_count must be set before.
+     */
+    template <typename boundary_score_t>
+    void initialise_first_line(boundary_score_t && boundary_score)
+    {
+        h_previous.assign(segment_count, simd::fill<score_type>(0));
+        h_current.assign(segment_count, simd::fill<score_type>(0));
+        e_line.assign(segment_count, simd::fill<score_type>(0));
+
+        for (size_t k = 0; k < segment_count; ++k)
+        {
+            for (size_t lane = 0; lane < lanes; ++lane)
+            {
+                scalar_score_type const score = boundary_score(lane * segment_count + k + 1);
+                h_previous[k][lane] = score;
+                e_line[k][lane] = score + gap_open_score;
+            }
+        }
+    }
+
+    /*!\brief Computes the next line of the matrix.
+     * \tparam track_maximum_t The type of the function tracking the maximum of the local alignment.
+     * \param[in] line_profile The striped profile of the letter of the current line.
+     * \param[in] previous_first The score of the cell in the first row or column of the previous line.
+     * \param[in] current_first The score of the cell in the first row or column of the current line.
+     * \param[in] track_maximum Invoked with the segment index and the scores of every computed vector; only invoked in
+     *                          the local alignment.
+     *
+     * \details
+     *
+     * Afterwards, h_previous holds the scores of the computed line.
+     */
+    template <typename track_maximum_t>
+    void compute_line(score_type const * line_profile,
+                      scalar_score_type const previous_first,
+                      scalar_score_type const current_first,
+                      track_maximum_t && track_maximum)
+    {
+        score_type const gap_open = simd::fill<score_type>(gap_open_score);
+        score_type const gap_extension = simd::fill<score_type>(gap_extension_score);
+        score_type const zero = simd::fill<score_type>(0);
+        score_type const minus_infinity = simd::fill<score_type>(minus_infinity_score());
+
+        // The first vector takes its diagonal from the last vector of the previous line, shifted by one segment.
+        score_type diagonal = shift_lanes_up(h_previous[segment_count - 1], previous_first);
+        score_type f = minus_infinity;
+        f[0] = current_first + gap_open_score;
+
+        for (size_t k = 0; k < segment_count; ++k)
+        {
+            score_type e = e_line[k];
+            score_type best = diagonal + line_profile[k];
+            best = (best < f) ? f : best;
+            best = (best < e) ? e : best;
+            if constexpr (traits_type::is_local)
+            {
+                best = (best < zero) ? zero : best;
+                track_maximum(k, best);
+            }
+            h_current[k] = best;
+
+            score_type const open = best + gap_open;
+            e += gap_extension;
+            e_line[k] = (e < open) ? open : e;
+            f += gap_extension;
+            f = (f < open) ? open : f;
+            diagonal = h_previous[k];
+        }
+
+        // Lazy-F loop: propagate the gaps along the line across the segment boundaries until they cannot improve a cell.
+        f = shift_lanes_up(f, minus_infinity_score());
+        for (size_t k = 0; any_lane(f > h_current[k] + gap_open);)
+        {
+            score_type best = h_current[k];
+            best = (best < f) ? f : best;
+            h_current[k] = best;
+            if constexpr (traits_type::is_local)
+                track_maximum(k, best);
+
+            score_type const open = best + gap_open;
+            e_line[k] = (e_line[k] < open) ? open : e_line[k];
+            f += gap_extension;
+            f = (f < minus_infinity) ? minus_infinity : f;
+
+            if (++k == segment_count)
+            {
+                k = 0;
+                f = shift_lanes_up(f, minus_infinity_score());
+            }
+        }
+
+        std::swap(h_previous, h_current);
+    }
+
+    /*!\brief Replaces the optimum if the given score is at least as good (the last tracked cell wins on ties).
+     * \param[in] score The score of the cell.
+     * \param[in] column The column index of the cell.
+     * \param[in] row The row index of the cell.
+     */
+    void update_optimum(scalar_score_type const score, size_t const column, size_t const row) noexcept
+    {
+        if (score >= optimal_score)
+        {
+            optimal_score = score;
+            optimal_column = column;
+            optimal_row = row;
+        }
+    }
+
+    /*!\brief Returns the score of the given position in the most recently computed line.
+     * \param[in] position The 0-based position within the line.
+     */
+    scalar_score_type line_score(size_t const position) const noexcept
+    {
+        return h_previous[position % segment_count][position / segment_count];
+    }
+
+    /*!\brief Returns the score of the cell in the first row of the given column.
+     * \param[in] column The column index.
+     */
+    scalar_score_type first_row_score(size_t const column) const noexcept
+    {
+        if (traits_type::is_local || first_row_is_free || column == 0)
+            return 0;
+
+        return gap_open_score + static_cast<scalar_score_type>(column - 1) * gap_extension_score;
+    }
+
+    /*!\brief Returns the score of the cell in the first column of the given row.
+     * \param[in] row The row index.
+     */
+    scalar_score_type first_column_score(size_t const row) const noexcept
+    {
+        if (traits_type::is_local || first_column_is_free || row == 0)
+            return 0;
+
+        return gap_open_score + static_cast<scalar_score_type>(row - 1) * gap_extension_score;
+    }
+
+    //!\brief A score that stays representable when the gap scores are added to it.
+    scalar_score_type minus_infinity_score() const noexcept
+    {
+        return std::numeric_limits<scalar_score_type>::lowest() - std::min<scalar_score_type>(gap_open_score, 0)
+             - std::min<scalar_score_type>(gap_extension_score, 0);
+    }
+
+    /*!\brief Moves every lane to the next higher lane and inserts the given value into the first lane.
+     * \param[in] vector The vector to shift.
+     * \param[in] first The value of the first lane.
+     */
+    static score_type shift_lanes_up(score_type const & vector, scalar_score_type const first) noexcept
+    {
+        return [&]<size_t... lane_index>(std::index_sequence<lane_index...>)
+        {
+            return score_type{first, vector[lane_index]...};
+        }(std::make_index_sequence<lanes - 1>{});
+    }
+
+    /*!\brief Returns whether any lane of the given comparison mask is set.
+     * \param[in] mask The comparison mask.
+     */
+    template <typename mask_t>
+    static bool any_lane(mask_t const & mask) noexcept
+    {
+        bool result = false;
+        for (size_t lane = 0; lane < lanes; ++lane)
+            result |= (mask[lane] != 0);
+        return result;
+    }
+
+    //!\brief The score of the first gap (gap open plus gap extension).
+    scalar_score_type gap_open_score{};
+    //!\brief The score of every further gap.
+    scalar_score_type gap_extension_score{};
+    //!\brief Whether leading gaps in the first sequence are free.
+    bool first_row_is_free{false};
+    //!\brief Whether leading gaps in the second sequence are free.
+    bool first_column_is_free{false};
+    //!\brief Whether trailing gaps in the first sequence are free.
+    bool last_row_is_free{false};
+    //!\brief Whether trailing gaps in the second sequence are free.
+    bool last_column_is_free{false};
+
+    //!\brief The number of vectors per line.
+    size_t segment_count{};
+    //!\brief The optimal scores of the previous line (swapped with the current line after every line).
+    score_line_type h_previous{};
+    //!\brief The optimal scores of the current line.
+    score_line_type h_current{};
+    //!\brief The scores of the gaps running across the lines, i.e. entering the next line.
+    score_line_type e_line{};
+
+    //!\brief The optimal score.
+    scalar_score_type optimal_score{};
+    //!\brief The column index of the optimum.
+    size_t optimal_column{};
+    //!\brief The row index of the optimum.
+    size_t optimal_row{};
+};
+
+} // namespace seqan3::detail
@@ -12,15 +12,19 @@
 #include <ranges>
 #include <type_traits>
 
+#include <seqan3/alignment/configuration/align_config_adaptive_score_width.hpp>
 #include <seqan3/alignment/configuration/align_config_band.hpp>
 #include <seqan3/alignment/configuration/align_config_debug.hpp>
+#include <seqan3/alignment/configuration/align_config_drop_off.hpp>
 #include <seqan3/alignment/configuration/align_config_method.hpp>
 #include <seqan3/alignment/configuration/align_config_on_result.hpp>
 #include <seqan3/alignment/configuration/align_config_output.hpp>
+#include <seqan3/alignment/configuration/align_config_query_profile.hpp>
 #include <seqan3/alignment/configuration/align_config_parallel.hpp>
 #include <seqan3/alignment/configuration/align_config_result_type.hpp>
 #include <seqan3/alignment/configuration/align_config_score_type.hpp>
 #include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
+#include <seqan3/alignment/configuration/align_config_sort_by_length.hpp>
 #include <seqan3/alignment/configuration/align_config_vectorised.hpp>
 #include <seqan3/alignment/matrix/detail/matrix_coordinate.hpp>
 #include <seqan3/alignment/matrix/detail/trace_directions.hpp>
@@ -118,6 +122,12 @@ public:
     static constexpr bool is_local = configuration_t::template exists<seqan3::align_cfg::method_local>();
     //!\brief Flag indicating whether banded alignment mode is enabled.
     static constexpr bool is_banded = configuration_t::template exists<align_cfg::band_fixed_size>();
+    //!\brief Flag indicating whether the global alignment is a seed extension with X-drop or Z-drop.
+    static constexpr bool is_extension =
+        configuration_t::template exists<align_cfg::x_drop>() || configuration_t::template exists<align_cfg::z_drop>();
+    //!\brief Flag indicating whether the sequence pairs are sorted by length before they are vectorised.
+    static constexpr bool is_length_sorted =
+        is_vectorised && configuration_t::template exists<align_cfg::sort_by_length>();
     //!\brief Flag indicating whether debug mode is enabled.
     static constexpr bool is_debug = configuration_t::template exists<detail::debug_mode>();
     //!\brief Flag indicating whether a user provided callback was given.
@@ -142,10 +152,26 @@ public:
     using matrix_coordinate_type =
         lazy_conditional_t<is_vectorised, lazy<simd_matrix_coordinate, matrix_index_type>, matrix_coordinate>;
 
+    /*!\brief Flag indicating whether the vectorised alignment selects the score width per sequence pair.
+     *
+     * \details
+     *
+     * This is the case if seqan3::align_cfg::adaptive_score_width is configured for an unbanded vectorised alignment
+     * that computes neither the alignment, its CIGAR sequence nor the begin positions.
+     * See seqan3::detail::pairwise_alignment_algorithm_adaptive_width.
+     */
+    static constexpr bool is_adaptive_score_width =
+        is_vectorised && !is_banded && !is_extension && !is_debug
+        && configuration_t::template exists<align_cfg::adaptive_score_width>()
+        && !configuration_t::template exists<align_cfg::output_begin_position>()
+        && !configuration_t::template exists<align_cfg::output_alignment>()
+        && !configuration_t::template exists<align_cfg::output_cigar>();
     //!\brief The number of alignments that can be computed in one simd vector.
     static constexpr size_t alignments_per_vector = []() constexpr
     {
-        if constexpr (is_vectorised)
+        if constexpr (is_adaptive_score_width)
+            return simd_traits<simd_type_t<int8_t>>::length;
+        else if constexpr (is_vectorised)
             return simd_traits<score_type>::length;
         else
             return 1;
@@ -159,16 +185,22 @@ public:
         configuration_t::template exists<align_cfg::output_begin_position>();
     //!\brief Flag indicating whether the sequence alignment shall be computed.
     static constexpr bool compute_sequence_alignment = configuration_t::template exists<align_cfg::output_alignment>();
+    //!\brief Flag indicating whether the CIGAR sequence of the alignment shall be computed.
+    static constexpr bool compute_cigar = configuration_t::template exists<align_cfg::output_cigar>();
     //!\brief Flag indicating whether the id of the first sequence shall be returned.
     static constexpr bool output_sequence1_id = configuration_t::template exists<align_cfg::output_sequence1_id>();
     //!\brief Flag indicating whether the id of the second sequence shall be returned.
     static constexpr bool output_sequence2_id = configuration_t::template exists<align_cfg::output_sequence2_id>();
     //!\brief Flag indicating if any output option was set.
     static constexpr bool has_output_configuration = compute_score || compute_end_positions || compute_begin_positions
-                                                  || compute_sequence_alignment || output_sequence1_id
+                                                  || compute_sequence_alignment || compute_cigar || output_sequence1_id
                                                   || output_sequence2_id;
     //!\brief Flag indicating whether the trace matrix needs to be computed.
-    static constexpr bool requires_trace_information = compute_begin_positions || compute_sequence_alignment;
+    static constexpr bool requires_trace_information =
+        compute_begin_positions || compute_sequence_alignment || compute_cigar;
+    //!\brief Flag indicating whether the second sequences are aligned against a query profile of the first sequence.
+    static constexpr bool is_query_profile = is_vectorised && !is_debug && !requires_trace_information
+                                          && configuration_t::template exists<align_cfg::query_profile>();
 };
 
 //------------------------------------------------------------------------------
@@ -9,10 +9,14 @@
 
 #pragma once
 
+#include <algorithm>
+#include <limits>
 #include <tuple>
 
 #include <seqan3/alignment/configuration/align_config_edit.hpp>
 #include <seqan3/alignment/pairwise/detail/concept.hpp>
+#include <seqan3/alignment/pairwise/edit_distance_banded.hpp>
+#include <seqan3/alignment/pairwise/edit_distance_simd.hpp>
 #include <seqan3/alignment/pairwise/edit_distance_unbanded.hpp>
 
 namespace seqan3::detail
@@ -43,6 +47,17 @@ private:
 
     static_assert(!std::same_as<alignment_result_type, empty_type>, "Alignment result type was not configured.");
 
+    /*!\brief Whether the sequence pairs can be computed with seqan3::detail::edit_distance_simd.
+     *
+     * \details
+     *
+     * This is the case if seqan3::align_cfg::vectorised is configured and neither a band nor any output that requires
+     * the trace matrix, i.e. the alignment or the begin positions.
+     */
+    static constexpr bool use_simd = configuration_traits_type::is_vectorised && !configuration_traits_type::is_banded
+                                  && !configuration_traits_type::is_debug
+                                  && !configuration_traits_type::requires_trace_information;
+
 public:
     /*!\name Constructors, destructor and assignment
      * \{
@@ -64,9 +79,17 @@ public:
      * incompatible configurations between the passed configuration and the one used during configuration of this
      * class. Further, the function object will be stored in a std::function which requires copyable objects and
      * in parallel executions the function object must be copied as well.
+     *
+     * \throws seqan3::invalid_alignment_configuration if a band is configured that cannot be used.
      */
     constexpr edit_distance_algorithm(config_t const & cfg) : cfg_ptr{new config_t(cfg)}
-    {}
+    {
+        if constexpr (configuration_traits_type::is_banded)
+        {
+            auto const & band = get<align_cfg::band_fixed_size>(cfg);
+            check_edit_distance_band(band.lower_diagonal, band.upper_diagonal, traits_t::is_semi_global_type::value);
+        }
+    }
     //!}
 
     /*!\brief Invokes the alignment computation for every indexed sequence pair contained in the given range.
@@ -83,6 +106,11 @@ public:
      *
      * Computes for each contained sequence pair the respective alignment and invokes the given callback for each
      * alignment result.
+     *
+     * If seqan3::align_cfg::vectorised is configured and all queries, i.e. the second sequences, have a length
+     * between 1 and 64, the sequence pairs are computed with one sequence pair per simd lane, see
+     * seqan3::detail::edit_distance_simd. If all queries fit into 32 bits, twice as many sequence pairs are computed
+     * at once. Otherwise, the sequence pairs are computed one after another.
      */
     template <indexed_sequence_pair_range indexed_sequence_pairs_t, typename callback_t>
         requires std::invocable<callback_t, alignment_result_type>
@@ -90,6 +118,24 @@ public:
     {
         using std::get;
 
+        if constexpr (use_simd)
+        {
+            size_t min_query_size = std::numeric_limits<size_t>::max();
+            size_t max_query_size = 0u;
+
+            for (auto && [sequence_pair, index] : indexed_sequence_pairs)
+            {
+                size_t const query_size = std::ranges::distance(get<1>(sequence_pair));
+                min_query_size = std::min(min_query_size, query_size);
+                max_query_size = std::max(max_query_size, query_size);
+            }
+
+            if (min_query_size > 0u && max_query_size <= 32u)
+                return compute_simd<uint32_t>(indexed_sequence_pairs, callback);
+            else if (min_query_size > 0u && max_query_size <= 64u)
+                return compute_simd<uint64_t>(indexed_sequence_pairs, callback);
+        }
+
         for (auto && [sequence_pair, index] : indexed_sequence_pairs)
             compute_single_pair(index,
                                 get<0>(sequence_pair),
@@ -98,6 +144,33 @@ public:
     }
 
 private:
+    /*!\brief Computes the sequence pairs in batches with seqan3::detail::edit_distance_simd.
+     * \tparam word_t The unsigned type of one simd lane; no query may be longer than the bits of this type.
+     * \param[in] indexed_sequence_pairs The indexed sequence pairs to align.
+     * \param[in] callback The callback function to be invoked with the alignment result.
+     */
+    template <typename word_t, typename indexed_sequence_pairs_t, typename callback_t>
+    void compute_simd(indexed_sequence_pairs_t && indexed_sequence_pairs, callback_t && callback)
+    {
+        using std::get;
+        using sequence_pair_t = std::tuple_element_t<0, std::ranges::range_value_t<indexed_sequence_pairs_t>>;
+        using query_t = std::tuple_element_t<1, std::remove_cvref_t<sequence_pair_t>>;
+        using query_alphabet_t = std::remove_cvref_t<std::ranges::range_reference_t<query_t>>;
+
+        edit_distance_simd<word_t, query_alphabet_t, config_t, typename traits_t::is_semi_global_type> algo{*cfg_ptr};
+
+        for (auto && [sequence_pair, index] : indexed_sequence_pairs)
+        {
+            algo.add(index, get<0>(sequence_pair), get<1>(sequence_pair));
+
+            if (algo.full())
+                algo(callback);
+        }
+
+        if (!algo.empty())
+            algo(callback);
+    }
+
     /*!\brief Invokes the actual alignment computation for a single pair of sequences.
      * \tparam    first_range_t  The type of the first sequence (or packed sequences); must model
      *                           std::ranges::forward_range.
@@ -119,6 +192,23 @@ private:
                                                              second_range_t,
                                                              config_t,
                                                              typename traits_t::is_semi_global_type>;
+
+        if constexpr (configuration_traits_type::is_banded)
+        {
+            // A band that covers the entire matrix does not restrict the alignment.
+            auto const & band = get<align_cfg::band_fixed_size>(*cfg_ptr);
+            bool const band_covers_matrix =
+                band.lower_diagonal <= -static_cast<int64_t>(std::ranges::distance(second_range))
+                && band.upper_diagonal >= static_cast<int64_t>(std::ranges::distance(first_range));
+
+            if (!band_covers_matrix)
+            {
+                edit_distance_banded algo{first_range, second_range, *cfg_ptr, edit_traits{}};
+                algo(idx, callback);
+                return;
+            }
+        }
+
         edit_distance_unbanded algo{first_range, second_range, *cfg_ptr, edit_traits{}};
         algo(idx, callback);
     }
@@ -0,0 +1,554 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides a pairwise alignment algorithm for edit distance with a band.
+ * \author Marcel Ehrhardt <marcel.ehrhardt AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <limits>
+#include <ranges>
+#include <string>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_band.hpp>
+#include <seqan3/alignment/exception.hpp>
+#include <seqan3/alignment/matrix/detail/advanceable_alignment_coordinate.hpp>
+#include <seqan3/alignment/matrix/detail/aligned_sequence_builder.hpp>
+#include <seqan3/alignment/matrix/detail/cigar_builder.hpp>
+#include <seqan3/alignment/matrix/detail/edit_distance_trace_matrix_banded.hpp>
+#include <seqan3/alignment/matrix/detail/matrix_concept.hpp>
+#include <seqan3/alignment/pairwise/alignment_result.hpp>
+#include <seqan3/alignment/pairwise/edit_distance_fwd.hpp>
+#include <seqan3/core/configuration/configuration.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Checks whether a band can be used for the edit distance.
+ * \ingroup alignment_pairwise
+ * \param[in] lower          The lower diagonal of the band.
+ * \param[in] upper          The upper diagonal of the band.
+ * \param[in] is_semi_global Whether the leading gaps of the database are free.
+ * \throws seqan3::invalid_alignment_configuration if the band cannot be used.
+ *
+ * \details
+ *
+ * The gaps of the query are never free, hence the band must start in the first column. For global alignments the band
+ * must contain the origin of the matrix.
+ */
+inline void check_edit_distance_band(int64_t const lower, int64_t const upper, bool const is_semi_global)
+{
+    std::string error_cause{};
+
+    if (upper < lower)
+        error_cause = " The upper diagonal is smaller than the lower diagonal.";
+    else if (upper < 0 || (lower > 0 && !is_semi_global))
+        error_cause = " The band starts in a region without free gaps.";
+
+    if (!error_cause.empty())
+        throw invalid_alignment_configuration{"The selected band [" + std::to_string(lower) + ":"
+                                              + std::to_string(upper)
+                                              + "] cannot be used with the current alignment configuration:"
+                                              + error_cause};
+}
+
+/*!\brief This calculates an alignment using the edit distance within a band.
+ * \ingroup alignment_pairwise
+ * \tparam database_t     \copydoc default_edit_distance_trait_type::database_type
+ * \tparam query_t        \copydoc default_edit_distance_trait_type::query_type
+ * \tparam align_config_t The configuration type; must be of type seqan3::configuration and contain
+ *                        seqan3::align_cfg::band_fixed_size.
+ * \tparam edit_traits    The traits type; see seqan3::detail::default_edit_distance_trait_type.
+ *
+ * \details
+ *
+ * Computes the bit-parallel edit distance of Myers/Hyyrö restricted to the diagonals
+ * `[lower_diagonal, upper_diagonal]` of the alignment matrix. Cells outside of the band cannot be part of an
+ * alignment. Instead of the full columns only the `band_size = upper_diagonal - lower_diagonal + 1` cells of the band
+ * are represented as bit-vectors. Because the band moves down by one row per column, the vertical differences are
+ * shifted by one bit after each column (diagonal orientation). Hence, the run time is
+ * \f$O(\lceil band\_size / w \rceil \cdot |database|)\f$ instead of
+ * \f$O(\lceil |query| / w \rceil \cdot |database|)\f$.
+ *
+ * The cells directly above and below the band are never better than the cells within the band, which is modelled by
+ * a horizontal difference of +1 entering the top of the band and a vertical difference of +1 at the bottom of the
+ * band. The rows above the first row are modelled as matching rows, such that the recursion reproduces the
+ * initialisation of the first row, i.e. `0, 1, 2, ...` for global and `0, 0, 0, ...` for semi-global alignments.
+ *
+ * If seqan3::align_cfg::min_score is given, the alignment is only valid if its score is not smaller than the
+ * configured score.
+ */
+template <std::ranges::viewable_range database_t,
+          std::ranges::viewable_range query_t,
+          typename align_config_t,
+          typename edit_traits>
+class edit_distance_banded :
+    //!\cond
+    edit_traits
+//!\endcond
+{
+public:
+    using edit_traits::word_size;
+    using typename edit_traits::align_config_type;
+    using typename edit_traits::database_type;
+    using typename edit_traits::query_type;
+    using typename edit_traits::score_type;
+    using typename edit_traits::word_type;
+
+    //!\brief The type of the trace matrix.
+    using trace_matrix_type = edit_distance_trace_matrix_banded<word_type, edit_traits::is_semi_global>;
+
+private:
+    using edit_traits::compute_begin_positions;
+    using edit_traits::compute_cigar;
+    using edit_traits::compute_end_positions;
+    using edit_traits::compute_sequence_alignment;
+    using edit_traits::compute_trace_matrix;
+    using edit_traits::is_global;
+    using edit_traits::is_semi_global;
+    using edit_traits::use_max_errors;
+    using typename edit_traits::alignment_result_type;
+    using typename edit_traits::query_alphabet_type;
+
+    //!\brief The horizontal/database sequence.
+    database_t database;
+    //!\brief The vertical/query sequence.
+    query_t query;
+    //!\brief The configuration.
+    align_config_t config;
+
+    //!\brief The lower diagonal of the band, clipped to the alignment matrix.
+    int64_t lower_diagonal{};
+    //!\brief The upper diagonal of the band, clipped to the alignment matrix.
+    int64_t upper_diagonal{};
+    //!\brief The number of cells of the band within one column.
+    size_t band_size{};
+    //!\brief The number of columns that intersect the last row within the band.
+    size_t column_count{};
+
+    //!\brief The machine words which store the positive vertical differences within the band.
+    std::vector<word_type> vp{};
+    //!\brief The machine words which store the negative vertical differences within the band.
+    std::vector<word_type> vn{};
+    //!\brief The machine words which store the positive horizontal differences of the current column.
+    std::vector<word_type> hp{};
+    /*!\brief The machine words which translate a letter of the query into a bit mask.
+     *
+     * \details
+     *
+     * Bit `upper_diagonal + i` is set if the letter matches the i-th letter of the query. The first `upper_diagonal`
+     * bits represent the rows above the first row and are set for every letter.
+     */
+    std::vector<word_type> bit_masks{};
+    //!\brief The number of machine words of the bit mask of one letter.
+    size_t bit_mask_block_count{};
+
+    //!\brief The best score in the last row within the band.
+    score_type _best_score{};
+    //!\brief The column of #_best_score.
+    size_t _best_score_column{};
+    //!\brief The number of errors that is still considered as a hit.
+    score_type max_errors{};
+
+    //!\brief The trace matrix of the edit distance alignment.
+    trace_matrix_type _trace_matrix{};
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    //!\brief The class template parameter may resolve to an lvalue reference which prohibits default constructibility.
+    edit_distance_banded() = delete;
+    edit_distance_banded(edit_distance_banded const &) = default;             //!< Defaulted.
+    edit_distance_banded(edit_distance_banded &&) = default;                  //!< Defaulted.
+    edit_distance_banded & operator=(edit_distance_banded const &) = default; //!< Defaulted.
+    edit_distance_banded & operator=(edit_distance_banded &&) = default;      //!< Defaulted.
+    ~edit_distance_banded() = default;                                        //!< Defaulted.
+
+    /*!\brief Constructor
+     * \param[in] _database \copydoc database
+     * \param[in] _query    \copydoc query
+     * \param[in] _config   \copydoc config
+     * \param[in] _traits   The traits object. Only the type information will be used.
+     * \throws seqan3::invalid_alignment_configuration if the band cannot be used for the given sequences.
+     */
+    edit_distance_banded(database_t _database,
+                         query_t _query,
+                         align_config_t _config,
+                         edit_traits const & SEQAN3_DOXYGEN_ONLY(_traits)) :
+        database{std::forward<database_t>(_database)},
+        query{std::forward<query_t>(_query)},
+        config{std::forward<align_config_t>(_config)}
+    {
+        static constexpr size_t alphabet_size_ = alphabet_size<query_alphabet_type>;
+
+        int64_t const database_size = std::ranges::size(database);
+        int64_t const query_size = std::ranges::size(query);
+
+        auto const & band = get<align_cfg::band_fixed_size>(config);
+        check_band(band.lower_diagonal, band.upper_diagonal, database_size, query_size);
+
+        // Diagonals outside of the matrix contain no cell.
+        lower_diagonal = std::max<int64_t>(band.lower_diagonal, -query_size);
+        upper_diagonal = std::min<int64_t>(band.upper_diagonal, database_size);
+        band_size = upper_diagonal - lower_diagonal + 1;
+        // Behind this column the band does not intersect the last row any more.
+        column_count = std::min(database_size, query_size + upper_diagonal);
+
+        if constexpr (use_max_errors)
+        {
+            max_errors = -get<align_cfg::min_score>(config).score;
+            assert(max_errors >= score_type{0});
+        }
+
+        size_t const block_count = (band_size + word_size - 1u) / word_size;
+        vp.resize(block_count, 0u);
+        vn.resize(block_count, 0u);
+        hp.resize(block_count, 0u);
+
+        // The window of column j starts at bit j - 1 and is band_size bits long; one more word avoids a bounds check.
+        bit_mask_block_count = (column_count + band_size + word_size - 1u) / word_size + 1u;
+        bit_masks.resize(alphabet_size_ * bit_mask_block_count, 0u);
+
+        // The rows above the first row match every letter.
+        for (size_t rank = 0u; rank < alphabet_size_; ++rank)
+            set_bits(bit_masks.begin() + rank * bit_mask_block_count, 0u, upper_diagonal);
+
+        // Letters behind the last window are never accessed.
+        size_t const mask_query_size = std::min<size_t>(query_size, column_count + band_size - upper_diagonal);
+        for (size_t j = 0u; j < mask_query_size; ++j)
+        {
+            size_t const position = upper_diagonal + j;
+            size_t const i = bit_mask_block_count * seqan3::to_rank(query[j]) + position / word_size;
+            bit_masks[i] |= word_type{1u} << (position % word_size);
+        }
+
+        if constexpr (compute_trace_matrix)
+        {
+            _trace_matrix = trace_matrix_type{static_cast<size_t>(query_size) + 1u, upper_diagonal, band_size};
+            _trace_matrix.reserve(column_count);
+        }
+    }
+    //!\}
+
+private:
+    /*!\brief Checks whether the band can be used for the given sequence sizes.
+     * \param[in] lower         The configured lower diagonal.
+     * \param[in] upper         The configured upper diagonal.
+     * \param[in] database_size The size of the database.
+     * \param[in] query_size    The size of the query.
+     * \throws seqan3::invalid_alignment_configuration if the band cannot be used.
+     */
+    static void
+    check_band(int64_t const lower, int64_t const upper, int64_t const database_size, int64_t const query_size)
+    {
+        check_edit_distance_band(lower, upper, is_semi_global);
+
+        // The band ends in the last column without free gaps or in the last row without free gaps.
+        if (query_size + lower > database_size || (is_global && query_size + upper < database_size))
+            throw invalid_alignment_configuration{"The selected band [" + std::to_string(lower) + ":"
+                                                  + std::to_string(upper)
+                                                  + "] cannot be used with the current alignment configuration: "
+                                                    "The band ends in a region without free gaps."};
+    }
+
+    //!\brief Sets the bits in `[first, last)` of the bit-vector starting at `words`.
+    template <typename iterator_t>
+    static void set_bits(iterator_t words, size_t first, size_t const last) noexcept
+    {
+        for (; first < last; ++first)
+            words[first / word_size] |= word_type{1u} << (first % word_size);
+    }
+
+    //!\brief Returns the sum of the vertical differences stored in the first `count` bits of #vp and #vn.
+    score_type sum_of_differences(size_t const count) const noexcept
+    {
+        score_type sum{};
+        size_t const full_blocks = count / word_size;
+
+        for (size_t block = 0u; block < full_blocks; ++block)
+            sum += std::popcount(vp[block]) - std::popcount(vn[block]);
+
+        if (size_t const rest = count % word_size; rest != 0u)
+        {
+            word_type const mask = (word_type{1u} << rest) - 1u;
+            sum += std::popcount(static_cast<word_type>(vp[full_blocks] & mask))
+                 - std::popcount(static_cast<word_type>(vn[full_blocks] & mask));
+        }
+
+        return sum;
+    }
+
+    /*!\brief Initialises the vertical differences of the first column.
+     * \returns The score of the first cell of the band.
+     *
+     * \details
+     *
+     * Bit `k` represents the difference between the rows `k - upper_diagonal + 1` and `k - upper_diagonal`. The last
+     * bit is the difference to the cell below the band, which is always +1.
+     */
+    score_type initialise_first_column() noexcept
+    {
+        size_t const first_row = upper_diagonal; // The bit of the difference between row 1 and row 0.
+
+        set_bits(vp.begin(), std::min(first_row, band_size - 1u), band_size);
+
+        if constexpr (is_global)
+        {
+            set_bits(vn.begin(), 0u, std::min(first_row, band_size - 1u));
+            return upper_diagonal;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+
+    //!\brief Compute the alignment.
+    void compute()
+    {
+        size_t const query_size = std::ranges::size(query);
+        size_t const block_count = vp.size();
+        size_t const last_bit = (band_size - 1u) % word_size;
+        // The first column in which the last row is within the band.
+        size_t const first_column = std::max<int64_t>(0, static_cast<int64_t>(query_size) + lower_diagonal);
+
+        score_type top_score = initialise_first_column();
+        score_type last_row_score = query_size;
+        // If the first cell of the last row is outside of the band, the first score within the band is always better.
+        _best_score = (first_column == 0u) ? last_row_score : std::numeric_limits<score_type>::max();
+        _best_score_column = 0u;
+
+        auto database_it = std::ranges::begin(database);
+        for (size_t column = 1u; column <= column_count; ++column, ++database_it)
+        {
+            size_t const rank = seqan3::to_rank(static_cast<query_alphabet_type>(*database_it));
+            word_type const * masks = bit_masks.data() + bit_mask_block_count * rank;
+            size_t const window_offset = (column - 1u) / word_size;
+            size_t const window_shift = (column - 1u) % word_size;
+            // The band row of the last row of the matrix.
+            int64_t const last_row = static_cast<int64_t>(query_size) + upper_diagonal - static_cast<int64_t>(column);
+
+            word_type carry_d0{0u};
+            word_type carry_hp{1u}; // The cell above the band is never better.
+            word_type carry_hn{0u};
+            word_type last_row_hp{0u};
+            word_type last_row_hn{0u};
+
+            for (size_t block = 0u; block < block_count; ++block)
+            {
+                word_type b = masks[window_offset + block] >> window_shift;
+                if (window_shift != 0u)
+                    b |= static_cast<word_type>(masks[window_offset + block + 1u] << (word_size - window_shift));
+
+                word_type const vp_ = vp[block];
+                word_type const vn_ = vn[block];
+
+                word_type x = b | vn_;
+                word_type const t = vp_ + (x & vp_) + carry_d0;
+                word_type const d0 = (t ^ vp_) | x;
+                word_type const hn = vp_ & d0;
+                word_type const hp_ = vn_ | ~(vp_ | d0);
+                carry_d0 = (carry_d0 != 0u) ? t <= vp_ : t < vp_;
+
+                x = (hp_ << 1u) | carry_hp;
+                vn[block] = x & d0;
+                vp[block] = (hn << 1u) | ~(x | d0) | carry_hn;
+                carry_hp = hp_ >> (word_size - 1u);
+                carry_hn = hn >> (word_size - 1u);
+
+                if constexpr (compute_trace_matrix)
+                    hp[block] = hp_;
+
+                if (last_row >= 0 && static_cast<size_t>(last_row) / word_size == block)
+                {
+                    last_row_hp = (hp_ >> (last_row % word_size)) & 1u;
+                    last_row_hn = (hn >> (last_row % word_size)) & 1u;
+                }
+            }
+
+            if constexpr (compute_trace_matrix)
+                this->_trace_matrix.add_column(hp, vp);
+
+            if (column == first_column) // The last row enters the band at the bottom.
+                last_row_score = top_score + 1 + sum_of_differences(last_row + 1);
+            else if (column > first_column)
+                last_row_score += last_row_hp - last_row_hn;
+
+            if (is_semi_global && column >= first_column)
+            {
+                _best_score_column = (last_row_score <= _best_score) ? column : _best_score_column;
+                _best_score = std::min(last_row_score, _best_score);
+            }
+
+            // The first cell of the band is one row below the first cell of the previous column.
+            top_score += 1 - static_cast<score_type>(vn[0] & 1u);
+
+            // Shift the band down by one row.
+            for (size_t block = 0u; block + 1u < block_count; ++block)
+            {
+                vp[block] = (vp[block] >> 1u) | static_cast<word_type>(vp[block + 1u] << (word_size - 1u));
+                vn[block] = (vn[block] >> 1u) | static_cast<word_type>(vn[block + 1u] << (word_size - 1u));
+            }
+            vp.back() = (vp.back() >> 1u) | (word_type{1u} << last_bit);
+            vn.back() = (vn.back() >> 1u) & ~(word_type{1u} << last_bit);
+        }
+
+        if constexpr (is_global)
+        {
+            _best_score = last_row_score;
+            _best_score_column = column_count;
+        }
+    }
+
+public:
+    //!\brief Returns true if the computation produced a valid alignment.
+    bool is_valid() const noexcept
+    {
+        if constexpr (use_max_errors)
+            return _best_score <= max_errors;
+
+        return true;
+    }
+
+    //!\brief Return the score of the alignment.
+    std::optional<score_type> score() const noexcept
+    {
+        if (!is_valid())
+            return std::nullopt;
+
+        return -_best_score;
+    }
+
+    //!\brief Return the end position of the alignment.
+    advanceable_alignment_coordinate<> end_positions() const noexcept
+    {
+        if (!is_valid())
+            return invalid_coordinate();
+
+        return {column_index_type{_best_score_column}, row_index_type{std::ranges::size(query)}};
+    }
+
+    //!\brief Return the begin position of the alignment.
+    advanceable_alignment_coordinate<> begin_positions() const noexcept
+    {
+        static_assert(compute_begin_positions,
+                      "begin_positions() can only be computed if you specify the "
+                      "result type within your alignment config.");
+        if (!is_valid())
+            return invalid_coordinate();
+
+        auto trace_path = _trace_matrix.trace_path(matrix_coordinate{row_index_type{std::ranges::size(query)},
+                                                                     column_index_type{_best_score_column}});
+        auto trace_path_it = std::ranges::begin(trace_path);
+        std::ranges::advance(trace_path_it, std::ranges::end(trace_path));
+        matrix_coordinate const begin_positions = trace_path_it.coordinate();
+        return {column_index_type{begin_positions.col}, row_index_type{begin_positions.row}};
+    }
+
+    //!\brief Return the trace matrix of the alignment.
+    trace_matrix_type const & trace_matrix() const noexcept
+    {
+        static_assert(compute_trace_matrix,
+                      "trace_matrix() can only be computed if you specify the "
+                      "result type within your alignment config.");
+        return _trace_matrix;
+    }
+
+    /*!\brief Generic invocable interface.
+     * \param[in] idx The index of the currently processed sequence pair.
+     * \param[in] callback The callback function to be invoked with the alignment result.
+     */
+    template <typename callback_t>
+    void operator()([[maybe_unused]] size_t const idx, callback_t && callback)
+    {
+        using traits_type = alignment_configuration_traits<align_config_t>;
+        using result_value_type = typename alignment_result_value_type_accessor<alignment_result_type>::type;
+
+        compute();
+
+        auto cached_end_positions = invalid_coordinate();
+        auto cached_begin_positions = invalid_coordinate();
+
+        if constexpr (compute_end_positions)
+            cached_end_positions = end_positions();
+
+        if constexpr (compute_begin_positions && !compute_sequence_alignment && !compute_cigar)
+            cached_begin_positions = begin_positions();
+
+        result_value_type res_vt{};
+
+        if constexpr (traits_type::output_sequence1_id)
+            res_vt.sequence1_id = idx;
+
+        if constexpr (traits_type::output_sequence2_id)
+            res_vt.sequence2_id = idx;
+
+        if constexpr (traits_type::compute_score)
+            res_vt.score = score().value_or(matrix_inf<score_type>);
+
+        if constexpr (traits_type::compute_sequence_alignment)
+        {
+            if (is_valid())
+            {
+                auto [first, second] = cached_end_positions;
+                matrix_coordinate const end_positions{row_index_type{second}, column_index_type{first}};
+
+                aligned_sequence_builder builder{database, query};
+                auto trace_res = builder(_trace_matrix.trace_path(end_positions));
+                res_vt.alignment = std::move(trace_res.alignment);
+                cached_begin_positions.first = trace_res.first_sequence_slice_positions.first;
+                cached_begin_positions.second = trace_res.second_sequence_slice_positions.first;
+            }
+        }
+
+        if constexpr (traits_type::compute_cigar)
+        {
+            if (is_valid())
+            {
+                auto [first, second] = cached_end_positions;
+                matrix_coordinate const end_positions{row_index_type{second}, column_index_type{first}};
+
+                cigar_builder builder{};
+                auto trace_res = builder(_trace_matrix.trace_path(end_positions));
+                res_vt.cigar_sequence = std::move(trace_res.cigar_sequence);
+                cached_begin_positions.first = trace_res.first_sequence_slice_positions.first;
+                cached_begin_positions.second = trace_res.second_sequence_slice_positions.first;
+            }
+        }
+
+        if constexpr (traits_type::compute_end_positions)
+            res_vt.end_positions = std::move(cached_end_positions);
+
+        if constexpr (traits_type::compute_begin_positions)
+            res_vt.begin_positions = std::move(cached_begin_positions);
+
+        callback(alignment_result_type{std::move(res_vt)});
+    }
+
+private:
+    //!\brief Returns an invalid_coordinate for this alignment.
+    advanceable_alignment_coordinate<> invalid_coordinate() const noexcept
+    {
+        return {column_index_type{std::ranges::size(database)}, row_index_type{std::ranges::size(query)}};
+    }
+};
+
+/*!\name Type deduction guides
+ * \relates seqan3::detail::edit_distance_banded
+ * \{
+ */
+
+//!\brief Deduce the type from the provided arguments.
+template <typename database_t, typename query_t, typename config_t, typename traits_t>
+edit_distance_banded(database_t && database, query_t && query, config_t config, traits_t)
+    -> edit_distance_banded<database_t, query_t, config_t, traits_t>;
+//!\}
+
+} // namespace seqan3::detail
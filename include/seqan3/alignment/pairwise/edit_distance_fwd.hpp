@@ -98,16 +98,18 @@ struct default_edit_distance_trait_type
     static constexpr bool compute_score = true;
     //!\brief Whether the alignment configuration indicates to compute and/or store the alignment of the sequences.
     static constexpr bool compute_sequence_alignment = alignment_traits_type::compute_sequence_alignment;
+    //!\brief Whether the alignment configuration indicates to compute and/or store the CIGAR sequence.
+    static constexpr bool compute_cigar = alignment_traits_type::compute_cigar;
     //!\brief Whether the alignment configuration indicates to compute and/or store the begin positions.
     static constexpr bool compute_begin_positions =
-        alignment_traits_type::compute_begin_positions || compute_sequence_alignment;
+        alignment_traits_type::compute_begin_positions || compute_sequence_alignment || compute_cigar;
     //!\brief Whether the alignment configuration indicates to compute and/or store the end positions.
     static constexpr bool compute_end_positions =
         alignment_traits_type::compute_end_positions || compute_begin_positions;
     //!\brief Whether the alignment configuration indicates to compute and/or store the score matrix.
     static constexpr bool compute_score_matrix = false;
     //!\brief Whether the alignment configuration indicates to compute and/or store the trace matrix.
-    static constexpr bool compute_trace_matrix = compute_begin_positions || compute_sequence_alignment;
+    static constexpr bool compute_trace_matrix = compute_begin_positions || compute_sequence_alignment || compute_cigar;
     //!\brief Whether the alignment configuration indicates to compute and/or store the score or trace matrix.
     static constexpr bool compute_matrix = compute_score_matrix || compute_trace_matrix;
 
@@ -129,6 +131,12 @@ template <std::ranges::viewable_range database_t,
           typename align_config_t,
           typename traits_t>
 class edit_distance_unbanded; //forward declaration
+
+template <std::ranges::viewable_range database_t,
+          std::ranges::viewable_range query_t,
+          typename align_config_t,
+          typename traits_t>
+class edit_distance_banded; //forward declaration
 //!\endcond
 
 } // namespace seqan3::detail
@@ -0,0 +1,339 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \author Rene Rahn <rene.rahn AT fu-berlin.de>
+ * \brief Provides seqan3::detail::edit_distance_simd.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <ranges>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_min_score.hpp>
+#include <seqan3/alignment/matrix/detail/advanceable_alignment_coordinate.hpp>
+#include <seqan3/alignment/matrix/detail/matrix_concept.hpp>
+#include <seqan3/alignment/pairwise/alignment_result.hpp>
+#include <seqan3/alignment/pairwise/detail/type_traits.hpp>
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/core/configuration/configuration.hpp>
+#include <seqan3/utility/detail/bits_of.hpp>
+#include <seqan3/utility/simd/algorithm.hpp>
+#include <seqan3/utility/simd/simd.hpp>
+#include <seqan3/utility/simd/simd_traits.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Computes the edit distance of a batch of short sequence pairs with one sequence pair per simd lane.
+ * \ingroup alignment_pairwise
+ * \tparam word_t           The unsigned type of one lane; the queries must not be longer than the bits of this type.
+ * \tparam query_alphabet_t The alphabet type of the query sequences.
+ * \tparam align_config_t   The type of the alignment configuration.
+ * \tparam is_semi_global_t A std::bool_constant indicating whether the alignment is semi-global.
+ *
+ * \details
+ *
+ * Each lane of a seqan3::simd::simd_type over `word_t` stores the single machine word of Myers' bit-parallel
+ * algorithm of one sequence pair, i.e. the sequence pairs of one batch are computed with the same instructions.
+ * The sequence pairs are added via #add until the batch is full, i.e. #lanes pairs were added, and computed by
+ * invoking the object. All columns up to the longest database of the batch are computed; lanes with a shorter
+ * database simply stop updating their score.
+ *
+ * Only the score and the end positions can be computed. The alignment and the begin positions require the
+ * trace matrix, which is only offered by seqan3::detail::edit_distance_unbanded.
+ */
+template <typename word_t, typename query_alphabet_t, typename align_config_t, typename is_semi_global_t>
+class edit_distance_simd
+{
+private:
+    static_assert(std::is_unsigned_v<word_t>, "The word type of edit_distance_simd must be unsigned.");
+
+    //!\brief The simd vector type storing one word per sequence pair.
+    using simd_type = simd_type_t<word_t>;
+    //!\brief The alignment configuration traits.
+    using traits_type = alignment_configuration_traits<align_config_t>;
+    //!\brief The type of the score.
+    using score_type = typename traits_type::original_score_type;
+    //!\brief The alignment result type generated by the algorithm.
+    using alignment_result_type = typename traits_type::alignment_result_type;
+    //!\brief The alignment result value type.
+    using result_value_type = typename alignment_result_value_type_accessor<alignment_result_type>::type;
+
+    static_assert(!traits_type::requires_trace_information,
+                  "The vectorised edit distance cannot compute the alignment or the begin positions.");
+
+    //!\brief Whether the alignment is semi-global, i.e. the first sequence has free end gaps.
+    static constexpr bool is_semi_global = is_semi_global_t::value;
+    //!\brief Whether only scores within the configured seqan3::align_cfg::min_score are valid.
+    static constexpr bool use_max_errors = align_config_t::template exists<align_cfg::min_score>();
+    //!\brief The number of letters of the query alphabet.
+    static constexpr size_t sigma = alphabet_size<query_alphabet_t>;
+
+public:
+    //!\brief The number of bits of one lane, i.e. the maximal length of a query.
+    static constexpr size_t word_size = bits_of<word_t>;
+    //!\brief The number of sequence pairs that are computed at once.
+    static constexpr size_t lanes = simd_traits<simd_type>::length;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    edit_distance_simd() = delete;                                        //!< Deleted.
+    edit_distance_simd(edit_distance_simd const &) = default;             //!< Defaulted.
+    edit_distance_simd(edit_distance_simd &&) = default;                  //!< Defaulted.
+    edit_distance_simd & operator=(edit_distance_simd const &) = default; //!< Defaulted.
+    edit_distance_simd & operator=(edit_distance_simd &&) = default;      //!< Defaulted.
+    ~edit_distance_simd() = default;                                      //!< Defaulted.
+
+    /*!\brief Constructs the algorithm for the given configuration.
+     * \param[in] config The alignment configuration.
+     */
+    explicit edit_distance_simd(align_config_t const & config) : bit_masks(lanes * sigma, 0u)
+    {
+        if constexpr (use_max_errors)
+            max_errors = -get<align_cfg::min_score>(config).score;
+    }
+    //!\}
+
+    /*!\brief Adds a sequence pair to the current batch.
+     * \tparam database_t The type of the database sequence; must model std::ranges::forward_range.
+     * \tparam query_t    The type of the query sequence; must model std::ranges::forward_range.
+     * \param[in] idx      The index of the sequence pair.
+     * \param[in] database The database sequence, i.e. the first sequence of the pair.
+     * \param[in] query    The query sequence, i.e. the second sequence of the pair; must not be empty and must not
+     *                     be longer than #word_size.
+     */
+    template <std::ranges::forward_range database_t, std::ranges::forward_range query_t>
+    void add(size_t const idx, database_t && database, query_t && query)
+    {
+        assert(!full());
+        assert(!std::ranges::empty(query));
+        assert(static_cast<size_t>(std::ranges::distance(query)) <= word_size);
+
+        size_t const lane = batch_size++;
+        size_t const database_size = std::ranges::distance(database);
+        indices[lane] = idx;
+        database_sizes[lane] = database_size;
+
+        // The ranks are stored column by column. The buffer is only grown, i.e. shorter databases keep the ranks of
+        // a previous batch behind their end, which are valid ranks but never contribute to the score.
+        column_count = std::max(column_count, database_size);
+        if (database_ranks.size() < column_count * lanes)
+            database_ranks.resize(column_count * lanes, 0u);
+
+        word_t * lane_ranks = database_ranks.data() + lane;
+        for (auto && letter : database)
+        {
+            *lane_ranks = seqan3::to_rank(static_cast<query_alphabet_t>(letter));
+            lane_ranks += lanes;
+        }
+
+        for (size_t rank = 0u; rank < sigma; ++rank)
+            bit_masks[rank * lanes + lane] = 0u;
+
+        word_t query_size = 0u;
+        for (auto && letter : query)
+            bit_masks[seqan3::to_rank(letter) * lanes + lane] |= word_t{1u} << query_size++;
+        query_sizes[lane] = query_size;
+    }
+
+    //!\brief Whether the batch contains #lanes sequence pairs.
+    bool full() const noexcept
+    {
+        return batch_size == lanes;
+    }
+
+    //!\brief Whether the batch contains no sequence pair.
+    bool empty() const noexcept
+    {
+        return batch_size == 0u;
+    }
+
+    /*!\brief Computes the current batch and invokes the callback with the alignment result of every sequence pair.
+     * \param[in] callback The callback function to be invoked with the alignment results in the order in which the
+     *                     sequence pairs were added.
+     *
+     * \details
+     *
+     * Afterwards the batch is empty and new sequence pairs can be added.
+     */
+    template <typename callback_t>
+    void operator()(callback_t && callback)
+    {
+        compute();
+
+        for (size_t lane = 0u; lane < batch_size; ++lane)
+        {
+            bool const is_valid = !use_max_errors || best_scores[lane] <= static_cast<word_t>(max_errors);
+            size_t const end_column = (is_semi_global && is_valid) ? best_columns[lane] : database_sizes[lane];
+
+            result_value_type res_vt{};
+
+            if constexpr (traits_type::output_sequence1_id)
+                res_vt.sequence1_id = indices[lane];
+
+            if constexpr (traits_type::output_sequence2_id)
+                res_vt.sequence2_id = indices[lane];
+
+            if constexpr (traits_type::compute_score)
+                res_vt.score = is_valid ? -static_cast<score_type>(best_scores[lane]) : matrix_inf<score_type>;
+
+            if constexpr (traits_type::compute_end_positions)
+                res_vt.end_positions = advanceable_alignment_coordinate<>{column_index_type{end_column},
+                                                                          row_index_type{query_sizes[lane]}};
+
+            callback(alignment_result_type{std::move(res_vt)});
+        }
+
+        batch_size = 0u;
+    }
+
+private:
+    //!\brief Computes the scores of the last row for all lanes.
+    void compute()
+    {
+        // Lanes without a sequence pair have an empty database and are never updated.
+        for (size_t lane = batch_size; lane < lanes; ++lane)
+        {
+            database_sizes[lane] = 0u;
+            query_sizes[lane] = 1u;
+        }
+
+        alignas(alignof(simd_type)) std::array<word_t, lanes> buffer{};
+
+        auto load_lanes = [&](auto && lane_value)
+        {
+            for (size_t lane = 0u; lane < lanes; ++lane)
+                buffer[lane] = lane_value(lane);
+
+            return simd::load<simd_type>(buffer.data());
+        };
+
+        simd_type const database_size = load_lanes(
+            [&](size_t const lane)
+            {
+                return static_cast<word_t>(database_sizes[lane]);
+            });
+        simd_type const last_row_shift = load_lanes(
+            [&](size_t const lane)
+            {
+                return static_cast<word_t>(query_sizes[lane] - 1u);
+            });
+        simd_type const zero = simd::fill<simd_type>(0u);
+        simd_type const one = simd::fill<simd_type>(1u);
+        simd_type const last_row_mask = one << last_row_shift;
+        // The first row is 0, 1, 2, ... in the global alignment and 0, 0, 0, ... in the semi-global alignment.
+        simd_type const hp0 = simd::fill<simd_type>(is_semi_global ? 0u : 1u);
+
+        simd_type vp = simd::fill<simd_type>(~word_t{0u});
+        simd_type vn = zero;
+        simd_type score = last_row_shift + one;
+        simd_type best_score = score;
+        simd_type best_column = zero;
+        simd_type column = zero;
+
+        for (size_t j = 0u; j < column_count; ++j)
+        {
+            simd_type const b = bit_mask_of_column(j);
+
+            // Myers' bit-parallel recurrence, see seqan3::detail::edit_distance_unbanded::compute_step.
+            simd_type x = b | vn;
+            simd_type const t = vp + (x & vp);
+            simd_type const d0 = (t ^ vp) | x;
+            simd_type const hn = vp & d0;
+            simd_type const hp = vn | ~(vp | d0);
+
+            x = (hp << 1u) | hp0;
+            vn = x & d0;
+            vp = (hn << 1u) | ~(x | d0);
+
+            // Lanes whose database ends before the current column keep their score.
+            auto const is_active = column < database_size;
+            simd_type const score_mask = is_active ? last_row_mask : zero;
+            score = score + ((hp & score_mask) >> last_row_shift) - ((hn & score_mask) >> last_row_shift);
+            column = column + one;
+
+            if constexpr (is_semi_global)
+            {
+                // Prefer the rightmost column on ties like seqan3::detail::edit_distance_unbanded.
+                auto const is_better = is_active & (score <= best_score);
+                best_score = is_better ? score : best_score;
+                best_column = is_better ? column : best_column;
+            }
+        }
+
+        if constexpr (!is_semi_global)
+            best_score = score;
+
+        simd::store(best_scores.data(), best_score);
+        simd::store(best_columns.data(), best_column);
+        column_count = 0u;
+    }
+
+    /*!\brief Returns the bit masks of the database letters in the given column.
+     * \param[in] column The column, i.e. the position in the databases.
+     *
+     * \details
+     *
+     * For small alphabets the bit mask of every letter is selected by comparing the ranks of the column with the
+     * rank of the letter. Otherwise, the bit mask of each lane is looked up separately.
+     */
+    simd_type bit_mask_of_column(size_t const column) const noexcept
+    {
+        word_t const * column_ranks = database_ranks.data() + column * lanes;
+
+        if constexpr (sigma <= 16u)
+        {
+            simd_type const ranks = simd::load<simd_type>(column_ranks);
+            simd_type const zero = simd::fill<simd_type>(0u);
+            simd_type b = zero;
+
+            for (size_t rank = 0u; rank < sigma; ++rank)
+            {
+                simd_type const bit_mask = simd::load<simd_type>(bit_masks.data() + rank * lanes);
+                b |= (ranks == simd::fill<simd_type>(static_cast<word_t>(rank))) ? bit_mask : zero;
+            }
+
+            return b;
+        }
+        else
+        {
+            alignas(alignof(simd_type)) std::array<word_t, lanes> buffer{};
+
+            for (size_t lane = 0u; lane < lanes; ++lane)
+                buffer[lane] = bit_masks[column_ranks[lane] * lanes + lane];
+
+            return simd::load<simd_type>(buffer.data());
+        }
+    }
+
+    //!\brief The maximal number of errors if seqan3::align_cfg::min_score is configured.
+    score_type max_errors{};
+    //!\brief The number of sequence pairs in the current batch.
+    size_t batch_size{};
+    //!\brief The number of columns of the current batch, i.e. the length of the longest database.
+    size_t column_count{};
+    //!\brief The bit masks of the query letters; the masks of all lanes for the letter with rank `r` start at
+    //!       `r * lanes`.
+    std::vector<word_t> bit_masks{};
+    //!\brief The ranks of the database letters; the ranks of all lanes in column `j` start at `j * lanes`.
+    std::vector<word_t> database_ranks{};
+    //!\brief The length of the database of each lane.
+    std::array<size_t, lanes> database_sizes{};
+    //!\brief The length of the query of each lane.
+    std::array<size_t, lanes> query_sizes{};
+    //!\brief The index of the sequence pair of each lane.
+    std::array<size_t, lanes> indices{};
+    //!\brief The best score in the last row of each lane.
+    alignas(alignof(simd_type)) std::array<word_t, lanes> best_scores{};
+    //!\brief The column of the best score of each lane.
+    alignas(alignof(simd_type)) std::array<word_t, lanes> best_columns{};
+};
+
+} // namespace seqan3::detail
@@ -0,0 +1,371 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides seqan3::extend_ungapped and seqan3::ungapped_extension_result.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <ranges>
+#include <stdexcept>
+#include <type_traits>
+
+#include <seqan3/alignment/scoring/scoring_scheme_base.hpp>
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/alphabet/container/bitpacked_sequence.hpp>
+#include <seqan3/utility/math.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Determines whether seqan3::extend_ungapped can compare the letters of `sequence_t` word-wise.
+ * \tparam sequence_t The type of the sequence.
+ * \ingroup alignment_pairwise
+ *
+ * \details
+ *
+ * This is the case for a seqan3::bitpacked_sequence, whose letters occupy `bits_per_letter` consecutive bits of the
+ * underlying 64 bit words.
+ */
+template <typename sequence_t>
+struct ungapped_packed_traits : std::false_type
+{};
+
+//!\cond
+template <typename alphabet_t>
+struct ungapped_packed_traits<bitpacked_sequence<alphabet_t>> :
+    std::bool_constant<(detail::ceil_log2(alphabet_size<alphabet_t>) > 0u)>
+{
+    static constexpr size_t bits_per_letter = detail::ceil_log2(alphabet_size<alphabet_t>);
+};
+//!\endcond
+
+/*!\brief The X-drop state of one direction of seqan3::extend_ungapped.
+ * \ingroup alignment_pairwise
+ *
+ * \details
+ *
+ * The extension is fed with blocks of up to 64 letters, each represented by a bit mask of the mismatching letters.
+ * Since a match never lowers the score and a mismatch never raises it, the best score can only change at the end of
+ * a run of matches and the X-drop criterion can only be met after a mismatch. Thus, a block is processed in time
+ * linear in the number of its mismatches and a block without mismatches in constant time.
+ */
+struct ungapped_drop_off_state
+{
+    int32_t match{};      //!< The score of a match; positive.
+    int32_t mismatch{};   //!< The score of a mismatch; negative.
+    int32_t drop_score{}; //!< The score drop below the best score at which the extension stops.
+    int32_t score{};      //!< The score of the extension up to seqan3::detail::ungapped_drop_off_state::length.
+    int32_t best_score{}; //!< The best score seen so far.
+    size_t length{};      //!< The number of letters processed so far.
+    size_t best_length{}; //!< The number of letters of the extension with the best score.
+
+    /*!\brief Processes the next block of letters.
+     * \tparam reversed            Whether the letters are processed from the highest to the lowest bit.
+     * \param[in] mismatches      The mismatching letters; letter `i` is represented by bit `i * bits_per_letter`.
+     * \param[in] block_size      The number of letters in the block.
+     * \param[in] bits_per_letter The number of bits per letter in `mismatches`.
+     * \returns `true` if the extension continues, `false` if the X-drop criterion was met.
+     */
+    template <bool reversed>
+    constexpr bool process(uint64_t mismatches, size_t const block_size, size_t const bits_per_letter) noexcept
+    {
+        size_t processed = 0; // Letters of the block that are already accounted for.
+
+        while (mismatches != 0u)
+        {
+            size_t position{};
+            if constexpr (reversed)
+            {
+                size_t const bit = 63u - std::countl_zero(mismatches);
+                mismatches ^= uint64_t{1u} << bit;
+                position = block_size - 1u - bit / bits_per_letter;
+            }
+            else
+            {
+                position = std::countr_zero(mismatches) / bits_per_letter;
+                mismatches &= mismatches - 1u;
+            }
+
+            add_matches(position - processed);
+            score += mismatch;
+            processed = position + 1u;
+            length += 1u;
+
+            if (best_score - score > drop_score)
+                return false;
+        }
+
+        add_matches(block_size - processed);
+        return true;
+    }
+
+private:
+    //!\brief Extends the current extension by a run of `count` matches.
+    constexpr void add_matches(size_t const count) noexcept
+    {
+        score += static_cast<int32_t>(count) * match;
+        length += count;
+
+        if (count != 0u && score > best_score)
+        {
+            best_score = score;
+            best_length = length;
+        }
+    }
+};
+
+/*!\brief Extends an ungapped alignment of two sequences in one direction until the X-drop criterion is met.
+ * \tparam reversed              Whether the extension runs towards the begin of the sequences.
+ * \tparam block_mismatches_fn_t The type of the function computing the mismatches of a block.
+ * \param[in] state            The initialised X-drop state.
+ * \param[in] max_length       The number of letters available for the extension in both sequences.
+ * \param[in] block_size       The maximal number of letters per block.
+ * \param[in] bits_per_letter  The number of bits per letter in the mismatch mask of a block.
+ * \param[in] block_mismatches Returns the mismatch mask of the block given its distance to the anchor and its size.
+ * \returns The best score and the number of letters of the best extension.
+ */
+template <bool reversed, typename block_mismatches_fn_t>
+constexpr std::pair<int32_t, size_t> extend_ungapped_in_direction(ungapped_drop_off_state state,
+                                                                  size_t const max_length,
+                                                                  size_t const block_size,
+                                                                  size_t const bits_per_letter,
+                                                                  block_mismatches_fn_t && block_mismatches)
+{
+    for (size_t distance = 0; distance < max_length; distance += block_size)
+    {
+        size_t const current_block_size = std::min(block_size, max_length - distance);
+
+        if (!state.process<reversed>(block_mismatches(distance, current_block_size),
+                                     current_block_size,
+                                     bits_per_letter))
+            break;
+    }
+
+    return {state.best_score, state.best_length};
+}
+
+} // namespace seqan3::detail
+
+namespace seqan3
+{
+
+/*!\brief The result of seqan3::extend_ungapped.
+ * \ingroup alignment_pairwise
+ *
+ * \details
+ *
+ * The positions describe the half-open slices `[begin, end)` of the sequences covered by the ungapped alignment.
+ * Both slices have the same length.
+ *
+ * \experimentalapi{Experimental since version 3.4.}
+ */
+struct ungapped_extension_result
+{
+    int32_t score{};                   //!< The score of the ungapped alignment.
+    size_t sequence1_begin_position{}; //!< The begin position of the alignment in the first sequence.
+    size_t sequence1_end_position{};   //!< The end position of the alignment in the first sequence.
+    size_t sequence2_begin_position{}; //!< The begin position of the alignment in the second sequence.
+    size_t sequence2_end_position{};   //!< The end position of the alignment in the second sequence.
+
+    //!\brief Compares two results member-wise.
+    friend constexpr bool operator==(ungapped_extension_result const &, ungapped_extension_result const &) = default;
+};
+
+/*!\brief Extends an anchor of two sequences to both sides without gaps until the X-drop criterion is met.
+ * \ingroup alignment_pairwise
+ *
+ * \tparam sequence1_t The type of the first sequence; must model std::ranges::random_access_range and
+ *                     std::ranges::sized_range.
+ * \tparam sequence2_t The type of the second sequence; must model std::ranges::random_access_range and
+ *                     std::ranges::sized_range, and its letters must be comparable to the ones of the first sequence.
+ * \param[in] sequence1  The first sequence.
+ * \param[in] sequence2  The second sequence.
+ * \param[in] position1  The position of the anchor in the first sequence, e.g. the begin of a seed.
+ * \param[in] position2  The position of the anchor in the second sequence.
+ * \param[in] match      The score of a match; must be positive.
+ * \param[in] mismatch   The score of a mismatch; must be negative.
+ * \param[in] drop_score The score drop below the best score at which an extension stops; must not be negative.
+ * \returns A seqan3::ungapped_extension_result with the score and the positions of the ungapped alignment.
+ * \throws std::invalid_argument if the scores are not valid.
+ * \throws std::out_of_range if an anchor position is greater than the size of the respective sequence.
+ *
+ * \details
+ *
+ * The anchor aligns `sequence1[position1]` with `sequence2[position2]`. The alignment is extended along this diagonal
+ * to the right, starting with the anchor, and to the left, starting with the letters before the anchor. Each
+ * direction stops as soon as its score falls more than `drop_score` below the best score seen in this direction, or
+ * at the end of a sequence. Each direction then ends at the extension with the best score, preferring the shorter one
+ * in case of ties, and the score of the result is the sum of both.
+ *
+ * The letters are compared in blocks: one 64 bit mask of mismatches is computed per block and only the mismatches
+ * are visited afterwards. If both sequences are a seqan3::bitpacked_sequence over the same alphabet, the letters are
+ * compared directly in the packed words, e.g. 32 seqan3::dna4 letters with a single XOR. Otherwise, a block
+ * compares 64 letters, which the compiler vectorises for contiguous sequences.
+ *
+ * ### Example
+ *
+ * \include test/snippet/alignment/pairwise/extend_ungapped.cpp
+ *
+ * \see seqan3::align_cfg::x_drop
+ *
+ * \experimentalapi{Experimental since version 3.4.}
+ */
+template <std::ranges::random_access_range sequence1_t, std::ranges::random_access_range sequence2_t>
+    requires std::ranges::sized_range<sequence1_t> && std::ranges::sized_range<sequence2_t>
+          && std::equality_comparable_with<std::ranges::range_reference_t<sequence1_t>,
+                                           std::ranges::range_reference_t<sequence2_t>>
+ungapped_extension_result extend_ungapped(sequence1_t && sequence1,
+                                          sequence2_t && sequence2,
+                                          size_t const position1,
+                                          size_t const position2,
+                                          match_score<int32_t> const match,
+                                          mismatch_score<int32_t> const mismatch,
+                                          int32_t const drop_score)
+{
+    if (match.get() <= 0 || mismatch.get() >= 0 || drop_score < 0)
+        throw std::invalid_argument{"extend_ungapped requires a positive match score, a negative mismatch score and a "
+                                    "non-negative drop score."};
+
+    size_t const size1 = std::ranges::size(sequence1);
+    size_t const size2 = std::ranges::size(sequence2);
+
+    if (position1 > size1 || position2 > size2)
+        throw std::out_of_range{"The anchor position of extend_ungapped is out of range."};
+
+    detail::ungapped_drop_off_state const state{.match = match.get(),
+                                                .mismatch = mismatch.get(),
+                                                .drop_score = drop_score};
+    size_t const left_length = std::min(position1, position2);
+    size_t const right_length = std::min(size1 - position1, size2 - position2);
+
+    std::pair<int32_t, size_t> left{};
+    std::pair<int32_t, size_t> right{};
+
+    using sequence1_type = std::remove_cvref_t<sequence1_t>;
+    if constexpr (detail::ungapped_packed_traits<sequence1_type>::value
+                  && std::same_as<sequence1_type, std::remove_cvref_t<sequence2_t>>)
+    {
+        constexpr size_t bits_per_letter = detail::ungapped_packed_traits<sequence1_type>::bits_per_letter;
+        constexpr size_t block_size = 64u / bits_per_letter;
+
+        // The first bit of every letter.
+        constexpr uint64_t letter_bits = []()
+        {
+            uint64_t bits{};
+            for (size_t i = 0; i < block_size; ++i)
+                bits |= uint64_t{1u} << (i * bits_per_letter);
+            return bits;
+        }();
+
+        uint64_t const * words1 = sequence1.raw_data().data();
+        uint64_t const * words2 = sequence2.raw_data().data();
+
+        // Loads the `count` letters beginning at `position` into the lowest bits of a word.
+        auto load = [](uint64_t const * words, size_t const position, size_t const count) -> uint64_t
+        {
+            size_t const bit = position * bits_per_letter;
+            size_t const offset = bit & 63u;
+            size_t const width = count * bits_per_letter;
+            uint64_t letters = words[bit >> 6] >> offset;
+
+            // Only touch the next word if the letters span into it; it might not exist otherwise.
+            if (offset + width > 64u)
+                letters |= words[(bit >> 6) + 1u] << (64u - offset);
+
+            return (width == 64u) ? letters : letters & ((uint64_t{1u} << width) - 1u);
+        };
+
+        // Reduces the bits of every letter of `a ^ b` into its first bit.
+        auto mismatches = [&](size_t const begin1, size_t const begin2, size_t const count) -> uint64_t
+        {
+            uint64_t const difference = load(words1, begin1, count) ^ load(words2, begin2, count);
+            uint64_t reduced = difference;
+            for (size_t i = 1; i < bits_per_letter; ++i)
+                reduced |= difference >> i;
+            return reduced & letter_bits;
+        };
+
+        right = detail::extend_ungapped_in_direction<false>(state,
+                                                            right_length,
+                                                            block_size,
+                                                            bits_per_letter,
+                                                            [&](size_t const distance, size_t const count)
+                                                            {
+                                                                return mismatches(position1 + distance,
+                                                                                  position2 + distance,
+                                                                                  count);
+                                                            });
+        left = detail::extend_ungapped_in_direction<true>(state,
+                                                          left_length,
+                                                          block_size,
+                                                          bits_per_letter,
+                                                          [&](size_t const distance, size_t const count)
+                                                          {
+                                                              return mismatches(position1 - distance - count,
+                                                                                position2 - distance - count,
+                                                                                count);
+                                                          });
+    }
+    else
+    {
+        auto it1 = std::ranges::begin(sequence1);
+        auto it2 = std::ranges::begin(sequence2);
+
+        // Compares `count` letters without an early exit, such that the loop can be vectorised, and gathers the
+        // resulting bytes into bits eight at a time.
+        auto mismatches = [&](size_t const begin1, size_t const begin2, size_t const count) -> uint64_t
+        {
+            std::array<uint8_t, 64> differs{};
+            for (size_t i = 0; i < count; ++i)
+                differs[i] = !(it1[begin1 + i] == it2[begin2 + i]);
+
+            uint64_t mask{};
+            for (size_t i = 0; i < count; i += 8u)
+            {
+                uint64_t bytes{};
+                for (size_t j = 0; j < 8u; ++j)
+                    bytes |= static_cast<uint64_t>(differs[i + j]) << (j * 8u);
+
+                // Moves the lowest bit of byte `j` to bit `56 + j`.
+                mask |= ((bytes * 0x0102040810204080ULL) >> 56) << i;
+            }
+            return mask;
+        };
+
+        right = detail::extend_ungapped_in_direction<false>(state,
+                                                            right_length,
+                                                            64u,
+                                                            1u,
+                                                            [&](size_t const distance, size_t const count)
+                                                            {
+                                                                return mismatches(position1 + distance,
+                                                                                  position2 + distance,
+                                                                                  count);
+                                                            });
+        left = detail::extend_ungapped_in_direction<true>(state,
+                                                          left_length,
+                                                          64u,
+                                                          1u,
+                                                          [&](size_t const distance, size_t const count)
+                                                          {
+                                                              return mismatches(position1 - distance - count,
+                                                                                position2 - distance - count,
+                                                                                count);
+                                                          });
+    }
+
+    return ungapped_extension_result{.score = left.first + right.first,
+                                     .sequence1_begin_position = position1 - left.second,
+                                     .sequence1_end_position = position1 + right.second,
+                                     .sequence2_begin_position = position2 - left.second,
+                                     .sequence2_end_position = position2 + right.second};
+}
+
+} // namespace seqan3
@@ -33,9 +33,9 @@ namespace seqan3::detail
  * \details
  *
  * Wraps a regular scoring scheme by extracting the scores for a match and a mismatch and converts them into
- * seqan3::detail::simd vectors. Only symmetric scoring schemes are preserved, i.e. in the vectorised scoring
- * scheme elements with the same rank are assigned the match score and elements with a different rank are assigned the
- * mismatch score.
+ * seqan3::detail::simd vectors. Elements with the same rank are assigned the match score and elements with a
+ * different rank are assigned the mismatch score. Scoring schemes with more than one match or mismatch score are
+ * rejected on construction; the alignment configuration selects seqan3::detail::simd_matrix_scoring_scheme for them.
  * Note during the conversion to the simd vectors the alphabet type information is lost and
  * only the ranks of the alphabet are used.
  *
@@ -157,6 +157,45 @@ public:
         return match_score[0];
     }
 
+    //!\brief Whether the scores are looked up in a scoring matrix; always `false`.
+    static constexpr bool uses_scoring_matrix() noexcept
+    {
+        return false;
+    }
+
+    /*!\brief Whether the given scoring scheme assigns only one match and one mismatch score.
+     * \tparam scoring_scheme_t The type of the scoring scheme; must model seqan3::scoring_scheme for `alphabet_t`.
+     * \param[in] scoring_scheme The scoring scheme to check.
+     *
+     * \details
+     *
+     * Only such scoring schemes can be represented by this scheme. Other scoring schemes, e.g. a
+     * seqan3::nucleotide_scoring_scheme with scores for the IUPAC symbols of seqan3::dna15, must be looked up in a
+     * seqan3::detail::simd_matrix_scoring_scheme.
+     */
+    template <typename scoring_scheme_t>
+        requires scoring_scheme_for<scoring_scheme_t, alphabet_t>
+    static constexpr bool has_only_match_and_mismatch_scores(scoring_scheme_t const & scoring_scheme)
+    {
+        auto const match = scoring_scheme.score(seqan3::assign_rank_to(0, alphabet_t{}),
+                                                seqan3::assign_rank_to(0, alphabet_t{}));
+        auto const mismatch = scoring_scheme.score(seqan3::assign_rank_to(0, alphabet_t{}),
+                                                   seqan3::assign_rank_to(1, alphabet_t{}));
+
+        for (size_t rank1 = 0; rank1 < alphabet_size<alphabet_t>; ++rank1)
+        {
+            for (size_t rank2 = 0; rank2 < alphabet_size<alphabet_t>; ++rank2)
+            {
+                if (scoring_scheme.score(seqan3::assign_rank_to(rank1, alphabet_t{}),
+                                         seqan3::assign_rank_to(rank2, alphabet_t{}))
+                    != ((rank1 == rank2) ? match : mismatch))
+                    return false;
+            }
+        }
+
+        return true;
+    }
+
     //!\brief Returns the given simd vector without changing it (no-op).
     template <typename alphabet_ranks_t>
         requires std::same_as<std::remove_cvref_t<alphabet_ranks_t>, alphabet_ranks_type>
@@ -173,7 +212,8 @@ private:
      * \param[in] scoring_scheme The scoring scheme to initialise the vectorised match and mismatch score from.
      *
      * \throws std::invalid_argument if the value of the match or mismatch score exceed the value range of the
-     *         scalar type of the used simd vector type `simd_score_t`.
+     *         scalar type of the used simd vector type `simd_score_t`, or if the scoring scheme assigns more than
+     *         one match or mismatch score.
      *
      * \details
      *
@@ -203,6 +243,10 @@ private:
             }
         }
 
+        if (!has_only_match_and_mismatch_scores(scoring_scheme))
+            throw std::invalid_argument{"The selected scoring scheme assigns more than one match or mismatch score; "
+                                        "use seqan3::detail::simd_matrix_scoring_scheme instead."};
+
         match_score = simd::fill<simd_score_t>(static_cast<simd_scalar_t>(scalar_match_score));
         mismatch_score = simd::fill<simd_score_t>(static_cast<simd_scalar_t>(scalar_mismatch_score));
     }
@@ -9,7 +9,11 @@
 
 #pragma once
 
+#include <algorithm>
 #include <concepts>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 #include <seqan3/alignment/configuration/align_config_method.hpp>
 #include <seqan3/alignment/scoring/scoring_scheme_concept.hpp>
@@ -17,11 +21,12 @@
 #include <seqan3/core/concept/cereal.hpp>
 #include <seqan3/utility/simd/algorithm.hpp>
 #include <seqan3/utility/simd/concept.hpp>
+#include <seqan3/utility/simd/simd.hpp>
 
 namespace seqan3::detail
 {
 
-/*!\brief A vectorised scoring scheme to handle scoring matrices using gather strategy.
+/*!\brief A vectorised scoring scheme to handle scoring matrices using gather or byte shuffle strategy.
  * \ingroup alignment_scoring
  * \tparam simd_score_t The type of the simd vector; must model seqan3::simd::simd_concept.
  * \tparam alphabet_t The type of the alphabet over which to define the scoring scheme; must model seqan3::semialphabet.
@@ -39,6 +44,16 @@ namespace seqan3::detail
  * This function computes the starting index of the respective matrix entry within the linearised
  * scoring scheme. To improve the performance this is only done once per column inside of the alignment algorithm.
  *
+ * ### Byte shuffle lookup
+ *
+ * Gather operations are slow on most architectures. For small alphabets the linearised scoring scheme is split into
+ * blocks of 16 scores instead, which are stored in simd vectors and looked up with seqan3::detail::shuffle_lookup.
+ * The block containing the score of an element is selected by comparing the block index of its matrix index with
+ * every block. This is faster than the gather if the number of blocks is small compared to the number of elements
+ * of the simd vector, e.g. for seqan3::dna4 or seqan3::dna15 with 8 bit scores, but not for seqan3::aa27.
+ * It is selected automatically if seqan3::detail::has_shuffle_lookup_v is `true` for `simd_score_t`, the number of
+ * blocks does not exceed half the number of elements and all scores can be represented with 8 bits.
+ *
  * This simd scoring scheme matrix only needs one padding symbol, whose rank is initialised with the size of the
  * alphabet. Accordingly, the internal alphabet size increases by one.
  * Depending on the selected algorithm method the corresponding score values are either set to `1` for the global
@@ -57,6 +72,10 @@ class simd_matrix_scoring_scheme
 private:
     //!\brief The underlying scalar type of the simd vector.
     using scalar_type = typename simd_traits<simd_score_t>::scalar_type;
+    /*!\brief The unsigned simd type used to compute the indices within the linearised scoring scheme.
+     * \details The indices wrap around instead of overflowing if they exceed the signed scalar type.
+     */
+    using simd_index_type = simd::simd_type_t<std::make_unsigned_t<scalar_type>, simd_traits<simd_score_t>::length>;
     //!\brief The score profile type used for this scoring scheme, which is the same as the simd score type.
     using simd_score_profile_type = simd_score_t;
     //!\brief The type of the simd vector representing the alphabet ranks of one sequence batch.
@@ -77,8 +96,20 @@ private:
     //!\brief The score used for the padding symbol (global -> increases score; local -> decreases score).
     static constexpr scalar_type score_for_padding_symbol = (is_global) ? 1 : -1;
 
+    //!\brief The number of blocks of 16 scores of the linearised scoring scheme.
+    static constexpr size_t block_count = (index_offset * index_offset + 15) / 16;
+    //!\brief Whether the scores are looked up with byte shuffles if they can be represented with 8 bits.
+    static constexpr bool has_shuffle_backend =
+        has_shuffle_lookup_v<simd_score_t> && block_count <= simd_traits<simd_score_t>::length / 2;
+    //!\brief The type of the simd vectors storing the blocks of the linearised scoring scheme.
+    using block_vector_type = simd::simd_type_t<int8_t, sizeof(simd_score_t)>;
+
     //!\brief The scoring scheme stored as a linear array.
     std::vector<scalar_type> scoring_scheme_data{};
+    //!\brief The blocks of the linearised scoring scheme, repeated in every block of 16 elements of the vector.
+    std::vector<block_vector_type> block_vectors{};
+    //!\brief Whether the scores are looked up with byte shuffles.
+    bool uses_shuffle_lookup{false};
 
 public:
     //!\brief The padding symbol used to fill up smaller sequences in a simd batch.
@@ -137,7 +168,16 @@ public:
     constexpr simd_score_t score(simd_score_profile_type const & score_profile,
                                  simd_alphabet_ranks_type const & ranks) const noexcept
     {
-        simd_score_t const matrix_index = score_profile + ranks; // Compute the matrix indices for the lookup.
+        // Compute the matrix indices for the lookup.
+        simd_index_type const matrix_index = reinterpret_cast<simd_index_type const &>(score_profile)
+                                           + reinterpret_cast<simd_index_type const &>(ranks);
+
+        if constexpr (has_shuffle_backend)
+        {
+            if (uses_shuffle_lookup)
+                return shuffle_score(matrix_index);
+        }
+
         simd_score_t result{};
 
         for (size_t idx = 0; idx < simd_traits<simd_score_t>::length; ++idx)
@@ -153,6 +193,12 @@ public:
         return score_for_padding_symbol;
     }
 
+    //!\brief Whether the scores are looked up in a scoring matrix; always `true`.
+    static constexpr bool uses_scoring_matrix() noexcept
+    {
+        return true;
+    }
+
     /*!\brief Converts the simd alphabet ranks into a score profile used for scoring it later with the alphabet ranks
      *        of another sequence batch.
      *
@@ -165,10 +211,32 @@ public:
      */
     constexpr simd_score_profile_type make_score_profile(simd_alphabet_ranks_type const & ranks) const noexcept
     {
-        return ranks * simd::fill<simd_score_t>(index_offset);
+        return reinterpret_cast<simd_score_profile_type>(reinterpret_cast<simd_index_type const &>(ranks)
+                                                         * simd::fill<simd_index_type>(index_offset));
     }
 
 private:
+    /*!\brief Computes the scores with byte shuffles.
+     * \param[in] matrix_index The indices of the scores within the linearised scoring scheme.
+     * \returns The score simd vector.
+     */
+    constexpr simd_score_t shuffle_score(simd_index_type const & matrix_index) const noexcept
+    {
+        simd_index_type const block_index = matrix_index >> 4;
+        simd_score_t const index_in_block =
+            reinterpret_cast<simd_score_t>(matrix_index & simd::fill<simd_index_type>(15));
+        simd_score_t result = shuffle_lookup(block_vectors[0], index_in_block);
+
+        for (size_t block = 1; block < block_count; ++block)
+        {
+            result = (block_index == simd::fill<simd_index_type>(block))
+                       ? shuffle_lookup(block_vectors[block], index_in_block)
+                       : result;
+        }
+
+        return result;
+    }
+
     /*!\brief Store the given scoring scheme matrix into a private member variable.
      * \tparam scoring_scheme_t The type of the scoring scheme; must model seqan3::scoring_scheme_for the given
      *                          alphabet type.
@@ -218,6 +286,36 @@ private:
             }
             ++data_it; // skip one for the padded symbol.
         }
+
+        if constexpr (has_shuffle_backend)
+            initialise_block_vectors();
+    }
+
+    /*!\brief Stores the linearised scoring scheme in simd vectors for the byte shuffle lookup.
+     * \details The byte shuffle lookup is only used if all scores can be represented with 8 bits.
+     */
+    constexpr void initialise_block_vectors()
+    {
+        uses_shuffle_lookup = std::ranges::all_of(scoring_scheme_data,
+                                                  [](scalar_type const score)
+                                                  {
+                                                      return std::in_range<int8_t>(score);
+                                                  });
+        block_vectors.clear();
+
+        if (!uses_shuffle_lookup)
+            return;
+
+        block_vectors.resize(block_count);
+        for (size_t block = 0; block < block_count; ++block)
+        {
+            for (size_t i = 0; i < simd_traits<block_vector_type>::length; ++i)
+            {
+                size_t const matrix_index = block * 16 + i % 16;
+                if (matrix_index < scoring_scheme_data.size())
+                    block_vectors[block][i] = static_cast<int8_t>(scoring_scheme_data[matrix_index]);
+            }
+        }
     }
 };
 
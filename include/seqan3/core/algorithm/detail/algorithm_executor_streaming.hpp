@@ -0,0 +1,431 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides seqan3::detail::algorithm_executor_streaming.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <ranges>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include <seqan3/core/algorithm/detail/execution_handler_parallel.hpp>
+#include <seqan3/core/configuration/detail/configuration_element_parallel_mode.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief A parallel algorithm executor that streams the results with a bounded buffer.
+ * \ingroup core_algorithm
+ * \tparam resource_t The underlying range of algorithm inputs; must model std::ranges::viewable_range and
+ *                    std::ranges::forward_range.
+ * \tparam algorithm_t The algorithm to be invoked on the elements of the given resource; must model std::semiregular.
+ * \tparam algorithm_result_t The result type generated by the algorithm; must model std::semiregular.
+ *
+ * \details
+ *
+ * In contrast to the seqan3::detail::algorithm_executor_blocking with the seqan3::detail::execution_handler_parallel,
+ * this executor does not compute the entire resource at once. It owns a fixed number of result buckets and invokes
+ * the algorithm asynchronously for as many elements of the resource as there are free buckets. Every call to
+ * seqan3::detail::algorithm_executor_streaming::next_result() returns the next result of a finished invocation. As
+ * soon as all results of a bucket were returned, the bucket is reused for the next element of the resource.
+ * Accordingly, the memory is bounded by the number of buckets and the computation overlaps with the consumption of
+ * the results.
+ *
+ * ### Result order
+ *
+ * With seqan3::detail::parallel_result_order::input the buckets are returned in the order of the resource, i.e. the
+ * results are reported in the same order as by the seqan3::detail::algorithm_executor_blocking. With
+ * seqan3::detail::parallel_result_order::completion the buckets are returned in the order in which their invocations
+ * finished, such that a slow invocation does not delay the results of the following ones.
+ *
+ * ### Thread safety
+ *
+ * The algorithm is copied for every invocation. Only one thread may call
+ * seqan3::detail::algorithm_executor_streaming::next_result() at a time.
+ */
+template <std::ranges::viewable_range resource_t, std::semiregular algorithm_t, std::semiregular algorithm_result_t>
+    requires std::ranges::forward_range<resource_t>
+          && std::invocable<algorithm_t,
+                            std::ranges::range_reference_t<resource_t>,
+                            std::function<void(algorithm_result_t)>>
+class algorithm_executor_streaming
+{
+private:
+    /*!\name Resource types
+     * \{
+     */
+    //!\brief The underlying resource type.
+    using resource_type = std::views::all_t<resource_t>;
+    //!\brief The iterator over the underlying resource.
+    using resource_iterator_type = std::ranges::iterator_t<resource_type>;
+    //!\brief The difference type over the underlying resource.
+    using resource_difference_type = std::iter_difference_t<resource_iterator_type>;
+    //!\}
+
+    /*!\name Buffer types
+     * \{
+     */
+    //!\brief The type of a bucket storing the results produced by a single algorithm invocation.
+    using bucket_type = std::vector<algorithm_result_t>;
+    //!\brief The iterator type of a bucket.
+    using bucket_iterator_type = std::ranges::iterator_t<bucket_type>;
+    //!\}
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \brief The class is move-only, i.e. it is not copy-constructible or copy-assignable.
+     * \{
+     */
+    //!\brief Deleted default constructor because this class manages an external resource.
+    algorithm_executor_streaming() = delete;
+    //!\brief This class provides unique ownership over the managed resource and is therefor not copyable.
+    algorithm_executor_streaming(algorithm_executor_streaming const &) = delete;
+
+    /*!\brief Move constructs the resource of the other executor.
+     * \param[in] other The other executor (prvalue) to move from.
+     *
+     * \details
+     *
+     * The running invocations of the other executor might refer to its resource. Hence, the move waits until they
+     * have finished. Their results remain buffered.
+     *
+     * ### Complexity
+     *
+     * Constant if the underlying resource type models std::ranges::random_access_range, otherwise linear.
+     */
+    algorithm_executor_streaming(algorithm_executor_streaming && other) :
+        algorithm_executor_streaming{std::move(other), other.finish_running_invocations()}
+    {}
+
+    //!\brief This class provides unique ownership over the managed resource and is therefor not copyable.
+    algorithm_executor_streaming & operator=(algorithm_executor_streaming const &) = delete;
+
+    //!\brief Move assigns from the resource of another executor.
+    //!\copydetails seqan3::detail::algorithm_executor_streaming::algorithm_executor_streaming(algorithm_executor_streaming && other)
+    algorithm_executor_streaming & operator=(algorithm_executor_streaming && other)
+    {
+        // The running invocations of this executor might refer to the resource that is replaced.
+        wait_for_running_invocations();
+        auto old_resource_position = other.finish_running_invocations();
+
+        resource = std::move(other.resource);
+        move_initialise(std::move(other), old_resource_position);
+        return *this;
+    }
+
+    //!\brief Defaulted; the execution handler joins its threads before the resource is destroyed.
+    ~algorithm_executor_streaming() = default;
+
+    /*!\brief Constructs this executor with the given resource range.
+     *
+     * \param[in] resource The underlying resource.
+     * \param[in] algorithm The algorithm to invoke on the elements of the underlying resource.
+     * \param[in] result A dummy result object to deduce the type of the underlying buffer value.
+     * \param[in] exec_handler The parallel execution handler.
+     * \param[in] buffer_size The number of result buckets, i.e. the maximal number of invocations at a time.
+     * \param[in] order The order in which the results are reported.
+     *
+     * \throws std::invalid_argument if `buffer_size` is 0.
+     *
+     * \details
+     *
+     * No algorithm is invoked before the first call to seqan3::detail::algorithm_executor_streaming::next_result().
+     * The third argument is only used for deducing the algorithm result type.
+     */
+    algorithm_executor_streaming(resource_t resource,
+                                 algorithm_t algorithm,
+                                 algorithm_result_t const SEQAN3_DOXYGEN_ONLY(result),
+                                 execution_handler_parallel && exec_handler,
+                                 size_t const buffer_size,
+                                 parallel_result_order const order = parallel_result_order::input) :
+        resource{std::forward<resource_t>(resource)},
+        resource_it{std::ranges::begin(this->resource)},
+        state{std::make_unique<internal_state>(std::move(algorithm), buffer_size, order)},
+        exec_handler{std::move(exec_handler)}
+    {
+        if (buffer_size == 0)
+            throw std::invalid_argument{"The buffer size of a parallel algorithm must be greater than 0."};
+
+        // Buckets are taken from the back, so the first invocation uses the first bucket.
+        for (size_t bucket = buffer_size; bucket > 0; --bucket)
+            free_buckets.push_back(bucket - 1);
+    }
+    //!\}
+
+    /*!\brief Returns the next available algorithm result.
+     * \returns A std::optional that either contains the next algorithm result or is empty, i.e. the
+     *          underlying resource has been completely consumed.
+     *
+     * \details
+     *
+     * Invokes the algorithm for the next elements of the resource as long as free buckets are available and blocks
+     * until the next bucket is complete. Invocations that do not produce any result are skipped.
+     */
+    std::optional<algorithm_result_t> next_result()
+    {
+        for (;;)
+        {
+            if (current_bucket.has_value())
+            {
+                if (bucket_it != state->buckets[*current_bucket].end())
+                {
+                    std::optional<algorithm_result_t> result{std::ranges::iter_move(bucket_it)};
+                    ++bucket_it;
+                    return result;
+                }
+
+                // The bucket is consumed and can be reused.
+                state->buckets[*current_bucket].clear();
+                free_buckets.push_back(*current_bucket);
+                current_bucket.reset();
+            }
+
+            invoke_on_free_buckets();
+
+            if (pending_buckets.empty())
+                return std::nullopt;
+
+            current_bucket = wait_for_next_bucket();
+            bucket_it = state->buckets[*current_bucket].begin();
+        }
+    }
+
+    //!\brief Checks whether the end of the input resource was reached.
+    bool is_eof() noexcept
+    {
+        return resource_it == std::ranges::end(resource);
+    }
+
+private:
+    /*!\brief The state shared with the running invocations; stored on the heap to keep its address on moves.
+     *
+     * \details
+     *
+     * ### Thread safety
+     *
+     * A bucket is exclusively accessed by the invocation writing into it until the invocation marks it as finished.
+     * The finished flags and the queue of finished buckets are guarded by the mutex.
+     */
+    struct internal_state
+    {
+        /*!\brief Constructs the state.
+         * \param[in] algorithm The algorithm that is copied for every invocation.
+         * \param[in] buffer_size The number of buckets.
+         * \param[in] order The order in which the buckets are reported.
+         */
+        internal_state(algorithm_t algorithm, size_t const buffer_size, parallel_result_order const order) :
+            algorithm{std::move(algorithm)},
+            buckets(buffer_size),
+            finished(buffer_size, false),
+            order{order}
+        {}
+
+        /*!\brief Marks an invocation as finished.
+         * \param[in] bucket The bucket of the invocation.
+         */
+        void finish(size_t const bucket)
+        {
+            {
+                std::lock_guard lock{mutex};
+                finished[bucket] = true;
+                if (order == parallel_result_order::completion)
+                    finished_buckets.push_back(bucket);
+                --running_invocations;
+            }
+            condition.notify_one();
+        }
+
+        //!\brief The algorithm that is copied for every invocation.
+        algorithm_t algorithm;
+        //!\brief The result buckets.
+        std::vector<bucket_type> buckets;
+        //!\brief Whether the invocation writing into a bucket has finished.
+        std::vector<bool> finished;
+        //!\brief The buckets in the order in which their invocations finished.
+        std::deque<size_t> finished_buckets{};
+        //!\brief The number of invocations that have not finished yet.
+        size_t running_invocations{0};
+        //!\brief The order in which the buckets are reported.
+        parallel_result_order order;
+        //!\brief Guards the finished flags, the queue of finished buckets and the number of running invocations.
+        std::mutex mutex{};
+        //!\brief Notifies the consumer about a finished invocation.
+        std::condition_variable condition{};
+    };
+
+    /*!\brief This constructor is needed to ensure initialisation order for the move construction.
+     * \details
+     * We need to access the processed seqan3::detail::algorithm_executor_streaming::resource_position BEFORE moving the
+     * resource range. As that could invalidate iterators.
+     */
+    algorithm_executor_streaming(algorithm_executor_streaming && other,
+                                 resource_difference_type old_resource_position) :
+        resource{std::move(other.resource)}
+    {
+        move_initialise(std::move(other), old_resource_position);
+    }
+
+    //!\brief Blocks until all running invocations have finished.
+    void wait_for_running_invocations()
+    {
+        if (state == nullptr) // Moved-from executor.
+            return;
+
+        std::unique_lock lock{state->mutex};
+        state->condition.wait(lock,
+                              [this]
+                              {
+                                  return state->running_invocations == 0;
+                              });
+    }
+
+    /*!\brief Waits until all running invocations have finished.
+     * \returns The number of times the resource_it was incremented.
+     */
+    resource_difference_type finish_running_invocations()
+    {
+        wait_for_running_invocations();
+
+        auto position = std::ranges::distance(std::ranges::begin(resource), resource_it);
+        assert(position >= 0);
+        return position;
+    }
+
+    //!\brief Invokes the algorithm asynchronously on the next elements of the resource while buckets are free.
+    void invoke_on_free_buckets()
+    {
+        for (; !free_buckets.empty() && !is_eof(); ++resource_it)
+        {
+            size_t const bucket = free_buckets.back();
+            free_buckets.pop_back();
+
+            {
+                std::lock_guard lock{state->mutex};
+                state->finished[bucket] = false;
+                ++state->running_invocations;
+            }
+            pending_buckets.push_back(bucket);
+
+            internal_state * shared_state = state.get();
+            exec_handler.execute(
+                [shared_state, bucket](auto && input, auto && callback)
+                {
+                    algorithm_t algorithm{shared_state->algorithm};
+                    algorithm(std::forward<decltype(input)>(input), std::forward<decltype(callback)>(callback));
+                    shared_state->finish(bucket);
+                },
+                *resource_it,
+                [target_bucket = &shared_state->buckets[bucket]](auto && algorithm_result)
+                {
+                    target_bucket->push_back(std::move(algorithm_result));
+                });
+        }
+    }
+
+    /*!\brief Blocks until the next bucket is complete according to the result order.
+     * \returns The index of the complete bucket.
+     *
+     * \details
+     *
+     * If the calling thread belongs to the thread pool, it executes pending tasks while waiting, such that the results
+     * can also be consumed within a task of the pool.
+     */
+    size_t wait_for_next_bucket()
+    {
+        assert(!pending_buckets.empty());
+
+        size_t bucket{};
+        // Must be called with the locked mutex.
+        auto take_complete_bucket = [&]() -> bool
+        {
+            if (state->order == parallel_result_order::input)
+            {
+                if (!state->finished[pending_buckets.front()])
+                    return false;
+
+                bucket = pending_buckets.front();
+                pending_buckets.pop_front();
+                return true;
+            }
+
+            if (state->finished_buckets.empty())
+                return false;
+
+            bucket = state->finished_buckets.front();
+            state->finished_buckets.pop_front();
+            std::erase(pending_buckets, bucket);
+            return true;
+        };
+
+        do
+        {
+            std::lock_guard lock{state->mutex};
+            if (take_complete_bucket())
+                return bucket;
+        }
+        while (exec_handler.run_pending_task());
+
+        std::unique_lock lock{state->mutex};
+        state->condition.wait(lock, take_complete_bucket);
+        return bucket;
+    }
+
+    //!\brief Helper function to move initialise `this` from `other`.
+    void move_initialise(algorithm_executor_streaming && other, resource_difference_type old_resource_position)
+    {
+        resource_it = std::ranges::next(std::ranges::begin(resource), old_resource_position);
+        // The buckets are stored on the heap, hence the bucket iterator stays valid.
+        state = std::move(other.state);
+        free_buckets = std::move(other.free_buckets);
+        pending_buckets = std::move(other.pending_buckets);
+        current_bucket = std::move(other.current_bucket);
+        bucket_it = std::move(other.bucket_it);
+        exec_handler = std::move(other.exec_handler);
+    }
+
+    //!\brief The underlying resource.
+    resource_type resource; // a std::ranges::view
+    //!\brief The iterator over the resource that stores the current state of the executor.
+    resource_iterator_type resource_it{};
+    //!\brief The state shared with the running invocations.
+    std::unique_ptr<internal_state> state{};
+    //!\brief The buckets that can be used for the next invocations.
+    std::vector<size_t> free_buckets{};
+    //!\brief The buckets of the running or finished invocations in the order of the resource.
+    std::deque<size_t> pending_buckets{};
+    //!\brief The bucket whose results are currently returned.
+    std::optional<size_t> current_bucket{};
+    //!\brief The iterator pointing to the next result within the current bucket.
+    bucket_iterator_type bucket_it{};
+    //!\brief The execution handler; declared last, such that its threads are joined before the resource is destroyed.
+    execution_handler_parallel exec_handler{};
+};
+
+/*!\name Type deduction guides
+ * \relates seqan3::detail::algorithm_executor_streaming
+ * \{
+ */
+
+//!\brief Deduce the type from the provided arguments.
+template <typename resource_rng_t, std::semiregular algorithm_t, std::semiregular algorithm_result_t>
+algorithm_executor_streaming(resource_rng_t &&,
+                             algorithm_t,
+                             algorithm_result_t const &,
+                             execution_handler_parallel &&,
+                             size_t,
+                             parallel_result_order = parallel_result_order::input)
+    -> algorithm_executor_streaming<resource_rng_t, algorithm_t, algorithm_result_t>;
+//!\}
+} // namespace seqan3::detail
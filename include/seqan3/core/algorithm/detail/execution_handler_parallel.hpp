@@ -9,15 +9,18 @@
 
 #pragma once
 
+#include <cassert>
 #include <concepts>
+#include <condition_variable>
 #include <functional>
+#include <memory>
+#include <mutex>
 #include <ranges>
 #include <thread>
 #include <type_traits>
 #include <vector>
 
-#include <seqan3/contrib/parallel/buffer_queue.hpp>
-#include <seqan3/utility/parallel/detail/reader_writer_manager.hpp>
+#include <seqan3/utility/parallel/thread_pool.hpp>
 #include <seqan3/utility/type_traits/basic.hpp>
 
 namespace seqan3::detail
@@ -35,57 +38,47 @@ namespace seqan3::detail
  *
  * ### Concurrency
  *
- * This class maintains a thread pool and a concurrent queue to execute the algorithm tasks asynchronously.
- * On construction the active consumer threads are spawned in the thread pool and concurrently start fetching
- * algorithm tasks from the concurrent queue. At the same time only one producer thread is allowed to asynchronously
- * submit new algorithm tasks.
+ * The algorithm tasks are executed by a seqan3::thread_pool. The handler either owns a pool with the given number of
+ * threads or uses a pool that is shared with other handlers, e.g. across several calls of seqan3::align_pairwise.
+ * The handler keeps track of its own tasks, such that seqan3::detail::execution_handler_parallel::wait only waits for
+ * the tasks submitted through this handler. If the waiting thread is a thread of the pool, it executes pending tasks
+ * of the pool meanwhile, such that algorithms can be nested in the tasks of a pool. At most
+ * seqan3::detail::execution_handler_parallel::max_pending_tasks tasks of a handler are pending at the same time;
+ * further submissions wait until a task has finished. At the same time only one producer thread is allowed to
+ * asynchronously submit new algorithm tasks.
  *
  * \note Instances of this class are not copyable.
  *
  * \warning This class is only thread-safe in a single producer context. Multiple consumers are allowed.
  *          Concurrent invocation of the interfaces are undefined behaviour.
- *
- * \attention This class cannot be reused for multiple calls. For this to work, it requires barriers and a queue that
- *            can be reopened.
  */
 class execution_handler_parallel
 {
-private:
-    //!\brief The type erased task type.
-    using task_type = std::function<void()>;
-
 public:
+    //!\brief The maximal number of pending tasks submitted through one handler.
+    static constexpr size_t max_pending_tasks{10000};
+
     /*!\name Constructors, destructor and assignment
      * \brief Instances of this class are not copyable.
      * \{
      */
 
-    /*!\brief Constructs the execution handler spawning `thread_count` many threads.
+    /*!\brief Constructs the execution handler with its own pool spawning `thread_count` many threads.
      * \param thread_count The number of threads to spawn.
      *
      * \details
      *
-     * Spawns `thread_count` many threads processing the tasks in the queue in parallel.
+     * Spawns `thread_count` many threads processing the tasks in parallel.
      */
-    execution_handler_parallel(size_t const thread_count) : state{std::make_unique<internal_state>()}
-    {
-        auto * q = &(state->queue);
-        for (size_t i = 0; i < thread_count; ++i)
-        {
-            state->thread_pool.emplace_back(
-                [q]()
-                {
-                    for (;;)
-                    {
-                        task_type task;
-                        if (q->wait_pop(task) == contrib::queue_op_status::closed)
-                            return;
-
-                        task();
-                    }
-                });
-        }
-    }
+    execution_handler_parallel(size_t const thread_count) :
+        state{std::make_unique<internal_state>(std::make_unique<thread_pool>(thread_count))}
+    {}
+
+    /*!\brief Constructs the execution handler executing the tasks in the given pool.
+     * \param pool The thread pool; must outlive the execution handler.
+     */
+    explicit execution_handler_parallel(thread_pool & pool) : state{std::make_unique<internal_state>(pool)}
+    {}
 
     /*!\brief Constructs the execution handler spawning 1 thread.
      *
@@ -126,7 +119,7 @@ public:
      * \details
      *
      * Inside the function the algorithm and the callback are captured as copies to the sate of a lambda function
-     * which wraps the task that is stored on the concurrent queue and asynchronously executed. The algorithm input
+     * which wraps the task that is submitted to the thread pool and asynchronously executed. The algorithm input
      * type, however, is perfectly forwarded if `input` is a lvalue-reference or moved if it is a rvalue-reference.
      * Accordingly, the `algorithm_input_t` must either be a lvalue_reference or std::move_constructible.
      */
@@ -137,28 +130,23 @@ public:
     {
         assert(state != nullptr);
 
-        // Note: Unfortunately, we can't use std::forward_as_tuple here because a std::function object (`task_type`)
-        // cannot be constructed if the tuple element type is a rvalue-reference.
-        // So we capture the input as a `tuple<algorithm_input_t>` which either is a lvalue reference or has no
+        // Note: We capture the input as a `tuple<algorithm_input_t>` which either is a lvalue reference or has no
         // reference type according to the reference collapsing rules of forwarding references.
         // Then we forward the input into the tuple which either just stores the reference or the input is moved into
         // the tuple. When the task is executed by some thread the stored input will either be forwarded as a
         // lvalue-reference to the algorithm or the input is moved into the algorithm from the tuple. This is valid
-        // since the task is executed only once by the parallel execution handler.
+        // since the task is executed only once.
         // Here is a discussion about the problem on stackoverflow:
         // https://stackoverflow.com/questions/26831382/capturing-perfectly-forwarded-variable-in-lambda/
 
-        // Asynchronously pushes the algorithm job as a task to the queue.
         // Note: that lambda is mutable, s.t. we can move out the content of input_tpl
-        task_type task =
-            [=, input_tpl = std::tuple<algorithm_input_t>{std::forward<algorithm_input_t>(input)}]() mutable
+        auto task = [=, input_tpl = std::tuple<algorithm_input_t>{std::forward<algorithm_input_t>(input)}]() mutable
         {
             using forward_input_t = std::tuple_element_t<0, decltype(input_tpl)>;
             algorithm(std::forward<forward_input_t>(std::get<0>(input_tpl)), std::move(callback));
         };
 
-        [[maybe_unused]] contrib::queue_op_status status = state->queue.wait_push(std::move(task));
-        assert(status == contrib::queue_op_status::success);
+        state->submit(std::move(task));
     }
 
     /*!\brief Asynchronously executes the algorithm for every element of the given input range.
@@ -173,8 +161,7 @@ public:
      * \details
      *
      * Effectively calls seqan3::detail::execution_handler_parallel::execute on every element of the given input
-     * range. For every element, a work task is generated and queued for processing by the threads spawned at the
-     * construction of this execution handler.
+     * range. For every element, a work task is generated and submitted to the thread pool.
      * The call blocks until all elements have been processed.
      */
     template <std::copy_constructible algorithm_t,
@@ -194,7 +181,18 @@ public:
     {
         assert(state != nullptr);
 
-        state->stop_and_wait();
+        state->wait_for_pending_tasks(0);
+    }
+
+    /*!\brief Executes a pending task of the pool if the calling thread belongs to the pool.
+     * \returns `true` if a task was executed.
+     * \sa seqan3::thread_pool::run_pending_task
+     */
+    bool run_pending_task()
+    {
+        assert(state != nullptr);
+
+        return state->run_pending_task();
     }
 
 private:
@@ -213,42 +211,126 @@ private:
         * \brief Instances of this class are not copyable and not movable.
         * \{
         */
-        internal_state() = default;                                  //!< Defaulted.
+        internal_state() = delete;                                   //!< Deleted.
         internal_state(internal_state const &) = delete;             //!< Deleted.
         internal_state(internal_state &&) = delete;                  //!< Deleted.
         internal_state & operator=(internal_state const &) = delete; //!< Deleted.
         internal_state & operator=(internal_state &&) = delete;      //!< Deleted.
 
-        //!\brief Waits for threads to finish.
+        //!\brief Constructs the state owning the given pool.
+        explicit internal_state(std::unique_ptr<thread_pool> pool) : owned_pool{std::move(pool)}, pool{*owned_pool}
+        {}
+
+        //!\brief Constructs the state using the given pool.
+        explicit internal_state(thread_pool & pool) : pool{pool}
+        {}
+
+        //!\brief Waits for the submitted tasks to finish.
         ~internal_state()
         {
-            stop_and_wait();
+            wait_for_pending_tasks(0);
         }
         //!\}
 
-        /*!\brief Waits until all threads have been joined.
+        /*!\brief Submits a task to the pool.
+         * \param[in] function The task; invoked without arguments.
          *
          * \details
          *
-         * ### Thread safety
-         *
-         * This function is not thread-safe.
+         * The task is stored on the heap until it was executed. Blocks while seqan3::detail::execution_handler_parallel
+         * ::max_pending_tasks tasks are pending.
+         */
+        template <typename function_t>
+        void submit(function_t && function)
+        {
+            wait_for_pending_tasks(max_pending_tasks - 1);
+
+            {
+                std::lock_guard lock{mutex};
+                ++pending_tasks;
+            }
+
+            auto * task = new pending_task<std::remove_cvref_t<function_t>>{std::forward<function_t>(function), *this};
+            pool.submit(*task);
+        }
+
+        //!\copydoc seqan3::detail::execution_handler_parallel::run_pending_task
+        bool run_pending_task()
+        {
+            return pool.run_pending_task();
+        }
+
+        /*!\brief Blocks until at most `count` tasks are pending.
+         * \details A thread of the pool executes pending tasks meanwhile.
+         * \param[in] count The number of pending tasks to wait for.
          */
-        void stop_and_wait()
+        void wait_for_pending_tasks(size_t const count)
         {
-            queue.close();
+            for (;;)
+            {
+                {
+                    std::lock_guard lock{mutex};
+                    if (pending_tasks <= count)
+                        return;
+                }
 
-            for (auto & t : thread_pool)
+                if (pool.run_pending_task())
+                    continue;
+
+                // All remaining tasks are currently running.
+                std::unique_lock lock{mutex};
+                task_finished.wait(lock,
+                                   [&]
+                                   {
+                                       return pending_tasks <= count;
+                                   });
+                return;
+            }
+        }
+
+    private:
+        /*!\brief A task submitted through the handler; deletes itself after execution.
+         * \tparam function_t The type of the task.
+         */
+        template <typename function_t>
+        struct pending_task
+        {
+            //!\brief Executes the task, deletes it and notifies the handler.
+            void operator()()
             {
-                if (t.joinable())
-                    t.join();
+                internal_state & owner = state;
+                {
+                    std::unique_ptr<pending_task> self{this};
+                    function();
+                }
+                owner.finish_task();
             }
+
+            //!\brief The task.
+            function_t function;
+            //!\brief The state of the handler that submitted the task.
+            internal_state & state;
+        };
+
+        //!\brief Marks a task as finished.
+        void finish_task()
+        {
+            // Notify while holding the lock, since the state may be destructed as soon as the lock is released.
+            std::lock_guard lock{mutex};
+            --pending_tasks;
+            task_finished.notify_all();
         }
 
-        //!\brief The thread pool.
-        std::vector<std::thread> thread_pool{};
-        //!\brief The concurrent queue containing the algorithms to process.
-        contrib::fixed_buffer_queue<task_type> queue{10000};
+        //!\brief The pool if owned by the handler.
+        std::unique_ptr<thread_pool> owned_pool{};
+        //!\brief The pool executing the tasks.
+        thread_pool & pool;
+        //!\brief Guards the number of pending tasks.
+        std::mutex mutex{};
+        //!\brief Notifies about finished tasks.
+        std::condition_variable task_finished{};
+        //!\brief The number of submitted tasks that have not finished.
+        size_t pending_tasks{0};
     };
 
     //!\brief Manages the internal state.
@@ -10,12 +10,25 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <memory>
 #include <optional>
 
 #include <seqan3/core/configuration/pipeable_config_element.hpp>
+#include <seqan3/utility/parallel/thread_pool.hpp>
 
 namespace seqan3::detail
 {
+/*!\brief The order in which the results of a parallel algorithm are reported.
+ * \ingroup core_configuration
+ */
+enum class parallel_result_order : uint8_t
+{
+    input,     //!< The results are reported in the order of the input.
+    completion //!< The results are reported as soon as their computation finished.
+};
+
 /*!\brief A global configuration type used to enable parallel execution of algorithms.
  * \ingroup core_configuration
  * \tparam wrapped_config_id_t The algorithm specific configuration id wrapped in a std::integral_constant.
@@ -23,11 +36,27 @@ namespace seqan3::detail
  * \details
  *
  * This type is used to enable the parallel mode of the algorithms.
+ *
+ * The results are streamed: at most seqan3::detail::parallel_mode::buffer_size algorithm invocations are computed or
+ * buffered at the same time and new invocations are started while the results are consumed. Accordingly, the memory
+ * does not grow with the size of the input. By default, the results are reported in the order of the input, such that
+ * one slow invocation delays the results of the following ones. With parallel_result_order::completion the results
+ * are reported as soon as they are available instead.
+ *
+ * By default, every algorithm invocation spawns its own threads. If the element is constructed from a
+ * seqan3::thread_pool, the algorithm executes its tasks in the given pool instead, such that consecutive invocations
+ * reuse the same threads. The pool must outlive the results of the algorithm.
  */
 template <typename wrapped_config_id_t>
 class parallel_mode : private pipeable_config_element
 {
 public:
+    //!\brief The order in which the results are reported.
+    using result_order = parallel_result_order;
+
+    //!\brief The number of algorithm invocations buffered per thread if no buffer size is set.
+    static constexpr size_t default_buffer_size_per_thread{16};
+
     /*!\name Constructors, assignment and destructor
      * \{
      */
@@ -43,11 +72,54 @@ public:
      */
     explicit parallel_mode(uint32_t thread_count_) noexcept : thread_count{thread_count_}
     {}
+
+    /*!\brief Executes the algorithm in the given thread pool.
+     * \param[in] pool_ The thread pool; the number of threads is set to the size of the pool.
+     */
+    explicit parallel_mode(thread_pool & pool_) noexcept :
+        thread_count{static_cast<uint32_t>(pool_.size())},
+        pool{std::addressof(pool_)}
+    {}
+
+    /*!\brief Executes the algorithm in the given thread pool with the given buffer size and result order.
+     * \param[in] pool_ The thread pool; the number of threads is set to the size of the pool.
+     * \param[in] buffer_size_ The maximum number of algorithm invocations that are computed or buffered at once.
+     * \param[in] order_ The order in which the results are reported.
+     */
+    parallel_mode(thread_pool & pool_, size_t buffer_size_, result_order order_ = result_order::input) noexcept :
+        thread_count{static_cast<uint32_t>(pool_.size())},
+        buffer_size{buffer_size_},
+        order{order_},
+        pool{std::addressof(pool_)}
+    {}
+
+    /*!\brief Sets the number of threads, the buffer size and the result order.
+     * \param[in] thread_count_ The maximum number of threads to be used by the algorithm.
+     * \param[in] buffer_size_ The maximum number of algorithm invocations that are computed or buffered at once.
+     * \param[in] order_ The order in which the results are reported.
+     */
+    parallel_mode(uint32_t thread_count_, size_t buffer_size_, result_order order_ = result_order::input) noexcept :
+        thread_count{thread_count_},
+        buffer_size{buffer_size_},
+        order{order_}
+    {}
     //!\}
 
     //!\brief The maximum number of threads the algorithm can use.
     std::optional<uint32_t> thread_count{std::nullopt};
 
+    /*!\brief The maximum number of algorithm invocations that are computed or buffered at once.
+     * \details If not set, seqan3::detail::parallel_mode::default_buffer_size_per_thread invocations per thread are
+     *          buffered.
+     */
+    std::optional<size_t> buffer_size{std::nullopt};
+
+    //!\brief The order in which the results are reported [default: result_order::input].
+    result_order order{result_order::input};
+
+    //!\brief The thread pool executing the algorithm; if `nullptr`, the algorithm spawns its own threads.
+    thread_pool * pool{nullptr};
+
     /*!\privatesection
      * \brief Internal id to check for consistent configuration settings.
      */
@@ -24,6 +24,15 @@ namespace seqan3::search_cfg
  *
  * The config element takes the number of threads as a parameter, which must be greater than `0`.
  *
+ * The queries are searched while the results are consumed. At most seqan3::search_cfg::parallel::buffer_size queries
+ * are searched or buffered at the same time (by default 16 per thread), such that the memory does not depend on the
+ * number of queries. By default, the results are reported in the order of the queries. If
+ * seqan3::search_cfg::parallel::order is set to `result_order::completion`, the results of a query are reported as
+ * soon as the query was searched.
+ *
+ * Instead of the number of threads, the config element can be initialised with a seqan3::thread_pool. Then, consecutive
+ * searches reuse the threads of the pool instead of spawning new ones. The pool must outlive the search results.
+ *
  * ### Example
  *
  * \include test/snippet/search/configuration_parallel.cpp
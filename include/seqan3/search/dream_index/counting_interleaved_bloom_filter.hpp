@@ -0,0 +1,543 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \author Enrico Seiler <enrico.seiler AT fu-berlin.de>
+ * \brief Provides seqan3::counting_interleaved_bloom_filter.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+
+#include <seqan3/contrib/sdsl-lite.hpp>
+#include <seqan3/core/concept/cereal.hpp>
+#include <seqan3/utility/bloom_filter/bloom_filter_strong_types.hpp>
+#include <seqan3/utility/simd/algorithm.hpp>
+#include <seqan3/utility/simd/simd.hpp>
+#include <seqan3/utility/simd/simd_traits.hpp>
+
+namespace seqan3
+{
+
+/*!\brief The counting Interleaved Bloom Filter. Answers how often a value was inserted into each of multiple bins.
+ * \ingroup search_dream_index
+ * \tparam counter_width_ The number of bits per counter. Must be 4 or 8.
+ * \implements seqan3::cerealisable
+ *
+ * \details
+ *
+ * ### Counting Interleaved Bloom Filter
+ *
+ * The counting Interleaved Bloom Filter has the same layout as the seqan3::interleaved_bloom_filter, but stores a
+ * `counter_width_`-bit counter instead of a single bit for each bin and position. The `i`'th counters of all bins are
+ * stored next to each other, i.e. a query reads one contiguous row of counters for each hash function.
+ *
+ * Inserting a value increments the counters at all `h` hashed positions of the bin. Counters saturate at
+ * \f$2^{\text{counter\_width}} - 1\f$, i.e. they never overflow.
+ * The count of a value in a bin is the minimum of its `h` counters. Since counters may be shared with other values,
+ * the count may be overestimated, but it is never underestimated unless the counter saturated.
+ *
+ * Compared to a seqan3::interleaved_bloom_filter with the same number of bins and bin size, a counting Interleaved
+ * Bloom Filter needs `counter_width_` times more memory.
+ *
+ * ### Querying
+ * To query the counting Interleaved Bloom Filter for a value, call
+ * seqan3::counting_interleaved_bloom_filter::counting_agent and use the returned
+ * seqan3::counting_interleaved_bloom_filter::counting_agent_type. The minimum over the `h` rows is computed with
+ * SIMD instructions, processing as many bins at once as fit into a vector register.
+ *
+ * ### Example
+ *
+ * \include test/snippet/search/dream_index/counting_interleaved_bloom_filter.cpp
+ *
+ * ### Thread safety
+ *
+ * The Interleaved Bloom Filter promises the basic thread-safety by the STL that all
+ * calls to `const` member functions are safe from multiple threads (as long as no thread calls
+ * a non-`const` member function at the same time).
+ *
+ * Additionally, concurrent calls to `emplace` are safe iff each thread handles a multiple of wordsize (=64) many bins.
+ * For example, calls to `emplace` from multiple threads are safe if `thread_1` accesses bins 0-63, `thread_2` bins
+ * 64-127, and so on.
+ */
+template <uint8_t counter_width_ = 8>
+class counting_interleaved_bloom_filter
+{
+    static_assert(counter_width_ == 4 || counter_width_ == 8, "The counter width must be 4 or 8.");
+
+private:
+    //!\brief The type of the underlying counter vector.
+    using data_type = seqan3::contrib::sdsl::int_vector<counter_width_>;
+
+    //!\brief The largest value a counter can hold.
+    static constexpr uint8_t counter_max = (1u << counter_width_) - 1u;
+
+    //!\brief The number of bins specified by the user.
+    size_t bins{};
+    //!\brief The number of bins stored in the filter (next multiple of 64 of `bins`).
+    size_t technical_bins{};
+    //!\brief The size of each bin in counters.
+    size_t bin_size_{};
+    //!\brief The number of bits to shift the hash value before doing multiplicative hashing.
+    size_t hash_shift{};
+    //!\brief The number of 64-bit integers needed to store a bit for each of `bins` many bins.
+    size_t bin_words{};
+    //!\brief The number of hash functions.
+    size_t hash_funs{};
+    //!\brief The counters.
+    data_type data{};
+    //!\brief Precalculated seeds for multiplicative hashing. Identical to seqan3::interleaved_bloom_filter.
+    static constexpr std::array<size_t, 5> hash_seeds{13'572'355'802'537'770'549ULL, // 2**64 / (e/2)
+                                                      13'043'817'825'332'782'213ULL, // 2**64 / sqrt(2)
+                                                      10'650'232'656'628'343'401ULL, // 2**64 / sqrt(3)
+                                                      16'499'269'484'942'379'435ULL, // 2**64 / (sqrt(5)/2)
+                                                      4'893'150'838'803'335'377ULL}; // 2**64 / (3*pi/5)
+
+    /*!\brief Perturbs a value and fits it into the vector.
+     * \param h The value to process.
+     * \param seed The seed to use.
+     * \returns The index of the first counter of the row the value is hashed to.
+     * \sa https://probablydance.com/2018/06/16/
+     * \sa https://lemire.me/blog/2016/06/27
+     */
+    inline constexpr size_t hash_and_fit(size_t h, size_t const seed) const
+    {
+        h *= seed;
+        assert(hash_shift < 64);
+        h ^= h >> hash_shift;               // XOR and shift higher bits into lower bits
+        h *= 11'400'714'819'323'198'485ULL; // = 2^64 / golden_ration, to expand h to 64 bit range
+                                            // Use fastrange (integer modulo without division) if possible.
+#ifdef __SIZEOF_INT128__
+        h = static_cast<uint64_t>((static_cast<__uint128_t>(h) * static_cast<__uint128_t>(bin_size_)) >> 64);
+#else
+        h %= bin_size_;
+#endif
+        h *= technical_bins;
+        return h;
+    }
+
+public:
+    //!\brief The number of bits per counter.
+    static constexpr uint8_t counter_width = counter_width_;
+
+    class counting_agent_type; // documented upon definition below
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    counting_interleaved_bloom_filter() = default;                                                      //!< Defaulted.
+    counting_interleaved_bloom_filter(counting_interleaved_bloom_filter const &) = default;             //!< Defaulted.
+    counting_interleaved_bloom_filter & operator=(counting_interleaved_bloom_filter const &) = default; //!< Defaulted.
+    counting_interleaved_bloom_filter(counting_interleaved_bloom_filter &&) = default;                  //!< Defaulted.
+    counting_interleaved_bloom_filter & operator=(counting_interleaved_bloom_filter &&) = default;      //!< Defaulted.
+    ~counting_interleaved_bloom_filter() = default;                                                     //!< Defaulted.
+
+    /*!\brief Construct a counting Interleaved Bloom Filter.
+     * \param bins_ The number of bins.
+     * \param size The number of counters per bin.
+     * \param funs The number of hash functions. Default 2. At least 1, at most 5.
+     * \throws std::logic_error if any of the parameters is 0 or more than 5 hash functions are requested.
+     *
+     * \details
+     *
+     * ### Example
+     *
+     * \include test/snippet/search/dream_index/counting_interleaved_bloom_filter.cpp
+     */
+    counting_interleaved_bloom_filter(seqan3::bin_count bins_,
+                                      seqan3::bin_size size,
+                                      seqan3::hash_function_count funs = seqan3::hash_function_count{2u})
+    {
+        bins = bins_.get();
+        bin_size_ = size.get();
+        hash_funs = funs.get();
+
+        if (bins == 0)
+            throw std::logic_error{"The number of bins must be > 0."};
+        if (hash_funs == 0 || hash_funs > 5)
+            throw std::logic_error{"The number of hash functions must be > 0 and <= 5."};
+        if (bin_size_ == 0)
+            throw std::logic_error{"The size of a bin must be > 0."};
+
+        hash_shift = std::countl_zero(bin_size_);
+        bin_words = (bins + 63) >> 6;    // = ceil(bins/64)
+        technical_bins = bin_words << 6; // = bin_words * 64
+        data = data_type(technical_bins * bin_size_, 0u);
+    }
+    //!\}
+
+    /*!\name Modifiers
+     * \{
+     */
+    /*!\brief Inserts a value into a specific bin, i.e. increments its count in this bin.
+     * \param[in] value The raw numeric value to process.
+     * \param[in] bin The bin index to insert into.
+     *
+     * \details
+     *
+     * Counters that already hold the maximum value are not incremented.
+     */
+    void emplace(size_t const value, bin_index const bin) noexcept
+    {
+        assert(bin.get() < bins);
+        std::array<size_t, 5> indices{};
+
+        for (size_t i = 0; i < hash_funs; ++i)
+        {
+            size_t idx = hash_and_fit(value, hash_seeds[i]);
+            idx += bin.get();
+            assert(idx < data.size());
+            indices[i] = idx;
+
+            // If two hash functions map to the same counter, it must only be incremented once.
+            if (std::find(indices.begin(), indices.begin() + i, idx) != indices.begin() + i)
+                continue;
+
+            uint64_t const counter = data[idx];
+            if (counter != counter_max)
+                data[idx] = counter + 1u;
+        }
+    }
+
+    /*!\brief Clears a specific bin.
+     * \param[in] bin The bin index to clear.
+     */
+    void clear(bin_index const bin) noexcept
+    {
+        assert(bin.get() < bins);
+        for (size_t idx = bin.get(), i = 0; i < bin_size_; idx += technical_bins, ++i)
+            data[idx] = 0u;
+    }
+
+    /*!\brief Clears a range of bins.
+     * \tparam rng_t The type of the range. Must model std::ranges::forward_range and the reference type must be
+     *               seqan3::bin_index.
+     * \param[in] bin_range The range of bins to clear.
+     */
+    template <typename rng_t>
+    void clear(rng_t && bin_range) noexcept
+    {
+        static_assert(std::ranges::forward_range<rng_t>, "The range of bins to clear must model a forward_range.");
+        static_assert(std::same_as<std::remove_cvref_t<std::ranges::range_reference_t<rng_t>>, bin_index>,
+                      "The reference type of the range to clear must be seqan3::bin_index.");
+#ifndef NDEBUG
+        for (auto && bin : bin_range)
+            assert(bin.get() < bins);
+#endif // NDEBUG
+
+        for (size_t offset = 0, i = 0; i < bin_size_; offset += technical_bins, ++i)
+            for (auto && bin : bin_range)
+                data[bin.get() + offset] = 0u;
+    }
+    //!\}
+
+    /*!\brief Returns a seqan3::counting_interleaved_bloom_filter::counting_agent_type to be used for counting.
+     * \attention Calling seqan3::counting_interleaved_bloom_filter::counting_agent on a temporary is not allowed.
+     */
+    counting_agent_type counting_agent() const
+    {
+        return counting_agent_type{*this};
+    }
+
+    /*!\name Capacity
+     * \{
+     */
+    /*!\brief Returns the number of hash functions used in the counting Interleaved Bloom Filter.
+     * \returns The number of hash functions.
+     */
+    size_t hash_function_count() const noexcept
+    {
+        return hash_funs;
+    }
+
+    /*!\brief Returns the number of bins that the counting Interleaved Bloom Filter manages.
+     * \returns The number of bins.
+     */
+    size_t bin_count() const noexcept
+    {
+        return bins;
+    }
+
+    /*!\brief Returns the number of counters per bin.
+     * \returns The number of counters per bin.
+     */
+    size_t bin_size() const noexcept
+    {
+        return bin_size_;
+    }
+
+    /*!\brief Returns the size of the underlying counter vector.
+     * \returns The size in bits of the underlying counter vector.
+     */
+    size_t bit_size() const noexcept
+    {
+        return data.bit_size();
+    }
+    //!\}
+
+    /*!\name Comparison operators
+     * \{
+     */
+    /*!\brief Test for equality.
+     * \param[in] lhs A `seqan3::counting_interleaved_bloom_filter`.
+     * \param[in] rhs `seqan3::counting_interleaved_bloom_filter` to compare to.
+     * \returns `true` if equal, `false` otherwise.
+     */
+    friend bool operator==(counting_interleaved_bloom_filter const & lhs,
+                           counting_interleaved_bloom_filter const & rhs) noexcept
+    {
+        return std::tie(lhs.bins,
+                        lhs.technical_bins,
+                        lhs.bin_size_,
+                        lhs.hash_shift,
+                        lhs.bin_words,
+                        lhs.hash_funs,
+                        lhs.data)
+            == std::tie(rhs.bins,
+                        rhs.technical_bins,
+                        rhs.bin_size_,
+                        rhs.hash_shift,
+                        rhs.bin_words,
+                        rhs.hash_funs,
+                        rhs.data);
+    }
+
+    /*!\brief Test for inequality.
+     * \param[in] lhs A `seqan3::counting_interleaved_bloom_filter`.
+     * \param[in] rhs `seqan3::counting_interleaved_bloom_filter` to compare to.
+     * \returns `true` if unequal, `false` otherwise.
+     */
+    friend bool operator!=(counting_interleaved_bloom_filter const & lhs,
+                           counting_interleaved_bloom_filter const & rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+    //!\}
+
+    /*!\name Access
+     * \{
+     */
+    /*!\brief Provides direct, unsafe access to the underlying data structure.
+     * \returns A reference to an SDSL int_vector.
+     *
+     * \details
+     *
+     * \noapi{The exact representation of the data is implementation defined.}
+     */
+    constexpr data_type & raw_data() noexcept
+    {
+        return data;
+    }
+
+    //!\copydoc raw_data()
+    constexpr data_type const & raw_data() const noexcept
+    {
+        return data;
+    }
+    //!\}
+
+    /*!\cond DEV
+     * \brief Serialisation support function.
+     * \tparam archive_t Type of `archive`; must satisfy seqan3::cereal_archive.
+     * \param[in] archive The archive being serialised from/to.
+     *
+     * \attention These functions are never called directly, see \ref serialisation for more details.
+     */
+    template <cereal_archive archive_t>
+    void CEREAL_SERIALIZE_FUNCTION_NAME(archive_t & archive)
+    {
+        archive(bins);
+        archive(technical_bins);
+        archive(bin_size_);
+        archive(hash_shift);
+        archive(bin_words);
+        archive(hash_funs);
+        archive(data);
+    }
+    //!\endcond
+};
+
+/*!\brief Manages count queries for the seqan3::counting_interleaved_bloom_filter.
+ *
+ * \details
+ *
+ * ### Example
+ *
+ * \include test/snippet/search/dream_index/counting_interleaved_bloom_filter.cpp
+ */
+template <uint8_t counter_width_>
+class counting_interleaved_bloom_filter<counter_width_>::counting_agent_type
+{
+private:
+    //!\brief The type of the augmented seqan3::counting_interleaved_bloom_filter.
+    using cibf_t = counting_interleaved_bloom_filter<counter_width_>;
+
+    /*!\brief The simd type used to compute the minimum of the rows.
+     * \details
+     *
+     * A row consists of a multiple of 64 counters, i.e. a multiple of `8 * counter_width_` bytes. The vector length
+     * is limited to this size such that it always divides the length of a row.
+     */
+    using simd_t = simd::simd_type_t<uint8_t,
+                                     std::min<size_t>(simd_traits<simd::simd_type_t<uint8_t>>::length,
+                                                      8u * counter_width_)>;
+
+    //!\brief The number of bytes of one row of counters.
+    size_t row_bytes{};
+
+    //!\brief A pointer to the augmented seqan3::counting_interleaved_bloom_filter.
+    cibf_t const * cibf_ptr{nullptr};
+
+    //!\brief Stores the (packed) minima of the rows of all bins.
+    std::vector<uint8_t> row_buffer{};
+
+    //!\brief Stores the result of count().
+    std::vector<uint8_t> result_buffer{};
+
+    /*!\brief Computes the minimum of the counters of the rows starting at `row_begins` and writes it to `row_buffer`.
+     * \details
+     *
+     * For 4-bit counters, each byte holds two counters. The minimum of the low nibbles and the minimum of the
+     * (masked) high nibbles are computed separately and recombined afterwards.
+     */
+    void compute_row_minima(std::array<uint8_t const *, 5> const & row_begins) noexcept
+    {
+        size_t const hash_funs = cibf_ptr->hash_funs;
+        constexpr size_t simd_length = simd_traits<simd_t>::length;
+        assert(row_bytes % simd_length == 0u);
+
+        for (size_t offset = 0; offset < row_bytes; offset += simd_length)
+        {
+            simd_t minimum = simd::load<simd_t>(row_begins[0] + offset);
+
+            if constexpr (counter_width_ == 8u)
+            {
+                for (size_t i = 1; i < hash_funs; ++i)
+                {
+                    simd_t const current = simd::load<simd_t>(row_begins[i] + offset);
+                    minimum = (current < minimum) ? current : minimum;
+                }
+            }
+            else
+            {
+                // There are no 8-bit shifts, but masking the nibbles keeps their order.
+                simd_t const low_mask = simd::fill<simd_t>(0x0F);
+                simd_t const high_mask = simd::fill<simd_t>(0xF0);
+                simd_t minimum_high = minimum & high_mask;
+                minimum &= low_mask;
+
+                for (size_t i = 1; i < hash_funs; ++i)
+                {
+                    simd_t const current = simd::load<simd_t>(row_begins[i] + offset);
+                    simd_t const current_low = current & low_mask;
+                    simd_t const current_high = current & high_mask;
+                    minimum = (current_low < minimum) ? current_low : minimum;
+                    minimum_high = (current_high < minimum_high) ? current_high : minimum_high;
+                }
+
+                minimum |= minimum_high;
+            }
+
+            simd::store(row_buffer.data() + offset, minimum);
+        }
+    }
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    counting_agent_type() = default;                                        //!< Defaulted.
+    counting_agent_type(counting_agent_type const &) = default;             //!< Defaulted.
+    counting_agent_type & operator=(counting_agent_type const &) = default; //!< Defaulted.
+    counting_agent_type(counting_agent_type &&) = default;                  //!< Defaulted.
+    counting_agent_type & operator=(counting_agent_type &&) = default;      //!< Defaulted.
+    ~counting_agent_type() = default;                                       //!< Defaulted.
+
+    /*!\brief Construct a counting_agent_type for an existing seqan3::counting_interleaved_bloom_filter.
+     * \private
+     * \param cibf The seqan3::counting_interleaved_bloom_filter.
+     */
+    explicit counting_agent_type(cibf_t const & cibf) :
+        row_bytes{cibf.technical_bins * counter_width_ / 8u},
+        cibf_ptr(std::addressof(cibf)),
+        row_buffer(row_bytes),
+        result_buffer(cibf.bin_count())
+    {}
+    //!\}
+
+    /*!\name Counting
+     * \{
+     */
+    /*!\brief Determines how often a value was inserted into each bin.
+     * \param[in] value The raw value to process.
+     * \returns A vector of size seqan3::counting_interleaved_bloom_filter::bin_count. The `i`'th entry is the
+     *          estimated count of `value` in bin `i`.
+     *
+     * \attention The result of this function must always be bound via reference, e.g. `auto &`, to prevent copying.
+     * \attention Sequential calls to this function invalidate the previously returned reference.
+     *
+     * \details
+     *
+     * The count is the minimum of the `h` counters the value is hashed to. It may overestimate the true count and
+     * is capped at the largest value a counter can hold.
+     *
+     * ### Thread safety
+     *
+     * Concurrent invocations of this function are not thread safe, please create a
+     * seqan3::counting_interleaved_bloom_filter::counting_agent_type for each thread.
+     */
+    [[nodiscard]] std::vector<uint8_t> const & count(size_t const value) & noexcept
+    {
+        assert(cibf_ptr != nullptr);
+        assert(row_buffer.size() == row_bytes);
+
+        std::array<uint8_t const *, 5> row_begins{};
+        auto const * raw = reinterpret_cast<uint8_t const *>(cibf_ptr->data.data());
+
+        // Each row starts at a multiple of 64 counters, i.e. on a byte boundary.
+        for (size_t i = 0; i < cibf_ptr->hash_funs; ++i)
+            row_begins[i] = raw + cibf_ptr->hash_and_fit(value, cibf_ptr->hash_seeds[i]) * counter_width_ / 8u;
+
+        compute_row_minima(row_begins);
+
+        if constexpr (counter_width_ == 8u)
+        {
+            std::memcpy(result_buffer.data(), row_buffer.data(), result_buffer.size());
+        }
+        else
+        {
+            // Counter `2i` is stored in the low nibble, counter `2i + 1` in the high nibble of byte `i`.
+            // Eight counters at a time are spread from 32 bits to one byte each.
+            size_t const bins = result_buffer.size();
+            size_t bin = 0;
+
+            for (; bin + 8u <= bins; bin += 8u)
+            {
+                uint32_t packed;
+                std::memcpy(&packed, row_buffer.data() + bin / 2u, sizeof(packed));
+                uint64_t spread = packed;
+                spread = (spread | (spread << 16)) & 0x0000'FFFF'0000'FFFFULL;
+                spread = (spread | (spread << 8)) & 0x00FF'00FF'00FF'00FFULL;
+                spread = (spread | (spread << 4)) & 0x0F0F'0F0F'0F0F'0F0FULL;
+                std::memcpy(result_buffer.data() + bin, &spread, sizeof(spread));
+            }
+
+            for (; bin < bins; ++bin)
+                result_buffer[bin] = (row_buffer[bin / 2u] >> ((bin & 1u) << 2)) & 0x0F;
+        }
+
+        return result_buffer;
+    }
+
+    // `count` cannot be called on a temporary, since the object the returned reference points to
+    // is immediately destroyed.
+    [[nodiscard]] std::vector<uint8_t> const & count(size_t const value) && noexcept = delete;
+    //!\}
+};
+
+} // namespace seqan3
@@ -11,9 +11,13 @@
 
 #include <algorithm>
 #include <bit>
+#include <cstring>
+#include <filesystem>
+#include <numeric>
 
 #include <seqan3/contrib/sdsl-lite.hpp>
 #include <seqan3/core/concept/cereal.hpp>
+#include <seqan3/utility/bloom_filter/detail/mapped_bit_vector.hpp>
 //Todo: When removing, the contents of the following header can be moved into utility/bloom_filter/bloom_filter.hpp
 #include <seqan3/utility/bloom_filter/bloom_filter_strong_types.hpp>
 
@@ -75,6 +79,9 @@ namespace seqan3
  * To count the occurrences of a range of values in the Interleaved Bloom Filter, call
  * seqan3::interleaved_bloom_filter::counting_agent() and use
  * the returned seqan3::interleaved_bloom_filter::counting_agent_type.
+ * If only the bins whose count reaches a threshold are of interest, use
+ * seqan3::interleaved_bloom_filter::counting_agent_type::membership_for, which stops counting as soon as the result
+ * is known.
  *
  * ### Compression
  *
@@ -83,6 +90,20 @@ namespace seqan3
  * `seqan3::interleaved_bloom_filter`, in which case the underlying bitvector is compressed.
  * The compressed Interleaved Bloom Filter is immutable, i.e. only querying is supported.
  *
+ * ### Memory mapping
+ *
+ * Any Interleaved Bloom Filter can be written to disk in a memory-mappable format via
+ * seqan3::interleaved_bloom_filter::store.
+ * A `seqan3::interleaved_bloom_filter<seqan3::data_layout::mapped>` constructed from such a file does not load the
+ * bitvector; the membership and counting agents work directly on the memory-mapped words.
+ * Loading is hence instantaneous, only the accessed pages are read from disk, and all processes mapping the same file
+ * share the memory via the page cache.
+ * The mapped Interleaved Bloom Filter is immutable, i.e. only querying is supported. Construct an uncompressed
+ * seqan3::interleaved_bloom_filter from it to modify it.
+ *
+ * The compressed layout is stored in its uncompressed form, since the select structures of the compressed bitvector
+ * cannot be mapped.
+ *
  * ### Thread safety
  *
  * The Interleaved Bloom Filter promises the basic thread-safety by the STL that all
@@ -103,9 +124,15 @@ private:
     //!\endcond
 
     //!\brief The underlying datatype to use.
-    using data_type = std::conditional_t<data_layout_mode_ == data_layout::uncompressed,
-                                         seqan3::contrib::sdsl::bit_vector,
-                                         seqan3::contrib::sdsl::sd_vector<>>;
+    using data_type =
+        std::conditional_t<data_layout_mode_ == data_layout::uncompressed,
+                           seqan3::contrib::sdsl::bit_vector,
+                           std::conditional_t<data_layout_mode_ == data_layout::compressed,
+                                              seqan3::contrib::sdsl::sd_vector<>,
+                                              detail::mapped_bit_vector>>;
+
+    //!\brief Identifies an Interleaved Bloom Filter in the memory-mappable on-disk format.
+    static constexpr std::array<char, 8> file_magic{'S', 'E', 'Q', 'A', 'N', '3', 'I', 'B'};
 
     //!\brief The number of bins specified by the user.
     size_t bins{};
@@ -222,6 +249,25 @@ public:
         data = seqan3::contrib::sdsl::bit_vector{ibf.data.begin(), ibf.data.end()};
     }
 
+    /*!\brief Construct an uncompressed Interleaved Bloom Filter from a mapped one.
+     * \param[in] ibf The mapped seqan3::interleaved_bloom_filter.
+     *
+     * \details
+     *
+     * Copies the bitvector into memory. The resulting Interleaved Bloom Filter is independent of the mapped file.
+     */
+    interleaved_bloom_filter(interleaved_bloom_filter<data_layout::mapped> const & ibf)
+        requires (data_layout_mode == data_layout::uncompressed)
+    {
+        std::tie(bins, technical_bins, bin_size_, hash_shift, bin_words, hash_funs) =
+            std::tie(ibf.bins, ibf.technical_bins, ibf.bin_size_, ibf.hash_shift, ibf.bin_words, ibf.hash_funs);
+
+        data = seqan3::contrib::sdsl::bit_vector(ibf.data.size());
+        std::memcpy(data.data(),
+                    ibf.data.data(),
+                    detail::mapped_bit_vector::word_count(ibf.data.size()) * sizeof(uint64_t));
+    }
+
     /*!\brief Construct a compressed Interleaved Bloom Filter.
      * \param[in] ibf The uncompressed seqan3::interleaved_bloom_filter.
      *
@@ -241,6 +287,39 @@ public:
 
         data = seqan3::contrib::sdsl::sd_vector<>{ibf.data};
     }
+
+    /*!\brief Construct a mapped Interleaved Bloom Filter from a file written by
+     *        seqan3::interleaved_bloom_filter::store.
+     * \param[in] path The file to map.
+     * \throws seqan3::file_open_error if the file cannot be mapped or does not contain an Interleaved Bloom Filter.
+     *
+     * \attention This constructor can only be used to construct **mapped** Interleaved Bloom Filters.
+     *
+     * \details
+     *
+     * The file must stay unchanged while it is mapped.
+     *
+     * ### Example
+     *
+     * \snippet test/snippet/search/dream_index/interleaved_bloom_filter_mapped.cpp main
+     */
+    explicit interleaved_bloom_filter(std::filesystem::path const & path)
+        requires (data_layout_mode == data_layout::mapped)
+        : data{path, file_magic}
+    {
+        auto const & parameters = data.header().parameters;
+        bins = parameters[0];
+        bin_size_ = parameters[1];
+        hash_shift = parameters[2];
+        bin_words = parameters[3];
+        hash_funs = parameters[4];
+        technical_bins = bin_words << 6;
+
+        if (bins == 0 || bin_size_ == 0 || hash_funs == 0 || hash_funs > 5 || bin_words != ((bins + 63) >> 6)
+            || hash_shift != static_cast<size_t>(std::countl_zero(bin_size_))
+            || data.size() != technical_bins * bin_size_)
+            throw file_open_error{"The file " + path.string() + " does not contain a valid Interleaved Bloom Filter."};
+    }
     //!\}
 
     /*!\name Modifiers
@@ -384,6 +463,32 @@ public:
     }
     //!\}
 
+    /*!\name Storage
+     * \{
+     */
+    /*!\brief Writes the Interleaved Bloom Filter in the memory-mappable on-disk format.
+     * \param[in] path The file to write to. An existing file is overwritten.
+     * \throws seqan3::file_open_error if the file cannot be opened for writing.
+     * \throws seqan3::io_error if writing fails.
+     *
+     * \details
+     *
+     * Use `seqan3::interleaved_bloom_filter<seqan3::data_layout::mapped>` to map the file.
+     *
+     * ### Example
+     *
+     * \snippet test/snippet/search/dream_index/interleaved_bloom_filter_mapped.cpp main
+     */
+    void store(std::filesystem::path const & path) const
+    {
+        detail::mapped_filter_header header{};
+        header.magic = file_magic;
+        header.parameters = {bins, bin_size_, hash_shift, bin_words, hash_funs};
+
+        detail::write_mapped_filter(path, header, data);
+    }
+    //!\}
+
     /*!\name Lookup
      * \{
      */
@@ -524,6 +629,7 @@ public:
      * \attention These functions are never called directly, see \ref serialisation for more details.
      */
     template <cereal_archive archive_t>
+        requires (data_layout_mode != data_layout::mapped)
     void CEREAL_SERIALIZE_FUNCTION_NAME(archive_t & archive)
     {
         archive(bins);
@@ -749,6 +855,42 @@ public:
     //!\}
 };
 
+namespace detail
+{
+/*!\brief Calls `on_bin_fn` with the position of each set bit of `bit_vector` in increasing order.
+ * \ingroup search_dream_index
+ * \param[in] bit_vector The bitvector to enumerate; an SDSL bitvector.
+ * \param[in] on_bin_fn  The function to invoke for each set bit.
+ */
+template <typename on_bin_fn_t>
+void for_each_set_bin(seqan3::contrib::sdsl::bit_vector const & bit_vector, on_bin_fn_t && on_bin_fn)
+{
+    // Jump to the next 1 and return the number of places jumped in the bit_sequence
+    auto jump_to_next_1bit = [](size_t & x)
+    {
+        auto const zeros = std::countr_zero(x);
+        x >>= zeros; // skip number of zeros
+        return zeros;
+    };
+
+    // Each iteration can handle 64 bits
+    for (size_t bit_pos = 0; bit_pos < bit_vector.size(); bit_pos += 64)
+    {
+        // get 64 bits starting at position `bit_pos`
+        size_t bit_sequence = bit_vector.get_int(bit_pos);
+
+        // process each relative bin inside the bit_sequence
+        for (size_t bin = bit_pos; bit_sequence != 0u; ++bin, bit_sequence >>= 1)
+        {
+            // Jump to the next 1 and
+            bin += jump_to_next_1bit(bit_sequence);
+
+            on_bin_fn(bin);
+        }
+    }
+}
+} // namespace detail
+
 /*!\brief A data structure that behaves like a std::vector and can be used to consolidate the results of multiple calls
  *        to seqan3::interleaved_bloom_filter::membership_agent_type::bulk_contains.
  * \ingroup search_dream_index
@@ -785,7 +927,9 @@ private:
         std::same_as<binning_bitvector_t,
                      interleaved_bloom_filter<data_layout::uncompressed>::membership_agent_type::binning_bitvector>
         || std::same_as<binning_bitvector_t,
-                        interleaved_bloom_filter<data_layout::compressed>::membership_agent_type::binning_bitvector>;
+                        interleaved_bloom_filter<data_layout::compressed>::membership_agent_type::binning_bitvector>
+        || std::same_as<binning_bitvector_t,
+                        interleaved_bloom_filter<data_layout::mapped>::membership_agent_type::binning_bitvector>;
 
 public:
     /*!\name Constructors, destructor and assignment
@@ -892,29 +1036,7 @@ private:
     {
         assert(this->size() >= binning_bitvector.size()); // The counting vector may be bigger than what we need.
 
-        // Jump to the next 1 and return the number of places jumped in the bit_sequence
-        auto jump_to_next_1bit = [](size_t & x)
-        {
-            auto const zeros = std::countr_zero(x);
-            x >>= zeros; // skip number of zeros
-            return zeros;
-        };
-
-        // Each iteration can handle 64 bits
-        for (size_t bit_pos = 0; bit_pos < binning_bitvector.size(); bit_pos += 64)
-        {
-            // get 64 bits starting at position `bit_pos`
-            size_t bit_sequence = binning_bitvector.raw_data().get_int(bit_pos);
-
-            // process each relative bin inside the bit_sequence
-            for (size_t bin = bit_pos; bit_sequence != 0u; ++bin, bit_sequence >>= 1)
-            {
-                // Jump to the next 1 and
-                bin += jump_to_next_1bit(bit_sequence);
-
-                on_bin_fn(bin);
-            }
-        }
+        detail::for_each_set_bin(binning_bitvector.raw_data(), std::forward<on_bin_fn_t>(on_bin_fn));
     }
 };
 
@@ -943,6 +1065,15 @@ private:
     //!\brief Store a seqan3::interleaved_bloom_filter::membership_agent to call `bulk_contains`.
     membership_agent_type membership_agent;
 
+    //!\brief Marks the bins that are still tracked by membership_for().
+    seqan3::contrib::sdsl::bit_vector live_bins{};
+
+    //!\brief The 64-bit words of `live_bins` that (may) contain tracked bins.
+    std::vector<size_t> live_batches{};
+
+    //!\brief Stores the result of membership_for().
+    std::vector<size_t> matching_bins{};
+
 public:
     /*!\name Constructors, destructor and assignment
      * \{
@@ -961,8 +1092,12 @@ public:
     explicit counting_agent_type(ibf_t const & ibf) :
         ibf_ptr(std::addressof(ibf)),
         membership_agent(ibf),
+        live_bins(ibf.bin_count()),
         result_buffer(ibf.bin_count())
-    {}
+    {
+        matching_bins.reserve(ibf.bin_count());
+        live_batches.reserve(ibf.bin_words);
+    }
     //!\}
 
     //!\brief Stores the result of bulk_count().
@@ -1012,6 +1147,154 @@ public:
     // is immediately destroyed.
     template <std::ranges::range value_range_t>
     [[nodiscard]] counting_vector<value_t> const & bulk_count(value_range_t && values) && noexcept = delete;
+
+    /*!\brief Determines the bins that contain at least `threshold` many of the values in a range.
+     * \tparam value_range_t The type of the range of values. Must model std::ranges::forward_range or
+     *                       std::ranges::sized_range. The reference type must model std::unsigned_integral.
+     * \param[in] values    The range of values to process.
+     * \param[in] threshold The minimal number of values a bin must contain.
+     * \returns The indices of all bins whose count reaches `threshold`, in increasing order.
+     *
+     * \attention The result of this function must always be bound via reference, e.g. `auto &`, to prevent copying.
+     * \attention Sequential calls to this function invalidate the previously returned reference.
+     * \attention The content of `result_buffer` is unspecified after calling this function.
+     *
+     * \details
+     *
+     * Yields the same bins as filtering the result of seqan3::interleaved_bloom_filter::counting_agent_type::bulk_count
+     * by `threshold`, but stops tracking a bin as soon as it is decided:
+     * A bin is dropped once its count cannot reach `threshold` anymore given the number of remaining values, and it is
+     * reported once its count reaches `threshold`.
+     * Only words of the Interleaved Bloom Filter that contain undecided bins are accessed, and the computation stops
+     * when all bins are decided.
+     * For large numbers of bins and selective thresholds, this is considerably faster than counting all values.
+     *
+     * ### Thread safety
+     *
+     * Concurrent invocations of this function are not thread safe, please create a
+     * seqan3::interleaved_bloom_filter::counting_agent_type for each thread.
+     */
+    template <std::ranges::range value_range_t>
+    [[nodiscard]] std::vector<size_t> const & membership_for(value_range_t && values, size_t const threshold) &
+    {
+        assert(ibf_ptr != nullptr);
+        assert(result_buffer.size() == ibf_ptr->bin_count());
+        assert(live_bins.size() == ibf_ptr->bin_count());
+
+        static_assert(std::ranges::input_range<value_range_t>, "The values must model input_range.");
+        static_assert(std::ranges::forward_range<value_range_t> || std::ranges::sized_range<value_range_t>,
+                      "The values must model forward_range or sized_range.");
+        static_assert(std::unsigned_integral<std::ranges::range_value_t<value_range_t>>,
+                      "An individual value must be an unsigned integral.");
+
+        matching_bins.clear();
+
+        size_t const value_count = std::ranges::distance(values);
+
+        if (threshold > value_count)
+            return matching_bins;
+
+        if (threshold == 0u)
+        {
+            for (size_t bin = 0; bin < ibf_ptr->bins; ++bin)
+                matching_bins.push_back(bin);
+            return matching_bins;
+        }
+
+        std::ranges::fill(result_buffer, 0);
+
+        // Initially, all bins are undecided. Bits beyond the number of bins must stay unset.
+        for (size_t bit_pos = 0; bit_pos < live_bins.size(); bit_pos += 64u)
+        {
+            uint8_t const len = std::min<size_t>(64u, live_bins.size() - bit_pos);
+            live_bins.set_int(bit_pos, -1ULL >> (64u - len), len);
+        }
+
+        live_batches.resize(ibf_ptr->bin_words);
+        std::iota(live_batches.begin(), live_batches.end(), 0u);
+
+        // A bin is hopeless as soon as it misses more than `miss_budget` many values.
+        size_t const miss_budget = value_count - threshold;
+        size_t undecided_bins = ibf_ptr->bins;
+        size_t processed = 0u;
+        // No bin can be hopeless before this many values have been processed.
+        size_t next_check = miss_budget + 1u;
+
+        std::array<size_t, 5> bloom_filter_indices;
+
+        for (auto && value : values)
+        {
+            for (size_t i = 0; i < ibf_ptr->hash_funs; ++i)
+                bloom_filter_indices[i] = ibf_ptr->hash_and_fit(value, ibf_ptr->hash_seeds[i]);
+
+            for (size_t const batch : live_batches)
+            {
+                size_t tmp = live_bins.get_int(batch << 6);
+
+                // Only access the Interleaved Bloom Filter if there are undecided bins in this batch.
+                for (size_t i = 0; tmp != 0u && i < ibf_ptr->hash_funs; ++i)
+                {
+                    assert(bloom_filter_indices[i] + (batch << 6) < ibf_ptr->data.size());
+                    tmp &= ibf_ptr->data.get_int(bloom_filter_indices[i] + (batch << 6));
+                }
+
+                for (; tmp != 0u; tmp &= tmp - 1u)
+                {
+                    size_t const bin = (batch << 6) + std::countr_zero(tmp);
+
+                    if (++result_buffer[bin] == threshold)
+                    {
+                        live_bins[bin] = 0;
+                        matching_bins.push_back(bin);
+                        --undecided_bins;
+                    }
+                }
+            }
+
+            if (++processed == next_check)
+            {
+                // A bin needs a count of at least `minimal_count` to still be able to reach the threshold.
+                size_t const minimal_count = processed - miss_budget;
+                size_t minimal_slack = value_count;
+
+                detail::for_each_set_bin(live_bins,
+                                         [&](size_t const bin)
+                                         {
+                                             if (result_buffer[bin] < minimal_count)
+                                             {
+                                                 live_bins[bin] = 0;
+                                                 --undecided_bins;
+                                             }
+                                             else
+                                             {
+                                                 minimal_slack = std::min<size_t>(minimal_slack,
+                                                                                  result_buffer[bin] - minimal_count);
+                                             }
+                                         });
+
+                // A bin with a slack of `s` can only become hopeless after missing `s + 1` more values.
+                next_check = processed + minimal_slack + 1u;
+
+                std::erase_if(live_batches,
+                              [this](size_t const batch)
+                              {
+                                  return live_bins.get_int(batch << 6) == 0u;
+                              });
+            }
+
+            if (undecided_bins == 0u)
+                break;
+        }
+
+        std::ranges::sort(matching_bins);
+        return matching_bins;
+    }
+
+    // `membership_for` cannot be called on a temporary, since the object the returned reference points to
+    // is immediately destroyed.
+    template <std::ranges::range value_range_t>
+    [[nodiscard]] std::vector<size_t> const & membership_for(value_range_t && values,
+                                                             size_t const threshold) && = delete;
     //!\}
 };
 
@@ -27,4 +27,5 @@
 
 #pragma once
 
+#include <seqan3/search/kmer_index/minimiser_sketch.hpp>
 #include <seqan3/search/kmer_index/shape.hpp>
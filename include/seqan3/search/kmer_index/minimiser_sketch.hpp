@@ -0,0 +1,270 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \author Enrico Seiler <enrico.seiler AT fu-berlin.de>
+ * \brief Provides seqan3::minimiser_sketch and seqan3::bulk_minimiser_hash.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
+#include <vector>
+
+#include <seqan3/alphabet/container/concatenated_sequences.hpp>
+#include <seqan3/search/views/minimiser_hash.hpp>
+
+namespace seqan3
+{
+
+/*!\brief The minimisers of a collection of sequences and their positions, stored in flat arrays.
+ * \ingroup search_kmer_index
+ *
+ * \details
+ *
+ * `hashes[i]` and `positions[i]` contain the minimiser hash values of the i-th sequence and the positions of the
+ * respective k-mers in the i-th sequence. Each member stores the values of all sequences in one contiguous array,
+ * see seqan3::concatenated_sequences.
+ *
+ * \experimentalapi{Experimental since version 3.4.}
+ */
+struct minimiser_sketch
+{
+    //!\brief The minimiser hash values of each sequence.
+    concatenated_sequences<std::vector<uint64_t>> hashes{};
+    //!\brief The position of each minimiser within its sequence.
+    concatenated_sequences<std::vector<uint64_t>> positions{};
+};
+
+} // namespace seqan3
+
+namespace seqan3::detail
+{
+
+/*!\brief Computes the minimisers of all sequences in parallel and stores them in flat arrays.
+ * \ingroup search_kmer_index
+ * \tparam with_positions Whether the positions of the minimisers are computed.
+ * \tparam sequences_t    The type of the collection of sequences.
+ * \param[in] sequences    The collection of sequences.
+ * \param[in] shape        The seqan3::shape to use for hashing.
+ * \param[in] window_size  The window size to use.
+ * \param[in] seed         The seed to use.
+ * \param[in] thread_count The number of threads to use.
+ * \throws std::invalid_argument if `thread_count` is 0 or the arguments are rejected by seqan3::views::minimiser_hash.
+ *
+ * \details
+ *
+ * The sequences are processed in batches of consecutive sequences. The threads fetch the next batch from a shared
+ * counter and append the minimisers to a buffer that is owned by the thread and reused for all its batches, i.e.
+ * no memory is allocated for single sequences. Once all batches are processed, the number of minimisers per sequence
+ * determines the offsets in the result and the buffers are copied into the result.
+ */
+template <bool with_positions, typename sequences_t>
+minimiser_sketch bulk_minimiser_hash_impl(sequences_t const & sequences,
+                                          shape const & shape,
+                                          window_size const window_size,
+                                          seed const seed,
+                                          size_t const thread_count)
+{
+    static_assert(std::ranges::random_access_range<sequences_t const> && std::ranges::sized_range<sequences_t const>,
+                  "The collection of sequences must model std::ranges::random_access_range and "
+                  "std::ranges::sized_range.");
+    static_assert(std::ranges::forward_range<std::ranges::range_reference_t<sequences_t const>>,
+                  "The sequences must model std::ranges::forward_range.");
+    static_assert(semialphabet<std::ranges::range_reference_t<std::ranges::range_reference_t<sequences_t const>>>,
+                  "The sequences must be over elements of seqan3::semialphabet.");
+
+    if (thread_count == 0u)
+        throw std::invalid_argument{"The number of threads must be greater than 0."};
+
+    // Checks the arguments before any thread is started.
+    using alphabet_t = std::ranges::range_value_t<std::ranges::range_reference_t<sequences_t const>>;
+    [[maybe_unused]] auto validated = std::views::empty<alphabet_t> | views::minimiser_hash(shape, window_size, seed);
+
+    size_t const sequence_count = std::ranges::size(sequences);
+    size_t const batch_size = 64u;
+    size_t const batch_count = (sequence_count + batch_size - 1u) / batch_size;
+
+    //!\cond
+    struct thread_buffer
+    {
+        std::vector<uint64_t> hashes{};
+        std::vector<uint64_t> positions{};
+    };
+    //!\endcond
+
+    std::vector<thread_buffer> buffers(thread_count);
+    std::vector<size_t> minimiser_counts(sequence_count);
+    // The thread that processed each batch and the offset of the batch in its buffer.
+    std::vector<std::pair<size_t, size_t>> batch_locations(batch_count);
+    std::vector<std::exception_ptr> exceptions(thread_count);
+    std::atomic<size_t> next_batch{0u};
+
+    auto process_batches = [&](size_t const thread_id)
+    {
+        try
+        {
+            // A local buffer avoids false sharing of the vector members between the threads.
+            thread_buffer buffer{};
+
+            for (size_t batch = next_batch++; batch < batch_count; batch = next_batch++)
+            {
+                batch_locations[batch] = {thread_id, buffer.hashes.size()};
+                size_t const batch_end = std::min(sequence_count, (batch + 1u) * batch_size);
+
+                for (size_t i = batch * batch_size; i < batch_end; ++i)
+                {
+                    size_t const old_size = buffer.hashes.size();
+                    auto minimisers = sequences[i] | views::minimiser_hash(shape, window_size, seed);
+
+                    for (auto it = minimisers.begin(); it != minimisers.end(); ++it)
+                    {
+                        buffer.hashes.push_back(*it);
+
+                        if constexpr (with_positions)
+                            buffer.positions.push_back(it.position());
+                    }
+
+                    minimiser_counts[i] = buffer.hashes.size() - old_size;
+                }
+            }
+
+            buffers[thread_id] = std::move(buffer);
+        }
+        catch (...)
+        {
+            exceptions[thread_id] = std::current_exception();
+        }
+    };
+
+    if (thread_count == 1u)
+    {
+        process_batches(0u);
+    }
+    else
+    {
+        std::vector<std::thread> threads{};
+        threads.reserve(thread_count);
+
+        for (size_t thread_id = 0u; thread_id < thread_count; ++thread_id)
+            threads.emplace_back(process_batches, thread_id);
+
+        for (std::thread & thread : threads)
+            thread.join();
+    }
+
+    for (std::exception_ptr const & exception : exceptions)
+        if (exception)
+            std::rethrow_exception(exception);
+
+    minimiser_sketch sketch{};
+    auto && [hashes, delimiters] = sketch.hashes.raw_data();
+
+    delimiters.resize(sequence_count + 1u);
+    for (size_t i = 0u; i < sequence_count; ++i)
+        delimiters[i + 1u] = delimiters[i] + minimiser_counts[i];
+
+    hashes.resize(delimiters.back());
+    if constexpr (with_positions)
+        sketch.positions.raw_data().first.resize(delimiters.back());
+
+    for (size_t batch = 0u; batch < batch_count; ++batch)
+    {
+        auto [thread_id, buffer_offset] = batch_locations[batch];
+        size_t const first = delimiters[batch * batch_size];
+        size_t const last = delimiters[std::min(sequence_count, (batch + 1u) * batch_size)];
+
+        std::copy_n(buffers[thread_id].hashes.begin() + buffer_offset, last - first, hashes.begin() + first);
+
+        if constexpr (with_positions)
+        {
+            std::copy_n(buffers[thread_id].positions.begin() + buffer_offset,
+                        last - first,
+                        sketch.positions.raw_data().first.begin() + first);
+        }
+    }
+
+    if constexpr (with_positions)
+        sketch.positions.raw_data().second = delimiters;
+
+    return sketch;
+}
+
+} // namespace seqan3::detail
+
+namespace seqan3
+{
+
+/*!\brief Computes the minimisers of all sequences of a collection in parallel.
+ * \ingroup search_kmer_index
+ * \tparam sequences_t     The type of the collection of sequences. Must model std::ranges::random_access_range and
+ *                         std::ranges::sized_range, the sequences must be over elements of seqan3::semialphabet.
+ * \param[in] sequences    The collection of sequences, e.g. a seqan3::concatenated_sequences.
+ * \param[in] shape        The seqan3::shape to use for hashing.
+ * \param[in] window_size  The window size to use.
+ * \param[in] seed         The seed to use. Default: 0x8F3F73B5CF1C9ADE.
+ * \param[in] thread_count The number of threads to use. Default: 1.
+ * \returns A seqan3::concatenated_sequences where the i-th element contains the minimiser hash values of the i-th
+ *          sequence.
+ * \throws std::invalid_argument if `thread_count` is 0 or if the size of the shape is greater than the `window_size`.
+ *
+ * \details
+ *
+ * The result of the i-th sequence is the same as `sequences[i] | seqan3::views::minimiser_hash(shape, window_size,
+ * seed)`. In contrast to applying the view to each sequence and storing the results in a
+ * `std::vector<std::vector<uint64_t>>`, the minimisers of all sequences are stored in one contiguous array and the
+ * sequences are processed by `thread_count` threads. Each thread appends the minimisers to its own buffer, i.e.
+ * there is no synchronisation besides fetching the next batch of sequences.
+ *
+ * ### Example
+ *
+ * \include test/snippet/search/kmer_index/minimiser_sketch.cpp
+ *
+ * \experimentalapi{Experimental since version 3.4.}
+ */
+template <typename sequences_t>
+concatenated_sequences<std::vector<uint64_t>>
+bulk_minimiser_hash(sequences_t const & sequences,
+                    shape const & shape,
+                    window_size const window_size,
+                    seed const seed = seqan3::seed{0x8F'3F'73'B5'CF'1C'9A'DE},
+                    size_t const thread_count = 1u)
+{
+    return detail::bulk_minimiser_hash_impl<false>(sequences, shape, window_size, seed, thread_count).hashes;
+}
+
+/*!\brief Computes the minimisers of all sequences of a collection and their positions in parallel.
+ * \ingroup search_kmer_index
+ * \tparam sequences_t     The type of the collection of sequences. Must model std::ranges::random_access_range and
+ *                         std::ranges::sized_range, the sequences must be over elements of seqan3::semialphabet.
+ * \param[in] sequences    The collection of sequences, e.g. a seqan3::concatenated_sequences.
+ * \param[in] shape        The seqan3::shape to use for hashing.
+ * \param[in] window_size  The window size to use.
+ * \param[in] seed         The seed to use. Default: 0x8F3F73B5CF1C9ADE.
+ * \param[in] thread_count The number of threads to use. Default: 1.
+ * \returns A seqan3::minimiser_sketch that contains the minimiser hash values of each sequence and the positions of
+ *          the respective k-mers within the sequence.
+ * \throws std::invalid_argument if `thread_count` is 0 or if the size of the shape is greater than the `window_size`.
+ *
+ * \details
+ *
+ * Like seqan3::bulk_minimiser_hash, but additionally stores the position of each minimiser, i.e. the position of
+ * the first letter of the k-mer within its sequence.
+ *
+ * \experimentalapi{Experimental since version 3.4.}
+ */
+template <typename sequences_t>
+minimiser_sketch bulk_minimiser_hash_with_positions(sequences_t const & sequences,
+                                                    shape const & shape,
+                                                    window_size const window_size,
+                                                    seed const seed = seqan3::seed{0x8F'3F'73'B5'CF'1C'9A'DE},
+                                                    size_t const thread_count = 1u)
+{
+    return detail::bulk_minimiser_hash_impl<true>(sequences, shape, window_size, seed, thread_count);
+}
+
+} // namespace seqan3
@@ -14,6 +14,7 @@
 
 #include <seqan3/core/algorithm/algorithm_result_generator_range.hpp>
 #include <seqan3/core/algorithm/detail/algorithm_executor_blocking.hpp>
+#include <seqan3/core/algorithm/detail/algorithm_executor_streaming.hpp>
 #include <seqan3/core/configuration/configuration.hpp>
 #include <seqan3/search/configuration/default_configuration.hpp>
 #include <seqan3/search/configuration/on_result.hpp>
@@ -127,6 +128,9 @@ search(queries_t && queries, index_t const & index, configuration_t const & cfg
     {
         if constexpr (std::same_as<execution_handler_t, detail::execution_handler_parallel>)
         {
+            if (parallel.pool != nullptr)
+                return execution_handler_t{*parallel.pool};
+
             auto thread_count = parallel.thread_count;
             if (!thread_count)
                 throw std::runtime_error{"You must configure the number of threads in seqan3::search_cfg::parallel."};
@@ -146,6 +150,23 @@ search(queries_t && queries, index_t const & index, configuration_t const & cfg
                                                 indexed_queries,
                                                 get<search_cfg::on_result>(complete_config).callback);
     }
+    else if constexpr (std::same_as<execution_handler_t, detail::execution_handler_parallel>)
+    { // Stream the results of the parallel execution through a bounded buffer.
+        using executor_t =
+            detail::algorithm_executor_streaming<indexed_queries_t, decltype(algorithm), algorithm_result_t>;
+
+        auto const & parallel = get<search_cfg::parallel>(complete_config);
+        auto exec_handler = select_execution_handler();
+        size_t const buffer_size = parallel.buffer_size.value_or(
+            *parallel.thread_count * search_cfg::parallel::default_buffer_size_per_thread);
+
+        return algorithm_result_generator_range{executor_t{std::move(indexed_queries),
+                                                           std::move(algorithm),
+                                                           algorithm_result_t{},
+                                                           std::move(exec_handler),
+                                                           buffer_size,
+                                                           parallel.order}};
+    }
     else
     {
         using executor_t = detail::algorithm_executor_blocking<indexed_queries_t,
@@ -0,0 +1,620 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \author Enrico Seiler <enrico.seiler AT fu-berlin.de>
+ * \brief Provides seqan3::views::canonical_kmer_hash.
+ */
+
+#pragma once
+
+#include <seqan3/alphabet/nucleotide/concept.hpp>
+#include <seqan3/core/detail/empty_type.hpp>
+#include <seqan3/search/views/kmer_hash.hpp>
+
+namespace seqan3::detail
+{
+// ---------------------------------------------------------------------------------------------------------------------
+// canonical_kmer_hash_view class
+// ---------------------------------------------------------------------------------------------------------------------
+
+/*!\brief Whether the canonical k-mer hash of the nucleotide alphabet `alphabet_t` can be computed by shifting ranks.
+ * \ingroup search_views
+ *
+ * \details
+ *
+ * This is the case if the alphabet size is a power of two, e.g. for seqan3::dna4 and seqan3::rna4.
+ */
+template <typename alphabet_t>
+concept canonical_kmer_hashable = nucleotide_alphabet<alphabet_t> && (alphabet_size<alphabet_t> > 1u)
+                               && (alphabet_size<alphabet_t> == (1ULL << ceil_log2(alphabet_size<alphabet_t>)));
+
+/*!\brief The type returned by seqan3::views::canonical_kmer_hash.
+ * \tparam urng_t The type of the underlying range, must model std::ranges::input_range, the reference type must model
+ *                seqan3::nucleotide_alphabet and its alphabet size must be a power of two.
+ * \implements std::ranges::view
+ * \ingroup search_views
+ *
+ * \details
+ *
+ * The iterator maintains the hash of the span of the shape on the forward strand and on the reverse complement
+ * strand. For each letter, the forward hash is shifted left and the reverse complement hash is shifted right.
+ * Each letter of the underlying range is hence only accessed once.
+ *
+ * If the span of a gapped shape does not fit into 64 bits, both hashes are computed from the first letter of each
+ * k-mer instead, as seqan3::views::kmer_hash does for gapped shapes. This requires a std::ranges::forward_range.
+ *
+ * The hash values are skewed with a seed (`hash ^ seed`) before taking the minimum, see seqan3::views::minimiser_hash.
+ * seqan3::views::canonical_kmer_hash uses a seed of `0`.
+ *
+ * Note that most members of this class are generated by std::ranges::view_interface which is not yet documented here.
+ */
+template <std::ranges::view urng_t>
+class canonical_kmer_hash_view : public std::ranges::view_interface<canonical_kmer_hash_view<urng_t>>
+{
+private:
+    static_assert(std::ranges::input_range<urng_t>, "The canonical_kmer_hash_view only works on input_ranges");
+    static_assert(canonical_kmer_hashable<std::ranges::range_value_t<urng_t>>,
+                  "The value type of the underlying range must model seqan3::nucleotide_alphabet and the "
+                  "alphabet size must be a power of two.");
+
+    //!\brief The alphabet of the underlying range.
+    using alphabet_t = std::ranges::range_value_t<urng_t>;
+
+    //!\brief The number of bits per letter.
+    static constexpr size_t bits_per_letter = ceil_log2(alphabet_size<alphabet_t>);
+
+    //!\brief The underlying range.
+    urng_t urange;
+
+    //!\brief The shape to use.
+    shape shape_;
+
+    //!\brief The seed to skew the hash values with.
+    uint64_t seed{};
+
+    template <bool const_range>
+    class basic_iterator;
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    canonical_kmer_hash_view()
+        requires std::default_initializable<urng_t>
+    = default;                                                                            //!< Defaulted.
+    canonical_kmer_hash_view(canonical_kmer_hash_view const & rhs) = default;             //!< Defaulted.
+    canonical_kmer_hash_view(canonical_kmer_hash_view && rhs) = default;                  //!< Defaulted.
+    canonical_kmer_hash_view & operator=(canonical_kmer_hash_view const & rhs) = default; //!< Defaulted.
+    canonical_kmer_hash_view & operator=(canonical_kmer_hash_view && rhs) = default;      //!< Defaulted.
+    ~canonical_kmer_hash_view() = default;                                                //!< Defaulted.
+
+    /*!\brief Construct from a view, a given shape and a seed.
+     * \throws std::invalid_argument if the hash cannot be represented in `uint64_t`, i.e.
+     *         \f$s>\frac{64}{\log_2\sigma}\f$ with shape count \f$s\f$ and alphabet size \f$\sigma\f$, or if
+     *         the span of the shape does not fit into `uint64_t` and `urng_t` is not a std::ranges::forward_range.
+     */
+    explicit canonical_kmer_hash_view(urng_t urange_, shape const & s_, uint64_t const seed_ = 0u) :
+        urange{std::move(urange_)},
+        shape_{s_},
+        seed{seed_}
+    {
+        validate_shape();
+    }
+
+    /*!\brief Construct from a non-view that can be view-wrapped, a given shape and a seed.
+     * \throws std::invalid_argument if the hash cannot be represented in `uint64_t`, i.e.
+     *         \f$s>\frac{64}{\log_2\sigma}\f$ with shape count \f$s\f$ and alphabet size \f$\sigma\f$, or if
+     *         the span of the shape does not fit into `uint64_t` and `urng_t` is not a std::ranges::forward_range.
+     */
+    template <typename rng_t>
+        requires (!std::same_as<std::remove_cvref_t<rng_t>, canonical_kmer_hash_view>)
+              && std::ranges::viewable_range<rng_t>
+              && std::constructible_from<urng_t, std::ranges::ref_view<std::remove_reference_t<rng_t>>>
+    explicit canonical_kmer_hash_view(rng_t && urange_, shape const & s_, uint64_t const seed_ = 0u) :
+        urange{std::views::all(std::forward<rng_t>(urange_))},
+        shape_{s_},
+        seed{seed_}
+    {
+        validate_shape();
+    }
+    //!\}
+
+    /*!\name Iterators
+     * \{
+     */
+    /*!\brief Returns an iterator to the first element of the range.
+     * \returns Iterator to the first element.
+     *
+     * \details
+     *
+     * ### Complexity
+     *
+     * Linear in size of shape.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    basic_iterator<false> begin() noexcept
+    {
+        return {std::ranges::begin(urange), std::ranges::end(urange), shape_, seed};
+    }
+
+    //!\copydoc begin()
+    basic_iterator<true> begin() const noexcept
+        requires const_iterable_range<urng_t>
+    {
+        return {std::ranges::begin(urange), std::ranges::end(urange), shape_, seed};
+    }
+
+    /*!\brief Returns the sentinel of the range.
+     * \returns std::default_sentinel.
+     */
+    std::default_sentinel_t end() const noexcept
+    {
+        return {};
+    }
+    //!\}
+
+    /*!\brief Returns the size of the range, if the underlying range is a std::ranges::sized_range.
+     * \returns Size of range.
+     */
+    auto size()
+        requires std::ranges::sized_range<urng_t>
+    {
+        using size_type = std::ranges::range_size_t<urng_t>;
+        return std::max<size_type>(std::ranges::size(urange) + 1, shape_.size()) - shape_.size();
+    }
+
+    //!\copydoc size()
+    auto size() const
+        requires std::ranges::sized_range<urng_t const>
+    {
+        using size_type = std::ranges::range_size_t<urng_t const>;
+        return std::max<size_type>(std::ranges::size(urange) + 1, shape_.size()) - shape_.size();
+    }
+
+private:
+    //!\brief Checks that the shape is not too long for the given alphabet and the underlying range.
+    void validate_shape() const
+    {
+        validate_kmer_hash_shape<alphabet_t>(shape_);
+
+        // Longer spans are hashed from the first letter of each k-mer, which needs a multi-pass range.
+        if (shape_.size() * bits_per_letter <= 64u || std::ranges::forward_range<urng_t>)
+            return;
+
+        std::string message{"The shape is too long for the given alphabet.\n"};
+        message += "Alphabet: ";
+        message += detail::type_name_as_string<alphabet_t>;
+        message += "\nMaximum shape size: ";
+        message += std::to_string(64u / bits_per_letter);
+        message += "\nGiven shape size: ";
+        message += std::to_string(shape_.size());
+        message += "\nLonger shapes require a forward range.";
+        throw std::invalid_argument{message};
+    }
+};
+
+/*!\brief Iterator for calculating canonical hash values via a given seqan3::shape.
+ *
+ * \details
+ *
+ * The iterator points behind the last letter of the current k-mer and stores its hash value. The end is reached, once
+ * the iterator is incremented while the underlying iterator is at the end of the underlying range.
+ *
+ * If the span of the shape does not fit into 64 bits, the iterator additionally stores an iterator to the first letter
+ * of the current k-mer and recomputes both hashes from there.
+ */
+template <std::ranges::view urng_t>
+template <bool const_range>
+class canonical_kmer_hash_view<urng_t>::basic_iterator
+{
+private:
+    //!\brief The iterator type of the underlying range.
+    using it_t = maybe_const_iterator_t<const_range, urng_t>;
+    //!\brief The sentinel type of the underlying range.
+    using sentinel_t = maybe_const_sentinel_t<const_range, urng_t>;
+
+    //!\brief The type of the iterator to the first letter of the current k-mer. Only needed for long spans.
+    using kmer_begin_t = std::conditional_t<std::forward_iterator<it_t>, it_t, empty_type>;
+
+    template <bool other_const_range>
+    friend class basic_iterator;
+
+public:
+    /*!\name Associated types
+     * \{
+     */
+    //!\brief Type for distances between iterators.
+    using difference_type = std::iter_difference_t<it_t>;
+    //!\brief Value type of this iterator.
+    using value_type = size_t;
+    //!\brief The pointer type.
+    using pointer = void;
+    //!\brief Reference to `value_type`.
+    using reference = value_type;
+    //!\brief The iterator category tag.
+    using iterator_category = std::input_iterator_tag;
+    //!\brief Tag this class as a forward iterator if the underlying range is a forward range.
+    using iterator_concept =
+        std::conditional_t<std::forward_iterator<it_t>, std::forward_iterator_tag, std::input_iterator_tag>;
+    //!\}
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    basic_iterator() = default;                                   //!< Defaulted.
+    basic_iterator(basic_iterator const &) = default;             //!< Defaulted.
+    basic_iterator(basic_iterator &&) = default;                  //!< Defaulted.
+    basic_iterator & operator=(basic_iterator const &) = default; //!< Defaulted.
+    basic_iterator & operator=(basic_iterator &&) = default;      //!< Defaulted.
+    ~basic_iterator() = default;                                  //!< Defaulted.
+
+    //!\brief Allow iterator on a const range to be constructible from an iterator over a non-const range.
+    basic_iterator(basic_iterator<!const_range> const & it) noexcept
+        requires const_range
+        :
+        hash_value{std::move(it.hash_value)},
+        forward_hash{std::move(it.forward_hash)},
+        reverse_hash{std::move(it.reverse_hash)},
+        span_mask{std::move(it.span_mask)},
+        extract_mask{std::move(it.extract_mask)},
+        reverse_shift{std::move(it.reverse_shift)},
+        seed{std::move(it.seed)},
+        at_end{std::move(it.at_end)},
+        shape_{std::move(it.shape_)},
+        kmer_begin{std::move(it.kmer_begin)},
+        text_it{std::move(it.text_it)},
+        text_end{std::move(it.text_end)}
+    {}
+
+    /*!\brief Construct from a given iterator on the text, a seqan3::shape and a seed.
+    * \param[in] it_start Iterator pointing to the first position of the text.
+    * \param[in] it_end   Sentinel pointing to the end of the text.
+    * \param[in] s_       The seqan3::shape that determines which positions participate in hashing.
+    * \param[in] seed_    The seed to skew the hash values with.
+    *
+    * \details
+    *
+    * ### Complexity
+    *
+    * Linear in size of shape.
+    */
+    basic_iterator(it_t it_start, sentinel_t it_end, shape const & s_, uint64_t const seed_) :
+        span_mask{low_bits(s_.size() * bits_per_letter)},
+        extract_mask{packed_shape_mask(s_, bits_per_letter)},
+        reverse_shift{(s_.size() - 1u) * bits_per_letter},
+        seed{seed_},
+        shape_{s_},
+        text_it{std::move(it_start)},
+        text_end{std::move(it_end)}
+    {
+        assert(std::ranges::size(s_) > 0);
+
+        if constexpr (std::forward_iterator<it_t>)
+        {
+            if (extract_mask == 0u) // The span does not fit into a word.
+            {
+                kmer_begin = text_it;
+
+                for (size_t i = 0; i < s_.size(); ++i, ++text_it)
+                {
+                    if (text_it == text_end)
+                    {
+                        at_end = true;
+                        return;
+                    }
+                }
+
+                hash_full();
+                return;
+            }
+        }
+
+        for (size_t i = 0; i < s_.size(); ++i)
+        {
+            if (text_it == text_end)
+            {
+                at_end = true;
+                return;
+            }
+
+            roll_forward();
+        }
+
+        compute_hash_value();
+    }
+    //!\}
+
+    //!\anchor basic_iterator_comparison_canonical_kmer_hash
+    //!\name Comparison operators
+    //!\{
+
+    //!\brief Compare to another basic_iterator.
+    friend bool operator==(basic_iterator const & lhs, basic_iterator const & rhs) noexcept
+        requires std::forward_iterator<it_t>
+    {
+        return std::tie(lhs.text_it, lhs.at_end) == std::tie(rhs.text_it, rhs.at_end);
+    }
+
+    //!\brief Compare to the sentinel of the canonical_kmer_hash_view.
+    friend bool operator==(basic_iterator const & lhs, std::default_sentinel_t const &) noexcept
+    {
+        return lhs.at_end;
+    }
+    //!\}
+
+    /*!\brief Return the number of hash values from `rhs` to the end.
+     * \attention This function is only available if sentinel_t and it_t model std::sized_sentinel_for.
+     */
+    friend difference_type operator-(std::default_sentinel_t const &, basic_iterator const & rhs) noexcept
+        requires std::sized_sentinel_for<sentinel_t, it_t>
+    {
+        return rhs.at_end ? 0 : static_cast<difference_type>(rhs.text_end - rhs.text_it) + 1;
+    }
+
+    /*!\brief Return the negated number of hash values from `lhs` to the end.
+     * \attention This function is only available if sentinel_t and it_t model std::sized_sentinel_for.
+     */
+    friend difference_type operator-(basic_iterator const & lhs, std::default_sentinel_t const & rhs) noexcept
+        requires std::sized_sentinel_for<sentinel_t, it_t>
+    {
+        return -(rhs - lhs);
+    }
+
+    //!\brief Pre-increment.
+    basic_iterator & operator++() noexcept
+    {
+        if (text_it == text_end)
+        {
+            at_end = true;
+        }
+        else
+        {
+            if constexpr (std::forward_iterator<it_t>)
+            {
+                if (extract_mask == 0u) // The span does not fit into a word.
+                {
+                    ++text_it;
+                    ++kmer_begin;
+                    hash_full();
+                    return *this;
+                }
+            }
+
+            roll_forward();
+            compute_hash_value();
+        }
+
+        return *this;
+    }
+
+    //!\brief Post-increment.
+    basic_iterator operator++(int) noexcept
+        requires std::forward_iterator<it_t>
+    {
+        basic_iterator tmp{*this};
+        ++(*this);
+        return tmp;
+    }
+
+    //!\brief Post-increment.
+    void operator++(int) noexcept
+        requires (!std::forward_iterator<it_t>)
+    {
+        ++(*this);
+    }
+
+    //!\brief Return the hash value.
+    value_type operator*() const noexcept
+    {
+        return hash_value;
+    }
+
+private:
+    //!\brief The hash value of the current k-mer.
+    size_t hash_value{};
+
+    //!\brief The hash of the span of the shape on the forward strand.
+    uint64_t forward_hash{};
+
+    //!\brief The hash of the span of the shape on the reverse complement strand.
+    uint64_t reverse_hash{};
+
+    //!\brief Selects all positions of the span of the shape.
+    uint64_t span_mask{};
+
+    //!\brief Selects the positions of the span that are part of the hash.
+    uint64_t extract_mask{};
+
+    //!\brief The shift that moves a rank to the leftmost position of the span.
+    size_t reverse_shift{};
+
+    //!\brief The seed to skew the hash values with.
+    uint64_t seed{};
+
+    //!\brief Whether the iterator is at the end.
+    bool at_end{false};
+
+    //!\brief The shape to use. Only needed for long spans.
+    shape shape_{};
+
+    //!\brief Iterator to the first letter of the current k-mer. Only needed for long spans.
+    kmer_begin_t kmer_begin{};
+
+    //!\brief Iterator to the position behind the current k-mer.
+    it_t text_it{};
+
+    //!\brief The end of the text.
+    sentinel_t text_end{};
+
+    //!\brief Adds the letter at `text_it` to both span hashes and advances `text_it`.
+    void roll_forward()
+    {
+        auto const letter = *text_it;
+        uint64_t const rank = to_rank(letter);
+        uint64_t const complement_rank = to_rank(seqan3::complement(letter));
+
+        // The reverse complement of the new letter becomes the leftmost position of the reverse complement strand.
+        forward_hash = ((forward_hash << bits_per_letter) | rank) & span_mask;
+        reverse_hash = (reverse_hash >> bits_per_letter) | (complement_rank << reverse_shift);
+
+        ++text_it;
+    }
+
+    /*!\brief Computes the canonical hash value from the letters of the current k-mer.
+     *
+     * \details
+     *
+     * The reverse complement of the letter at position `i` of the span is at position `span - 1 - i` of the reverse
+     * complement k-mer. Hence, the letters of the k-mer contribute to the reverse complement hash in reverse order.
+     */
+    void hash_full()
+    {
+        uint64_t forward{};
+        uint64_t reverse{};
+        size_t reverse_letters{};
+        size_t const span = shape_.size();
+        auto it = kmer_begin;
+
+        for (size_t i = 0; i < span; ++i, ++it)
+        {
+            auto const letter = *it;
+
+            if (shape_[i])
+                forward = (forward << bits_per_letter) | to_rank(letter);
+
+            if (shape_[span - 1u - i])
+            {
+                uint64_t const complement_rank = to_rank(seqan3::complement(letter));
+                reverse |= complement_rank << (reverse_letters * bits_per_letter);
+                ++reverse_letters;
+            }
+        }
+
+        hash_value = std::min<uint64_t>(forward ^ seed, reverse ^ seed);
+    }
+
+    //!\brief Computes the canonical hash value from the span hashes.
+    void compute_hash_value() noexcept
+    {
+        uint64_t forward = forward_hash;
+        uint64_t reverse = reverse_hash;
+
+        if (extract_mask != span_mask) // gapped
+        {
+            forward = parallel_bit_extract(forward, extract_mask);
+            reverse = parallel_bit_extract(reverse, extract_mask);
+        }
+
+        hash_value = std::min<uint64_t>(forward ^ seed, reverse ^ seed);
+    }
+};
+
+//!\brief A deduction guide for the view class template.
+template <std::ranges::viewable_range rng_t>
+canonical_kmer_hash_view(rng_t &&, shape const & shape_) -> canonical_kmer_hash_view<std::views::all_t<rng_t>>;
+
+//!\brief A deduction guide for the view class template.
+template <std::ranges::viewable_range rng_t>
+canonical_kmer_hash_view(rng_t &&, shape const & shape_, uint64_t const seed_)
+    -> canonical_kmer_hash_view<std::views::all_t<rng_t>>;
+
+// ---------------------------------------------------------------------------------------------------------------------
+// canonical_kmer_hash_fn (adaptor definition)
+// ---------------------------------------------------------------------------------------------------------------------
+
+//!\brief views::canonical_kmer_hash's range adaptor object type (non-closure).
+//!\ingroup search_views
+struct canonical_kmer_hash_fn
+{
+    //!\brief Store the shape and return a range adaptor closure object.
+    constexpr auto operator()(shape const & shape_) const
+    {
+        return adaptor_from_functor{*this, shape_};
+    }
+
+    /*!\brief            Call the view's constructor with the underlying view and a seqan3::shape as argument.
+     * \param[in] urange The input range to process. Must model std::ranges::viewable_range and the reference type
+     *                   of the range must model seqan3::nucleotide_alphabet.
+     * \param[in] shape_ The seqan3::shape to use for hashing.
+     * \throws std::invalid_argument if resulting hash values would be too big for a 64 bit integer.
+     * \returns          A range of converted elements.
+     */
+    template <std::ranges::range urng_t>
+    constexpr auto operator()(urng_t && urange, shape const & shape_) const
+    {
+        static_assert(std::ranges::viewable_range<urng_t>,
+                      "The range parameter to views::canonical_kmer_hash cannot be a temporary of a non-view range.");
+        static_assert(std::ranges::input_range<urng_t>,
+                      "The range parameter to views::canonical_kmer_hash must model std::ranges::input_range.");
+        static_assert(canonical_kmer_hashable<std::ranges::range_value_t<urng_t>>,
+                      "The range parameter to views::canonical_kmer_hash must be over elements of "
+                      "seqan3::nucleotide_alphabet whose alphabet size is a power of two.");
+
+        return canonical_kmer_hash_view{std::forward<urng_t>(urange), shape_};
+    }
+};
+
+} // namespace seqan3::detail
+
+namespace seqan3::views
+{
+/*!\brief               Computes the canonical hash value for each position of a range via a given shape.
+ * \tparam urng_t       The type of the range being processed. See below for requirements. [template parameter is
+ *                      omitted in pipe notation]
+ * \param[in] urange    The range being processed. [parameter is omitted in pipe notation]
+ * \param[in] shape     The seqan3::shape that determines how to compute the hash value.
+ * \returns             A range of std::size_t where each value is the canonical hash of the resp. k-mer.
+ *                      See below for the properties of the returned range.
+ * \ingroup search_views
+ *
+ * \details
+ *
+ * The canonical hash of a k-mer is the minimum of its hash value and the hash value of its reverse complement,
+ * i.e. a k-mer and its reverse complement have the same canonical hash. The hash values of both strands are the same
+ * as the ones of seqan3::views::kmer_hash applied to the range and to its reverse complement, respectively.
+ * In contrast to computing both via seqan3::views::kmer_hash, each letter is only accessed once and the underlying
+ * range only needs to be a std::ranges::input_range.
+ *
+ * \attention
+ * The alphabet size \f$\sigma\f$ of the alphabet of `urange` must be a power of two, e.g. seqan3::dna4, and
+ * the hash of the shape must be representable in an `uint64_t`, i.e. \f$s \le \frac{64}{\log_2\sigma}\f$ for the
+ * shape count \f$s\f$. If the span of `shape` exceeds this limit, `urange` must be a std::ranges::forward_range and
+ * the hash values are computed letter by letter, as in seqan3::views::kmer_hash.
+ *
+ * ### View properties
+ *
+ * | Concepts and traits              | `urng_t` (underlying range type)   | `rrng_t` (returned range type)   |
+ * |----------------------------------|:----------------------------------:|:--------------------------------:|
+ * | std::ranges::input_range         | *required*                         | *preserved*                      |
+ * | std::ranges::forward_range       |                                    | *preserved*                      |
+ * | std::ranges::bidirectional_range |                                    | *lost*                           |
+ * | std::ranges::random_access_range |                                    | *lost*                           |
+ * | std::ranges::contiguous_range    |                                    | *lost*                           |
+ * |                                  |                                    |                                  |
+ * | std::ranges::viewable_range      | *required*                         | *guaranteed*                     |
+ * | std::ranges::view                |                                    | *guaranteed*                     |
+ * | std::ranges::sized_range         |                                    | *preserved*                      |
+ * | std::ranges::common_range        |                                    | *lost*                           |
+ * | std::ranges::output_range        |                                    | *lost*                           |
+ * | seqan3::const_iterable_range     |                                    | *preserved*                      |
+ * |                                  |                                    |                                  |
+ * | std::ranges::range_reference_t   | seqan3::nucleotide_alphabet        | std::size_t                      |
+ *
+ * See the \link views views submodule documentation \endlink for detailed descriptions of the view properties.
+ *
+ * ### Example
+ *
+ * \include test/snippet/search/views/canonical_kmer_hash.cpp
+ *
+ * \hideinitializer
+ *
+ * \experimentalapi{Experimental since version 3.4.}
+ */
+inline constexpr auto canonical_kmer_hash = detail::canonical_kmer_hash_fn{};
+
+} // namespace seqan3::views
@@ -9,13 +9,95 @@
 
 #pragma once
 
+#if defined(__BMI2__)
+#    include <immintrin.h>
+#endif
+
 #include <seqan3/alphabet/concept.hpp>
+#include <seqan3/alphabet/container/bitpacked_sequence.hpp>
 #include <seqan3/alphabet/range/hash.hpp>
 #include <seqan3/search/kmer_index/shape.hpp>
 #include <seqan3/utility/math.hpp>
 
 namespace seqan3::detail
 {
+/*!\brief Checks that hashes resulting from the shape/alphabet combination can be represented in `uint64_t`.
+ * \tparam alphabet_t The alphabet of the hashed range.
+ * \param[in] shape_ The shape to check.
+ * \throws std::invalid_argument if \f$s>\frac{64}{\log_2\sigma}\f$ with shape count \f$s\f$ and alphabet size
+ *         \f$\sigma\f$.
+ */
+template <semialphabet alphabet_t>
+inline void validate_kmer_hash_shape(shape const & shape_)
+{
+    int const max_shape_count = 64 / std::log2(alphabet_size<alphabet_t>);
+
+    if (shape_.count() <= max_shape_count)
+        return;
+
+    std::string message{"The shape is too long for the given alphabet.\n"};
+    message += "Alphabet: ";
+    message += detail::type_name_as_string<alphabet_t>;
+    message += "\nMaximum shape count: ";
+    message += std::to_string(max_shape_count);
+    message += "\nGiven shape count: ";
+    message += std::to_string(shape_.count());
+    throw std::invalid_argument{message};
+}
+
+/*!\brief Returns a word in which the `count` lowest bits are set.
+ * \param[in] count The number of bits to set. Must be at most 64.
+ */
+constexpr uint64_t low_bits(size_t const count) noexcept
+{
+    return (count >= 64u) ? std::numeric_limits<uint64_t>::max() : (1ULL << count) - 1u;
+}
+
+/*!\brief Selects the bits of a span hash that belong to the positions of a shape.
+ * \param[in] shape_          The shape.
+ * \param[in] bits_per_letter The number of bits of each position in the span hash.
+ * \returns A mask that can be used with seqan3::detail::parallel_bit_extract to compute the hash value of the shape
+ *          from the hash of its whole span. `0`, if the span hash does not fit into 64 bit.
+ *
+ * \details
+ *
+ * In a span hash, the leftmost position of the shape occupies the most significant bits. Like
+ * seqan3::views::kmer_hash, the mask always selects the last position, even if the shape has a `0` there.
+ */
+constexpr uint64_t packed_shape_mask(shape const & shape_, size_t const bits_per_letter) noexcept
+{
+    size_t const span = shape_.size();
+    uint64_t mask{0};
+
+    if (span * bits_per_letter > 64u)
+        return mask;
+
+    for (size_t i = 0; i < span; ++i)
+        if (shape_[i] || i + 1u == span)
+            mask |= low_bits(bits_per_letter) << ((span - 1u - i) * bits_per_letter);
+
+    return mask;
+}
+
+/*!\brief Gathers the bits of `value` selected by `mask` into the lowest bits of the result, preserving their order.
+ * \details
+ * Uses the `PEXT` instruction if BMI2 is available.
+ */
+inline uint64_t parallel_bit_extract(uint64_t const value, uint64_t mask) noexcept
+{
+#if defined(__BMI2__)
+    return _pext_u64(value, mask);
+#else
+    uint64_t result{0};
+
+    for (uint64_t bit{1u}; mask != 0u; bit <<= 1, mask &= mask - 1u)
+        if (value & mask & -mask)
+            result |= bit;
+
+    return result;
+#endif
+}
+
 // ---------------------------------------------------------------------------------------------------------------------
 // kmer_hash_view class
 // ---------------------------------------------------------------------------------------------------------------------
@@ -49,31 +131,14 @@ private:
     template <bool const_range>
     class basic_iterator;
 
-    //!\brief The maximum shape count for the given alphabet.
-    static inline int max_shape_count = 64 / std::log2(alphabet_size<std::ranges::range_reference_t<urng_t>>);
-
-    //!\brief Throws the exception for validate_shape().
-    [[noreturn]] void shape_too_long_error() const
+    //!\brief Checks that the shape is not too long for the given alphabet.
+    inline void validate_shape() const
     {
-        std::string message{"The shape is too long for the given alphabet.\n"};
-        message += "Alphabet: ";
         // Note: Since we want the alphabet type name, std::ranges::range_value_t is the better choice.
         // For seqan3::bitpacked_sequence<seqan3::dna4>:
         // reference_t: seqan3::bitpacked_sequence<seqan3::dna4>::reference_proxy_type
         // value_t: seqan3::dna4
-        message += detail::type_name_as_string<std::remove_cvref_t<std::ranges::range_value_t<urng_t>>>;
-        message += "\nMaximum shape count: ";
-        message += std::to_string(max_shape_count);
-        message += "\nGiven shape count: ";
-        message += std::to_string(shape_.count());
-        throw std::invalid_argument{message};
-    }
-
-    //!\brief Checks that the shape is not too long for the given alphabet.
-    inline void validate_shape() const
-    {
-        if (shape_.count() > max_shape_count)
-            shape_too_long_error();
+        validate_kmer_hash_shape<std::remove_cvref_t<std::ranges::range_value_t<urng_t>>>(shape_);
     }
 
 public:
@@ -674,6 +739,417 @@ private:
 template <std::ranges::viewable_range rng_t>
 kmer_hash_view(rng_t &&, shape const & shape_) -> kmer_hash_view<std::views::all_t<rng_t>>;
 
+// ---------------------------------------------------------------------------------------------------------------------
+// packed_kmer_hash_view class
+// ---------------------------------------------------------------------------------------------------------------------
+
+/*!\brief Determines whether seqan3::views::kmer_hash can read the k-mers of `urng_t` directly from packed words.
+ * \tparam urng_t The type of the underlying view.
+ * \ingroup search_views
+ *
+ * \details
+ *
+ * This is the case for a std::ranges::ref_view or std::ranges::owning_view over a seqan3::bitpacked_sequence whose
+ * alphabet size is a power of two, e.g. seqan3::bitpacked_sequence<seqan3::dna4>. The rank of such a letter occupies
+ * exactly `bits_per_letter` bits and no letter spans two words.
+ */
+template <typename urng_t>
+struct packed_kmer_hash_traits : std::false_type
+{};
+
+//!\cond
+template <typename alphabet_t>
+struct packed_kmer_hash_traits<bitpacked_sequence<alphabet_t>> :
+    std::bool_constant<(alphabet_size<alphabet_t> > 1u)
+                       && (alphabet_size<alphabet_t> == (1ULL << detail::ceil_log2(alphabet_size<alphabet_t>)))
+                       && (64u % detail::ceil_log2(alphabet_size<alphabet_t>) == 0u)>
+{
+    static constexpr size_t bits_per_letter = detail::ceil_log2(alphabet_size<alphabet_t>);
+};
+
+template <typename container_t>
+struct packed_kmer_hash_traits<std::ranges::ref_view<container_t>> :
+    packed_kmer_hash_traits<std::remove_const_t<container_t>>
+{};
+
+template <typename container_t>
+struct packed_kmer_hash_traits<std::ranges::owning_view<container_t>> : packed_kmer_hash_traits<container_t>
+{};
+//!\endcond
+
+/*!\brief The type returned by seqan3::views::kmer_hash for views over a seqan3::bitpacked_sequence.
+ * \tparam urng_t The type of the underlying view, must fulfil seqan3::detail::packed_kmer_hash_traits.
+ * \implements std::ranges::view
+ * \implements std::ranges::random_access_range
+ * \implements std::ranges::sized_range
+ * \ingroup search_views
+ *
+ * \details
+ *
+ * Produces the same hash values as seqan3::detail::kmer_hash_view, but reads the ranks directly from the words of the
+ * seqan3::bitpacked_sequence instead of accessing each letter via its proxy and seqan3::to_rank.
+ * Since the alphabet size is a power of two, the hash of a k-mer is the concatenation of the ranks of its letters.
+ * Advancing the iterator shifts the next rank into the hash and masks out the leftmost one.
+ * For a gapped shape, the hash of the whole span of the shape is computed the same way, and the positions of the `0`s
+ * are removed with a single parallel bit extract (`PEXT`, if BMI2 is available).
+ * If the span of a gapped shape does not fit into 64 bit, each hash is computed letter by letter.
+ *
+ * Note that most members of this class are generated by std::ranges::view_interface which is not yet documented here.
+ */
+template <std::ranges::view urng_t>
+    requires packed_kmer_hash_traits<urng_t>::value
+class packed_kmer_hash_view : public std::ranges::view_interface<packed_kmer_hash_view<urng_t>>
+{
+private:
+    //!\brief The underlying range.
+    urng_t urange;
+
+    //!\brief The shape to use.
+    shape shape_;
+
+    class iterator;
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    packed_kmer_hash_view()
+        requires std::default_initializable<urng_t>
+    = default;                                                                      //!< Defaulted.
+    packed_kmer_hash_view(packed_kmer_hash_view const & rhs) = default;             //!< Defaulted.
+    packed_kmer_hash_view(packed_kmer_hash_view && rhs) = default;                  //!< Defaulted.
+    packed_kmer_hash_view & operator=(packed_kmer_hash_view const & rhs) = default; //!< Defaulted.
+    packed_kmer_hash_view & operator=(packed_kmer_hash_view && rhs) = default;      //!< Defaulted.
+    ~packed_kmer_hash_view() = default;                                             //!< Defaulted.
+
+    /*!\brief Construct from a view and a given shape.
+     * \throws std::invalid_argument if hashes resulting from the shape/alphabet combination cannot be represented in
+     *         `uint64_t`, i.e. \f$s>\frac{64}{\log_2\sigma}\f$ with shape size \f$s\f$ and alphabet size \f$\sigma\f$.
+     */
+    explicit packed_kmer_hash_view(urng_t urange_, shape const & s_) : urange{std::move(urange_)}, shape_{s_}
+    {
+        validate_kmer_hash_shape<std::remove_cvref_t<std::ranges::range_value_t<urng_t>>>(shape_);
+    }
+    //!\}
+
+    /*!\name Iterators
+     * \{
+     */
+    /*!\brief Returns an iterator to the first element of the range.
+     * \returns Iterator to the first element.
+     *
+     * \details
+     *
+     * ### Complexity
+     *
+     * Linear in size of shape.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    iterator begin() const noexcept
+    {
+        return iterator{urange.base().raw_data().data(), 0u, std::ranges::size(urange), shape_};
+    }
+
+    /*!\brief Returns an iterator to the element following the last element of the range.
+     * \returns Iterator to the end.
+     *
+     * \details
+     *
+     * This element acts as a placeholder; attempting to dereference it results in undefined behaviour.
+     *
+     * ### Complexity
+     *
+     * Linear in size of shape.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    iterator end() const noexcept
+    {
+        return iterator{urange.base().raw_data().data(), size(), std::ranges::size(urange), shape_};
+    }
+    //!\}
+
+    /*!\brief Returns the size of the range.
+     * \returns Size of range.
+     */
+    size_t size() const noexcept
+    {
+        return std::max<size_t>(std::ranges::size(urange) + 1, shape_.size()) - shape_.size();
+    }
+};
+
+/*!\brief Iterator for calculating hash values via a given seqan3::shape from the words of a
+ *        seqan3::bitpacked_sequence.
+ *
+ * \details
+ *
+ * Like seqan3::detail::kmer_hash_view::basic_iterator, the iterator stores the hash of all but the last position of
+ * the span and adds the last position upon access. This avoids reading past the end of the text.
+ */
+template <std::ranges::view urng_t>
+    requires packed_kmer_hash_traits<urng_t>::value
+class packed_kmer_hash_view<urng_t>::iterator
+{
+public:
+    /*!\name Associated types
+     * \{
+     */
+    //!\brief Type for distances between iterators.
+    using difference_type = std::ptrdiff_t;
+    //!\brief Value type of this iterator.
+    using value_type = size_t;
+    //!\brief The pointer type.
+    using pointer = void;
+    //!\brief Reference to `value_type`.
+    using reference = value_type;
+    //!\brief The iterator category tag.
+    using iterator_category = std::input_iterator_tag;
+    //!\brief The iterator concept tag.
+    using iterator_concept = std::random_access_iterator_tag;
+    //!\}
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    constexpr iterator() = default;                             //!< Defaulted.
+    constexpr iterator(iterator const &) = default;             //!< Defaulted.
+    constexpr iterator(iterator &&) = default;                  //!< Defaulted.
+    constexpr iterator & operator=(iterator const &) = default; //!< Defaulted.
+    constexpr iterator & operator=(iterator &&) = default;      //!< Defaulted.
+    ~iterator() = default;                                      //!< Defaulted.
+
+    /*!\brief Construct from the words of the text and a seqan3::shape.
+     * \param[in] words     Pointer to the first word of the text.
+     * \param[in] position  The position of the first letter of the k-mer this iterator points to.
+     * \param[in] text_size The number of letters in the text.
+     * \param[in] s_        The seqan3::shape that determines which positions participate in hashing.
+     *
+     * \details
+     *
+     * ### Complexity
+     *
+     * Linear in size of shape.
+     */
+    iterator(uint64_t const * words, size_t const position, size_t const text_size, shape const & s_) noexcept :
+        words{words},
+        position{position},
+        shape_{s_}
+    {
+        assert(std::ranges::size(shape_) > 0);
+
+        extract_mask = packed_shape_mask(shape_, bits_per_letter);
+
+        if (extract_mask != 0u)
+            span_mask = low_bits(shape_.size() * bits_per_letter);
+
+        // Only hash if there is at least one k-mer, otherwise this would read past the end of the text.
+        if (shape_.size() <= text_size)
+            hash_prefix();
+    }
+    //!\}
+
+    //!\name Comparison operators
+    //!\{
+
+    //!\brief Compare to another iterator.
+    friend bool operator==(iterator const & lhs, iterator const & rhs) noexcept
+    {
+        return lhs.position == rhs.position;
+    }
+
+    //!\brief Compare to another iterator.
+    friend bool operator!=(iterator const & lhs, iterator const & rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+    //!\brief Compare to another iterator.
+    friend bool operator<(iterator const & lhs, iterator const & rhs) noexcept
+    {
+        return lhs.position < rhs.position;
+    }
+
+    //!\brief Compare to another iterator.
+    friend bool operator>(iterator const & lhs, iterator const & rhs) noexcept
+    {
+        return lhs.position > rhs.position;
+    }
+
+    //!\brief Compare to another iterator.
+    friend bool operator<=(iterator const & lhs, iterator const & rhs) noexcept
+    {
+        return lhs.position <= rhs.position;
+    }
+
+    //!\brief Compare to another iterator.
+    friend bool operator>=(iterator const & lhs, iterator const & rhs) noexcept
+    {
+        return lhs.position >= rhs.position;
+    }
+    //!\}
+
+    //!\brief Pre-increment.
+    iterator & operator++() noexcept
+    {
+        // Moves the last position of the current k-mer into the prefix of the next one.
+        prefix_hash = ((prefix_hash << bits_per_letter) | rank_at(position + shape_.size() - 1u)) & prefix_mask();
+        ++position;
+        return *this;
+    }
+
+    //!\brief Post-increment.
+    iterator operator++(int) noexcept
+    {
+        iterator tmp{*this};
+        ++(*this);
+        return tmp;
+    }
+
+    //!\brief Pre-decrement.
+    iterator & operator--() noexcept
+    {
+        --position;
+        hash_prefix();
+        return *this;
+    }
+
+    //!\brief Post-decrement.
+    iterator operator--(int) noexcept
+    {
+        iterator tmp{*this};
+        --(*this);
+        return tmp;
+    }
+
+    //!\brief Forward this iterator.
+    iterator & operator+=(difference_type const skip) noexcept
+    {
+        position += skip;
+        hash_prefix();
+        return *this;
+    }
+
+    //!\brief Forward copy of this iterator.
+    iterator operator+(difference_type const skip) const noexcept
+    {
+        iterator tmp{*this};
+        return tmp += skip;
+    }
+
+    //!\brief Non-member operator+ delegates to non-friend operator+.
+    friend iterator operator+(difference_type const skip, iterator const & it) noexcept
+    {
+        return it + skip;
+    }
+
+    //!\brief Decrement iterator by `skip`.
+    iterator & operator-=(difference_type const skip) noexcept
+    {
+        position -= skip;
+        hash_prefix();
+        return *this;
+    }
+
+    //!\brief Return decremented copy of this iterator.
+    iterator operator-(difference_type const skip) const noexcept
+    {
+        iterator tmp{*this};
+        return tmp -= skip;
+    }
+
+    //!\brief Return offset between two iterator's positions.
+    friend difference_type operator-(iterator const & lhs, iterator const & rhs) noexcept
+    {
+        return static_cast<difference_type>(lhs.position - rhs.position);
+    }
+
+    //!\brief Move the iterator by a given offset and return the corresponding hash value.
+    reference operator[](difference_type const n) const
+    {
+        return *(*this + n);
+    }
+
+    //!\brief Return the hash value.
+    value_type operator*() const noexcept
+    {
+        size_t const span = shape_.size();
+
+        if (extract_mask == 0u) // The span does not fit into 64 bit.
+            return hash_full();
+
+        size_t const span_hash = ((prefix_hash << bits_per_letter) | rank_at(position + span - 1u)) & span_mask;
+
+        if (extract_mask == span_mask) // ungapped
+            return span_hash;
+
+        return parallel_bit_extract(span_hash, extract_mask);
+    }
+
+private:
+    //!\brief The number of bits per letter.
+    static constexpr size_t bits_per_letter{packed_kmer_hash_traits<urng_t>::bits_per_letter};
+
+    //!\brief The words of the text.
+    uint64_t const * words{nullptr};
+
+    //!\brief The position of the leftmost letter of the k-mer.
+    size_t position{0};
+
+    //!\brief The ranks of all but the last position of the span of the shape, leftmost position first.
+    size_t prefix_hash{0};
+
+    //!\brief Selects all positions of the span of the shape.
+    size_t span_mask{0};
+
+    //!\brief Selects the positions of the span that are part of the hash. `0` if the span does not fit into 64 bit.
+    size_t extract_mask{0};
+
+    //!\brief The shape to use.
+    shape shape_;
+
+    //!\brief Selects all but the last position of the span of the shape.
+    size_t prefix_mask() const noexcept
+    {
+        return span_mask >> bits_per_letter;
+    }
+
+    //!\brief Returns the rank of the letter at position `i` of the text.
+    size_t rank_at(size_t const i) const noexcept
+    {
+        size_t const bit = i * bits_per_letter;
+        return (words[bit >> 6] >> (bit & 63u)) & low_bits(bits_per_letter);
+    }
+
+    //!\brief Calculates the prefix hash by explicitly looking at each position.
+    void hash_prefix() noexcept
+    {
+        prefix_hash = 0;
+
+        if (extract_mask == 0u)
+            return;
+
+        for (size_t i = 0; i < shape_.size() - 1u; ++i)
+            prefix_hash = (prefix_hash << bits_per_letter) | rank_at(position + i);
+    }
+
+    //!\brief Calculates the hash value by explicitly looking at each position of the shape.
+    size_t hash_full() const noexcept
+    {
+        size_t hash{0};
+
+        for (size_t i = 0; i < shape_.size() - 1u; ++i)
+            if (shape_[i])
+                hash = (hash << bits_per_letter) | rank_at(position + i);
+
+        return (hash << bits_per_letter) | rank_at(position + shape_.size() - 1u);
+    }
+};
+
 // ---------------------------------------------------------------------------------------------------------------------
 // kmer_hash_fn (adaptor definition)
 // ---------------------------------------------------------------------------------------------------------------------
@@ -706,7 +1182,10 @@ struct kmer_hash_fn
         static_assert(semialphabet<std::ranges::range_reference_t<urng_t>>,
                       "The range parameter to views::kmer_hash must be over elements of seqan3::semialphabet.");
 
-        return kmer_hash_view{std::forward<urng_t>(urange), shape_};
+        if constexpr (packed_kmer_hash_traits<std::views::all_t<urng_t>>::value)
+            return packed_kmer_hash_view{std::views::all(std::forward<urng_t>(urange)), shape_};
+        else
+            return kmer_hash_view{std::forward<urng_t>(urange), shape_};
     }
 };
 //![adaptor_def]
@@ -752,6 +1231,12 @@ namespace seqan3::views
  *
  * See the \link views views submodule documentation \endlink for detailed descriptions of the view properties.
  *
+ * ### Bitpacked sequences
+ *
+ * If `urange` is a seqan3::bitpacked_sequence (or a std::ranges::ref_view of one) over an alphabet whose size is a
+ * power of two, e.g. seqan3::bitpacked_sequence<seqan3::dna4>, the hash values are read directly from the packed
+ * words instead of letter by letter. This is considerably faster, in particular for gapped shapes.
+ *
  * \attention The Shape is defined from right to left! The mask 0b11111101 applied to "AGAAAATA" is
  * interpreted as "A.AAAATA" (and not "AGAAAA.A") and will return the hash value for "AAAAATA".
  *
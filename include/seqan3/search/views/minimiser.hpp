@@ -10,7 +10,9 @@
 #pragma once
 
 #include <algorithm>
-#include <deque>
+#include <tuple>
+#include <utility>
+#include <vector>
 
 #include <seqan3/core/detail/empty_type.hpp>
 #include <seqan3/core/range/detail/adaptor_from_functor.hpp>
@@ -265,10 +267,16 @@ public:
         requires const_range
         :
         minimiser_value{std::move(it.minimiser_value)},
+        minimiser_position{std::move(it.minimiser_position)},
+        window_size{std::move(it.window_size)},
+        window_end_position{std::move(it.window_end_position)},
         urng1_iterator{std::move(it.urng1_iterator)},
         urng1_sentinel{std::move(it.urng1_sentinel)},
         urng2_iterator{std::move(it.urng2_iterator)},
-        window_values{std::move(it.window_values)}
+        block_values{std::move(it.block_values)},
+        suffix_minima{std::move(it.suffix_minima)},
+        prefix_minimum{std::move(it.prefix_minimum)},
+        block_offset{std::move(it.block_offset)}
     {}
 
     /*!\brief Construct from begin and end iterators of a given range over std::totally_ordered values, and the number
@@ -292,10 +300,10 @@ public:
         urng1_sentinel{std::move(urng1_sentinel)},
         urng2_iterator{std::move(urng2_iterator)}
     {
-        size_t size = std::ranges::distance(urng1_iterator, urng1_sentinel);
-        window_size = std::min<size_t>(window_size, size);
+        size_t size = std::ranges::distance(this->urng1_iterator, this->urng1_sentinel);
+        this->window_size = std::min<size_t>(window_size, size);
 
-        window_first(window_size);
+        window_first();
     }
     //!\}
 
@@ -307,7 +315,7 @@ public:
     friend bool operator==(basic_iterator const & lhs, basic_iterator const & rhs)
     {
         return (lhs.urng1_iterator == rhs.urng1_iterator) && (rhs.urng2_iterator == rhs.urng2_iterator)
-            && (lhs.window_values.size() == rhs.window_values.size());
+            && (lhs.window_size == rhs.window_size);
     }
 
     //!\brief Compare to another basic_iterator.
@@ -362,6 +370,12 @@ public:
         return minimiser_value;
     }
 
+    //!\brief Return the position of the current minimiser within the underlying range(s).
+    size_t position() const noexcept
+    {
+        return minimiser_position;
+    }
+
     //!\brief Return the underlying iterator. It will point to the last element in the current window.
     constexpr urng1_iterator_t const & base() const & noexcept
     {
@@ -378,8 +392,14 @@ private:
     //!\brief The minimiser value.
     value_type minimiser_value{};
 
-    //!\brief The offset relative to the beginning of the window where the minimizer value is found.
-    size_t minimiser_position_offset{};
+    //!\brief The position of the minimiser value within the underlying range(s).
+    size_t minimiser_position{};
+
+    //!\brief The number of values in one window.
+    size_t window_size{};
+
+    //!\brief The position of the rightmost value of the current window within the underlying range(s).
+    size_t window_end_position{};
 
     //!\brief Iterator to the rightmost value of one window.
     urng1_iterator_t urng1_iterator{};
@@ -388,8 +408,22 @@ private:
     //!\brief Iterator to the rightmost value of one window of the second range.
     urng2_iterator_t urng2_iterator{};
 
-    //!\brief Stored values per window. It is necessary to store them, because a shift can remove the current minimiser.
-    std::deque<value_type> window_values{};
+    /*!\brief The values of the current block. The value at position `p` is stored at index `p % window_size`.
+     * \details
+     *
+     * The underlying range is divided into blocks of `window_size` values. Each window consists of a suffix of the
+     * previous block and a prefix of the current block. Since the minima of all suffixes of the previous block are
+     * computed once, when the block is complete, and the minimum of the prefix is updated in every step, the
+     * minimum of a window can be determined in constant time (van Herk/Gil-Werman algorithm). This gives
+     * amortised constant cost per shift of the window without any allocations.
+     */
+    std::vector<value_type> block_values{};
+    //!\brief The (rightmost) minimum of each suffix of the previous block, and its position.
+    std::vector<std::pair<value_type, size_t>> suffix_minima{};
+    //!\brief The (rightmost) minimum of the current block up to the current position, and its position.
+    std::pair<value_type, size_t> prefix_minimum{};
+    //!\brief The index of the current position within the current block.
+    size_t block_offset{};
 
     //!\brief Increments iterator by 1.
     void next_unique_minimiser()
@@ -415,28 +449,69 @@ private:
             ++urng2_iterator;
     }
 
+    //!\brief Adds the value at `window_end_position` to the current block.
+    void push_value(value_type const & value)
+    {
+        if (block_offset == window_size) // The block is complete.
+        {
+            // Ties are resolved to the right, like in the first window.
+            size_t position = window_end_position - 1u;
+            suffix_minima[window_size - 1u] = {block_values[window_size - 1u], position};
+
+            for (size_t i = window_size - 1u; i > 0u; --i)
+            {
+                --position;
+                suffix_minima[i - 1u] =
+                    (block_values[i - 1u] < suffix_minima[i].first) ? std::pair{block_values[i - 1u], position}
+                                                                    : suffix_minima[i];
+            }
+
+            block_offset = 0u;
+        }
+
+        block_values[block_offset] = value;
+
+        if (block_offset == 0u || !(prefix_minimum.first < value))
+            prefix_minimum = {value, window_end_position};
+
+        ++block_offset;
+    }
+
+    //!\brief Returns the rightmost minimum of the current window and its position.
+    std::pair<value_type, size_t> const & window_minimum() const
+    {
+        // The window starts at index `block_offset` of the previous block, or covers exactly the current block.
+        if (block_offset < window_size && suffix_minima[block_offset].first < prefix_minimum.first)
+            return suffix_minima[block_offset];
+
+        return prefix_minimum;
+    }
+
     //!\brief Calculates minimisers for the first window.
-    void window_first(size_t const window_size)
+    void window_first()
     {
         if (window_size == 0u)
             return;
 
+        block_values.resize(window_size);
+        suffix_minima.resize(window_size);
+
         for (size_t i = 0u; i < window_size - 1u; ++i)
         {
-            window_values.push_back(window_value());
+            push_value(window_value());
             advance_window();
+            ++window_end_position;
         }
-        window_values.push_back(window_value());
-        auto minimiser_it = std::ranges::min_element(window_values, std::less_equal<value_type>{});
-        minimiser_value = *minimiser_it;
-        minimiser_position_offset = std::distance(std::begin(window_values), minimiser_it);
+        push_value(window_value());
+
+        std::tie(minimiser_value, minimiser_position) = window_minimum();
     }
 
     /*!\brief Calculates the next minimiser value.
      * \returns True, if new minimiser is found or end is reached. Otherwise returns false.
      * \details
-     * For the following windows, we remove the first window value (is now not in window_values) and add the new
-     * value that results from the window shifting.
+     * For the following windows, we add the new value that results from the window shifting. Only if the current
+     * minimiser left the window, the minimum of the window needs to be determined.
      */
     bool next_minimiser()
     {
@@ -445,26 +520,22 @@ private:
             return true;
 
         value_type const new_value = window_value();
+        ++window_end_position;
+        push_value(new_value);
 
-        window_values.pop_front();
-        window_values.push_back(new_value);
-
-        if (minimiser_position_offset == 0)
+        if (minimiser_position + window_size == window_end_position)
         {
-            auto minimiser_it = std::ranges::min_element(window_values, std::less_equal<value_type>{});
-            minimiser_value = *minimiser_it;
-            minimiser_position_offset = std::distance(std::begin(window_values), minimiser_it);
+            std::tie(minimiser_value, minimiser_position) = window_minimum();
             return true;
         }
 
         if (new_value < minimiser_value)
         {
             minimiser_value = new_value;
-            minimiser_position_offset = window_values.size() - 1;
+            minimiser_position = window_end_position;
             return true;
         }
 
-        --minimiser_position_offset;
         return false;
     }
 };
@@ -11,6 +11,7 @@
 
 #include <seqan3/alphabet/views/complement.hpp>
 #include <seqan3/core/detail/strong_type.hpp>
+#include <seqan3/search/views/canonical_kmer_hash.hpp>
 #include <seqan3/search/views/kmer_hash.hpp>
 #include <seqan3/search/views/minimiser.hpp>
 
@@ -85,6 +86,27 @@ struct minimiser_hash_fn
         if (shape.size() > window_size.get())
             throw std::invalid_argument{"The size of the shape cannot be greater than the window size."};
 
+        if constexpr (canonical_kmer_hashable<std::ranges::range_value_t<urng_t>>)
+        {
+            // Hashes both strands in a single pass and does not need a bidirectional range.
+            return seqan3::detail::minimiser_view{
+                canonical_kmer_hash_view{std::forward<urng_t>(urange), shape, seed.get()},
+                window_size.get() - shape.size() + 1};
+        }
+        else
+        {
+            return minimiser_of_both_strands(std::forward<urng_t>(urange), shape, window_size, seed);
+        }
+    }
+
+private:
+    //!\brief Computes the minimisers by hashing the forward strand and the reverse complement strand separately.
+    template <std::ranges::range urng_t>
+    static auto minimiser_of_both_strands(urng_t && urange,
+                                          shape const & shape,
+                                          window_size const window_size,
+                                          seed const seed)
+    {
         auto forward_strand = std::forward<urng_t>(urange) | seqan3::views::kmer_hash(shape)
                             | std::views::transform(
                                   [seed](uint64_t i)
@@ -151,6 +173,11 @@ namespace seqan3::views
  * order. The user can change the seed to any other value he or she thinks is useful. A seed of 0 is returning the
  * lexicographical order.
  *
+ * If the alphabet size of `urange` is a power of two, e.g. seqan3::dna4, both strands are hashed in a single pass via
+ * seqan3::views::canonical_kmer_hash. Otherwise, the reverse complement strand is hashed separately, which requires
+ * `urange` to be a std::ranges::bidirectional_range. Gapped shapes whose span does not fit into 64 bits are hashed
+ * letter by letter, as in seqan3::views::kmer_hash.
+ *
  * \sa seqan3::views::minimiser_view
  *
  * \attention
@@ -0,0 +1,496 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \author Enrico Seiler <enrico.seiler AT fu-berlin.de>
+ * \brief Provides seqan3::views::strobemer.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#include <seqan3/search/views/kmer_hash.hpp>
+#include <seqan3/search/views/minimiser_hash.hpp>
+
+namespace seqan3
+{
+/*!\brief The range of offsets, relative to the first strobe, in which the second strobe of a strobemer is searched.
+ * \ingroup search_views
+ */
+struct strobe_window
+{
+    //!\brief The smallest offset of the second strobe.
+    size_t min_offset;
+    //!\brief The largest offset of the second strobe.
+    size_t max_offset;
+};
+} // namespace seqan3
+
+namespace seqan3::detail
+{
+// ---------------------------------------------------------------------------------------------------------------------
+// strobemer_view class
+// ---------------------------------------------------------------------------------------------------------------------
+
+/*!\brief The type returned by seqan3::views::strobemer.
+ * \tparam urng_t The type of the range of k-mer values, must model std::ranges::forward_range and the reference type
+ *                must be convertible to `uint64_t`.
+ * \implements std::ranges::view
+ * \ingroup search_views
+ *
+ * \details
+ *
+ * For the i-th k-mer value \f$h_i\f$, the second strobe \f$h_j\f$ is the value with
+ * \f$j \in [i + w_{min}, \min(i + w_{max}, n - 1)]\f$ that minimises \f$h_i \oplus h_j \oplus seed\f$, and the
+ * returned value is \f$h_i / 2 + h_j / 3\f$.
+ *
+ * See seqan3::views::strobemer for a detailed explanation on strobemers.
+ *
+ * \note Most members of this class are generated by std::ranges::view_interface which is not yet documented here.
+ */
+template <std::ranges::view urng_t>
+class strobemer_view : public std::ranges::view_interface<strobemer_view<urng_t>>
+{
+private:
+    static_assert(std::ranges::forward_range<urng_t>, "The strobemer_view only works on forward_ranges.");
+    static_assert(std::convertible_to<std::ranges::range_reference_t<urng_t>, uint64_t>,
+                  "The reference type of the underlying range must be convertible to uint64_t.");
+
+    //!\brief The range of k-mer values.
+    urng_t urange{};
+    //!\brief The offsets of the second strobe.
+    strobe_window window{};
+    //!\brief The seed used for selecting the second strobe.
+    uint64_t seed{};
+
+    template <bool const_range>
+    class basic_iterator;
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    strobemer_view()
+        requires std::default_initializable<urng_t>
+    = default;                                                        //!< Defaulted.
+    strobemer_view(strobemer_view const & rhs) = default;             //!< Defaulted.
+    strobemer_view(strobemer_view && rhs) = default;                  //!< Defaulted.
+    strobemer_view & operator=(strobemer_view const & rhs) = default; //!< Defaulted.
+    strobemer_view & operator=(strobemer_view && rhs) = default;      //!< Defaulted.
+    ~strobemer_view() = default;                                      //!< Defaulted.
+
+    /*!\brief Construct from a view of k-mer values, the offsets of the second strobe and a seed.
+     * \param[in] urange The k-mer values.
+     * \param[in] window The offsets of the second strobe.
+     * \param[in] seed   The seed used for selecting the second strobe.
+     * \throws std::invalid_argument if `window.min_offset` is 0 or greater than `window.max_offset`.
+     */
+    strobemer_view(urng_t urange, strobe_window const window, uint64_t const seed = 0u) :
+        urange{std::move(urange)},
+        window{window},
+        seed{seed}
+    {
+        if (window.min_offset == 0u || window.min_offset > window.max_offset)
+            throw std::invalid_argument{"The strobe window must satisfy 0 < min_offset <= max_offset."};
+    }
+
+    /*!\brief Construct from a non-view that can be view-wrapped, the offsets of the second strobe and a seed.
+     * \tparam other_urng_t The type of another urange. Must model std::ranges::viewable_range and be constructible
+     *                      from urng_t.
+     * \param[in] urange The k-mer values.
+     * \param[in] window The offsets of the second strobe.
+     * \param[in] seed   The seed used for selecting the second strobe.
+     * \throws std::invalid_argument if `window.min_offset` is 0 or greater than `window.max_offset`.
+     */
+    template <typename other_urng_t>
+        requires (std::ranges::viewable_range<other_urng_t>
+                  && std::constructible_from<urng_t, std::ranges::ref_view<std::remove_reference_t<other_urng_t>>>)
+    strobemer_view(other_urng_t && urange, strobe_window const window, uint64_t const seed = 0u) :
+        strobemer_view{std::views::all(std::forward<other_urng_t>(urange)), window, seed}
+    {}
+    //!\}
+
+    /*!\name Iterators
+     * \{
+     */
+    /*!\brief Returns an iterator to the first element of the range.
+     * \returns Iterator to the first element.
+     *
+     * \details
+     *
+     * ### Complexity
+     *
+     * Linear in `window.max_offset`.
+     *
+     * ### Exceptions
+     *
+     * Strong exception guarantee.
+     */
+    basic_iterator<false> begin()
+    {
+        return {std::ranges::begin(urange), std::ranges::end(urange), window, seed};
+    }
+
+    //!\copydoc begin()
+    basic_iterator<true> begin() const
+        requires const_iterable_range<urng_t>
+    {
+        return {std::ranges::begin(urange), std::ranges::end(urange), window, seed};
+    }
+
+    /*!\brief Returns the sentinel of the range.
+     * \returns std::default_sentinel.
+     */
+    std::default_sentinel_t end() const noexcept
+    {
+        return {};
+    }
+    //!\}
+
+    /*!\brief Returns the size of the range, if the underlying range is a std::ranges::sized_range.
+     * \returns Size of range.
+     */
+    auto size()
+        requires std::ranges::sized_range<urng_t>
+    {
+        using size_type = std::ranges::range_size_t<urng_t>;
+        size_type const kmer_count = std::ranges::size(urange);
+        return (kmer_count > window.min_offset) ? kmer_count - static_cast<size_type>(window.min_offset)
+                                                : size_type{};
+    }
+
+    //!\copydoc size()
+    auto size() const
+        requires std::ranges::sized_range<urng_t const>
+    {
+        using size_type = std::ranges::range_size_t<urng_t const>;
+        size_type const kmer_count = std::ranges::size(urange);
+        return (kmer_count > window.min_offset) ? kmer_count - static_cast<size_type>(window.min_offset)
+                                                : size_type{};
+    }
+};
+
+//!\brief Iterator for calculating strobemers.
+template <std::ranges::view urng_t>
+template <bool const_range>
+class strobemer_view<urng_t>::basic_iterator
+{
+private:
+    //!\brief The iterator type of the underlying range.
+    using urng_iterator_t = maybe_const_iterator_t<const_range, urng_t>;
+    //!\brief The sentinel type of the underlying range.
+    using urng_sentinel_t = maybe_const_sentinel_t<const_range, urng_t>;
+
+    template <bool>
+    friend class basic_iterator;
+
+public:
+    /*!\name Associated types
+     * \{
+     */
+    //!\brief Type for distances between iterators.
+    using difference_type = std::ranges::range_difference_t<urng_t>;
+    //!\brief Value type of this iterator.
+    using value_type = uint64_t;
+    //!\brief The pointer type.
+    using pointer = void;
+    //!\brief Reference to `value_type`.
+    using reference = value_type;
+    //!\brief Tag this class as a forward iterator.
+    using iterator_category = std::forward_iterator_tag;
+    //!\brief Tag this class as a forward iterator.
+    using iterator_concept = iterator_category;
+    //!\}
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    basic_iterator() = default;                                   //!< Defaulted.
+    basic_iterator(basic_iterator const &) = default;             //!< Defaulted.
+    basic_iterator(basic_iterator &&) = default;                  //!< Defaulted.
+    basic_iterator & operator=(basic_iterator const &) = default; //!< Defaulted.
+    basic_iterator & operator=(basic_iterator &&) = default;      //!< Defaulted.
+    ~basic_iterator() = default;                                  //!< Defaulted.
+
+    //!\brief Allow iterator on a const range to be constructible from an iterator over a non-const range.
+    basic_iterator(basic_iterator<!const_range> const & it)
+        requires const_range
+        :
+        urng_iterator{std::move(it.urng_iterator)},
+        urng_sentinel{std::move(it.urng_sentinel)},
+        window{std::move(it.window)},
+        seed{std::move(it.seed)},
+        lookahead{std::move(it.lookahead)},
+        lookahead_begin{std::move(it.lookahead_begin)},
+        lookahead_size{std::move(it.lookahead_size)},
+        position{std::move(it.position)},
+        strobemer_value{std::move(it.strobemer_value)}
+    {}
+
+    /*!\brief Construct from begin and end iterators of a given range over k-mer values, the offsets of the second
+     *        strobe and a seed.
+     * \param[in] urng_iterator Iterator pointing to the first k-mer value.
+     * \param[in] urng_sentinel Iterator pointing to the last position.
+     * \param[in] window        The offsets of the second strobe.
+     * \param[in] seed          The seed used for selecting the second strobe.
+     */
+    basic_iterator(urng_iterator_t urng_iterator,
+                   urng_sentinel_t urng_sentinel,
+                   strobe_window const window,
+                   uint64_t const seed) :
+        urng_iterator{std::move(urng_iterator)},
+        urng_sentinel{std::move(urng_sentinel)},
+        window{window},
+        seed{seed},
+        lookahead(2u * (window.max_offset + 1u))
+    {
+        while (lookahead_size <= window.max_offset && this->urng_iterator != this->urng_sentinel)
+        {
+            store(lookahead_size++, *this->urng_iterator);
+            ++this->urng_iterator;
+        }
+
+        compute_strobemer();
+    }
+    //!\}
+
+    //!\anchor basic_iterator_comparison_strobemer
+    //!\name Comparison operators
+    //!\{
+
+    //!\brief Compare to another basic_iterator.
+    friend bool operator==(basic_iterator const & lhs, basic_iterator const & rhs)
+    {
+        return lhs.position == rhs.position;
+    }
+
+    //!\brief Compare to the sentinel of the strobemer_view.
+    friend bool operator==(basic_iterator const & lhs, std::default_sentinel_t const &)
+    {
+        return lhs.lookahead_size <= lhs.window.min_offset;
+    }
+    //!\}
+
+    //!\brief Pre-increment.
+    basic_iterator & operator++() noexcept
+    {
+        // Replaces the first strobe by the next k-mer value, if there is one. Otherwise, the lookahead shrinks.
+        if (urng_iterator != urng_sentinel)
+        {
+            store(lookahead_begin, *urng_iterator);
+            ++urng_iterator;
+        }
+        else
+        {
+            --lookahead_size;
+        }
+
+        lookahead_begin = (lookahead_begin == window.max_offset) ? 0u : lookahead_begin + 1u;
+        ++position;
+        compute_strobemer();
+        return *this;
+    }
+
+    //!\brief Post-increment.
+    basic_iterator operator++(int) noexcept
+    {
+        basic_iterator tmp{*this};
+        ++(*this);
+        return tmp;
+    }
+
+    //!\brief Return the strobemer value.
+    value_type operator*() const noexcept
+    {
+        return strobemer_value;
+    }
+
+private:
+    //!\brief Iterator to the first k-mer value that has not been added to the lookahead.
+    urng_iterator_t urng_iterator{};
+    //!\brief Sentinel of the k-mer values.
+    urng_sentinel_t urng_sentinel{};
+
+    //!\brief The offsets of the second strobe.
+    strobe_window window{};
+    //!\brief The seed used for selecting the second strobe.
+    uint64_t seed{};
+
+    /*!\brief The k-mer values at the offsets `0, ..., window.max_offset` from the first strobe.
+     * \details
+     *
+     * A ring buffer of capacity `window.max_offset + 1` in which every value is stored twice, at index `i` and
+     * `i + window.max_offset + 1`. Hence, the values starting at `lookahead_begin` are contiguous.
+     * At the end of the underlying range, it contains fewer values.
+     */
+    std::vector<uint64_t> lookahead{};
+    //!\brief The index of the first strobe in the lookahead.
+    size_t lookahead_begin{};
+    //!\brief The number of values in the lookahead.
+    size_t lookahead_size{};
+
+    //!\brief The position of the first strobe.
+    size_t position{};
+    //!\brief The current strobemer value.
+    uint64_t strobemer_value{};
+
+    //!\brief Stores a value at the given index of the ring buffer and its copy.
+    void store(size_t const index, uint64_t const value) noexcept
+    {
+        lookahead[index] = value;
+        lookahead[index + window.max_offset + 1u] = value;
+    }
+
+    /*!\brief Selects the second strobe and computes the strobemer value.
+     * \details
+     *
+     * Since the order of the candidates for the second strobe depends on the first strobe, the candidates of
+     * consecutive strobemers cannot be shared and all `window.max_offset - window.min_offset + 1` candidates are
+     * compared.
+     */
+    void compute_strobemer() noexcept
+    {
+        if (lookahead_size <= window.min_offset)
+            return;
+
+        uint64_t const * const values = lookahead.data() + lookahead_begin;
+        uint64_t const first_strobe = values[0];
+        uint64_t const first_key = first_strobe ^ seed;
+
+        // The smallest key is searched first and then its leftmost occurrence. Both loops can be vectorised.
+        uint64_t min_key = std::numeric_limits<uint64_t>::max();
+        for (size_t offset = window.min_offset; offset < lookahead_size; ++offset)
+            min_key = std::min(min_key, first_key ^ values[offset]);
+
+        size_t second_offset = window.min_offset;
+        while ((first_key ^ values[second_offset]) != min_key)
+            ++second_offset;
+
+        uint64_t const second_strobe = values[second_offset];
+        strobemer_value = first_strobe / 2u + second_strobe / 3u;
+    }
+};
+
+//!\brief A deduction guide for the view class template.
+template <std::ranges::viewable_range rng_t>
+strobemer_view(rng_t &&, strobe_window const, uint64_t const = 0u) -> strobemer_view<std::views::all_t<rng_t>>;
+
+// ---------------------------------------------------------------------------------------------------------------------
+// strobemer_fn (adaptor definition)
+// ---------------------------------------------------------------------------------------------------------------------
+
+//!\brief seqan3::views::strobemer's range adaptor object type (non-closure).
+//!\ingroup search_views
+struct strobemer_fn
+{
+    //!\brief Store the shape and the strobe window and return a range adaptor closure object.
+    constexpr auto operator()(shape const & shape, strobe_window const window) const
+    {
+        return adaptor_from_functor{*this, shape, window};
+    }
+
+    //!\brief Store the shape, the strobe window and the seed and return a range adaptor closure object.
+    constexpr auto operator()(shape const & shape, strobe_window const window, seed const seed) const
+    {
+        return adaptor_from_functor{*this, shape, window, seed};
+    }
+
+    /*!\brief Computes the strobemers of a range.
+     * \param[in] urange The input range to process. Must model std::ranges::viewable_range and the reference type of
+     *                   the range must model seqan3::semialphabet.
+     * \param[in] shape  The seqan3::shape to use for hashing the strobes.
+     * \param[in] window The offsets of the second strobe.
+     * \param[in] seed   The seed used for selecting the second strobe.
+     * \throws std::invalid_argument if `window.min_offset` is 0 or greater than `window.max_offset`.
+     * \returns A range of strobemer values.
+     */
+    template <std::ranges::range urng_t>
+    constexpr auto operator()(urng_t && urange,
+                              shape const & shape,
+                              strobe_window const window,
+                              seed const seed = seqan3::seed{0x8F'3F'73'B5'CF'1C'9A'DE}) const
+    {
+        static_assert(std::ranges::viewable_range<urng_t>,
+                      "The range parameter to views::strobemer cannot be a temporary of a non-view range.");
+        static_assert(std::ranges::forward_range<urng_t>,
+                      "The range parameter to views::strobemer must model std::ranges::forward_range.");
+        static_assert(semialphabet<std::ranges::range_reference_t<urng_t>>,
+                      "The range parameter to views::strobemer must be over elements of seqan3::semialphabet.");
+
+        return strobemer_view{std::forward<urng_t>(urange) | seqan3::views::kmer_hash(shape), window, seed.get()};
+    }
+};
+
+} // namespace seqan3::detail
+
+namespace seqan3::views
+{
+/*!\brief Computes the randstrobes of order 2 of a range.
+ * \tparam urng_t       The type of the range being processed. See below for requirements. [template parameter is
+ *                      omitted in pipe notation]
+ * \param[in] urange    The range being processed. [parameter is omitted in pipe notation]
+ * \param[in] shape     The seqan3::shape that determines how the strobes are hashed, see seqan3::views::kmer_hash.
+ * \param[in] window    The seqan3::strobe_window, i.e. the offsets relative to the first strobe in which the second
+ *                      strobe is searched.
+ * \param[in] seed      The seed used for selecting the second strobe. Default: 0x8F3F73B5CF1C9ADE.
+ * \returns             A range of `uint64_t` where each value is a strobemer value. See below for the properties of the
+ *                      returned range.
+ * \throws std::invalid_argument if `window.min_offset` is 0 or greater than `window.max_offset`.
+ * \ingroup search_views
+ *
+ * \details
+ *
+ * A strobemer links two k-mers, the *strobes*, that are located at a variable distance
+ * ([Sahlin, 2021](https://doi.org/10.1101/gr.275648.121)). Because the second strobe may be chosen at different
+ * offsets, a strobemer is conserved even if there is an insertion or deletion between the two strobes.
+ *
+ * Every k-mer \f$h_i\f$ that has at least `window.min_offset` k-mers to its right is the first strobe of one
+ * strobemer. Its second strobe is the k-mer \f$h_j\f$ with
+ * \f$i + w_{min} \leq j \leq \min(i + w_{max}, n - 1)\f$ that minimises \f$h_i \oplus h_j \oplus seed\f$. If there
+ * are several, the leftmost one is used. The returned value is \f$h_i / 2 + h_j / 3\f$, i.e. it is different for
+ * \f$(h_i, h_j)\f$ and \f$(h_j, h_i)\f$.
+ *
+ * Each strobemer is computed from a lookahead buffer of the next `window.max_offset` k-mer values. Since the order of
+ * the candidates depends on the first strobe, no candidate order can be shared between consecutive strobemers, and
+ * computing a strobemer takes `window.max_offset - window.min_offset + 1` comparisons. For a fixed window, the cost is
+ * hence linear in the length of the range.
+ *
+ * \attention
+ * Be aware of the requirements of the seqan3::views::kmer_hash view.
+ *
+ * ### View properties
+ *
+ * | Concepts and traits              | `urng_t` (underlying range type)   | `rrng_t` (returned range type)   |
+ * |----------------------------------|:----------------------------------:|:--------------------------------:|
+ * | std::ranges::input_range         | *required*                         | *preserved*                      |
+ * | std::ranges::forward_range       | *required*                         | *preserved*                      |
+ * | std::ranges::bidirectional_range |                                    | *lost*                           |
+ * | std::ranges::random_access_range |                                    | *lost*                           |
+ * | std::ranges::contiguous_range    |                                    | *lost*                           |
+ * |                                  |                                    |                                  |
+ * | std::ranges::viewable_range      | *required*                         | *guaranteed*                     |
+ * | std::ranges::view                |                                    | *guaranteed*                     |
+ * | std::ranges::sized_range         |                                    | *preserved*                      |
+ * | std::ranges::common_range        |                                    | *lost*                           |
+ * | std::ranges::output_range        |                                    | *lost*                           |
+ * | seqan3::const_iterable_range     |                                    | *preserved*                      |
+ * |                                  |                                    |                                  |
+ * | std::ranges::range_reference_t   | seqan3::semialphabet               | `uint64_t`                       |
+ *
+ * See the \link views views submodule documentation \endlink for detailed descriptions of the view properties.
+ *
+ * ### Example
+ *
+ * \include test/snippet/search/views/strobemer.cpp
+ *
+ * \hideinitializer
+ *
+ * \experimentalapi{Experimental since version 3.4.}
+ */
+inline constexpr auto strobemer = detail::strobemer_fn{};
+
+} // namespace seqan3::views
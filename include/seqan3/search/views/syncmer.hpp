@@ -0,0 +1,560 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \author Enrico Seiler <enrico.seiler AT fu-berlin.de>
+ * \brief Provides seqan3::views::syncmer.
+ */
+
+#pragma once
+
+#include <vector>
+
+#include <seqan3/core/detail/strong_type.hpp>
+#include <seqan3/search/views/kmer_hash.hpp>
+#include <seqan3/search/views/minimiser_hash.hpp>
+
+namespace seqan3
+{
+//!\brief strong_type for the position of the smallest s-mer of an open syncmer.
+//!\ingroup search_views
+struct syncmer_offset : seqan3::detail::strong_type<uint8_t, syncmer_offset>
+{
+    using seqan3::detail::strong_type<uint8_t, syncmer_offset>::strong_type;
+};
+} // namespace seqan3
+
+namespace seqan3::detail
+{
+// ---------------------------------------------------------------------------------------------------------------------
+// syncmer_view class
+// ---------------------------------------------------------------------------------------------------------------------
+
+/*!\brief The type returned by seqan3::views::syncmer.
+ * \tparam kmer_urng_t The type of the range of k-mer values, must model std::ranges::forward_range.
+ * \tparam smer_urng_t The type of the range of s-mer values, must model std::ranges::forward_range, the reference type
+ *                     must model std::totally_ordered.
+ * \implements std::ranges::view
+ * \ingroup search_views
+ *
+ * \details
+ *
+ * The i-th k-mer value is returned if the smallest of the s-mer values `i, ..., i + k - s` (the leftmost one if
+ * there are several) is located at one of the offsets given by `offset_mask`. Bit `j` of `offset_mask` is set if
+ * offset `j` is allowed.
+ *
+ * See seqan3::views::syncmer for a detailed explanation on syncmers.
+ *
+ * \note Most members of this class are generated by std::ranges::view_interface which is not yet documented here.
+ */
+template <std::ranges::view kmer_urng_t, std::ranges::view smer_urng_t>
+class syncmer_view : public std::ranges::view_interface<syncmer_view<kmer_urng_t, smer_urng_t>>
+{
+private:
+    static_assert(std::ranges::forward_range<kmer_urng_t>, "The syncmer_view only works on forward_ranges.");
+    static_assert(std::ranges::forward_range<smer_urng_t>, "The syncmer_view only works on forward_ranges.");
+    static_assert(std::totally_ordered<std::ranges::range_reference_t<smer_urng_t>>,
+                  "The reference type of the s-mer range must model std::totally_ordered.");
+
+    //!\brief Whether the given ranges are const_iterable.
+    static constexpr bool const_iterable =
+        seqan3::const_iterable_range<kmer_urng_t> && seqan3::const_iterable_range<smer_urng_t>;
+
+    //!\brief The range of k-mer values.
+    kmer_urng_t kmer_urange{};
+    //!\brief The range of s-mer values.
+    smer_urng_t smer_urange{};
+
+    //!\brief The number of s-mers in one k-mer, i.e. `k - s + 1`.
+    size_t smers_per_kmer{};
+    //!\brief Bit `j` is set if the smallest s-mer may be located at offset `j`.
+    uint64_t offset_mask{};
+
+    template <bool const_range>
+    class basic_iterator;
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    syncmer_view()
+        requires std::default_initializable<kmer_urng_t> && std::default_initializable<smer_urng_t>
+    = default;                                                      //!< Defaulted.
+    syncmer_view(syncmer_view const & rhs) = default;             //!< Defaulted.
+    syncmer_view(syncmer_view && rhs) = default;                  //!< Defaulted.
+    syncmer_view & operator=(syncmer_view const & rhs) = default; //!< Defaulted.
+    syncmer_view & operator=(syncmer_view && rhs) = default;      //!< Defaulted.
+    ~syncmer_view() = default;                                    //!< Defaulted.
+
+    /*!\brief Construct from the k-mer and s-mer values, the number of s-mers per k-mer and the allowed offsets.
+     * \param[in] kmer_urange    The k-mer values.
+     * \param[in] smer_urange    The s-mer values. Must contain `smers_per_kmer - 1` more values than `kmer_urange`.
+     * \param[in] smers_per_kmer The number of s-mers in one k-mer. Must be in `[1, 64]`.
+     * \param[in] offset_mask    Bit `j` is set if the smallest s-mer may be located at offset `j`.
+     * \throws std::invalid_argument if `smers_per_kmer` is not in `[1, 64]`.
+     */
+    syncmer_view(kmer_urng_t kmer_urange,
+                 smer_urng_t smer_urange,
+                 size_t const smers_per_kmer,
+                 uint64_t const offset_mask) :
+        kmer_urange{std::move(kmer_urange)},
+        smer_urange{std::move(smer_urange)},
+        smers_per_kmer{smers_per_kmer},
+        offset_mask{offset_mask}
+    {
+        if (smers_per_kmer == 0u || smers_per_kmer > 64u)
+            throw std::invalid_argument{"The number of s-mers per k-mer must be in [1, 64]."};
+    }
+    //!\}
+
+    /*!\name Iterators
+     * \{
+     */
+    /*!\brief Returns an iterator to the first element of the range.
+     * \returns Iterator to the first element.
+     *
+     * \details
+     *
+     * ### Complexity
+     *
+     * Linear in the number of values up to the first syncmer.
+     *
+     * ### Exceptions
+     *
+     * Strong exception guarantee.
+     */
+    basic_iterator<false> begin()
+    {
+        return {std::ranges::begin(kmer_urange),
+                std::ranges::end(kmer_urange),
+                std::ranges::begin(smer_urange),
+                smers_per_kmer,
+                offset_mask};
+    }
+
+    //!\copydoc begin()
+    basic_iterator<true> begin() const
+        requires const_iterable
+    {
+        return {std::ranges::begin(kmer_urange),
+                std::ranges::end(kmer_urange),
+                std::ranges::begin(smer_urange),
+                smers_per_kmer,
+                offset_mask};
+    }
+
+    /*!\brief Returns the sentinel of the range.
+     * \returns std::default_sentinel.
+     */
+    std::default_sentinel_t end() const noexcept
+    {
+        return {};
+    }
+    //!\}
+};
+
+//!\brief Iterator for calculating syncmers.
+template <std::ranges::view kmer_urng_t, std::ranges::view smer_urng_t>
+template <bool const_range>
+class syncmer_view<kmer_urng_t, smer_urng_t>::basic_iterator
+{
+private:
+    //!\brief The iterator type of the k-mer range.
+    using kmer_iterator_t = maybe_const_iterator_t<const_range, kmer_urng_t>;
+    //!\brief The sentinel type of the k-mer range.
+    using kmer_sentinel_t = maybe_const_sentinel_t<const_range, kmer_urng_t>;
+    //!\brief The iterator type of the s-mer range.
+    using smer_iterator_t = maybe_const_iterator_t<const_range, smer_urng_t>;
+    //!\brief The type of the s-mer values.
+    using smer_value_t = std::ranges::range_value_t<smer_urng_t>;
+
+    template <bool>
+    friend class basic_iterator;
+
+public:
+    /*!\name Associated types
+     * \{
+     */
+    //!\brief Type for distances between iterators.
+    using difference_type = std::ranges::range_difference_t<kmer_urng_t>;
+    //!\brief Value type of this iterator.
+    using value_type = std::ranges::range_value_t<kmer_urng_t>;
+    //!\brief The pointer type.
+    using pointer = void;
+    //!\brief Reference to `value_type`.
+    using reference = value_type;
+    //!\brief Tag this class as a forward iterator.
+    using iterator_category = std::forward_iterator_tag;
+    //!\brief Tag this class as a forward iterator.
+    using iterator_concept = iterator_category;
+    //!\}
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    basic_iterator() = default;                                   //!< Defaulted.
+    basic_iterator(basic_iterator const &) = default;             //!< Defaulted.
+    basic_iterator(basic_iterator &&) = default;                  //!< Defaulted.
+    basic_iterator & operator=(basic_iterator const &) = default; //!< Defaulted.
+    basic_iterator & operator=(basic_iterator &&) = default;      //!< Defaulted.
+    ~basic_iterator() = default;                                  //!< Defaulted.
+
+    //!\brief Allow iterator on a const range to be constructible from an iterator over a non-const range.
+    basic_iterator(basic_iterator<!const_range> const & it)
+        requires const_range
+        :
+        kmer_iterator{std::move(it.kmer_iterator)},
+        kmer_sentinel{std::move(it.kmer_sentinel)},
+        smer_iterator{std::move(it.smer_iterator)},
+        smers_per_kmer{std::move(it.smers_per_kmer)},
+        offset_mask{std::move(it.offset_mask)},
+        kmer_position{std::move(it.kmer_position)},
+        candidates{std::move(it.candidates)},
+        candidates_begin{std::move(it.candidates_begin)},
+        candidates_size{std::move(it.candidates_size)}
+    {}
+
+    /*!\brief Construct from the begin of the k-mer and s-mer values, the number of s-mers per k-mer and the allowed
+     *        offsets.
+     * \param[in] kmer_iterator  Iterator pointing to the first k-mer value.
+     * \param[in] kmer_sentinel  Sentinel of the k-mer values.
+     * \param[in] smer_iterator  Iterator pointing to the first s-mer value.
+     * \param[in] smers_per_kmer The number of s-mers in one k-mer.
+     * \param[in] offset_mask    Bit `j` is set if the smallest s-mer may be located at offset `j`.
+     */
+    basic_iterator(kmer_iterator_t kmer_iterator,
+                   kmer_sentinel_t kmer_sentinel,
+                   smer_iterator_t smer_iterator,
+                   size_t const smers_per_kmer,
+                   uint64_t const offset_mask) :
+        kmer_iterator{std::move(kmer_iterator)},
+        kmer_sentinel{std::move(kmer_sentinel)},
+        smer_iterator{std::move(smer_iterator)},
+        smers_per_kmer{smers_per_kmer},
+        offset_mask{offset_mask}
+    {
+        if (this->kmer_iterator == this->kmer_sentinel)
+            return;
+
+        candidates.resize(smers_per_kmer);
+
+        // The last s-mer of the first k-mer is added by next_syncmer().
+        for (size_t position = 0u; position + 1u < smers_per_kmer; ++position, ++this->smer_iterator)
+            push_candidate(*this->smer_iterator, position);
+
+        next_syncmer();
+    }
+    //!\}
+
+    //!\anchor basic_iterator_comparison_syncmer
+    //!\name Comparison operators
+    //!\{
+
+    //!\brief Compare to another basic_iterator.
+    friend bool operator==(basic_iterator const & lhs, basic_iterator const & rhs)
+    {
+        return lhs.kmer_iterator == rhs.kmer_iterator;
+    }
+
+    //!\brief Compare to the sentinel of the syncmer_view.
+    friend bool operator==(basic_iterator const & lhs, std::default_sentinel_t const &)
+    {
+        return lhs.kmer_iterator == lhs.kmer_sentinel;
+    }
+    //!\}
+
+    //!\brief Pre-increment.
+    basic_iterator & operator++() noexcept
+    {
+        ++kmer_iterator;
+        ++kmer_position;
+        next_syncmer();
+        return *this;
+    }
+
+    //!\brief Post-increment.
+    basic_iterator operator++(int) noexcept
+    {
+        basic_iterator tmp{*this};
+        ++(*this);
+        return tmp;
+    }
+
+    //!\brief Return the value of the syncmer.
+    value_type operator*() const noexcept
+    {
+        return *kmer_iterator;
+    }
+
+    //!\brief Return the underlying k-mer iterator. It points to the current syncmer.
+    constexpr kmer_iterator_t const & base() const & noexcept
+    {
+        return kmer_iterator;
+    }
+
+    //!\brief Return the underlying k-mer iterator. It points to the current syncmer.
+    constexpr kmer_iterator_t base() &&
+    {
+        return std::move(kmer_iterator);
+    }
+
+private:
+    //!\brief Iterator to the current k-mer.
+    kmer_iterator_t kmer_iterator{};
+    //!\brief Sentinel of the k-mer values.
+    kmer_sentinel_t kmer_sentinel{};
+    //!\brief Iterator to the first s-mer that has not been added to the candidates.
+    smer_iterator_t smer_iterator{};
+
+    //!\brief The number of s-mers in one k-mer.
+    size_t smers_per_kmer{};
+    //!\brief Bit `j` is set if the smallest s-mer may be located at offset `j`.
+    uint64_t offset_mask{};
+    //!\brief The position of the current k-mer.
+    size_t kmer_position{};
+
+    /*!\brief The s-mers of the current k-mer that may become the smallest one, and their positions.
+     * \details
+     *
+     * A ring buffer of capacity `smers_per_kmer` that holds a monotone queue: The values are strictly increasing from
+     * the front to the back. An s-mer is removed from the back, once an s-mer that is not larger is added, and from
+     * the front, once it leaves the k-mer. The front is the leftmost smallest s-mer of the current k-mer.
+     * Each s-mer is added and removed at most once, i.e. the amortised cost per k-mer is constant.
+     */
+    std::vector<std::pair<smer_value_t, size_t>> candidates{};
+    //!\brief The index of the front of the candidates.
+    size_t candidates_begin{};
+    //!\brief The number of candidates.
+    size_t candidates_size{};
+
+    //!\brief Returns the index of the candidate at `offset` from the front.
+    size_t candidate_index(size_t const offset) const noexcept
+    {
+        size_t const index = candidates_begin + offset;
+        return (index >= smers_per_kmer) ? index - smers_per_kmer : index;
+    }
+
+    //!\brief Adds an s-mer to the back of the candidates.
+    void push_candidate(smer_value_t const & value, size_t const position)
+    {
+        // Equal values are kept, such that the front is the leftmost smallest s-mer.
+        while (candidates_size > 0u && value < candidates[candidate_index(candidates_size - 1u)].first)
+            --candidates_size;
+
+        candidates[candidate_index(candidates_size)] = {value, position};
+        ++candidates_size;
+    }
+
+    //!\brief Advances to the next k-mer, starting with the current one, whose smallest s-mer is at an allowed offset.
+    void next_syncmer()
+    {
+        for (; kmer_iterator != kmer_sentinel; ++kmer_iterator, ++kmer_position)
+        {
+            // Removes the s-mer that left the k-mer.
+            if (candidates_size > 0u && candidates[candidates_begin].second < kmer_position)
+            {
+                candidates_begin = candidate_index(1u);
+                --candidates_size;
+            }
+
+            push_candidate(*smer_iterator, kmer_position + smers_per_kmer - 1u);
+            ++smer_iterator;
+
+            if ((offset_mask >> (candidates[candidates_begin].second - kmer_position)) & 1u)
+                return;
+        }
+    }
+};
+
+//!\brief A deduction guide for the view class template.
+template <std::ranges::viewable_range kmer_rng_t, std::ranges::viewable_range smer_rng_t>
+syncmer_view(kmer_rng_t &&, smer_rng_t &&, size_t const, uint64_t const)
+    -> syncmer_view<std::views::all_t<kmer_rng_t>, std::views::all_t<smer_rng_t>>;
+
+// ---------------------------------------------------------------------------------------------------------------------
+// syncmer_fn (adaptor definition)
+// ---------------------------------------------------------------------------------------------------------------------
+
+//!\brief seqan3::views::syncmer's range adaptor object type (non-closure).
+//!\ingroup search_views
+struct syncmer_fn
+{
+    //!\brief Store the k-mer and s-mer size and return a range adaptor closure object.
+    constexpr auto operator()(ungapped const kmer_size, ungapped const smer_size) const
+    {
+        return adaptor_from_functor{*this, kmer_size, smer_size};
+    }
+
+    //!\brief Store the k-mer and s-mer size and the seed and return a range adaptor closure object.
+    constexpr auto operator()(ungapped const kmer_size, ungapped const smer_size, seed const seed) const
+    {
+        return adaptor_from_functor{*this, kmer_size, smer_size, seed};
+    }
+
+    //!\brief Store the k-mer and s-mer size and the offset and return a range adaptor closure object.
+    constexpr auto operator()(ungapped const kmer_size, ungapped const smer_size, syncmer_offset const offset) const
+    {
+        return adaptor_from_functor{*this, kmer_size, smer_size, offset};
+    }
+
+    //!\brief Store the k-mer and s-mer size, the offset and the seed and return a range adaptor closure object.
+    constexpr auto
+    operator()(ungapped const kmer_size, ungapped const smer_size, syncmer_offset const offset, seed const seed) const
+    {
+        return adaptor_from_functor{*this, kmer_size, smer_size, offset, seed};
+    }
+
+    /*!\brief Computes the closed syncmers of a range.
+     * \param[in] urange    The input range to process. Must model std::ranges::viewable_range and the reference type
+     *                      of the range must model seqan3::semialphabet.
+     * \param[in] kmer_size The size of the k-mers.
+     * \param[in] smer_size The size of the s-mers.
+     * \param[in] seed      The seed to use for ordering the s-mers.
+     * \throws std::invalid_argument if the s-mer size is not in `[1, k]` or `k - s` is greater than 63.
+     * \returns A range of k-mer hash values.
+     */
+    template <std::ranges::range urng_t>
+    constexpr auto operator()(urng_t && urange,
+                              ungapped const kmer_size,
+                              ungapped const smer_size,
+                              seed const seed = seqan3::seed{0x8F'3F'73'B5'CF'1C'9A'DE}) const
+    {
+        validate(kmer_size, smer_size);
+        uint64_t const last_offset = kmer_size.value - smer_size.value;
+
+        return make_view(std::forward<urng_t>(urange), kmer_size, smer_size, (1ULL << last_offset) | 1u, seed);
+    }
+
+    /*!\brief Computes the open syncmers of a range.
+     * \param[in] urange    The input range to process. Must model std::ranges::viewable_range and the reference type
+     *                      of the range must model seqan3::semialphabet.
+     * \param[in] kmer_size The size of the k-mers.
+     * \param[in] smer_size The size of the s-mers.
+     * \param[in] offset    The position of the smallest s-mer within an open syncmer.
+     * \param[in] seed      The seed to use for ordering the s-mers.
+     * \throws std::invalid_argument if the s-mer size is not in `[1, k]`, `k - s` is greater than 63, or the offset is
+     *         greater than `k - s`.
+     * \returns A range of k-mer hash values.
+     */
+    template <std::ranges::range urng_t>
+    constexpr auto operator()(urng_t && urange,
+                              ungapped const kmer_size,
+                              ungapped const smer_size,
+                              syncmer_offset const offset,
+                              seed const seed = seqan3::seed{0x8F'3F'73'B5'CF'1C'9A'DE}) const
+    {
+        validate(kmer_size, smer_size);
+
+        if (offset.get() > kmer_size.value - smer_size.value)
+            throw std::invalid_argument{"The offset of an open syncmer must not be greater than k - s."};
+
+        return make_view(std::forward<urng_t>(urange), kmer_size, smer_size, 1ULL << offset.get(), seed);
+    }
+
+private:
+    //!\brief Checks that the s-mer size is in `[1, k]` and that a k-mer contains at most 64 s-mers.
+    static void validate(ungapped const kmer_size, ungapped const smer_size)
+    {
+        if (smer_size.value == 0u || smer_size.value > kmer_size.value)
+            throw std::invalid_argument{"The s-mer size must be in [1, k]."};
+
+        if (kmer_size.value - smer_size.value > 63)
+            throw std::invalid_argument{"The difference of k-mer and s-mer size must not be greater than 63."};
+    }
+
+    //!\brief Hashes the k-mers and the (seeded) s-mers of `urange` and returns the seqan3::detail::syncmer_view.
+    template <std::ranges::range urng_t>
+    static auto make_view(urng_t && urange,
+                          ungapped const kmer_size,
+                          ungapped const smer_size,
+                          uint64_t const offset_mask,
+                          seed const seed)
+    {
+        static_assert(std::ranges::viewable_range<urng_t>,
+                      "The range parameter to views::syncmer cannot be a temporary of a non-view range.");
+        static_assert(std::ranges::forward_range<urng_t>,
+                      "The range parameter to views::syncmer must model std::ranges::forward_range.");
+        static_assert(semialphabet<std::ranges::range_reference_t<urng_t>>,
+                      "The range parameter to views::syncmer must be over elements of seqan3::semialphabet.");
+
+        auto kmers = urange | seqan3::views::kmer_hash(kmer_size);
+        auto smers = std::forward<urng_t>(urange) | seqan3::views::kmer_hash(smer_size)
+                   | std::views::transform(
+                         [seed](uint64_t i)
+                         {
+                             return i ^ seed.get();
+                         });
+
+        return syncmer_view{std::move(kmers),
+                            std::move(smers),
+                            static_cast<size_t>(kmer_size.value - smer_size.value + 1),
+                            offset_mask};
+    }
+};
+
+} // namespace seqan3::detail
+
+namespace seqan3::views
+{
+/*!\brief Computes the open or closed syncmers of a range.
+ * \tparam urng_t         The type of the range being processed. See below for requirements. [template parameter is
+ *                        omitted in pipe notation]
+ * \param[in] urange      The range being processed. [parameter is omitted in pipe notation]
+ * \param[in] kmer_size   The size \f$k\f$ of the k-mers, as seqan3::ungapped.
+ * \param[in] smer_size   The size \f$s\f$ of the s-mers, as seqan3::ungapped.
+ * \param[in] offset      The position \f$t\f$ of the smallest s-mer within an open syncmer. If omitted, closed syncmers
+ *                        are computed.
+ * \param[in] seed        The seed used to skew the hash values of the s-mers. Default: 0x8F3F73B5CF1C9ADE.
+ * \returns               A range of `size_t` where each value is the hash value of a syncmer, as computed by
+ *                        seqan3::views::kmer_hash. See below for the properties of the returned range.
+ * \throws std::invalid_argument if \f$s\f$ is not in \f$[1, k]\f$, \f$k - s > 63\f$, or \f$t > k - s\f$.
+ * \ingroup search_views
+ *
+ * \details
+ *
+ * A k-mer contains \f$k - s + 1\f$ s-mers. It is a *closed syncmer* if its smallest s-mer is its first or last
+ * s-mer, and an *open syncmer* if its smallest s-mer is located at offset \f$t\f$
+ * ([Edgar, 2021](https://doi.org/10.7717/peerj.10805)). If there are several smallest s-mers, the leftmost one is
+ * used. In contrast to minimisers, whether a k-mer is a syncmer only depends on the k-mer itself and not on its
+ * neighbourhood. Hence, a syncmer is conserved as long as the k-mer itself is, even if there are mutations nearby.
+ *
+ * Like in seqan3::views::minimiser_hash, the s-mers are ordered by their hash value XORed with the seed.
+ * The smallest s-mer of each k-mer is maintained with a monotone queue, i.e. the cost per k-mer is amortised constant
+ * and independent of \f$k\f$ and \f$s\f$.
+ *
+ * \attention
+ * Be aware of the requirements of the seqan3::views::kmer_hash view.
+ *
+ * ### View properties
+ *
+ * | Concepts and traits              | `urng_t` (underlying range type)   | `rrng_t` (returned range type)   |
+ * |----------------------------------|:----------------------------------:|:--------------------------------:|
+ * | std::ranges::input_range         | *required*                         | *preserved*                      |
+ * | std::ranges::forward_range       | *required*                         | *preserved*                      |
+ * | std::ranges::bidirectional_range |                                    | *lost*                           |
+ * | std::ranges::random_access_range |                                    | *lost*                           |
+ * | std::ranges::contiguous_range    |                                    | *lost*                           |
+ * |                                  |                                    |                                  |
+ * | std::ranges::viewable_range      | *required*                         | *guaranteed*                     |
+ * | std::ranges::view                |                                    | *guaranteed*                     |
+ * | std::ranges::sized_range         |                                    | *lost*                           |
+ * | std::ranges::common_range        |                                    | *lost*                           |
+ * | std::ranges::output_range        |                                    | *lost*                           |
+ * | seqan3::const_iterable_range     |                                    | *preserved*                      |
+ * |                                  |                                    |                                  |
+ * | std::ranges::range_reference_t   | seqan3::semialphabet               | std::size_t                      |
+ *
+ * See the \link views views submodule documentation \endlink for detailed descriptions of the view properties.
+ *
+ * ### Example
+ *
+ * \include test/snippet/search/views/syncmer.cpp
+ *
+ * \hideinitializer
+ *
+ * \experimentalapi{Experimental since version 3.4.}
+ */
+inline constexpr auto syncmer = detail::syncmer_fn{};
+
+} // namespace seqan3::views
@@ -0,0 +1,480 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \author Enrico Seiler <enrico.seiler AT fu-berlin.de>
+ * \brief Provides seqan3::views::unambiguous_kmer_hash.
+ */
+
+#pragma once
+
+#include <array>
+
+#include <seqan3/alphabet/nucleotide/concept.hpp>
+#include <seqan3/search/views/kmer_hash.hpp>
+
+namespace seqan3::detail
+{
+// ---------------------------------------------------------------------------------------------------------------------
+// unambiguous_kmer_hash_view class
+// ---------------------------------------------------------------------------------------------------------------------
+
+/*!\brief The type returned by seqan3::views::unambiguous_kmer_hash.
+ * \tparam urng_t The type of the underlying range, must model std::ranges::input_range and the reference type must
+ *                model seqan3::nucleotide_alphabet and seqan3::alphabet.
+ * \implements std::ranges::view
+ * \ingroup search_views
+ *
+ * \details
+ *
+ * Each letter is mapped to a 2-bit code (`A = 0`, `C = 1`, `G = 2`, `T`/`U` = 3) or marked as ambiguous. The iterator
+ * maintains the 2-bit hash of the span of the shape and the number of consecutive unambiguous letters at the end of
+ * the span. A k-mer is only returned if this number is at least the span of the shape.
+ *
+ * Note that most members of this class are generated by std::ranges::view_interface which is not yet documented here.
+ */
+template <std::ranges::view urng_t>
+class unambiguous_kmer_hash_view : public std::ranges::view_interface<unambiguous_kmer_hash_view<urng_t>>
+{
+private:
+    static_assert(std::ranges::input_range<urng_t>, "The unambiguous_kmer_hash_view only works on input_ranges");
+    static_assert(nucleotide_alphabet<std::ranges::range_reference_t<urng_t>>
+                      && alphabet<std::ranges::range_reference_t<urng_t>>,
+                  "The reference type of the underlying range must model seqan3::nucleotide_alphabet and "
+                  "seqan3::alphabet.");
+
+    //!\brief The alphabet of the underlying range.
+    using alphabet_t = std::remove_cvref_t<std::ranges::range_reference_t<urng_t>>;
+
+    //!\brief The code of ambiguous letters.
+    static constexpr uint8_t ambiguous_code = 4u;
+
+    //!\brief Maps the rank of each letter to its 2-bit code or to `ambiguous_code`.
+    static constexpr std::array<uint8_t, alphabet_size<alphabet_t>> letter_codes = []()
+    {
+        std::array<uint8_t, alphabet_size<alphabet_t>> codes{};
+
+        for (size_t rank = 0; rank < codes.size(); ++rank)
+        {
+            switch (to_char(assign_rank_to(rank, alphabet_t{})))
+            {
+                case 'A':
+                    codes[rank] = 0u;
+                    break;
+                case 'C':
+                    codes[rank] = 1u;
+                    break;
+                case 'G':
+                    codes[rank] = 2u;
+                    break;
+                case 'T':
+                case 'U':
+                    codes[rank] = 3u;
+                    break;
+                default:
+                    codes[rank] = ambiguous_code;
+            }
+        }
+
+        return codes;
+    }();
+
+    //!\brief The underlying range.
+    urng_t urange;
+
+    //!\brief The shape to use.
+    shape shape_;
+
+    template <bool const_range>
+    class basic_iterator;
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    unambiguous_kmer_hash_view()
+        requires std::default_initializable<urng_t>
+    = default;                                                                                //!< Defaulted.
+    unambiguous_kmer_hash_view(unambiguous_kmer_hash_view const & rhs) = default;             //!< Defaulted.
+    unambiguous_kmer_hash_view(unambiguous_kmer_hash_view && rhs) = default;                  //!< Defaulted.
+    unambiguous_kmer_hash_view & operator=(unambiguous_kmer_hash_view const & rhs) = default; //!< Defaulted.
+    unambiguous_kmer_hash_view & operator=(unambiguous_kmer_hash_view && rhs) = default;      //!< Defaulted.
+    ~unambiguous_kmer_hash_view() = default;                                                  //!< Defaulted.
+
+    /*!\brief Construct from a view and a given shape.
+     * \throws std::invalid_argument if the span of the shape is greater than 32.
+     */
+    explicit unambiguous_kmer_hash_view(urng_t urange_, shape const & s_) : urange{std::move(urange_)}, shape_{s_}
+    {
+        validate_shape();
+    }
+
+    /*!\brief Construct from a non-view that can be view-wrapped and a given shape.
+     * \throws std::invalid_argument if the span of the shape is greater than 32.
+     */
+    template <typename rng_t>
+        requires (!std::same_as<std::remove_cvref_t<rng_t>, unambiguous_kmer_hash_view>)
+              && std::ranges::viewable_range<rng_t>
+              && std::constructible_from<urng_t, std::ranges::ref_view<std::remove_reference_t<rng_t>>>
+    explicit unambiguous_kmer_hash_view(rng_t && urange_, shape const & s_) :
+        urange{std::views::all(std::forward<rng_t>(urange_))},
+        shape_{s_}
+    {
+        validate_shape();
+    }
+    //!\}
+
+    /*!\name Iterators
+     * \{
+     */
+    /*!\brief Returns an iterator to the first element of the range.
+     * \returns Iterator to the first element.
+     *
+     * \details
+     *
+     * ### Complexity
+     *
+     * Linear in the number of letters up to the end of the first unambiguous k-mer.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    basic_iterator<false> begin() noexcept
+    {
+        return {std::ranges::begin(urange), std::ranges::end(urange), shape_};
+    }
+
+    //!\copydoc begin()
+    basic_iterator<true> begin() const noexcept
+        requires const_iterable_range<urng_t>
+    {
+        return {std::ranges::begin(urange), std::ranges::end(urange), shape_};
+    }
+
+    /*!\brief Returns the sentinel of the range.
+     * \returns std::default_sentinel.
+     */
+    std::default_sentinel_t end() const noexcept
+    {
+        return {};
+    }
+    //!\}
+
+private:
+    //!\brief Checks that the hash of the span of the shape fits into 64 bits.
+    void validate_shape() const
+    {
+        if (shape_.size() <= 32u)
+            return;
+
+        std::string message{"The shape is too long for 2-bit hashing.\n"};
+        message += "Maximum shape size: 32\nGiven shape size: ";
+        message += std::to_string(shape_.size());
+        throw std::invalid_argument{message};
+    }
+};
+
+/*!\brief Iterator for calculating the hash values of unambiguous k-mers via a given seqan3::shape.
+ *
+ * \details
+ *
+ * The iterator points behind the last letter of the current k-mer and stores its hash value. The end is reached, once
+ * there is no unambiguous k-mer left in the underlying range.
+ */
+template <std::ranges::view urng_t>
+template <bool const_range>
+class unambiguous_kmer_hash_view<urng_t>::basic_iterator
+{
+private:
+    //!\brief The iterator type of the underlying range.
+    using it_t = maybe_const_iterator_t<const_range, urng_t>;
+    //!\brief The sentinel type of the underlying range.
+    using sentinel_t = maybe_const_sentinel_t<const_range, urng_t>;
+
+    template <bool other_const_range>
+    friend class basic_iterator;
+
+public:
+    /*!\name Associated types
+     * \{
+     */
+    //!\brief Type for distances between iterators.
+    using difference_type = std::iter_difference_t<it_t>;
+    //!\brief Value type of this iterator.
+    using value_type = size_t;
+    //!\brief The pointer type.
+    using pointer = void;
+    //!\brief Reference to `value_type`.
+    using reference = value_type;
+    //!\brief The iterator category tag.
+    using iterator_category = std::input_iterator_tag;
+    //!\brief Tag this class as a forward iterator if the underlying range is a forward range.
+    using iterator_concept =
+        std::conditional_t<std::forward_iterator<it_t>, std::forward_iterator_tag, std::input_iterator_tag>;
+    //!\}
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    basic_iterator() = default;                                   //!< Defaulted.
+    basic_iterator(basic_iterator const &) = default;             //!< Defaulted.
+    basic_iterator(basic_iterator &&) = default;                  //!< Defaulted.
+    basic_iterator & operator=(basic_iterator const &) = default; //!< Defaulted.
+    basic_iterator & operator=(basic_iterator &&) = default;      //!< Defaulted.
+    ~basic_iterator() = default;                                  //!< Defaulted.
+
+    //!\brief Allow iterator on a const range to be constructible from an iterator over a non-const range.
+    basic_iterator(basic_iterator<!const_range> const & it) noexcept
+        requires const_range
+        :
+        hash_value{std::move(it.hash_value)},
+        span_hash{std::move(it.span_hash)},
+        span_mask{std::move(it.span_mask)},
+        extract_mask{std::move(it.extract_mask)},
+        span{std::move(it.span)},
+        unambiguous_letters{std::move(it.unambiguous_letters)},
+        text_position{std::move(it.text_position)},
+        at_end{std::move(it.at_end)},
+        text_it{std::move(it.text_it)},
+        text_end{std::move(it.text_end)}
+    {}
+
+    /*!\brief Construct from a given iterator on the text and a seqan3::shape.
+    * \param[in] it_start Iterator pointing to the first position of the text.
+    * \param[in] it_end   Sentinel pointing to the end of the text.
+    * \param[in] s_       The seqan3::shape that determines which positions participate in hashing.
+    *
+    * \details
+    *
+    * ### Complexity
+    *
+    * Linear in the number of letters up to the end of the first unambiguous k-mer.
+    */
+    basic_iterator(it_t it_start, sentinel_t it_end, shape const & s_) :
+        span_mask{low_bits(2u * s_.size())},
+        extract_mask{packed_shape_mask(s_, 2u)},
+        span{s_.size()},
+        text_it{std::move(it_start)},
+        text_end{std::move(it_end)}
+    {
+        assert(std::ranges::size(s_) > 0);
+
+        next_unambiguous_kmer();
+    }
+    //!\}
+
+    //!\anchor basic_iterator_comparison_unambiguous_kmer_hash
+    //!\name Comparison operators
+    //!\{
+
+    //!\brief Compare to another basic_iterator.
+    friend bool operator==(basic_iterator const & lhs, basic_iterator const & rhs) noexcept
+        requires std::forward_iterator<it_t>
+    {
+        return std::tie(lhs.text_it, lhs.at_end) == std::tie(rhs.text_it, rhs.at_end);
+    }
+
+    //!\brief Compare to the sentinel of the unambiguous_kmer_hash_view.
+    friend bool operator==(basic_iterator const & lhs, std::default_sentinel_t const &) noexcept
+    {
+        return lhs.at_end;
+    }
+    //!\}
+
+    //!\brief Pre-increment.
+    basic_iterator & operator++() noexcept
+    {
+        next_unambiguous_kmer();
+        return *this;
+    }
+
+    //!\brief Post-increment.
+    basic_iterator operator++(int) noexcept
+        requires std::forward_iterator<it_t>
+    {
+        basic_iterator tmp{*this};
+        ++(*this);
+        return tmp;
+    }
+
+    //!\brief Post-increment.
+    void operator++(int) noexcept
+        requires (!std::forward_iterator<it_t>)
+    {
+        ++(*this);
+    }
+
+    //!\brief Return the hash value.
+    value_type operator*() const noexcept
+    {
+        return hash_value;
+    }
+
+    //!\brief Return the position of the first letter of the current k-mer in the underlying range.
+    size_t position() const noexcept
+    {
+        return text_position - span;
+    }
+
+private:
+    //!\brief The hash value of the current k-mer.
+    size_t hash_value{};
+
+    //!\brief The 2-bit hash of the span of the shape.
+    uint64_t span_hash{};
+
+    //!\brief Selects all positions of the span of the shape.
+    uint64_t span_mask{};
+
+    //!\brief Selects the positions of the span that are part of the hash.
+    uint64_t extract_mask{};
+
+    //!\brief The span of the shape.
+    size_t span{};
+
+    //!\brief The number of consecutive unambiguous letters in front of `text_it`.
+    size_t unambiguous_letters{};
+
+    //!\brief The position of `text_it` in the underlying range.
+    size_t text_position{};
+
+    //!\brief Whether the iterator is at the end.
+    bool at_end{false};
+
+    //!\brief Iterator to the position behind the current k-mer.
+    it_t text_it{};
+
+    //!\brief The end of the text.
+    sentinel_t text_end{};
+
+    //!\brief Advances `text_it` behind the next k-mer that does not contain an ambiguous letter.
+    void next_unambiguous_kmer() noexcept
+    {
+        while (text_it != text_end)
+        {
+            uint8_t const code = letter_codes[to_rank(*text_it)];
+
+            // An ambiguous letter resets the counter. Its code is masked, it will never be part of a returned hash.
+            unambiguous_letters = (code == ambiguous_code) ? 0u : unambiguous_letters + 1u;
+            span_hash = ((span_hash << 2u) | (code & 0b11u)) & span_mask;
+
+            ++text_it;
+            ++text_position;
+
+            if (unambiguous_letters >= span)
+            {
+                hash_value = (extract_mask == span_mask) ? span_hash : parallel_bit_extract(span_hash, extract_mask);
+                return;
+            }
+        }
+
+        at_end = true;
+    }
+};
+
+//!\brief A deduction guide for the view class template.
+template <std::ranges::viewable_range rng_t>
+unambiguous_kmer_hash_view(rng_t &&, shape const & shape_) -> unambiguous_kmer_hash_view<std::views::all_t<rng_t>>;
+
+// ---------------------------------------------------------------------------------------------------------------------
+// unambiguous_kmer_hash_fn (adaptor definition)
+// ---------------------------------------------------------------------------------------------------------------------
+
+//!\brief views::unambiguous_kmer_hash's range adaptor object type (non-closure).
+//!\ingroup search_views
+struct unambiguous_kmer_hash_fn
+{
+    //!\brief Store the shape and return a range adaptor closure object.
+    constexpr auto operator()(shape const & shape_) const
+    {
+        return adaptor_from_functor{*this, shape_};
+    }
+
+    /*!\brief            Call the view's constructor with the underlying view and a seqan3::shape as argument.
+     * \param[in] urange The input range to process. Must model std::ranges::viewable_range and the reference type
+     *                   of the range must model seqan3::nucleotide_alphabet and seqan3::alphabet.
+     * \param[in] shape_ The seqan3::shape to use for hashing.
+     * \throws std::invalid_argument if the span of the shape is greater than 32.
+     * \returns          A range of converted elements.
+     */
+    template <std::ranges::range urng_t>
+    constexpr auto operator()(urng_t && urange, shape const & shape_) const
+    {
+        static_assert(std::ranges::viewable_range<urng_t>,
+                      "The range parameter to views::unambiguous_kmer_hash cannot be a temporary of a non-view range.");
+        static_assert(std::ranges::input_range<urng_t>,
+                      "The range parameter to views::unambiguous_kmer_hash must model std::ranges::input_range.");
+        static_assert(nucleotide_alphabet<std::ranges::range_reference_t<urng_t>>
+                          && alphabet<std::ranges::range_reference_t<urng_t>>,
+                      "The range parameter to views::unambiguous_kmer_hash must be over elements of "
+                      "seqan3::nucleotide_alphabet.");
+
+        return unambiguous_kmer_hash_view{std::forward<urng_t>(urange), shape_};
+    }
+};
+
+} // namespace seqan3::detail
+
+namespace seqan3::views
+{
+/*!\brief               Computes hash values for all k-mers of a range that do not contain an ambiguous letter.
+ * \tparam urng_t       The type of the range being processed. See below for requirements. [template parameter is
+ *                      omitted in pipe notation]
+ * \param[in] urange    The range being processed. [parameter is omitted in pipe notation]
+ * \param[in] shape     The seqan3::shape that determines how to compute the hash value.
+ * \returns             A range of std::size_t where each value is the hash of an unambiguous k-mer.
+ *                      See below for the properties of the returned range.
+ * \throws std::invalid_argument if the span of the shape is greater than 32.
+ * \ingroup search_views
+ *
+ * \details
+ *
+ * seqan3::views::kmer_hash assigns a rank to ambiguous letters like `N` of seqan3::dna5, i.e. each k-mer that overlaps
+ * an `N` results in a hash value, too. This view skips all k-mers whose span contains a letter other than `A`, `C`,
+ * `G`, `T` or `U`. While hashing, the number of letters since the last ambiguous letter is tracked, i.e. no additional
+ * pass over the range is needed.
+ *
+ * The letters are hashed with 2 bits each (`A = 0`, `C = 1`, `G = 2`, `T`/`U` = 3), independent of the alphabet of the
+ * range. Hence, a k-mer has the same hash value as the k-mer computed by seqan3::views::kmer_hash on the same
+ * seqan3::dna4 sequence, e.g. k-mers of seqan3::dna5 reads can be looked up in an index built from seqan3::dna4
+ * sequences.
+ *
+ * The position of the first letter of the current k-mer in `urange` can be obtained via the `position()` member of the
+ * iterator.
+ *
+ * Minimisers of the unambiguous k-mers are obtained by applying seqan3::views::minimiser to the returned range.
+ *
+ * ### View properties
+ *
+ * | Concepts and traits              | `urng_t` (underlying range type)   | `rrng_t` (returned range type)   |
+ * |----------------------------------|:----------------------------------:|:--------------------------------:|
+ * | std::ranges::input_range         | *required*                         | *preserved*                      |
+ * | std::ranges::forward_range       |                                    | *preserved*                      |
+ * | std::ranges::bidirectional_range |                                    | *lost*                           |
+ * | std::ranges::random_access_range |                                    | *lost*                           |
+ * | std::ranges::contiguous_range    |                                    | *lost*                           |
+ * |                                  |                                    |                                  |
+ * | std::ranges::viewable_range      | *required*                         | *guaranteed*                     |
+ * | std::ranges::view                |                                    | *guaranteed*                     |
+ * | std::ranges::sized_range         |                                    | *lost*                           |
+ * | std::ranges::common_range        |                                    | *lost*                           |
+ * | std::ranges::output_range        |                                    | *lost*                           |
+ * | seqan3::const_iterable_range     |                                    | *preserved*                      |
+ * |                                  |                                    |                                  |
+ * | std::ranges::range_reference_t   | seqan3::nucleotide_alphabet        | std::size_t                      |
+ *
+ * See the \link views views submodule documentation \endlink for detailed descriptions of the view properties.
+ *
+ * ### Example
+ *
+ * \include test/snippet/search/views/unambiguous_kmer_hash.cpp
+ *
+ * \hideinitializer
+ *
+ * \experimentalapi{Experimental since version 3.4.}
+ */
+inline constexpr auto unambiguous_kmer_hash = detail::unambiguous_kmer_hash_fn{};
+
+} // namespace seqan3::views
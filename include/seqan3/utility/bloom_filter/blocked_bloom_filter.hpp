@@ -0,0 +1,446 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \author Enrico Seiler <enrico.seiler AT fu-berlin.de>
+ * \brief Provides seqan3::blocked_bloom_filter.
+ */
+
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cassert>
+#include <memory>
+#include <ranges>
+#include <vector>
+
+#include <seqan3/contrib/sdsl-lite.hpp>
+#include <seqan3/core/concept/cereal.hpp>
+#include <seqan3/utility/bloom_filter/bloom_filter_strong_types.hpp>
+
+namespace seqan3
+{
+
+/*!\brief The register-blocked Bloom Filter. A Bloom Filter that answers each query with a single memory access.
+ * \implements seqan3::cerealisable
+ * \ingroup utility_bloom_filter
+ *
+ * \details
+ *
+ * ### Register-blocked Bloom Filter
+ *
+ * The seqan3::bloom_filter hashes a value to `h` independent positions within the whole bitvector. For large filters,
+ * each of these positions is a cache miss.
+ * The register-blocked Bloom Filter divides the bitvector into blocks of 64 bits. A value is first hashed to a block
+ * and all of its `h` bits are then chosen within this block. Inserting and querying a value hence accesses a single
+ * 64-bit word, i.e. causes at most one cache miss, independent of the number of hash functions.
+ *
+ * The price is a higher false positive rate than that of a seqan3::bloom_filter of the same size, since the number of
+ * values per block varies. The difference is small for filters with few bits set per block, but more bits are needed
+ * to achieve the same false positive rate.
+ *
+ * The interface is the same as the one of the uncompressed seqan3::bloom_filter. The size of the bitvector is rounded
+ * up to the next multiple of 64.
+ *
+ * ### Querying
+ *
+ * To query the Bloom Filter for a value, call `seqan3::blocked_bloom_filter::contains`.
+ * To query the Bloom Filter for a range of values, call `seqan3::blocked_bloom_filter::count` which returns the
+ * number of hits. To obtain the result for each value, call seqan3::blocked_bloom_filter::membership_agent() and use
+ * seqan3::blocked_bloom_filter::membership_agent_type::bulk_contains of the returned agent, which reuses its result
+ * buffer for subsequent queries.
+ * Both process the values in batches: The blocks of all values of a batch are determined and prefetched first and
+ * tested afterwards, such that the memory accesses of a batch overlap.
+ *
+ * ### Example
+ *
+ * \include test/snippet/utility/bloom_filter/blocked_bloom_filter.cpp
+ *
+ * ### Thread safety
+ *
+ * The Bloom Filter promises the basic thread-safety by the STL that all
+ * calls to `const` member functions are safe from multiple threads (as long as no thread calls
+ * a non-`const` member function at the same time).
+ *
+ * \sa seqan3::bloom_filter
+ */
+class blocked_bloom_filter
+{
+private:
+    //!\brief The number of values that are processed at once by count() and membership_agent_type::bulk_contains().
+    static constexpr size_t batch_size{16u};
+
+    //!\brief The size of the underlying bit vector in bits.
+    size_t size_in_bits{};
+    //!\brief The number of 64-bit blocks.
+    size_t block_count{};
+    //!\brief The number of bits to shift the hash value before doing multiplicative hashing.
+    size_t hash_shift{};
+    //!\brief The number of hash functions.
+    size_t hash_funs{};
+    //!\brief The bitvector.
+    seqan3::contrib::sdsl::bit_vector data{};
+    //!\brief Precalculated seeds for multiplicative hashing. We use large irrational numbers for a uniform hashing.
+    static constexpr std::array<size_t, 2> hash_seeds{13'572'355'802'537'770'549ULL,  // 2**64 / (e/2)
+                                                      13'043'817'825'332'782'213ULL}; // 2**64 / sqrt(2)
+
+    //!\brief Perturbs a value.
+    inline constexpr size_t perturb(size_t h, size_t const seed) const noexcept
+    {
+        h *= seed;
+        h ^= h >> hash_shift;               // XOR and shift higher bits into lower bits
+        h *= 11'400'714'819'323'198'485ULL; // = 2^64 / golden_ration, to expand h to 64 bit range
+        return h;
+    }
+
+    /*!\brief Determines the block of a value.
+     * \param value The value to process.
+     * \returns The index of the 64-bit word within `data`.
+     * \sa https://lemire.me/blog/2016/06/27
+     */
+    inline constexpr size_t block_of(size_t const value) const noexcept
+    {
+        size_t const h = perturb(value, hash_seeds[0]);
+        // Use fastrange (integer modulo without division) if possible.
+#ifdef __SIZEOF_INT128__
+        return static_cast<uint64_t>((static_cast<__uint128_t>(h) * static_cast<__uint128_t>(block_count)) >> 64);
+#else
+        return h % block_count;
+#endif
+    }
+
+    /*!\brief Determines the bits of a value within its block.
+     * \param value The value to process.
+     * \returns A 64-bit mask with up to `hash_funs` bits set.
+     *
+     * \details
+     *
+     * The `i`-th bit position is taken from the `i`-th most significant 6-bit chunk of an independent hash value.
+     */
+    inline constexpr uint64_t mask_of(size_t const value) const noexcept
+    {
+        size_t h = perturb(value, hash_seeds[1]);
+        uint64_t mask{};
+
+        // The high bits of a multiplicative hash are the best mixed ones.
+        for (size_t i = 0; i < hash_funs; ++i, h <<= 6)
+            mask |= 1ULL << (h >> 58);
+
+        return mask;
+    }
+
+    /*!\brief Queries the values in batches and calls `on_result` with the result for each value.
+     * \param values The values to query.
+     * \param on_result Invoked with `true` or `false` for each value, in order.
+     */
+    template <typename value_range_t, typename on_result_t>
+    void for_each_result(value_range_t && values, on_result_t && on_result) const noexcept
+    {
+        uint64_t const * const words = data.data();
+        std::array<size_t, batch_size> blocks;
+        std::array<uint64_t, batch_size> masks;
+
+        auto it = std::ranges::begin(values);
+        auto const end = std::ranges::end(values);
+
+        while (it != end)
+        {
+            size_t batch_end = 0;
+
+            for (; batch_end < batch_size && it != end; ++batch_end, ++it)
+            {
+                size_t const value = *it;
+                blocks[batch_end] = block_of(value);
+                masks[batch_end] = mask_of(value);
+                __builtin_prefetch(words + blocks[batch_end]);
+            }
+
+            for (size_t i = 0; i < batch_end; ++i)
+                on_result((words[blocks[i]] & masks[i]) == masks[i]);
+        }
+    }
+
+public:
+    class membership_agent_type; // documented upon definition below
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    blocked_bloom_filter() = default;                                         //!< Defaulted.
+    blocked_bloom_filter(blocked_bloom_filter const &) = default;             //!< Defaulted.
+    blocked_bloom_filter & operator=(blocked_bloom_filter const &) = default; //!< Defaulted.
+    blocked_bloom_filter(blocked_bloom_filter &&) = default;                  //!< Defaulted.
+    blocked_bloom_filter & operator=(blocked_bloom_filter &&) = default;      //!< Defaulted.
+    ~blocked_bloom_filter() = default;                                        //!< Defaulted.
+
+    /*!\brief Construct a register-blocked Bloom Filter.
+     * \param size The bit vector size (in bits). Rounded up to the next multiple of 64.
+     * \param funs The number of hash functions. Default 2. At least 1, at most 5.
+     * \throws std::logic_error if `size` is 0 or the number of hash functions is not in `[1, 5]`.
+     */
+    blocked_bloom_filter(seqan3::bin_size size, seqan3::hash_function_count funs = seqan3::hash_function_count{2u})
+    {
+        hash_funs = funs.get();
+
+        if (hash_funs == 0 || hash_funs > 5)
+            throw std::logic_error{"The number of hash functions must be > 0 and <= 5."};
+        if (size.get() == 0)
+            throw std::logic_error{"The size of a bloom filter must be > 0."};
+
+        block_count = (size.get() + 63u) >> 6; // = ceil(size/64)
+        size_in_bits = block_count << 6;
+        hash_shift = std::countl_zero(block_count);
+        data = seqan3::contrib::sdsl::bit_vector(size_in_bits);
+    }
+    //!\}
+
+    /*!\name Modifiers
+     * \{
+     */
+    /*!\brief Inserts a value into the Bloom Filter.
+     * \param[in] value The raw numeric value to process.
+     */
+    void emplace(size_t const value) noexcept
+    {
+        data.data()[block_of(value)] |= mask_of(value);
+    }
+
+    /*!\brief Remove all values from the Bloom Filter by setting all bits to 0.
+     *
+     * \details
+     *
+     * While all values are removed from the vector, the size of the Bloom Filter is not changed.
+     */
+    void reset() noexcept
+    {
+        seqan3::contrib::sdsl::util::_set_zero_bits(data);
+    }
+    //!\}
+
+    /*!\name Lookup
+     * \{
+     */
+    /*!\brief Check whether a value is present in the Bloom Filter.
+     * \param[in] value The raw numeric value to process.
+     */
+    bool contains(size_t const value) const noexcept
+    {
+        uint64_t const mask = mask_of(value);
+        return (data.data()[block_of(value)] & mask) == mask;
+    }
+
+    /*!\brief Returns a seqan3::blocked_bloom_filter::membership_agent_type to be used for lookup of ranges of values.
+     * \attention Destroying or moving the Bloom Filter invalidates all agents constructed for it.
+     * \sa seqan3::blocked_bloom_filter::membership_agent_type::bulk_contains
+     */
+    membership_agent_type membership_agent() const;
+    //!\}
+
+    /*!\name Counting
+     * \{
+     */
+    /*!\brief Counts the occurrences for all values in a range.
+     * \tparam value_range_t The type of the range of values. Must model std::ranges::input_range. The reference type
+     *                       must model std::unsigned_integral.
+     * \param[in] values The range of values to process.
+     *
+     * \details
+     *
+     * ### Thread safety
+     *
+     * Concurrent invocations of this function are thread safe.
+     */
+    template <std::ranges::range value_range_t>
+    size_t count(value_range_t && values) const noexcept
+    {
+        static_assert(std::ranges::input_range<value_range_t>, "The values must model input_range.");
+        static_assert(std::unsigned_integral<std::ranges::range_value_t<value_range_t>>,
+                      "An individual value must be an unsigned integral.");
+
+        size_t result = 0;
+
+        for_each_result(values,
+                        [&result](bool const hit)
+                        {
+                            result += hit;
+                        });
+
+        return result;
+    }
+    //!\}
+
+    /*!\name Capacity
+     * \{
+     */
+    /*!\brief Returns the number of hash functions used in the Bloom Filter.
+     * \returns The number of hash functions.
+     */
+    size_t hash_function_count() const noexcept
+    {
+        return hash_funs;
+    }
+
+    /*!\brief Returns the size of the underlying bitvector.
+     * \returns The size in bits of the underlying bitvector.
+     */
+    size_t bit_size() const noexcept
+    {
+        return size_in_bits;
+    }
+    //!\}
+
+    /*!\name Comparison operators
+     * \{
+     */
+    /*!\brief Test for equality.
+     * \param[in] lhs A `seqan3::blocked_bloom_filter`.
+     * \param[in] rhs `seqan3::blocked_bloom_filter` to compare to.
+     * \returns `true` if equal, `false` otherwise.
+     */
+    friend bool operator==(blocked_bloom_filter const & lhs, blocked_bloom_filter const & rhs) noexcept
+    {
+        return std::tie(lhs.size_in_bits, lhs.block_count, lhs.hash_shift, lhs.hash_funs, lhs.data)
+            == std::tie(rhs.size_in_bits, rhs.block_count, rhs.hash_shift, rhs.hash_funs, rhs.data);
+    }
+
+    /*!\brief Test for inequality.
+     * \param[in] lhs A `seqan3::blocked_bloom_filter`.
+     * \param[in] rhs `seqan3::blocked_bloom_filter` to compare to.
+     * \returns `true` if unequal, `false` otherwise.
+     */
+    friend bool operator!=(blocked_bloom_filter const & lhs, blocked_bloom_filter const & rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+    //!\}
+
+    /*!\name Access
+     * \{
+     */
+    /*!\brief Provides direct, unsafe access to the underlying data structure.
+     * \returns A reference to an SDSL bitvector.
+     *
+     * \details
+     *
+     * \noapi{The exact representation of the data is implementation defined.}
+     */
+    constexpr seqan3::contrib::sdsl::bit_vector & raw_data() noexcept
+    {
+        return data;
+    }
+
+    //!\copydoc raw_data()
+    constexpr seqan3::contrib::sdsl::bit_vector const & raw_data() const noexcept
+    {
+        return data;
+    }
+    //!\}
+
+    /*!\cond DEV
+     * \brief Serialisation support function.
+     * \tparam archive_t Type of `archive`; must satisfy seqan3::cereal_archive.
+     * \param[in] archive The archive being serialised from/to.
+     *
+     * \attention These functions are never called directly, see \ref serialisation for more details.
+     */
+    template <cereal_archive archive_t>
+    void CEREAL_SERIALIZE_FUNCTION_NAME(archive_t & archive)
+    {
+        archive(size_in_bits);
+        archive(block_count);
+        archive(hash_shift);
+        archive(hash_funs);
+        archive(data);
+    }
+    //!\endcond
+};
+
+/*!\brief Manages membership queries of ranges of values for the seqan3::blocked_bloom_filter.
+ * \attention Destroying or moving the seqan3::blocked_bloom_filter invalidates all agents constructed for it.
+ * \details
+ *
+ * The agent stores the result of the last query. Its memory is reused by subsequent queries, such that querying many
+ * ranges of values does not allocate memory once the buffer has grown to the size of the largest range.
+ */
+class blocked_bloom_filter::membership_agent_type
+{
+private:
+    //!\brief A pointer to the augmented seqan3::blocked_bloom_filter.
+    blocked_bloom_filter const * bf_ptr{nullptr};
+
+    //!\brief Stores the result of bulk_contains().
+    std::vector<bool> result_buffer{};
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    membership_agent_type() = default;                                          //!< Defaulted.
+    membership_agent_type(membership_agent_type const &) = default;             //!< Defaulted.
+    membership_agent_type & operator=(membership_agent_type const &) = default; //!< Defaulted.
+    membership_agent_type(membership_agent_type &&) = default;                  //!< Defaulted.
+    membership_agent_type & operator=(membership_agent_type &&) = default;      //!< Defaulted.
+    ~membership_agent_type() = default;                                         //!< Defaulted.
+
+    /*!\brief Construct a membership_agent_type from a seqan3::blocked_bloom_filter.
+     * \private
+     * \param bf The seqan3::blocked_bloom_filter.
+     */
+    explicit membership_agent_type(blocked_bloom_filter const & bf) : bf_ptr(std::addressof(bf))
+    {}
+    //!\}
+
+    /*!\name Lookup
+     * \{
+     */
+    /*!\brief Check for each value in a range whether it is present in the Bloom Filter.
+     * \tparam value_range_t The type of the range of values. Must model std::ranges::input_range. The reference type
+     *                       must model std::unsigned_integral.
+     * \param[in] values The range of values to process.
+     * \returns A `std::vector<bool>` whose `i`-th entry is the result of `contains` for the `i`-th value.
+     *
+     * \attention The result of this function must always be bound via reference, e.g. `auto &`, to prevent copying.
+     * \attention Sequential calls to this function invalidate the previously returned reference.
+     *
+     * \details
+     *
+     * ### Thread safety
+     *
+     * Concurrent invocations of this function are not thread safe, please create a
+     * seqan3::blocked_bloom_filter::membership_agent_type for each thread.
+     */
+    template <std::ranges::range value_range_t>
+    [[nodiscard]] std::vector<bool> const & bulk_contains(value_range_t && values) &
+    {
+        assert(bf_ptr != nullptr);
+
+        static_assert(std::ranges::input_range<value_range_t>, "The values must model input_range.");
+        static_assert(std::unsigned_integral<std::ranges::range_value_t<value_range_t>>,
+                      "An individual value must be an unsigned integral.");
+
+        result_buffer.clear(); // Keeps the capacity.
+
+        bf_ptr->for_each_result(values,
+                                [this](bool const hit)
+                                {
+                                    result_buffer.push_back(hit);
+                                });
+
+        return result_buffer;
+    }
+
+    // `bulk_contains` cannot be called on a temporary, since the object the returned reference points to
+    // is immediately destroyed.
+    template <std::ranges::range value_range_t>
+    [[nodiscard]] std::vector<bool> const & bulk_contains(value_range_t && values) && = delete;
+    //!\}
+};
+
+inline blocked_bloom_filter::membership_agent_type blocked_bloom_filter::membership_agent() const
+{
+    return membership_agent_type{*this};
+}
+
+} // namespace seqan3
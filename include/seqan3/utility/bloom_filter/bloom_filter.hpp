@@ -9,8 +9,12 @@
 
 #pragma once
 
+#include <cstring>
+#include <filesystem>
+
 #include <seqan3/contrib/sdsl-lite.hpp>
 #include <seqan3/core/concept/cereal.hpp>
+#include <seqan3/utility/bloom_filter/detail/mapped_bit_vector.hpp>
 //Todo: When removing search/dream_index/interleaved_bloom_filter.hpp, the contents of the following header can be
 // moved into this file
 #include <seqan3/utility/bloom_filter/bloom_filter_strong_types.hpp>
@@ -72,6 +76,18 @@ namespace seqan3
  * `seqan3::bloom_filter`, in which case the underlying bitvector is compressed.
  * The compressed Bloom Filter is immutable, i.e. only querying is supported.
  *
+ * ### Memory mapping
+ *
+ * Any Bloom Filter can be written to disk in a memory-mappable format via seqan3::bloom_filter::store.
+ * A `seqan3::bloom_filter<seqan3::data_layout::mapped>` constructed from such a file does not load the bitvector, but
+ * answers queries directly on the memory-mapped words. Loading is hence instantaneous, only the accessed pages are
+ * read from disk, and all processes mapping the same file share the memory via the page cache.
+ * The mapped Bloom Filter is immutable, i.e. only querying is supported. Construct an uncompressed
+ * seqan3::bloom_filter from it to modify it.
+ *
+ * The compressed layout is stored in its uncompressed form, since the select structures of the compressed bitvector
+ * cannot be mapped.
+ *
  * ### Thread safety
  *
  * The Bloom Filter promises the basic thread-safety by the STL that all
@@ -91,9 +107,15 @@ private:
     //!\endcond
 
     //!\brief The underlying datatype to use.
-    using data_type = std::conditional_t<data_layout_mode_ == data_layout::uncompressed,
-                                         seqan3::contrib::sdsl::bit_vector,
-                                         seqan3::contrib::sdsl::sd_vector<>>;
+    using data_type =
+        std::conditional_t<data_layout_mode_ == data_layout::uncompressed,
+                           seqan3::contrib::sdsl::bit_vector,
+                           std::conditional_t<data_layout_mode_ == data_layout::compressed,
+                                              seqan3::contrib::sdsl::sd_vector<>,
+                                              detail::mapped_bit_vector>>;
+
+    //!\brief Identifies a Bloom Filter in the memory-mappable on-disk format.
+    static constexpr std::array<char, 8> file_magic{'S', 'E', 'Q', 'A', 'N', '3', 'B', 'F'};
 
     //!\brief The size of the underlying bit vector in bits.
     size_t size_in_bits{};
@@ -190,6 +212,48 @@ public:
 
         data = seqan3::contrib::sdsl::sd_vector<>{bf.data};
     }
+
+    /*!\brief Construct an uncompressed Bloom Filter from a mapped one.
+     * \param[in] bf The mapped seqan3::bloom_filter.
+     *
+     * \details
+     *
+     * Copies the bitvector into memory. The resulting Bloom Filter is independent of the mapped file.
+     */
+    bloom_filter(bloom_filter<data_layout::mapped> const & bf)
+        requires (data_layout_mode == data_layout::uncompressed)
+    {
+        std::tie(size_in_bits, hash_shift, hash_funs) = std::tie(bf.size_in_bits, bf.hash_shift, bf.hash_funs);
+
+        data = seqan3::contrib::sdsl::bit_vector(size_in_bits);
+        std::memcpy(data.data(),
+                    bf.data.data(),
+                    detail::mapped_bit_vector::word_count(size_in_bits) * sizeof(uint64_t));
+    }
+
+    /*!\brief Construct a mapped Bloom Filter from a file written by seqan3::bloom_filter::store.
+     * \param[in] path The file to map.
+     * \throws seqan3::file_open_error if the file cannot be mapped or does not contain a Bloom Filter.
+     *
+     * \attention This constructor can only be used to construct **mapped** Bloom Filters.
+     *
+     * \details
+     *
+     * The file must stay unchanged while it is mapped.
+     */
+    explicit bloom_filter(std::filesystem::path const & path)
+        requires (data_layout_mode == data_layout::mapped)
+        : data{path, file_magic}
+    {
+        auto const & parameters = data.header().parameters;
+        size_in_bits = data.size();
+        hash_shift = parameters[0];
+        hash_funs = parameters[1];
+
+        if (hash_funs == 0 || hash_funs > 5 || size_in_bits == 0
+            || hash_shift != static_cast<size_t>(std::countl_zero(size_in_bits)))
+            throw file_open_error{"The file " + path.string() + " does not contain a valid Bloom Filter."};
+    }
     //!\}
 
     /*!\name Modifiers
@@ -236,6 +300,29 @@ public:
     }
     //!\}
 
+    /*!\name Storage
+     * \{
+     */
+    /*!\brief Writes the Bloom Filter in the memory-mappable on-disk format.
+     * \param[in] path The file to write to. An existing file is overwritten.
+     * \throws seqan3::file_open_error if the file cannot be opened for writing.
+     * \throws seqan3::io_error if writing fails.
+     *
+     * \details
+     *
+     * Use `seqan3::bloom_filter<seqan3::data_layout::mapped>` to map the file.
+     */
+    void store(std::filesystem::path const & path) const
+    {
+        detail::mapped_filter_header header{};
+        header.magic = file_magic;
+        header.parameters[0] = hash_shift;
+        header.parameters[1] = hash_funs;
+
+        detail::write_mapped_filter(path, header, data);
+    }
+    //!\}
+
     /*!\name Lookup
      * \{
      */
@@ -372,6 +459,7 @@ public:
      * \attention These functions are never called directly, see \ref serialisation for more details.
      */
     template <cereal_archive archive_t>
+        requires (data_layout_mode != data_layout::mapped)
     void CEREAL_SERIALIZE_FUNCTION_NAME(archive_t & archive)
     {
         archive(size_in_bits);
@@ -9,6 +9,8 @@
 
 #pragma once
 
+#include <cstdint>
+
 #include <seqan3/core/detail/strong_type.hpp>
 
 //Todo: When removing search/dream_index/interleaved_bloom_filter.hpp, the contents of this header can be moved
@@ -17,12 +19,13 @@
 namespace seqan3
 {
 
-//!\brief Determines if the Interleaved Bloom Filter is compressed.
+//!\brief Determines if the Interleaved Bloom Filter is compressed or backed by a memory-mapped file.
 //!\ingroup utility_bloom_filter
-enum data_layout : bool
+enum data_layout : uint8_t
 {
     uncompressed, //!< The Interleaved Bloom Filter is uncompressed.
-    compressed    //!< The Interleaved Bloom Filter is compressed.
+    compressed,   //!< The Interleaved Bloom Filter is compressed.
+    mapped        //!< The Interleaved Bloom Filter is a read-only view of a memory-mapped file.
 };
 
 //!\brief A strong type that represents the number of bins for the seqan3::interleaved_bloom_filter.
@@ -0,0 +1,342 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \author Enrico Seiler <enrico.seiler AT fu-berlin.de>
+ * \brief Provides seqan3::detail::mapped_bit_vector and the memory-mappable on-disk format of the Bloom Filters.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <vector>
+
+#include <seqan3/core/platform.hpp>
+#include <seqan3/io/exception.hpp>
+
+//!\cond
+#ifndef SEQAN3_HAS_MMAP
+#    if __has_include(<sys/mman.h>) && __has_include(<sys/stat.h>) && __has_include(<fcntl.h>)                        \
+        && __has_include(<unistd.h>)
+#        define SEQAN3_HAS_MMAP 1
+#    else
+#        define SEQAN3_HAS_MMAP 0
+#    endif
+#endif // SEQAN3_HAS_MMAP
+
+#if SEQAN3_HAS_MMAP
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif // SEQAN3_HAS_MMAP
+//!\endcond
+
+namespace seqan3::detail
+{
+
+/*!\brief A read-only, shared memory mapping of a whole file.
+ * \ingroup utility_bloom_filter
+ *
+ * \details
+ *
+ * The file is mapped with `MAP_SHARED`, i.e. all processes mapping the same file share the same physical pages via the
+ * page cache. Pages are only loaded on first access.
+ *
+ * On platforms without POSIX `mmap`, the file is read into memory instead.
+ */
+class memory_mapped_file
+{
+private:
+    //!\brief The start of the mapping.
+    void * address{nullptr};
+    //!\brief The size of the mapping in bytes.
+    size_t size_in_bytes{};
+#if !SEQAN3_HAS_MMAP
+    //!\brief Holds the content of the file if it cannot be mapped. 64-bit words keep the bitvector aligned.
+    std::unique_ptr<uint64_t[]> buffer{};
+#endif // !SEQAN3_HAS_MMAP
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    memory_mapped_file() = delete;                                       //!< Deleted.
+    memory_mapped_file(memory_mapped_file const &) = delete;             //!< Deleted.
+    memory_mapped_file & operator=(memory_mapped_file const &) = delete; //!< Deleted.
+    memory_mapped_file(memory_mapped_file &&) = delete;                  //!< Deleted.
+    memory_mapped_file & operator=(memory_mapped_file &&) = delete;      //!< Deleted.
+
+    //!\brief Unmaps the file.
+    ~memory_mapped_file()
+    {
+#if SEQAN3_HAS_MMAP
+        if (address != nullptr)
+            ::munmap(address, size_in_bytes);
+#endif // SEQAN3_HAS_MMAP
+    }
+
+    /*!\brief Maps the file at `path` read-only into memory.
+     * \param[in] path The file to map.
+     * \throws seqan3::file_open_error if the file cannot be opened or mapped.
+     */
+    explicit memory_mapped_file(std::filesystem::path const & path)
+    {
+#if SEQAN3_HAS_MMAP
+        int const file_descriptor = ::open(path.c_str(), O_RDONLY);
+
+        if (file_descriptor == -1)
+            throw file_open_error{"Could not open file " + path.string() + " for reading."};
+
+        struct stat file_status;
+        if (::fstat(file_descriptor, &file_status) == -1)
+        {
+            ::close(file_descriptor);
+            throw file_open_error{"Could not determine the size of file " + path.string() + "."};
+        }
+
+        size_in_bytes = static_cast<size_t>(file_status.st_size);
+
+        if (size_in_bytes > 0u)
+        {
+            address = ::mmap(nullptr, size_in_bytes, PROT_READ, MAP_SHARED, file_descriptor, 0);
+
+            if (address == MAP_FAILED)
+                address = nullptr;
+        }
+
+        // The mapping stays valid after closing the file descriptor.
+        ::close(file_descriptor);
+
+        if (size_in_bytes > 0u && address == nullptr)
+            throw file_open_error{"Could not memory-map file " + path.string() + "."};
+
+        // Bloom Filter queries access random positions, read-ahead would only waste I/O.
+        if (address != nullptr)
+            ::posix_madvise(address, size_in_bytes, POSIX_MADV_RANDOM);
+#else  // SEQAN3_HAS_MMAP
+        std::ifstream file{path, std::ios::binary | std::ios::ate};
+
+        if (!file.good())
+            throw file_open_error{"Could not open file " + path.string() + " for reading."};
+
+        size_in_bytes = static_cast<size_t>(file.tellg());
+        buffer = std::make_unique<uint64_t[]>((size_in_bytes + 7u) / 8u);
+        address = buffer.get();
+
+        file.seekg(0);
+        if (!file.read(static_cast<char *>(address), size_in_bytes))
+            throw file_open_error{"Could not read file " + path.string() + "."};
+#endif // SEQAN3_HAS_MMAP
+    }
+    //!\}
+
+    //!\brief Returns a pointer to the first byte of the mapping.
+    std::byte const * data() const noexcept
+    {
+        return static_cast<std::byte const *>(address);
+    }
+
+    //!\brief Returns the size of the mapping in bytes.
+    size_t size() const noexcept
+    {
+        return size_in_bytes;
+    }
+};
+
+/*!\brief The header of the memory-mappable on-disk format of the (Interleaved) Bloom Filter.
+ * \ingroup utility_bloom_filter
+ *
+ * \details
+ *
+ * A file consists of this 64 byte header, followed by the bitvector stored as 64-bit words in native byte order.
+ * Since the header is 64 bytes long, the words are cache line aligned within the (page aligned) mapping.
+ * The bitvector is followed by one additional zero word such that unaligned 64-bit reads at the end of the bitvector
+ * stay within the file.
+ */
+struct mapped_filter_header
+{
+    //!\brief Identifies the type of the stored filter.
+    std::array<char, 8> magic{};
+    //!\brief Used to detect files written on a machine with a different byte order.
+    uint64_t byte_order_mark{expected_byte_order_mark};
+    //!\brief The size of the stored bitvector in bits.
+    uint64_t bit_size{};
+    //!\brief Filter-specific parameters, e.g. the number of bins.
+    std::array<uint64_t, 5> parameters{};
+
+    //!\brief The expected value of `byte_order_mark`.
+    static constexpr uint64_t expected_byte_order_mark{0x0102'0304'0506'0708ULL};
+};
+
+static_assert(sizeof(mapped_filter_header) == 64u);
+static_assert(std::is_trivially_copyable_v<mapped_filter_header>);
+
+/*!\brief A read-only bitvector that views the words of a seqan3::detail::memory_mapped_file.
+ * \ingroup utility_bloom_filter
+ *
+ * \details
+ *
+ * Provides the subset of the interface of `seqan3::contrib::sdsl::bit_vector` that is needed for querying.
+ * Copies share the underlying mapping.
+ */
+class mapped_bit_vector
+{
+private:
+    //!\brief The mapped file. Shared by all copies.
+    std::shared_ptr<memory_mapped_file const> file{};
+    //!\brief The header stored in the file.
+    mapped_filter_header header_{};
+    //!\brief Points to the first word of the bitvector within the mapping.
+    uint64_t const * words{nullptr};
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    mapped_bit_vector() = default;                                      //!< Defaulted.
+    mapped_bit_vector(mapped_bit_vector const &) = default;             //!< Defaulted.
+    mapped_bit_vector & operator=(mapped_bit_vector const &) = default; //!< Defaulted.
+    mapped_bit_vector(mapped_bit_vector &&) = default;                  //!< Defaulted.
+    mapped_bit_vector & operator=(mapped_bit_vector &&) = default;      //!< Defaulted.
+    ~mapped_bit_vector() = default;                                     //!< Defaulted.
+
+    /*!\brief Maps a file that was written by seqan3::detail::write_mapped_filter.
+     * \param[in] path  The file to map.
+     * \param[in] magic The expected magic of the file.
+     * \throws seqan3::file_open_error if the file cannot be mapped or does not contain a filter of the expected type.
+     */
+    mapped_bit_vector(std::filesystem::path const & path, std::array<char, 8> const & magic) :
+        file{std::make_shared<memory_mapped_file const>(path)}
+    {
+        if (file->size() < sizeof(mapped_filter_header))
+            throw file_open_error{"The file " + path.string() + " is too small to contain a filter."};
+
+        std::memcpy(&header_, file->data(), sizeof(mapped_filter_header));
+
+        if (header_.magic != magic)
+            throw file_open_error{"The file " + path.string() + " does not contain a filter of the requested type."};
+
+        if (header_.byte_order_mark != mapped_filter_header::expected_byte_order_mark)
+            throw file_open_error{"The file " + path.string() + " was written with a different byte order."};
+
+        if (file->size() < sizeof(mapped_filter_header) + (word_count(header_.bit_size) + 1u) * sizeof(uint64_t))
+            throw file_open_error{"The file " + path.string() + " is truncated."};
+
+        words = reinterpret_cast<uint64_t const *>(file->data() + sizeof(mapped_filter_header));
+    }
+    //!\}
+
+    //!\brief Returns the number of 64-bit words needed to store `bit_size` many bits.
+    static constexpr size_t word_count(size_t const bit_size) noexcept
+    {
+        return (bit_size + 63u) >> 6;
+    }
+
+    //!\brief Returns the header stored in the file.
+    mapped_filter_header const & header() const noexcept
+    {
+        return header_;
+    }
+
+    //!\brief Returns the number of bits.
+    size_t size() const noexcept
+    {
+        return header_.bit_size;
+    }
+
+    //!\brief Returns a pointer to the first word.
+    uint64_t const * data() const noexcept
+    {
+        return words;
+    }
+
+    //!\brief Returns the `i`-th bit.
+    bool operator[](size_t const i) const noexcept
+    {
+        assert(i < size());
+        return (words[i >> 6] >> (i & 63u)) & 1u;
+    }
+
+    /*!\brief Returns the `len` bits starting at position `idx` as an integer.
+     * \param[in] idx The position of the first bit.
+     * \param[in] len The number of bits to read. Must be in `[1, 64]`.
+     */
+    uint64_t get_int(size_t const idx, uint8_t const len = 64) const noexcept
+    {
+        assert(len > 0u && len <= 64u);
+        assert(idx + len <= size());
+
+        size_t const offset = idx & 63u;
+        uint64_t result = words[idx >> 6] >> offset;
+
+        if (offset + len > 64u) // The padding word guarantees that `idx >> 6 + 1` is a valid word.
+            result |= words[(idx >> 6) + 1u] << (64u - offset);
+
+        return (len == 64u) ? result : result & ((1ULL << len) - 1u);
+    }
+
+    //!\brief Test for equality.
+    friend bool operator==(mapped_bit_vector const & lhs, mapped_bit_vector const & rhs) noexcept
+    {
+        if (lhs.size() != rhs.size())
+            return false;
+
+        return lhs.words == rhs.words || std::equal(lhs.words, lhs.words + word_count(lhs.size()), rhs.words);
+    }
+};
+
+/*!\brief Writes a bitvector in the memory-mappable on-disk format.
+ * \tparam bit_vector_t The type of the bitvector; must provide `size()` and `get_int(idx, len)`.
+ * \param[in] path   The file to write to. An existing file is overwritten.
+ * \param[in] header The header to write. `bit_size` is set to the size of `data`.
+ * \param[in] data   The bitvector to store.
+ * \throws seqan3::file_open_error if the file cannot be opened for writing.
+ * \throws seqan3::io_error if writing fails.
+ * \sa seqan3::detail::mapped_filter_header
+ */
+template <typename bit_vector_t>
+void write_mapped_filter(std::filesystem::path const & path, mapped_filter_header header, bit_vector_t const & data)
+{
+    std::ofstream out{path, std::ios::binary | std::ios::trunc};
+
+    if (!out.good())
+        throw file_open_error{"Could not open file " + path.string() + " for writing."};
+
+    header.bit_size = data.size();
+    out.write(reinterpret_cast<char const *>(&header), sizeof(mapped_filter_header));
+
+    // Words are gathered in a buffer to avoid a stream call per word.
+    constexpr size_t buffer_words{1u << 16};
+    std::vector<uint64_t> buffer{};
+    buffer.reserve(buffer_words);
+
+    auto flush = [&]()
+    {
+        out.write(reinterpret_cast<char const *>(buffer.data()), buffer.size() * sizeof(uint64_t));
+        buffer.clear();
+    };
+
+    for (size_t idx = 0; idx < data.size(); idx += 64u)
+    {
+        buffer.push_back(data.get_int(idx, static_cast<uint8_t>(std::min<size_t>(64u, data.size() - idx))));
+
+        if (buffer.size() == buffer_words)
+            flush();
+    }
+
+    buffer.push_back(0u); // padding word
+    flush();
+
+    if (!out.good())
+        throw io_error{"Could not write to file " + path.string() + "."};
+}
+
+} // namespace seqan3::detail
@@ -23,9 +23,15 @@
  * ### Concurrency support
  *
  * This module contains helper classes to synchronise threads in concurrent environments.
+ *
+ * ### Thread pool
+ *
+ * seqan3::thread_pool provides persistent threads that can be shared by several invocations of the parallel
+ * algorithms.
  */
 //!\endcond
 
 #pragma once
 
 #include <seqan3/core/platform.hpp>
+#include <seqan3/utility/parallel/thread_pool.hpp>
@@ -0,0 +1,265 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides seqan3::thread_pool.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <concepts>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <seqan3/std/new>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <seqan3/core/platform.hpp>
+
+namespace seqan3
+{
+
+/*!\brief A persistent work-stealing thread pool that can be shared by several algorithm invocations.
+ * \ingroup utility_parallel
+ *
+ * \details
+ *
+ * The pool spawns its threads once on construction and joins them on destruction. Passing a pool to
+ * seqan3::align_cfg::parallel or seqan3::search_cfg::parallel lets consecutive calls of seqan3::align_pairwise or
+ * seqan3::search reuse the same threads instead of spawning new ones for every call.
+ *
+ * Every thread owns a double-ended task queue. A thread takes the oldest task from the front of its own queue, such
+ * that independent tasks are roughly executed in the order of submission, and, if its queue is empty, steals the
+ * newest task from the back of another queue, i.e. the owner and the thief work on opposite ends. Tasks submitted
+ * from outside of the pool are distributed round-robin over the queues; tasks submitted by a task of the pool are put
+ * into the queue of the executing thread. Idle threads sleep until a new task is submitted.
+ *
+ * Tasks are not type-erased into a std::function. A task is a reference to a callable that is owned by the caller
+ * and invoked without arguments. The callable must stay alive until it was invoked. Only the threads of the pool
+ * execute tasks, i.e. at most seqan3::thread_pool::size tasks run at the same time.
+ *
+ * ### Example
+ *
+ * \include test/snippet/utility/parallel/thread_pool.cpp
+ *
+ * ### Thread safety
+ *
+ * seqan3::thread_pool::submit and seqan3::thread_pool::run_pending_task may be called concurrently from any thread.
+ *
+ * \experimentalapi{Experimental since version 3.4.}
+ */
+class thread_pool
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \brief The pool is neither copyable nor movable.
+     * \{
+     */
+    thread_pool() = delete;                                //!< Deleted.
+    thread_pool(thread_pool const &) = delete;             //!< Deleted.
+    thread_pool(thread_pool &&) = delete;                  //!< Deleted.
+    thread_pool & operator=(thread_pool const &) = delete; //!< Deleted.
+    thread_pool & operator=(thread_pool &&) = delete;      //!< Deleted.
+
+    /*!\brief Spawns `thread_count` many threads.
+     * \param[in] thread_count The number of threads; must be greater than 0.
+     * \throws std::invalid_argument if `thread_count` is 0.
+     */
+    explicit thread_pool(size_t const thread_count) : queue_count{thread_count}
+    {
+        if (thread_count == 0)
+            throw std::invalid_argument{"A thread pool needs at least one thread."};
+
+        queues = std::make_unique<task_queue[]>(thread_count);
+        threads.reserve(thread_count);
+        for (size_t index = 0; index < thread_count; ++index)
+        {
+            threads.emplace_back(
+                [this, index]()
+                {
+                    run(index);
+                });
+        }
+    }
+
+    //!\brief Executes the pending tasks and joins the threads.
+    ~thread_pool()
+    {
+        {
+            std::lock_guard lock{sleep_mutex};
+            stopped = true;
+        }
+        wake_up.notify_all();
+
+        for (std::thread & thread : threads)
+            thread.join();
+    }
+    //!\}
+
+    //!\brief Returns the number of threads of the pool.
+    size_t size() const noexcept
+    {
+        return queue_count;
+    }
+
+    /*!\brief Submits a task to the pool.
+     * \tparam callable_t The type of the task; must model std::invocable without arguments.
+     * \param[in] callable The task; must stay alive until it was invoked.
+     */
+    template <std::invocable callable_t>
+    void submit(callable_t & callable)
+    {
+        task_type task{[](void * context)
+                       {
+                           (*static_cast<callable_t *>(context))();
+                       },
+                       std::addressof(callable)};
+
+        size_t const index =
+            (current_pool == this) ? current_index : next_queue.fetch_add(1, std::memory_order_relaxed) % queue_count;
+        {
+            std::lock_guard lock{queues[index].mutex};
+            queues[index].tasks.push_back(task);
+        }
+        {
+            std::lock_guard lock{sleep_mutex};
+            ++pending_tasks;
+        }
+        wake_up.notify_one();
+    }
+
+    /*!\brief Executes one pending task if the calling thread is a thread of this pool.
+     * \returns `true` if a task was executed, `false` if no task was pending or the calling thread does not belong to
+     *          the pool.
+     *
+     * \details
+     *
+     * A task waiting for the completion of other tasks of the same pool must call this function instead of blocking.
+     * Otherwise, all threads of the pool might wait for tasks that no thread executes. Threads outside of the pool do
+     * not execute tasks, such that never more than seqan3::thread_pool::size threads execute tasks at once.
+     */
+    bool run_pending_task()
+    {
+        if (current_pool != this)
+            return false;
+
+        if (task_type task{}; take_task(current_index, task))
+        {
+            task.function(task.context);
+            return true;
+        }
+        return false;
+    }
+
+private:
+    //!\brief A task: the function invoking the callable and the address of the callable.
+    struct task_type
+    {
+        //!\brief Invokes the callable stored at the given address.
+        void (*function)(void *){nullptr};
+        //!\brief The address of the callable.
+        void * context{nullptr};
+    };
+
+    //!\brief The task queue of one thread; aligned to avoid false sharing between the queues.
+    struct alignas(std::hardware_destructive_interference_size) task_queue
+    {
+        //!\brief Guards the tasks.
+        std::mutex mutex{};
+        //!\brief The tasks; the owning thread takes from the front, other threads steal from the back.
+        std::deque<task_type> tasks{};
+    };
+
+    /*!\brief Takes a task from the own queue or steals one from another queue.
+     * \param[in] index The index of the own queue.
+     * \param[out] task The taken task.
+     * \returns `true` if a task was taken.
+     */
+    bool take_task(size_t const index, task_type & task)
+    {
+        for (size_t offset = 0; offset < queue_count; ++offset)
+        {
+            task_queue & queue = queues[(index + offset) % queue_count];
+            std::lock_guard lock{queue.mutex};
+            if (queue.tasks.empty())
+                continue;
+
+            if (offset == 0)
+            {
+                task = queue.tasks.front();
+                queue.tasks.pop_front();
+            }
+            else
+            {
+                task = queue.tasks.back();
+                queue.tasks.pop_back();
+            }
+
+            pending_tasks.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+        return false;
+    }
+
+    /*!\brief The loop executed by every thread of the pool.
+     * \param[in] index The index of the queue owned by the thread.
+     */
+    void run(size_t const index)
+    {
+        current_pool = this;
+        current_index = index;
+
+        for (task_type task{};;)
+        {
+            if (take_task(index, task))
+            {
+                task.function(task.context);
+                continue;
+            }
+
+            std::unique_lock lock{sleep_mutex};
+            wake_up.wait(lock,
+                         [this]
+                         {
+                             return stopped || pending_tasks.load(std::memory_order_relaxed) > 0;
+                         });
+
+            if (stopped && pending_tasks.load(std::memory_order_relaxed) <= 0)
+                return;
+        }
+    }
+
+    //!\brief The pool whose thread is the calling thread.
+    static inline thread_local thread_pool * current_pool{nullptr};
+    //!\brief The index of the queue owned by the calling thread.
+    static inline thread_local size_t current_index{0};
+
+    //!\brief The number of queues, i.e. the number of threads.
+    size_t queue_count{};
+    //!\brief The task queues; one per thread.
+    std::unique_ptr<task_queue[]> queues{};
+    //!\brief The queue receiving the next task submitted from outside of the pool.
+    std::atomic<size_t> next_queue{0};
+    /*!\brief The number of submitted tasks that have not been taken.
+     * \details Signed, since a task can be taken before the submitting thread incremented the counter.
+     */
+    std::atomic<int64_t> pending_tasks{0};
+    //!\brief Guards sleeping and stopping of the threads.
+    std::mutex sleep_mutex{};
+    //!\brief Wakes up sleeping threads.
+    std::condition_variable wake_up{};
+    //!\brief Whether the pool is being destructed.
+    bool stopped{false};
+    //!\brief The threads of the pool.
+    std::vector<std::thread> threads{};
+};
+
+} // namespace seqan3
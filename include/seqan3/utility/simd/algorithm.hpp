@@ -114,6 +114,82 @@ constexpr target_simd_t upcast_unsigned(source_simd_t const & src)
         static_assert(simd_traits<source_simd_t>::max_length <= 32, "simd type is not supported.");
 }
 
+/*!\brief Whether seqan3::detail::shuffle_lookup is computed with byte shuffle instructions for the given simd type.
+ * \ingroup utility_simd
+ * \tparam simd_t The simd type of the looked up entries.
+ *
+ * \details
+ *
+ * This is the case for native builtin simd types with 8, 16 or 32 bit elements if SSE4, AVX2 or AVX512BW is
+ * available. Otherwise, seqan3::detail::shuffle_lookup looks up every element separately.
+ */
+template <typename simd_t>
+inline constexpr bool has_shuffle_lookup_v = []() constexpr
+{
+    if constexpr (is_builtin_simd_v<simd_t> && is_native_builtin_simd_v<simd_t>)
+    {
+        using scalar_t = typename simd_traits<simd_t>::scalar_type;
+        constexpr bool has_shuffle_instruction =
+#if defined(__AVX512BW__)
+            true;
+#else
+            simd_traits<simd_t>::max_length <= 32;
+#endif // defined(__AVX512BW__)
+        return has_shuffle_instruction && sizeof(scalar_t) <= 4;
+    }
+    else
+    {
+        return false;
+    }
+}();
+
+/*!\brief Looks up the entries of a table with 16 entries for every element of the index vector.
+ * \ingroup utility_simd
+ * \tparam simd_t The simd type of the index and the result; must model seqan3::simd::simd_concept.
+ * \tparam table_simd_t The simd type of the table; must model seqan3::simd::simd_concept with 8 bit elements and
+ *                      must have the same size in bytes as `simd_t` and at least 16 elements.
+ * \param[in] table The 16 entries of the table, repeated in every block of 16 elements.
+ * \param[in] index The indices of the entries; every index must be in the range [0, 128).
+ * \returns A vector with the entry `table[index[i] % 16]` (sign-extended) at every position `i`.
+ *
+ * \details
+ *
+ * If seqan3::detail::has_shuffle_lookup_v is `true` for `simd_t`, the lookup costs a single byte shuffle
+ * (`pshufb`) and for 16 and 32 bit elements two further instructions, instead of one memory access per element.
+ * Larger tables can be looked up by combining the lookups of several tables with the index modulo 16, selected by
+ * the index divided by 16.
+ */
+template <simd::simd_concept simd_t, simd::simd_concept table_simd_t>
+constexpr simd_t shuffle_lookup(table_simd_t const & table, simd_t const & index)
+{
+    static_assert(sizeof(typename simd_traits<table_simd_t>::scalar_type) == 1, "The table must have 8 bit elements.");
+    static_assert(sizeof(table_simd_t) == sizeof(simd_t), "The table and the index must have the same size.");
+    static_assert(simd_traits<table_simd_t>::length >= 16, "The table must have at least 16 elements.");
+
+    if constexpr (has_shuffle_lookup_v<simd_t> && simd_traits<simd_t>::max_length == 16) // SSE4
+    {
+        return shuffle_lookup_sse4(table, index);
+    }
+    else if constexpr (has_shuffle_lookup_v<simd_t> && simd_traits<simd_t>::max_length == 32) // AVX2
+    {
+        return shuffle_lookup_avx2(table, index);
+    }
+#if defined(__AVX512BW__)
+    else if constexpr (has_shuffle_lookup_v<simd_t> && simd_traits<simd_t>::max_length == 64) // AVX512
+    {
+        return shuffle_lookup_avx512(table, index);
+    }
+#endif // defined(__AVX512BW__)
+    else // Anything else
+    {
+        using scalar_t = typename simd_traits<simd_t>::scalar_type;
+        simd_t result{};
+        for (size_t i = 0; i < simd_traits<simd_t>::length; ++i)
+            result[i] = static_cast<scalar_t>(table[index[i] % 16]);
+        return result;
+    }
+}
+
 /*!\brief Extracts one half of the given simd vector and stores the result in the lower half of the target vector.
  * \ingroup utility_simd
  * \tparam index An index value in the range of [0, 1].
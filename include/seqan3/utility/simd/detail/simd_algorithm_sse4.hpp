@@ -70,6 +70,12 @@ constexpr simd_t extract_quarter_sse4(simd_t const & src);
 template <uint8_t index, simd::simd_concept simd_t>
 constexpr simd_t extract_eighth_sse4(simd_t const & src);
 
+/*!\copydoc seqan3::detail::shuffle_lookup
+ * \attention This is the implementation for SSE4 intrinsics.
+ */
+template <simd::simd_concept simd_t, simd::simd_concept table_simd_t>
+constexpr simd_t shuffle_lookup_sse4(table_simd_t const & table, simd_t const & index);
+
 } // namespace seqan3::detail
 
 //-----------------------------------------------------------------------------
@@ -231,6 +237,32 @@ constexpr simd_t extract_eighth_sse4(simd_t const & src)
     return reinterpret_cast<simd_t>(_mm_srli_si128(reinterpret_cast<__m128i const &>(src), index << 1));
 }
 
+template <simd::simd_concept simd_t, simd::simd_concept table_simd_t>
+constexpr simd_t shuffle_lookup_sse4(table_simd_t const & table, simd_t const & index)
+{
+    using scalar_t = typename simd_traits<simd_t>::scalar_type;
+    __m128i const & table_vector = reinterpret_cast<__m128i const &>(table);
+    __m128i const & index_vector = reinterpret_cast<__m128i const &>(index);
+
+    // Wider elements look up the entry in their highest byte and zero the other bytes (index with the highest bit
+    // set), such that an arithmetic shift sign-extends the entry.
+    if constexpr (sizeof(scalar_t) == 1)
+    {
+        return reinterpret_cast<simd_t>(_mm_shuffle_epi8(table_vector, index_vector));
+    }
+    else if constexpr (sizeof(scalar_t) == 2)
+    {
+        __m128i const shifted_index = _mm_or_si128(_mm_slli_epi16(index_vector, 8), _mm_set1_epi16(0x0080));
+        return reinterpret_cast<simd_t>(_mm_srai_epi16(_mm_shuffle_epi8(table_vector, shifted_index), 8));
+    }
+    else
+    {
+        static_assert(sizeof(scalar_t) == 4, "The shuffle lookup supports 8, 16 and 32 bit elements.");
+        __m128i const shifted_index = _mm_or_si128(_mm_slli_epi32(index_vector, 24), _mm_set1_epi32(0x00808080));
+        return reinterpret_cast<simd_t>(_mm_srai_epi32(_mm_shuffle_epi8(table_vector, shifted_index), 24));
+    }
+}
+
 } // namespace seqan3::detail
 
 #endif // __SSE4_2__
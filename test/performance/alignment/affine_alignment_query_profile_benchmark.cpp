@@ -0,0 +1,78 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_method.hpp>
+#include <seqan3/alignment/configuration/align_config_output.hpp>
+#include <seqan3/alignment/configuration/align_config_query_profile.hpp>
+#include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
+#include <seqan3/alignment/configuration/align_config_vectorised.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/aminoacid_scoring_scheme.hpp>
+#include <seqan3/alphabet/aminoacid/aa27.hpp>
+#include <seqan3/test/compatibility/benchmark.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+#include <seqan3/utility/views/repeat_n.hpp>
+#include <seqan3/utility/views/zip.hpp>
+
+// One protein query against a database of proteins, e.g. a database search.
+template <typename method_t, bool use_query_profile>
+void affine_query_against_database(benchmark::State & state)
+{
+    size_t const query_length = state.range(0);
+    size_t const database_size = 1'000;
+    auto query = seqan3::test::generate_sequence<seqan3::aa27>(query_length, 0, 0);
+    std::vector<std::vector<seqan3::aa27>> database{};
+    for (size_t i = 0; i < database_size; ++i)
+        database.push_back(seqan3::test::generate_sequence<seqan3::aa27>(query_length, query_length / 2, i + 1));
+
+    auto sequence_pairs = seqan3::views::zip(seqan3::views::repeat_n(query, database.size()), database);
+
+    auto cfg = method_t{}
+             | seqan3::align_cfg::scoring_scheme{
+                 seqan3::aminoacid_scoring_scheme{seqan3::aminoacid_similarity_matrix::blosum62}}
+             | seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-10},
+                                                  seqan3::align_cfg::extension_score{-1}}
+             | seqan3::align_cfg::output_score{} | seqan3::align_cfg::output_end_position{}
+             | seqan3::align_cfg::vectorised{};
+
+    int64_t score = 0;
+    size_t cells = 0;
+    for (auto const & sequence : database)
+        cells += query_length * sequence.size();
+
+    auto run = [&](auto const & config)
+    {
+        for (auto _ : state)
+        {
+            for (auto && result : seqan3::align_pairwise(sequence_pairs, config))
+                score += result.score();
+        }
+    };
+
+    if constexpr (use_query_profile)
+        run(cfg | seqan3::align_cfg::query_profile{});
+    else
+        run(cfg);
+
+    state.counters["score"] = score;
+    state.counters["cells/s"] = benchmark::Counter(state.iterations() * cells, benchmark::Counter::kIsRate);
+}
+
+static void arguments(benchmark::Benchmark * b)
+{
+    for (int64_t query_length : {100, 400})
+        b->Args({query_length});
+}
+
+BENCHMARK_TEMPLATE(affine_query_against_database, seqan3::align_cfg::method_global, false)->Apply(arguments);
+BENCHMARK_TEMPLATE(affine_query_against_database, seqan3::align_cfg::method_global, true)->Apply(arguments);
+BENCHMARK_TEMPLATE(affine_query_against_database, seqan3::align_cfg::method_local, false)->Apply(arguments);
+BENCHMARK_TEMPLATE(affine_query_against_database, seqan3::align_cfg::method_local, true)->Apply(arguments);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,66 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <benchmark/benchmark.h>
+
+#include <tuple>
+
+#include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_method.hpp>
+#include <seqan3/alignment/configuration/align_config_output.hpp>
+#include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
+#include <seqan3/alignment/configuration/align_config_vectorised.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/test/compatibility/benchmark.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+
+// A single long pair, e.g. a contig against a reference region; only the striped kernel vectorises it.
+template <typename method_t, bool is_vectorised>
+void affine_single_pair(benchmark::State & state)
+{
+    size_t const sequence_length = state.range(0);
+    auto sequence1 = seqan3::test::generate_sequence<seqan3::dna4>(sequence_length, 0, 0);
+    auto sequence2 = seqan3::test::generate_sequence<seqan3::dna4>(sequence_length, 0, 1);
+
+    auto cfg = method_t{}
+             | seqan3::align_cfg::scoring_scheme{
+                 seqan3::nucleotide_scoring_scheme{seqan3::match_score{4}, seqan3::mismatch_score{-5}}}
+             | seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-10},
+                                                  seqan3::align_cfg::extension_score{-1}}
+             | seqan3::align_cfg::output_score{} | seqan3::align_cfg::output_end_position{};
+
+    int64_t score = 0;
+    auto run = [&](auto const & config)
+    {
+        for (auto _ : state)
+        {
+            for (auto && result : seqan3::align_pairwise(std::tie(sequence1, sequence2), config))
+                score += result.score();
+        }
+    };
+
+    if constexpr (is_vectorised)
+        run(cfg | seqan3::align_cfg::vectorised{});
+    else
+        run(cfg);
+
+    state.counters["score"] = score;
+    state.counters["cells/s"] =
+        benchmark::Counter(state.iterations() * sequence_length * sequence_length, benchmark::Counter::kIsRate);
+}
+
+static void arguments(benchmark::Benchmark * b)
+{
+    for (int64_t sequence_length : {1'000, 10'000})
+        b->Args({sequence_length});
+}
+
+BENCHMARK_TEMPLATE(affine_single_pair, seqan3::align_cfg::method_global, false)->Apply(arguments);
+BENCHMARK_TEMPLATE(affine_single_pair, seqan3::align_cfg::method_global, true)->Apply(arguments);
+BENCHMARK_TEMPLATE(affine_single_pair, seqan3::align_cfg::method_local, false)->Apply(arguments);
+BENCHMARK_TEMPLATE(affine_single_pair, seqan3::align_cfg::method_local, true)->Apply(arguments);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,90 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_band.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/test/compatibility/benchmark.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+
+// Verification of a long read against a reference window: the read is a copy of the window with some errors.
+auto generate_read(std::vector<seqan3::dna4> const & window)
+{
+    std::mt19937_64 engine{42};
+    std::uniform_int_distribution<int> operation_distribution{0, 99};
+    std::vector<seqan3::dna4> read{};
+
+    for (seqan3::dna4 letter : window)
+    {
+        int const operation = operation_distribution(engine);
+        if (operation == 0) // deletion
+            continue;
+        else if (operation == 1) // substitution
+            letter.assign_rank((letter.to_rank() + 1) % 4);
+        else if (operation == 2) // insertion
+            read.push_back(letter);
+        read.push_back(letter);
+    }
+
+    return read;
+}
+
+template <bool with_alignment>
+void edit_distance(benchmark::State & state)
+{
+    size_t const sequence_length = state.range(0);
+    int32_t const band_width = state.range(1);
+    auto window = seqan3::test::generate_sequence<seqan3::dna4>(sequence_length, 0, 0);
+    auto read = generate_read(window);
+
+    auto cfg = seqan3::align_cfg::method_global{} | seqan3::align_cfg::edit_scheme | seqan3::align_cfg::output_score{};
+    int32_t const size_difference = static_cast<int32_t>(window.size()) - static_cast<int32_t>(read.size());
+    auto band = seqan3::align_cfg::band_fixed_size{
+        seqan3::align_cfg::lower_diagonal{std::min(0, size_difference) - band_width},
+        seqan3::align_cfg::upper_diagonal{std::max(0, size_difference) + band_width}};
+
+    int score = 0;
+    auto run = [&](auto const & config)
+    {
+        for (auto _ : state)
+        {
+            for (auto && result : seqan3::align_pairwise(std::tie(window, read), config))
+                score += result.score();
+        }
+    };
+
+    auto output_cfg = [&]()
+    {
+        if constexpr (with_alignment)
+            return cfg | seqan3::align_cfg::output_alignment{};
+        else
+            return cfg;
+    }();
+
+    // A band width of 0 denotes the unbanded algorithm.
+    if (band_width == 0)
+        run(output_cfg);
+    else
+        run(output_cfg | band);
+
+    state.counters["score"] = score;
+    state.counters["bp/s"] = benchmark::Counter(state.iterations() * sequence_length, benchmark::Counter::kIsRate);
+}
+
+static void arguments(benchmark::Benchmark * b)
+{
+    for (int64_t sequence_length : {10'000, 100'000})
+        for (int64_t band_width : {0, 16, 64, 256})
+            b->Args({sequence_length, band_width});
+}
+
+BENCHMARK_TEMPLATE(edit_distance, false)->Apply(arguments);
+BENCHMARK_TEMPLATE(edit_distance, true)->Apply(arguments);
+
+BENCHMARK_MAIN();
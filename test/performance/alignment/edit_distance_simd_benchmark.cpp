@@ -0,0 +1,91 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_vectorised.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/test/compatibility/benchmark.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+
+// Candidate verifications: each query is aligned against a mutated copy of itself with some flanking sequence.
+auto generate_sequence_pairs(size_t const query_length, size_t const pair_count)
+{
+    std::mt19937_64 engine{42};
+    std::uniform_int_distribution<int> operation_distribution{0, 49};
+    std::vector<std::pair<std::vector<seqan3::dna4>, std::vector<seqan3::dna4>>> sequence_pairs{};
+
+    for (size_t i = 0; i < pair_count; ++i)
+    {
+        auto query = seqan3::test::generate_sequence<seqan3::dna4>(query_length, 0, i);
+        auto database = seqan3::test::generate_sequence<seqan3::dna4>(4, 0, pair_count + i);
+
+        for (seqan3::dna4 letter : query)
+        {
+            int const operation = operation_distribution(engine);
+            if (operation == 0) // deletion
+                continue;
+            else if (operation == 1) // substitution
+                letter.assign_rank((letter.to_rank() + 1) % 4);
+            else if (operation == 2) // insertion
+                database.push_back(letter);
+            database.push_back(letter);
+        }
+
+        auto suffix = seqan3::test::generate_sequence<seqan3::dna4>(4, 0, 2 * pair_count + i);
+        database.insert(database.end(), suffix.begin(), suffix.end());
+        sequence_pairs.emplace_back(std::move(database), std::move(query));
+    }
+
+    return sequence_pairs;
+}
+
+template <bool is_vectorised>
+void edit_distance_batch(benchmark::State & state)
+{
+    size_t const query_length = state.range(0);
+    size_t const pair_count = 10'000;
+    auto sequence_pairs = generate_sequence_pairs(query_length, pair_count);
+
+    auto cfg = seqan3::align_cfg::method_global{seqan3::align_cfg::free_end_gaps_sequence1_leading{true},
+                                                seqan3::align_cfg::free_end_gaps_sequence2_leading{false},
+                                                seqan3::align_cfg::free_end_gaps_sequence1_trailing{true},
+                                                seqan3::align_cfg::free_end_gaps_sequence2_trailing{false}}
+             | seqan3::align_cfg::edit_scheme | seqan3::align_cfg::output_score{}
+             | seqan3::align_cfg::output_end_position{};
+
+    int64_t score = 0;
+    auto run = [&](auto const & config)
+    {
+        for (auto _ : state)
+        {
+            for (auto && result : seqan3::align_pairwise(sequence_pairs, config))
+                score += result.score();
+        }
+    };
+
+    if constexpr (is_vectorised)
+        run(cfg | seqan3::align_cfg::vectorised{});
+    else
+        run(cfg);
+
+    state.counters["score"] = score;
+    state.counters["pairs/s"] = benchmark::Counter(state.iterations() * pair_count, benchmark::Counter::kIsRate);
+}
+
+static void arguments(benchmark::Benchmark * b)
+{
+    for (int64_t query_length : {16, 32, 64})
+        b->Args({query_length});
+}
+
+BENCHMARK_TEMPLATE(edit_distance_batch, false)->Apply(arguments);
+BENCHMARK_TEMPLATE(edit_distance_batch, true)->Apply(arguments);
+
+BENCHMARK_MAIN();
@@ -11,6 +11,7 @@
 #include <utility>
 #include <vector>
 
+#include <seqan3/alignment/cigar_conversion/cigar_from_alignment.hpp>
 #include <seqan3/alignment/pairwise/align_pairwise.hpp>
 #include <seqan3/alphabet/aminoacid/aa20.hpp>
 #include <seqan3/alphabet/nucleotide/dna4.hpp>
@@ -94,6 +95,70 @@ void seqan3_affine_dna4_trace(benchmark::State & state)
 
 BENCHMARK(seqan3_affine_dna4_trace);
 
+// ============================================================================
+//  affine; cigar; dna4; single
+// ============================================================================
+
+void seqan3_affine_dna4_cigar_from_alignment(benchmark::State & state)
+{
+    size_t sequence_length = 500;
+    auto seq1 = seqan3::test::generate_sequence<seqan3::dna4>(sequence_length, 0, 0);
+    auto seq2 = seqan3::test::generate_sequence<seqan3::dna4>(sequence_length, 0, 1);
+    auto const output = seqan3::align_cfg::output_begin_position{} | seqan3::align_cfg::output_alignment{};
+
+    for (auto _ : state)
+    {
+        auto rng = align_pairwise(std::tie(seq1, seq2), affine_cfg | output);
+        benchmark::DoNotOptimize(seqan3::cigar_from_alignment((*std::ranges::begin(rng)).alignment()));
+    }
+
+    state.counters["cells"] = seqan3::test::pairwise_cell_updates(std::views::single(std::tie(seq1, seq2)), affine_cfg);
+    state.counters["CUPS"] = seqan3::test::cell_updates_per_second(state.counters["cells"]);
+}
+
+BENCHMARK(seqan3_affine_dna4_cigar_from_alignment);
+
+void seqan3_affine_dna4_cigar(benchmark::State & state)
+{
+    size_t sequence_length = 500;
+    auto seq1 = seqan3::test::generate_sequence<seqan3::dna4>(sequence_length, 0, 0);
+    auto seq2 = seqan3::test::generate_sequence<seqan3::dna4>(sequence_length, 0, 1);
+    auto const output = seqan3::align_cfg::output_begin_position{} | seqan3::align_cfg::output_cigar{};
+
+    for (auto _ : state)
+    {
+        auto rng = align_pairwise(std::tie(seq1, seq2), affine_cfg | output);
+        benchmark::DoNotOptimize((*std::ranges::begin(rng)).cigar_sequence());
+    }
+
+    state.counters["cells"] = seqan3::test::pairwise_cell_updates(std::views::single(std::tie(seq1, seq2)), affine_cfg);
+    state.counters["CUPS"] = seqan3::test::cell_updates_per_second(state.counters["cells"]);
+}
+
+BENCHMARK(seqan3_affine_dna4_cigar);
+
+// ============================================================================
+//  affine; begin position; dna4; single
+// ============================================================================
+
+void seqan3_affine_dna4_begin_position(benchmark::State & state)
+{
+    size_t sequence_length = state.range(0);
+    auto seq1 = seqan3::test::generate_sequence<seqan3::dna4>(sequence_length, 0, 0);
+    auto seq2 = seqan3::test::generate_sequence<seqan3::dna4>(sequence_length, 0, 1);
+
+    for (auto _ : state)
+    {
+        auto rng = align_pairwise(std::tie(seq1, seq2), affine_cfg | seqan3::align_cfg::output_begin_position{});
+        *std::ranges::begin(rng);
+    }
+
+    state.counters["cells"] = seqan3::test::pairwise_cell_updates(std::views::single(std::tie(seq1, seq2)), affine_cfg);
+    state.counters["CUPS"] = seqan3::test::cell_updates_per_second(state.counters["cells"]);
+}
+
+BENCHMARK(seqan3_affine_dna4_begin_position)->Arg(500)->Arg(5000);
+
 #ifdef SEQAN3_HAS_SEQAN2
 
 void seqan2_affine_dna4_trace(benchmark::State & state)
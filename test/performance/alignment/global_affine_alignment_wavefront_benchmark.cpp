@@ -0,0 +1,125 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_edit.hpp>
+#include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_method.hpp>
+#include <seqan3/alignment/configuration/align_config_output.hpp>
+#include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
+#include <seqan3/alignment/configuration/align_config_wavefront.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/test/compatibility/benchmark.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+
+// Pairs of highly similar sequences, e.g. two haplotypes or a read and its polished version.
+std::vector<std::pair<std::vector<seqan3::dna4>, std::vector<seqan3::dna4>>>
+generate_similar_pairs(size_t const sequence_length, size_t const error_permille, size_t const pair_count)
+{
+    std::mt19937_64 engine{42};
+    std::uniform_int_distribution<size_t> permille_distribution{0, 999};
+    std::uniform_int_distribution<size_t> operation_distribution{0, 2};
+    std::uniform_int_distribution<size_t> rank_distribution{0, 3};
+
+    std::vector<std::pair<std::vector<seqan3::dna4>, std::vector<seqan3::dna4>>> sequence_pairs{};
+    for (size_t pair = 0; pair < pair_count; ++pair)
+    {
+        auto sequence1 = seqan3::test::generate_sequence<seqan3::dna4>(sequence_length, 0, pair);
+        std::vector<seqan3::dna4> sequence2{};
+        for (seqan3::dna4 const letter : sequence1)
+        {
+            if (permille_distribution(engine) >= error_permille)
+                sequence2.push_back(letter);
+            else if (size_t const operation = operation_distribution(engine); operation == 0) // substitution
+                sequence2.push_back(seqan3::assign_rank_to(rank_distribution(engine), seqan3::dna4{}));
+            else if (operation == 1) // insertion
+                sequence2.insert(sequence2.end(), {seqan3::assign_rank_to(rank_distribution(engine), seqan3::dna4{}),
+                                                   letter});
+            // Otherwise a deletion.
+        }
+        sequence_pairs.emplace_back(std::move(sequence1), std::move(sequence2));
+    }
+    return sequence_pairs;
+}
+
+enum struct costs
+{
+    affine,
+    edit
+};
+
+template <costs cost_model, bool use_wavefront, bool with_alignment>
+void similar_sequences(benchmark::State & state)
+{
+    auto sequence_pairs = generate_similar_pairs(state.range(0), state.range(1), 10);
+
+    auto scoring_config = [&]()
+    {
+        if constexpr (cost_model == costs::affine)
+            return seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{seqan3::match_score{2},
+                                                                                      seqan3::mismatch_score{-4}}}
+                 | seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-4},
+                                                      seqan3::align_cfg::extension_score{-2}};
+        else
+            return seqan3::align_cfg::edit_scheme;
+    }();
+
+    auto output_config = [&]()
+    {
+        if constexpr (with_alignment)
+            return seqan3::align_cfg::output_score{} | seqan3::align_cfg::output_alignment{};
+        else
+            return seqan3::align_cfg::output_score{} | seqan3::align_cfg::output_end_position{};
+    }();
+
+    auto cfg = seqan3::align_cfg::method_global{} | scoring_config | output_config;
+
+    int64_t score = 0;
+    auto run = [&](auto const & config)
+    {
+        for (auto _ : state)
+        {
+            for (auto && result : seqan3::align_pairwise(sequence_pairs, config))
+                score += result.score();
+        }
+    };
+
+    if constexpr (use_wavefront)
+        run(cfg | seqan3::align_cfg::wavefront{});
+    else
+        run(cfg);
+
+    size_t cells = 0;
+    for (auto const & [sequence1, sequence2] : sequence_pairs)
+        cells += sequence1.size() * sequence2.size();
+
+    state.counters["score"] = score;
+    state.counters["cells/s"] = benchmark::Counter(state.iterations() * cells, benchmark::Counter::kIsRate);
+}
+
+// The sequence length and the error rate in per mille.
+static void arguments(benchmark::Benchmark * b)
+{
+    for (int64_t sequence_length : {1'000, 10'000})
+        for (int64_t error_permille : {1, 10, 50})
+            b->Args({sequence_length, error_permille});
+}
+
+BENCHMARK_TEMPLATE(similar_sequences, costs::affine, false, false)->Apply(arguments);
+BENCHMARK_TEMPLATE(similar_sequences, costs::affine, true, false)->Apply(arguments);
+BENCHMARK_TEMPLATE(similar_sequences, costs::affine, false, true)->Apply(arguments);
+BENCHMARK_TEMPLATE(similar_sequences, costs::affine, true, true)->Apply(arguments);
+BENCHMARK_TEMPLATE(similar_sequences, costs::edit, false, false)->Apply(arguments);
+BENCHMARK_TEMPLATE(similar_sequences, costs::edit, true, false)->Apply(arguments);
+BENCHMARK_TEMPLATE(similar_sequences, costs::edit, false, true)->Apply(arguments);
+BENCHMARK_TEMPLATE(similar_sequences, costs::edit, true, true)->Apply(arguments);
+
+BENCHMARK_MAIN();
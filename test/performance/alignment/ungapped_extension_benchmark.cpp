@@ -0,0 +1,149 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+#include <seqan3/alignment/pairwise/extend_ungapped.hpp>
+#include <seqan3/alphabet/container/bitpacked_sequence.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+
+inline constexpr int32_t match = 1;
+inline constexpr int32_t mismatch = -3;
+inline constexpr int32_t drop_score = 20;
+
+// Extends letter by letter over the ranks, as done without seqan3::extend_ungapped.
+template <typename sequence_t>
+seqan3::ungapped_extension_result scalar_extend_ungapped(sequence_t const & sequence1,
+                                                         sequence_t const & sequence2,
+                                                         size_t const position1,
+                                                         size_t const position2)
+{
+    auto extend = [](auto && ranks_match, size_t const max_length)
+    {
+        int32_t score{};
+        int32_t best_score{};
+        size_t best_length{};
+        for (size_t length = 1; length <= max_length && best_score - score <= drop_score; ++length)
+        {
+            score += ranks_match(length - 1u) ? match : mismatch;
+            if (score > best_score)
+            {
+                best_score = score;
+                best_length = length;
+            }
+        }
+        return std::pair{best_score, best_length};
+    };
+
+    auto [right_score, right_length] = extend(
+        [&](size_t const i)
+        {
+            return seqan3::to_rank(sequence1[position1 + i]) == seqan3::to_rank(sequence2[position2 + i]);
+        },
+        std::min(sequence1.size() - position1, sequence2.size() - position2));
+    auto [left_score, left_length] = extend(
+        [&](size_t const i)
+        {
+            return seqan3::to_rank(sequence1[position1 - 1u - i]) == seqan3::to_rank(sequence2[position2 - 1u - i]);
+        },
+        std::min(position1, position2));
+
+    return {.score = left_score + right_score,
+            .sequence1_begin_position = position1 - left_length,
+            .sequence1_end_position = position1 + right_length,
+            .sequence2_begin_position = position2 - left_length,
+            .sequence2_end_position = position2 + right_length};
+}
+
+enum struct kernel
+{
+    scalar,
+    blocked,
+    packed
+};
+
+// The second sequence alternates between homologous stretches, which differ from the first sequence by substitutions
+// at the given rate in per mille, and unrelated stretches. The seeds are at random positions.
+template <kernel kernel_type>
+void ungapped_extension(benchmark::State & state)
+{
+    size_t const sequence_length = 1'000'000;
+    size_t const seed_count = 10'000;
+    size_t const error_permille = state.range(0);
+
+    std::mt19937_64 engine{42};
+    std::uniform_int_distribution<size_t> permille_distribution{0, 999};
+    std::uniform_int_distribution<size_t> rank_distribution{0, 3};
+    std::uniform_int_distribution<size_t> position_distribution{0, sequence_length - 1};
+    std::geometric_distribution<size_t> homologous_length_distribution{1.0 / 500};
+    std::geometric_distribution<size_t> unrelated_length_distribution{1.0 / 100};
+
+    std::vector<seqan3::dna4> sequence1 = seqan3::test::generate_sequence<seqan3::dna4>(sequence_length, 0, 0);
+    std::vector<seqan3::dna4> sequence2{};
+    sequence2.reserve(sequence_length);
+    while (sequence2.size() < sequence_length)
+    {
+        for (size_t length = homologous_length_distribution(engine); length > 0 && sequence2.size() < sequence_length;
+             --length)
+        {
+            if (permille_distribution(engine) < error_permille)
+                sequence2.push_back(seqan3::assign_rank_to(rank_distribution(engine), seqan3::dna4{}));
+            else
+                sequence2.push_back(sequence1[sequence2.size()]);
+        }
+
+        for (size_t length = unrelated_length_distribution(engine); length > 0 && sequence2.size() < sequence_length;
+             --length)
+            sequence2.push_back(seqan3::assign_rank_to(rank_distribution(engine), seqan3::dna4{}));
+    }
+
+    std::vector<size_t> seeds(seed_count);
+    for (size_t & seed : seeds)
+        seed = position_distribution(engine);
+
+    seqan3::bitpacked_sequence<seqan3::dna4> packed1{sequence1};
+    seqan3::bitpacked_sequence<seqan3::dna4> packed2{sequence2};
+
+    size_t letters = 0;
+    for (auto _ : state)
+    {
+        for (size_t const seed : seeds)
+        {
+            seqan3::ungapped_extension_result result{};
+            if constexpr (kernel_type == kernel::scalar)
+                result = scalar_extend_ungapped(sequence1, sequence2, seed, seed);
+            else if constexpr (kernel_type == kernel::blocked)
+                result = seqan3::extend_ungapped(sequence1,
+                                                 sequence2,
+                                                 seed,
+                                                 seed,
+                                                 seqan3::match_score{match},
+                                                 seqan3::mismatch_score{mismatch},
+                                                 drop_score);
+            else
+                result = seqan3::extend_ungapped(packed1,
+                                                 packed2,
+                                                 seed,
+                                                 seed,
+                                                 seqan3::match_score{match},
+                                                 seqan3::mismatch_score{mismatch},
+                                                 drop_score);
+
+            letters += result.sequence1_end_position - result.sequence1_begin_position;
+        }
+    }
+
+    state.counters["seeds/s"] = benchmark::Counter(state.iterations() * seed_count, benchmark::Counter::kIsRate);
+    state.counters["letters/seed"] = static_cast<double>(letters) / (state.iterations() * seed_count);
+}
+
+BENCHMARK_TEMPLATE(ungapped_extension, kernel::scalar)->Arg(5)->Arg(20)->Arg(100);
+BENCHMARK_TEMPLATE(ungapped_extension, kernel::blocked)->Arg(5)->Arg(20)->Arg(100);
+BENCHMARK_TEMPLATE(ungapped_extension, kernel::packed)->Arg(5)->Arg(20)->Arg(100);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,87 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <benchmark/benchmark.h>
+
+#include <seqan3/search/dream_index/counting_interleaved_bloom_filter.hpp>
+#include <seqan3/test/compatibility/benchmark.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+#include <seqan3/utility/views/zip.hpp>
+
+inline benchmark::Counter hashes_per_second(size_t const count)
+{
+    return benchmark::Counter(count, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1000);
+}
+
+static void arguments(benchmark::Benchmark * b)
+{
+    // Bins must be powers of two
+    for (int32_t bins : {64, 8192})
+    {
+        // The IBF will have 2^counters counters
+        for (int32_t counters = 15; counters <= 20; counters += 5)
+        {
+            // The counters per bin must fit in an int32_t
+            if (counters - std::countr_zero(static_cast<uint32_t>(bins)) < 32)
+            {
+                for (int32_t hash_num = 2; hash_num < 4; ++hash_num)
+                {
+                    b->Args({bins, (1LL << counters) / bins, hash_num, 1000});
+                }
+            }
+        }
+    }
+}
+
+template <typename cibf_type>
+auto set_up(size_t bins, size_t counters, size_t hash_num, size_t sequence_length)
+{
+    auto bin_indices = seqan3::test::generate_numeric_sequence<size_t>(sequence_length, 0u, bins - 1);
+    auto hash_values = seqan3::test::generate_numeric_sequence<size_t>(sequence_length);
+    cibf_type cibf{seqan3::bin_count{bins}, seqan3::bin_size{counters}, seqan3::hash_function_count{hash_num}};
+
+    return std::make_tuple(bin_indices, hash_values, cibf);
+}
+
+template <typename cibf_type>
+void emplace_benchmark(::benchmark::State & state)
+{
+    auto && [bin_indices, hash_values, cibf] =
+        set_up<cibf_type>(state.range(0), state.range(1), state.range(2), state.range(3));
+
+    for (auto _ : state)
+    {
+        for (auto [hash, bin] : seqan3::views::zip(hash_values, bin_indices))
+            cibf.emplace(hash, seqan3::bin_index{bin});
+    }
+
+    state.counters["hashes/sec"] = hashes_per_second(std::ranges::size(hash_values));
+}
+
+template <typename cibf_type>
+void count_benchmark(::benchmark::State & state)
+{
+    auto && [bin_indices, hash_values, cibf] =
+        set_up<cibf_type>(state.range(0), state.range(1), state.range(2), state.range(3));
+
+    for (auto [hash, bin] : seqan3::views::zip(hash_values, bin_indices))
+        cibf.emplace(hash, seqan3::bin_index{bin});
+
+    auto agent = cibf.counting_agent();
+    for (auto _ : state)
+    {
+        for (auto hash : hash_values)
+            benchmark::DoNotOptimize(agent.count(hash));
+    }
+
+    state.counters["hashes/sec"] = hashes_per_second(std::ranges::size(hash_values));
+}
+
+BENCHMARK_TEMPLATE(emplace_benchmark, seqan3::counting_interleaved_bloom_filter<4>)->Apply(arguments);
+BENCHMARK_TEMPLATE(emplace_benchmark, seqan3::counting_interleaved_bloom_filter<8>)->Apply(arguments);
+
+BENCHMARK_TEMPLATE(count_benchmark, seqan3::counting_interleaved_bloom_filter<4>)->Apply(arguments);
+BENCHMARK_TEMPLATE(count_benchmark, seqan3::counting_interleaved_bloom_filter<8>)->Apply(arguments);
+
+BENCHMARK_MAIN();
@@ -146,6 +146,77 @@ void bulk_count_benchmark(::benchmark::State & state)
     state.counters["hashes/sec"] = hashes_per_second(std::ranges::size(hash_values));
 }
 
+static void threshold_arguments(benchmark::Benchmark * b)
+{
+    for (int32_t bins : {64, 1024, 8192})
+    {
+        // Threshold in percent of the number of values
+        for (int32_t threshold : {50, 90})
+        {
+            b->Args({bins, 1LL << 12, 2, 1000, threshold});
+        }
+    }
+}
+
+// All values are contained in bin 0, and each value is additionally contained in a random bin.
+template <typename ibf_type>
+auto set_up_threshold(size_t bins, size_t bits, size_t hash_num, size_t sequence_length)
+{
+    auto bin_indices = seqan3::test::generate_numeric_sequence<size_t>(sequence_length, 0u, bins - 1);
+    auto hash_values = seqan3::test::generate_numeric_sequence<size_t>(sequence_length);
+    seqan3::interleaved_bloom_filter tmp_ibf(seqan3::bin_count{bins},
+                                             seqan3::bin_size{bits},
+                                             seqan3::hash_function_count{hash_num});
+
+    for (auto [hash, bin] : seqan3::views::zip(hash_values, bin_indices))
+    {
+        tmp_ibf.emplace(hash, seqan3::bin_index{0u});
+        tmp_ibf.emplace(hash, seqan3::bin_index{bin});
+    }
+
+    ibf_type ibf{std::move(tmp_ibf)};
+
+    return std::make_tuple(hash_values, ibf);
+}
+
+template <typename ibf_type>
+void bulk_count_threshold_benchmark(::benchmark::State & state)
+{
+    auto && [hash_values, ibf] =
+        set_up_threshold<ibf_type>(state.range(0), state.range(1), state.range(2), state.range(3));
+    size_t const threshold = state.range(3) * state.range(4) / 100;
+
+    auto agent = ibf.counting_agent();
+    std::vector<size_t> result{};
+    for (auto _ : state)
+    {
+        result.clear();
+        auto & counts = agent.bulk_count(hash_values);
+        for (size_t bin = 0; bin < counts.size(); ++bin)
+            if (counts[bin] >= threshold)
+                result.push_back(bin);
+        benchmark::DoNotOptimize(result);
+    }
+
+    state.counters["hashes/sec"] = hashes_per_second(std::ranges::size(hash_values));
+}
+
+template <typename ibf_type>
+void membership_for_benchmark(::benchmark::State & state)
+{
+    auto && [hash_values, ibf] =
+        set_up_threshold<ibf_type>(state.range(0), state.range(1), state.range(2), state.range(3));
+    size_t const threshold = state.range(3) * state.range(4) / 100;
+
+    auto agent = ibf.counting_agent();
+    for (auto _ : state)
+    {
+        [[maybe_unused]] auto & res = agent.membership_for(hash_values, threshold);
+    }
+
+    state.counters["hashes/sec"] = hashes_per_second(std::ranges::size(hash_values));
+}
+
 BENCHMARK_TEMPLATE(emplace_benchmark, seqan3::interleaved_bloom_filter<seqan3::data_layout::uncompressed>)
     ->Apply(arguments);
 BENCHMARK_TEMPLATE(clear_benchmark, seqan3::interleaved_bloom_filter<seqan3::data_layout::uncompressed>)
@@ -163,4 +234,10 @@ BENCHMARK_TEMPLATE(bulk_count_benchmark, seqan3::interleaved_bloom_filter<seqan3
 BENCHMARK_TEMPLATE(bulk_count_benchmark, seqan3::interleaved_bloom_filter<seqan3::data_layout::compressed>)
     ->Apply(arguments);
 
+BENCHMARK_TEMPLATE(bulk_count_threshold_benchmark,
+                   seqan3::interleaved_bloom_filter<seqan3::data_layout::uncompressed>)
+    ->Apply(threshold_arguments);
+BENCHMARK_TEMPLATE(membership_for_benchmark, seqan3::interleaved_bloom_filter<seqan3::data_layout::uncompressed>)
+    ->Apply(threshold_arguments);
+
 BENCHMARK_MAIN();
@@ -0,0 +1,83 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <benchmark/benchmark.h>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/search/kmer_index/minimiser_sketch.hpp>
+#include <seqan3/test/compatibility/benchmark.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+#include <seqan3/utility/range/to.hpp>
+
+inline benchmark::Counter bp_per_second(size_t const basepairs)
+{
+    return benchmark::Counter(basepairs,
+                              benchmark::Counter::kIsIterationInvariantRate,
+                              benchmark::Counter::OneK::kIs1000);
+}
+
+static void arguments(benchmark::Benchmark * b)
+{
+    // Many short reads and few long sequences.
+    for (auto [sequence_count, sequence_length] : {std::pair{20'000, 150}, std::pair{100, 30'000}})
+    {
+        for (int32_t thread_count : {1, 4})
+            b->Args({sequence_count, sequence_length, thread_count});
+    }
+}
+
+static seqan3::concatenated_sequences<std::vector<seqan3::dna4>> generate_sequences(benchmark::State const & state)
+{
+    seqan3::concatenated_sequences<std::vector<seqan3::dna4>> sequences{};
+
+    for (int64_t i = 0; i < state.range(0); ++i)
+        sequences.push_back(seqan3::test::generate_sequence<seqan3::dna4>(state.range(1), 0, i));
+
+    return sequences;
+}
+
+// Stores the result of seqan3::views::minimiser_hash in a separate std::vector for each sequence.
+static void minimiser_hash_per_sequence(benchmark::State & state)
+{
+    auto sequences = generate_sequences(state);
+
+    for (auto _ : state)
+    {
+        std::vector<std::vector<uint64_t>> hashes{};
+        hashes.reserve(sequences.size());
+
+        for (auto && sequence : sequences)
+        {
+            auto minimisers = sequence | seqan3::views::minimiser_hash(seqan3::ungapped{19}, seqan3::window_size{29});
+            hashes.push_back(minimisers | seqan3::ranges::to<std::vector>());
+        }
+
+        benchmark::DoNotOptimize(hashes.data());
+    }
+
+    state.counters["Throughput[bp/s]"] = bp_per_second(state.range(0) * state.range(1));
+}
+
+static void bulk_minimiser_hash(benchmark::State & state)
+{
+    auto sequences = generate_sequences(state);
+    size_t const thread_count = state.range(2);
+
+    for (auto _ : state)
+    {
+        auto hashes = seqan3::bulk_minimiser_hash(sequences,
+                                                  seqan3::ungapped{19},
+                                                  seqan3::window_size{29},
+                                                  seqan3::seed{0x8F'3F'73'B5'CF'1C'9A'DE},
+                                                  thread_count);
+        benchmark::DoNotOptimize(hashes.raw_data().first.data());
+    }
+
+    state.counters["Throughput[bp/s]"] = bp_per_second(state.range(0) * state.range(1));
+}
+
+BENCHMARK(minimiser_hash_per_sequence)->Apply(arguments)->UseRealTime();
+BENCHMARK(bulk_minimiser_hash)->Apply(arguments)->UseRealTime();
+
+BENCHMARK_MAIN();
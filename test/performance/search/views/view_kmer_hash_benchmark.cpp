@@ -4,8 +4,13 @@
 
 #include <benchmark/benchmark.h>
 
+#include <seqan3/alphabet/container/bitpacked_sequence.hpp>
 #include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/alphabet/views/complement.hpp>
+#include <seqan3/search/views/canonical_kmer_hash.hpp>
 #include <seqan3/search/views/kmer_hash.hpp>
+#include <seqan3/search/views/unambiguous_kmer_hash.hpp>
 #include <seqan3/test/compatibility/benchmark.hpp>
 #include <seqan3/test/performance/sequence_generator.hpp>
 #include <seqan3/test/performance/units.hpp>
@@ -44,13 +49,26 @@ static void arguments(benchmark::Benchmark * b)
     }
 }
 
+// seqan3::views::kmer_hash on seqan3::dna5 supports at most k = 27.
+static void dna5_arguments(benchmark::Benchmark * b)
+{
+    for (int32_t sequence_length : {1000, 50000})
+    {
+        for (int32_t k : {8, 27})
+        {
+            b->Args({sequence_length, k});
+        }
+    }
+}
+
+template <typename sequence_t>
 static void seqan_kmer_hash_ungapped(benchmark::State & state)
 {
     auto sequence_length = state.range(0);
     assert(sequence_length > 0);
     size_t k = static_cast<size_t>(state.range(1));
     assert(k > 0);
-    auto seq = seqan3::test::generate_sequence<seqan3::dna4>(sequence_length, 0, 0);
+    sequence_t seq{seqan3::test::generate_sequence<seqan3::dna4>(sequence_length, 0, 0)};
 
     size_t sum{0};
 
@@ -66,13 +84,14 @@ static void seqan_kmer_hash_ungapped(benchmark::State & state)
     state.counters["Throughput[bp/s]"] = bp_per_second(sequence_length - k + 1);
 }
 
+template <typename sequence_t>
 static void seqan_kmer_hash_gapped(benchmark::State & state)
 {
     auto sequence_length = state.range(0);
     assert(sequence_length > 0);
     size_t k = static_cast<size_t>(state.range(1));
     assert(k > 0);
-    auto seq = seqan3::test::generate_sequence<seqan3::dna4>(sequence_length, 0, 0);
+    sequence_t seq{seqan3::test::generate_sequence<seqan3::dna4>(sequence_length, 0, 0)};
 
     size_t sum{0};
 
@@ -88,6 +107,133 @@ static void seqan_kmer_hash_gapped(benchmark::State & state)
     state.counters["Throughput[bp/s]"] = bp_per_second(sequence_length - k + 1);
 }
 
+static void seqan_kmer_hash_both_strands(benchmark::State & state)
+{
+    auto sequence_length = state.range(0);
+    assert(sequence_length > 0);
+    size_t k = static_cast<size_t>(state.range(1));
+    assert(k > 0);
+    auto seq = seqan3::test::generate_sequence<seqan3::dna4>(sequence_length, 0, 0);
+    seqan3::shape const shape{seqan3::ungapped{static_cast<uint8_t>(k)}};
+
+    size_t sum{0};
+
+    for (auto _ : state)
+    {
+        auto forward = seq | seqan3::views::kmer_hash(shape);
+        auto reverse = seq | seqan3::views::complement | std::views::reverse | seqan3::views::kmer_hash(shape)
+                     | std::views::reverse;
+
+        auto reverse_it = reverse.begin();
+        for (auto h : forward)
+            benchmark::DoNotOptimize(sum += std::min(h, *reverse_it++));
+    }
+
+    // prevent complete optimisation
+    [[maybe_unused]] volatile auto fin = sum;
+
+    state.counters["Throughput[bp/s]"] = bp_per_second(sequence_length - k + 1);
+}
+
+template <typename shape_tag>
+static void seqan_canonical_kmer_hash(benchmark::State & state)
+{
+    auto sequence_length = state.range(0);
+    assert(sequence_length > 0);
+    size_t k = static_cast<size_t>(state.range(1));
+    assert(k > 0);
+    auto seq = seqan3::test::generate_sequence<seqan3::dna4>(sequence_length, 0, 0);
+    seqan3::shape const shape = std::same_as<shape_tag, seqan3::ungapped>
+                                  ? seqan3::shape{seqan3::ungapped{static_cast<uint8_t>(k)}}
+                                  : make_gapped_shape(k);
+
+    size_t sum{0};
+
+    for (auto _ : state)
+    {
+        for (auto h : seq | seqan3::views::canonical_kmer_hash(shape))
+            benchmark::DoNotOptimize(sum += h);
+    }
+
+    // prevent complete optimisation
+    [[maybe_unused]] volatile auto fin = sum;
+
+    state.counters["Throughput[bp/s]"] = bp_per_second(sequence_length - k + 1);
+}
+
+// A seqan3::dna5 sequence where every 100th letter is an N.
+inline std::vector<seqan3::dna5> generate_sequence_with_n(size_t const sequence_length)
+{
+    std::vector<seqan3::dna5> seq{};
+    for (seqan3::dna4 const letter : seqan3::test::generate_sequence<seqan3::dna4>(sequence_length, 0, 0))
+        seq.push_back(seqan3::dna5{}.assign_char(seqan3::to_char(letter)));
+
+    for (size_t i = 50; i < seq.size(); i += 100)
+        seq[i] = seqan3::dna5{}.assign_char('N');
+
+    return seq;
+}
+
+// Hashes all k-mers and discards the ones that contain an N by additionally inspecting the sequence.
+static void seqan_kmer_hash_filter_n(benchmark::State & state)
+{
+    auto sequence_length = state.range(0);
+    assert(sequence_length > 0);
+    size_t k = static_cast<size_t>(state.range(1));
+    assert(k > 0);
+    auto seq = generate_sequence_with_n(sequence_length);
+    seqan3::dna5 const n = seqan3::dna5{}.assign_char('N');
+
+    size_t sum{0};
+
+    for (auto _ : state)
+    {
+        size_t last_n_end{0}; // The position behind the last N.
+        for (size_t i = 0; i + 1 < k; ++i)
+            if (seq[i] == n)
+                last_n_end = i + 1;
+
+        size_t kmer_end{k};
+        for (auto h : seq | seqan3::views::kmer_hash(seqan3::ungapped{static_cast<uint8_t>(k)}))
+        {
+            if (seq[kmer_end - 1] == n)
+                last_n_end = kmer_end;
+
+            if (last_n_end + k <= kmer_end)
+                benchmark::DoNotOptimize(sum += h);
+
+            ++kmer_end;
+        }
+    }
+
+    // prevent complete optimisation
+    [[maybe_unused]] volatile auto fin = sum;
+
+    state.counters["Throughput[bp/s]"] = bp_per_second(sequence_length - k + 1);
+}
+
+static void seqan_unambiguous_kmer_hash(benchmark::State & state)
+{
+    auto sequence_length = state.range(0);
+    assert(sequence_length > 0);
+    size_t k = static_cast<size_t>(state.range(1));
+    assert(k > 0);
+    auto seq = generate_sequence_with_n(sequence_length);
+
+    size_t sum{0};
+
+    for (auto _ : state)
+    {
+        for (auto h : seq | seqan3::views::unambiguous_kmer_hash(seqan3::ungapped{static_cast<uint8_t>(k)}))
+            benchmark::DoNotOptimize(sum += h);
+    }
+
+    // prevent complete optimisation
+    [[maybe_unused]] volatile auto fin = sum;
+
+    state.counters["Throughput[bp/s]"] = bp_per_second(sequence_length - k + 1);
+}
+
 static void naive_kmer_hash(benchmark::State & state)
 {
     auto sequence_length = state.range(0);
@@ -195,8 +341,15 @@ BENCHMARK(seqan2_kmer_hash_ungapped)->Apply(arguments);
 BENCHMARK(seqan2_kmer_hash_gapped)->Apply(arguments);
 #endif // SEQAN3_HAS_SEQAN2
 
-BENCHMARK(seqan_kmer_hash_ungapped)->Apply(arguments);
-BENCHMARK(seqan_kmer_hash_gapped)->Apply(arguments);
+BENCHMARK_TEMPLATE(seqan_kmer_hash_ungapped, std::vector<seqan3::dna4>)->Apply(arguments);
+BENCHMARK_TEMPLATE(seqan_kmer_hash_ungapped, seqan3::bitpacked_sequence<seqan3::dna4>)->Apply(arguments);
+BENCHMARK_TEMPLATE(seqan_kmer_hash_gapped, std::vector<seqan3::dna4>)->Apply(arguments);
+BENCHMARK_TEMPLATE(seqan_kmer_hash_gapped, seqan3::bitpacked_sequence<seqan3::dna4>)->Apply(arguments);
+BENCHMARK(seqan_kmer_hash_both_strands)->Apply(arguments);
+BENCHMARK_TEMPLATE(seqan_canonical_kmer_hash, seqan3::ungapped)->Apply(arguments);
+BENCHMARK_TEMPLATE(seqan_canonical_kmer_hash, seqan3::shape)->Apply(arguments);
+BENCHMARK(seqan_kmer_hash_filter_n)->Apply(dna5_arguments);
+BENCHMARK(seqan_unambiguous_kmer_hash)->Apply(dna5_arguments);
 BENCHMARK(naive_kmer_hash)->Apply(arguments);
 
 BENCHMARK_MAIN();
@@ -4,6 +4,8 @@
 
 #include <benchmark/benchmark.h>
 
+#include <numeric>
+
 #include <seqan3/alphabet/nucleotide/dna4.hpp>
 #include <seqan3/search/views/minimiser_hash.hpp>
 #include <seqan3/test/compatibility/benchmark.hpp>
@@ -42,7 +44,8 @@ static void arguments(benchmark::Benchmark * b)
     {
         for (int32_t k : {8, /*16, 24,*/ 30})
         {
-            for (int32_t w : {k + 5, k + 20})
+            // Large windows are used for sketching long reads.
+            for (int32_t w : {k + 5, k + 20, k + 100, k + 1000})
             {
                 b->Args({sequence_length, k, w});
             }
@@ -203,6 +206,26 @@ void compute_minimisers_on_poly_A_sequence(benchmark::State & state)
     state.counters["Throughput[bp/s]"] = bp_per_second(sequence_length - k + 1);
 }
 
+// The minimiser leaves the window in every step, i.e. a new minimum has to be found for every window.
+void compute_minimisers_on_increasing_values(benchmark::State & state)
+{
+    auto sequence_length = state.range(0);
+    size_t w = static_cast<size_t>(state.range(2) - state.range(1) + 1);
+    assert(sequence_length > 0);
+    std::vector<uint64_t> values(sequence_length);
+    std::iota(values.begin(), values.end(), 0u);
+
+    size_t sum{0};
+
+    for (auto _ : state)
+    {
+        for (auto h : values | seqan3::views::minimiser(w))
+            benchmark::DoNotOptimize(sum += h);
+    }
+
+    state.counters["Throughput[values/s]"] = bp_per_second(sequence_length);
+}
+
 #ifdef SEQAN3_HAS_SEQAN2
 BENCHMARK_TEMPLATE(compute_minimisers, method_tag::seqan2_ungapped)->Apply(arguments);
 BENCHMARK_TEMPLATE(compute_minimisers, method_tag::seqan2_gapped)->Apply(arguments);
@@ -215,4 +238,6 @@ BENCHMARK_TEMPLATE(compute_minimisers, method_tag::seqan3_gapped)->Apply(argumen
 BENCHMARK_TEMPLATE(compute_minimisers_on_poly_A_sequence, method_tag::seqan3_ungapped)->Apply(arguments);
 BENCHMARK_TEMPLATE(compute_minimisers_on_poly_A_sequence, method_tag::seqan3_gapped)->Apply(arguments);
 
+BENCHMARK(compute_minimisers_on_increasing_values)->Apply(arguments);
+
 BENCHMARK_MAIN();
@@ -0,0 +1,53 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <benchmark/benchmark.h>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/search/views/strobemer.hpp>
+#include <seqan3/test/compatibility/benchmark.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+
+inline benchmark::Counter bp_per_second(size_t const basepairs)
+{
+    return benchmark::Counter(basepairs,
+                              benchmark::Counter::kIsIterationInvariantRate,
+                              benchmark::Counter::OneK::kIs1000);
+}
+
+static void arguments(benchmark::Benchmark * b)
+{
+    for (int32_t sequence_length : {50000})
+    {
+        for (int32_t k : {15, 20})
+        {
+            // The windows used for short and long reads, respectively.
+            for (auto [min_offset, max_offset] : {std::pair{16, 31}, std::pair{21, 70}})
+                b->Args({sequence_length, k, min_offset, max_offset});
+        }
+    }
+}
+
+void compute_strobemers(benchmark::State & state)
+{
+    auto sequence_length = state.range(0);
+    uint8_t k = static_cast<uint8_t>(state.range(1));
+    seqan3::strobe_window window{static_cast<size_t>(state.range(2)), static_cast<size_t>(state.range(3))};
+    assert(sequence_length > 0);
+    auto seq = seqan3::test::generate_sequence<seqan3::dna4>(sequence_length, 0, 0);
+
+    size_t sum{0};
+
+    for (auto _ : state)
+    {
+        for (auto h : seq | seqan3::views::strobemer(seqan3::ungapped{k}, window))
+            benchmark::DoNotOptimize(sum += h);
+    }
+
+    state.counters["Throughput[bp/s]"] = bp_per_second(sequence_length - k + 1);
+}
+
+BENCHMARK(compute_strobemers)->Apply(arguments);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,98 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/search/views/syncmer.hpp>
+#include <seqan3/test/compatibility/benchmark.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+
+inline benchmark::Counter bp_per_second(size_t const basepairs)
+{
+    return benchmark::Counter(basepairs,
+                              benchmark::Counter::kIsIterationInvariantRate,
+                              benchmark::Counter::OneK::kIs1000);
+}
+
+static void arguments(benchmark::Benchmark * b)
+{
+    for (int32_t sequence_length : {50000})
+    {
+        for (int32_t k : {15, 31})
+        {
+            for (int32_t s : {5, 11})
+                b->Args({sequence_length, k, s});
+        }
+    }
+}
+
+enum class method_tag
+{
+    naive,
+    seqan3_closed,
+    seqan3_open
+};
+
+template <method_tag tag>
+void compute_syncmers(benchmark::State & state)
+{
+    auto sequence_length = state.range(0);
+    uint8_t k = static_cast<uint8_t>(state.range(1));
+    uint8_t s = static_cast<uint8_t>(state.range(2));
+    assert(sequence_length > 0);
+    assert(s <= k);
+    auto seq = seqan3::test::generate_sequence<seqan3::dna4>(sequence_length, 0, 0);
+
+    size_t sum{0};
+
+    for (auto _ : state)
+    {
+        if constexpr (tag == method_tag::naive)
+        {
+            // Searches the smallest s-mer of every k-mer from scratch.
+            uint64_t const seed = 0x8F'3F'73'B5'CF'1C'9A'DE;
+            auto kmers = seq | seqan3::views::kmer_hash(seqan3::ungapped{k});
+            auto smers = seq | seqan3::views::kmer_hash(seqan3::ungapped{s})
+                       | std::views::transform(
+                             [](uint64_t const i)
+                             {
+                                 return i ^ seed;
+                             });
+
+            auto smer_it = smers.begin();
+            for (auto h : kmers)
+            {
+                auto min_it = std::ranges::min_element(smer_it, std::ranges::next(smer_it, k - s + 1));
+                size_t const offset = std::ranges::distance(smer_it, min_it);
+
+                if (offset == 0u || offset == static_cast<size_t>(k - s))
+                    benchmark::DoNotOptimize(sum += h);
+
+                ++smer_it;
+            }
+        }
+        else if constexpr (tag == method_tag::seqan3_closed)
+        {
+            for (auto h : seq | seqan3::views::syncmer(seqan3::ungapped{k}, seqan3::ungapped{s}))
+                benchmark::DoNotOptimize(sum += h);
+        }
+        else
+        {
+            auto offset = seqan3::syncmer_offset{static_cast<uint8_t>((k - s) / 2)};
+            for (auto h : seq | seqan3::views::syncmer(seqan3::ungapped{k}, seqan3::ungapped{s}, offset))
+                benchmark::DoNotOptimize(sum += h);
+        }
+    }
+
+    state.counters["Throughput[bp/s]"] = bp_per_second(sequence_length - k + 1);
+}
+
+BENCHMARK_TEMPLATE(compute_syncmers, method_tag::naive)->Apply(arguments);
+BENCHMARK_TEMPLATE(compute_syncmers, method_tag::seqan3_closed)->Apply(arguments);
+BENCHMARK_TEMPLATE(compute_syncmers, method_tag::seqan3_open)->Apply(arguments);
+
+BENCHMARK_MAIN();
@@ -6,6 +6,7 @@
 
 #include <seqan3/test/compatibility/benchmark.hpp>
 #include <seqan3/test/performance/sequence_generator.hpp>
+#include <seqan3/utility/bloom_filter/blocked_bloom_filter.hpp>
 #include <seqan3/utility/bloom_filter/bloom_filter.hpp>
 
 inline benchmark::Counter hashes_per_second(size_t const count)
@@ -15,8 +16,8 @@ inline benchmark::Counter hashes_per_second(size_t const count)
 
 static void arguments(benchmark::Benchmark * b)
 {
-    // Size of the IBF will be 2^bits bits
-    for (int32_t bits = 15; bits <= 20; bits += 5)
+    // Size of the IBF will be 2^bits bits. The largest filter does not fit into the cache.
+    for (int32_t bits = 15; bits <= 30; bits += 5)
     {
         // The bits must fit in an int32_t
         if (bits < 32)
@@ -33,11 +34,18 @@ template <typename bf_type>
 auto set_up(size_t bits, size_t hash_num, size_t sequence_length)
 {
     auto hash_values = seqan3::test::generate_numeric_sequence<size_t>(sequence_length);
-    seqan3::bloom_filter tmp_bf(seqan3::bin_size{bits}, seqan3::hash_function_count{hash_num});
 
-    bf_type bf{std::move(tmp_bf)};
-
-    return std::make_tuple(hash_values, bf);
+    if constexpr (std::same_as<bf_type, seqan3::blocked_bloom_filter>)
+    {
+        bf_type bf{seqan3::bin_size{bits}, seqan3::hash_function_count{hash_num}};
+        return std::make_tuple(hash_values, bf);
+    }
+    else
+    {
+        seqan3::bloom_filter tmp_bf(seqan3::bin_size{bits}, seqan3::hash_function_count{hash_num});
+        bf_type bf{std::move(tmp_bf)};
+        return std::make_tuple(hash_values, bf);
+    }
 }
 
 template <typename ibf_type>
@@ -99,11 +107,14 @@ void count_benchmark(::benchmark::State & state)
 
 BENCHMARK_TEMPLATE(emplace_benchmark, seqan3::bloom_filter<seqan3::data_layout::uncompressed>)->Apply(arguments);
 BENCHMARK_TEMPLATE(reset_benchmark, seqan3::bloom_filter<seqan3::data_layout::uncompressed>)->Apply(arguments);
+BENCHMARK_TEMPLATE(emplace_benchmark, seqan3::blocked_bloom_filter)->Apply(arguments);
 
 BENCHMARK_TEMPLATE(contains_benchmark, seqan3::bloom_filter<seqan3::data_layout::uncompressed>)->Apply(arguments);
 BENCHMARK_TEMPLATE(contains_benchmark, seqan3::bloom_filter<seqan3::data_layout::compressed>)->Apply(arguments);
+BENCHMARK_TEMPLATE(contains_benchmark, seqan3::blocked_bloom_filter)->Apply(arguments);
 
 BENCHMARK_TEMPLATE(count_benchmark, seqan3::bloom_filter<seqan3::data_layout::uncompressed>)->Apply(arguments);
 BENCHMARK_TEMPLATE(count_benchmark, seqan3::bloom_filter<seqan3::data_layout::compressed>)->Apply(arguments);
+BENCHMARK_TEMPLATE(count_benchmark, seqan3::blocked_bloom_filter)->Apply(arguments);
 
 BENCHMARK_MAIN();
@@ -0,0 +1,15 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <seqan3/alignment/configuration/align_config_adaptive_score_width.hpp>
+#include <seqan3/alignment/configuration/align_config_output.hpp>
+#include <seqan3/alignment/configuration/align_config_vectorised.hpp>
+#include <seqan3/core/configuration/configuration.hpp>
+
+int main()
+{
+    // Compute short sequence pairs with 8 or 16-bit scores and only fall back to 32-bit scores where needed.
+    auto cfg = seqan3::align_cfg::vectorised{} | seqan3::align_cfg::adaptive_score_width{}
+             | seqan3::align_cfg::output_score{};
+}
@@ -0,0 +1,42 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <tuple>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_drop_off.hpp>
+#include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_method.hpp>
+#include <seqan3/alignment/configuration/align_config_output.hpp>
+#include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/debug_stream.hpp>
+
+int main()
+{
+    using namespace seqan3::literals;
+
+    // The sequences following a seed; the extension stops in the diverged region.
+    std::vector<seqan3::dna4> sequence1 = "ACGTGACTAGCTAGCATCGATTTTTTTTTTTTTTTTT"_dna4;
+    std::vector<seqan3::dna4> sequence2 = "ACGTGACTGCTAGCATCGATCCCCCCCCCCCCCCCCC"_dna4;
+
+    auto cfg = seqan3::align_cfg::method_global{}
+             | seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{seqan3::match_score{2},
+                                                                                   seqan3::mismatch_score{-4}}}
+             | seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-4},
+                                                  seqan3::align_cfg::extension_score{-2}}
+             | seqan3::align_cfg::output_score{} | seqan3::align_cfg::output_end_position{};
+
+    // Prune cells that fall 10 below the best score.
+    auto x_drop_cfg = cfg | seqan3::align_cfg::x_drop{10};
+    for (auto const & result : seqan3::align_pairwise(std::tie(sequence1, sequence2), x_drop_cfg))
+        seqan3::debug_stream << "X-drop: " << result << '\n';
+
+    // Additionally stop at a diverged region, but not at a long gap.
+    auto z_drop_cfg = cfg | seqan3::align_cfg::x_drop{50} | seqan3::align_cfg::z_drop{20};
+    for (auto const & result : seqan3::align_pairwise(std::tie(sequence1, sequence2), z_drop_cfg))
+        seqan3::debug_stream << "Z-drop: " << result << '\n';
+}
@@ -0,0 +1,14 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <seqan3/alignment/configuration/align_config_linear_memory_traceback.hpp>
+
+int main()
+{
+    // Always compute the traceback in linear memory.
+    auto cfg_always = seqan3::align_cfg::linear_memory_traceback{};
+
+    // Compute the traceback in linear memory only for matrices with more than 10^8 cells.
+    auto cfg_large = seqan3::align_cfg::linear_memory_traceback{100'000'000u};
+}
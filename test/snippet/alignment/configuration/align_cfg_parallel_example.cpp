@@ -5,6 +5,7 @@
 #include <thread>
 
 #include <seqan3/alignment/configuration/align_config_parallel.hpp>
+#include <seqan3/utility/parallel/thread_pool.hpp>
 
 int main()
 {
@@ -13,5 +14,11 @@ int main()
 
     // Enables parallel computation with the number of concurrent threads supported by the current architecture.
     seqan3::align_cfg::parallel cfg_n{std::thread::hardware_concurrency()};
-    ;
+
+    // Computes or buffers at most 64 alignments at once and reports them as soon as they are computed.
+    seqan3::align_cfg::parallel cfg_streaming{2, 64u, seqan3::align_cfg::parallel::result_order::completion};
+
+    // Executes the alignments in the threads of an existing pool.
+    seqan3::thread_pool pool{2};
+    seqan3::align_cfg::parallel cfg_pool{pool};
 }
@@ -0,0 +1,37 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <vector>
+
+#include <seqan3/alignment/configuration/all.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/aminoacid_scoring_scheme.hpp>
+#include <seqan3/alphabet/aminoacid/aa27.hpp>
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/utility/views/repeat_n.hpp>
+#include <seqan3/utility/views/zip.hpp>
+
+int main()
+{
+    using namespace seqan3::literals;
+
+    seqan3::aa27_vector query = "QFSEEILSDIYCWMLQCGQERAV"_aa27;
+    std::vector<seqan3::aa27_vector> database{"AFLPGWQEENKLSKIWMKDCGCLCVMLFSQ"_aa27,
+                                              "QFSEELLSDIYCWMLQCGQERAV"_aa27,
+                                              "SEEILSDIYCW"_aa27};
+
+    seqan3::aminoacid_scoring_scheme scheme{seqan3::aminoacid_similarity_matrix::blosum62};
+
+    // The profile of the query is computed once and reused for all sequences of the database.
+    auto cfg = seqan3::align_cfg::method_local{} | seqan3::align_cfg::scoring_scheme{scheme}
+             | seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-10},
+                                                  seqan3::align_cfg::extension_score{-1}}
+             | seqan3::align_cfg::output_score{} | seqan3::align_cfg::output_sequence2_id{}
+             | seqan3::align_cfg::vectorised{} | seqan3::align_cfg::query_profile{};
+
+    auto sequence_pairs = seqan3::views::zip(seqan3::views::repeat_n(query, database.size()), database);
+
+    for (auto && result : seqan3::align_pairwise(sequence_pairs, cfg))
+        seqan3::debug_stream << result.sequence2_id() << ": " << result.score() << '\n';
+}
@@ -0,0 +1,16 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <seqan3/alignment/configuration/align_config_sort_by_length.hpp>
+#include <seqan3/alignment/configuration/align_config_vectorised.hpp>
+#include <seqan3/core/configuration/configuration.hpp>
+
+int main()
+{
+    // Sort every window of 1024 consecutive sequence pairs by length before vectorising them.
+    auto cfg = seqan3::align_cfg::vectorised{} | seqan3::align_cfg::sort_by_length{};
+
+    // Sort every window of 10'000 consecutive sequence pairs by length.
+    auto cfg_large = seqan3::align_cfg::vectorised{} | seqan3::align_cfg::sort_by_length{10'000u};
+}
@@ -0,0 +1,34 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <utility>
+
+#include <seqan3/alignment/configuration/all.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/debug_stream.hpp>
+
+int main()
+{
+    using namespace seqan3::literals;
+
+    seqan3::dna4_vector haplotype1 = "ACGTGACTGACTAGCTAGCTAGGACTAGCTAGCATCGACTAGCATCGA"_dna4;
+    seqan3::dna4_vector haplotype2 = "ACGTGACTGACTAGCTACCTAGGACTAGCTAGCATCGAACTAGCATCGA"_dna4;
+
+    // Only the cells close to the optimal alignment of the two similar sequences are computed.
+    auto cfg = seqan3::align_cfg::method_global{}
+             | seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{seqan3::match_score{2},
+                                                                                   seqan3::mismatch_score{-4}}}
+             | seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-4},
+                                                  seqan3::align_cfg::extension_score{-2}}
+             | seqan3::align_cfg::output_score{} | seqan3::align_cfg::output_alignment{}
+             | seqan3::align_cfg::wavefront{};
+
+    for (auto && result : seqan3::align_pairwise(std::tie(haplotype1, haplotype2), cfg))
+    {
+        seqan3::debug_stream << "Score: " << result.score() << '\n';
+        seqan3::debug_stream << "Alignment:\n" << result.alignment() << '\n';
+    }
+}
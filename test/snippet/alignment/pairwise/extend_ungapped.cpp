@@ -0,0 +1,32 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <seqan3/alignment/pairwise/extend_ungapped.hpp>
+#include <seqan3/alphabet/container/bitpacked_sequence.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/debug_stream.hpp>
+
+int main()
+{
+    using namespace seqan3::literals;
+
+    // Packed sequences are compared 32 letters at a time.
+    seqan3::bitpacked_sequence<seqan3::dna4> reference{"TTTTGACGTAGCTAGCATTAGCGGGGGG"_dna4};
+    seqan3::bitpacked_sequence<seqan3::dna4> read{"CCACGTAGCTTGCATTAGCAAAA"_dna4};
+
+    // The seed "AGCT" starts at position 9 in the reference and at position 6 in the read.
+    seqan3::ungapped_extension_result result = seqan3::extend_ungapped(reference,
+                                                                       read,
+                                                                       9,
+                                                                       6,
+                                                                       seqan3::match_score{1},
+                                                                       seqan3::mismatch_score{-2},
+                                                                       5);
+
+    seqan3::debug_stream << "score: " << result.score << '\n'
+                         << "reference: [" << result.sequence1_begin_position << ", "
+                         << result.sequence1_end_position << ")\n"
+                         << "read: [" << result.sequence2_begin_position << ", " << result.sequence2_end_position
+                         << ")\n";
+}
@@ -17,5 +17,10 @@ int main()
     par_cfg.thread_count = 8;
     seqan3::configuration cfg2 = par_cfg | seqan3::search_cfg::max_error_total{seqan3::search_cfg::error_count{1}};
 
+    // Search at most 1000 queries at once and report the results in the order in which the queries were searched.
+    par_cfg.buffer_size = 1000u;
+    par_cfg.order = seqan3::search_cfg::parallel::result_order::completion;
+    seqan3::configuration cfg3 = par_cfg | seqan3::search_cfg::max_error_total{seqan3::search_cfg::error_count{1}};
+
     return 0;
 }
@@ -0,0 +1,40 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/search/dream_index/counting_interleaved_bloom_filter.hpp>
+#include <seqan3/search/views/kmer_hash.hpp>
+
+using namespace seqan3::literals;
+
+int main()
+{
+    // 8 bins, 8192 counters per bin, 2 hash functions, 4-bit counters.
+    seqan3::counting_interleaved_bloom_filter<4> cibf{seqan3::bin_count{8u},
+                                                      seqan3::bin_size{8192u},
+                                                      seqan3::hash_function_count{2u}};
+
+    auto const sequence1 = "ACTGACTGACTGATC"_dna4;
+    auto const sequence2 = "AAAAAAAAAAAAAAAAAAAAAAAA"_dna4;
+    auto hash_adaptor = seqan3::views::kmer_hash(seqan3::ungapped{5u});
+
+    // Insert all 5-mers of sequence1 into bin 0
+    for (auto && value : sequence1 | hash_adaptor)
+        cibf.emplace(value, seqan3::bin_index{0u});
+
+    // Insert all 5-mers of sequence2 into bin 3. "AAAAA" occurs 20 times, but the counters saturate at 15.
+    for (auto && value : sequence2 | hash_adaptor)
+        cibf.emplace(value, seqan3::bin_index{3u});
+
+    auto agent = cibf.counting_agent();
+
+    // The first 5-mer of sequence1, "ACTGA", occurs three times in sequence1.
+    size_t const actga = (sequence1 | hash_adaptor)[0];
+    seqan3::debug_stream << agent.count(actga) << '\n'; // [3,0,0,0,0,0,0,0]
+
+    // "AAAAA"
+    size_t const aaaaa = (sequence2 | hash_adaptor)[0];
+    seqan3::debug_stream << agent.count(aaaaa) << '\n'; // [0,0,0,15,0,0,0,0]
+}
@@ -0,0 +1,36 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <seqan3/test/snippet/create_temporary_snippet_file.hpp>
+// std::filesystem::current_path() / "ibf.mapped" will be deleted after the execution
+seqan3::test::create_temporary_snippet_file ibf_file{"ibf.mapped", ""};
+
+//![main]
+#include <filesystem>
+
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/search/dream_index/interleaved_bloom_filter.hpp>
+
+int main()
+{
+    auto const ibf_path = std::filesystem::current_path() / "ibf.mapped";
+
+    {
+        seqan3::interleaved_bloom_filter ibf{seqan3::bin_count{12u}, seqan3::bin_size{8192u}};
+        ibf.emplace(126, seqan3::bin_index{0u});
+        ibf.emplace(712, seqan3::bin_index{3u});
+        ibf.emplace(237, seqan3::bin_index{9u});
+
+        // Write the Interleaved Bloom Filter in the memory-mappable format.
+        ibf.store(ibf_path);
+    }
+
+    // Map the file. No data is loaded until it is accessed.
+    seqan3::interleaved_bloom_filter<seqan3::data_layout::mapped> ibf{ibf_path};
+
+    // The agents query the mapped data directly.
+    auto agent = ibf.membership_agent();
+    seqan3::debug_stream << agent.bulk_contains(712) << '\n'; // prints [0,0,0,1,0,0,0,0,0,0,0,0]
+}
+//![main]
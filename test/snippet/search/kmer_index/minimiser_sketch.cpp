@@ -0,0 +1,34 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/search/kmer_index/minimiser_sketch.hpp>
+
+using namespace seqan3::literals;
+
+int main()
+{
+    seqan3::concatenated_sequences<std::vector<seqan3::dna4>> sequences{};
+    sequences.push_back("ACGTAGCTTAGC"_dna4);
+    sequences.push_back("GGCATTACG"_dna4);
+
+    // Uses 2 threads. A seed of 0 orders the k-mers lexicographically.
+    auto hashes = seqan3::bulk_minimiser_hash(sequences,
+                                              seqan3::ungapped{3},
+                                              seqan3::window_size{5},
+                                              seqan3::seed{0},
+                                              2u);
+    seqan3::debug_stream << hashes << '\n';
+
+    // All minimisers are stored in one contiguous array.
+    seqan3::debug_stream << hashes.concat() << '\n';
+
+    auto sketch = seqan3::bulk_minimiser_hash_with_positions(sequences,
+                                                             seqan3::ungapped{3},
+                                                             seqan3::window_size{5},
+                                                             seqan3::seed{0},
+                                                             2u);
+    seqan3::debug_stream << sketch.positions << '\n';
+}
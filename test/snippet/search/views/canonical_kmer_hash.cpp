@@ -0,0 +1,19 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/search/views/canonical_kmer_hash.hpp>
+
+using namespace seqan3::literals;
+
+int main()
+{
+    std::vector<seqan3::dna4> text{"ACGTAGC"_dna4};
+
+    // ACG and its reverse complement CGT have the same canonical hash.
+    seqan3::debug_stream << (text | seqan3::views::canonical_kmer_hash(seqan3::ungapped{3})) << '\n'; // [6,6,44,28,9]
+
+    seqan3::debug_stream << (text | seqan3::views::canonical_kmer_hash(0b101_shape)) << '\n'; // [2,2,8,4,1]
+}
@@ -0,0 +1,18 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/search/views/strobemer.hpp>
+
+using namespace seqan3::literals;
+
+int main()
+{
+    std::vector<seqan3::dna4> text{"ACGTAGCTTAGC"_dna4};
+
+    // The second 3-mer is searched at offsets 2 to 4 from the first 3-mer.
+    auto strobemers = text | seqan3::views::strobemer(seqan3::ungapped{3}, seqan3::strobe_window{2, 4});
+    seqan3::debug_stream << strobemers << '\n';
+}
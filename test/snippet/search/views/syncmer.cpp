@@ -0,0 +1,27 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/search/views/syncmer.hpp>
+
+using namespace seqan3::literals;
+
+int main()
+{
+    std::vector<seqan3::dna4> text{"ACGTAGCTTAGC"_dna4};
+
+    // Closed syncmers: The smallest 2-mer is the first or the last 2-mer of the 4-mer.
+    // A seed of 0 orders the 2-mers lexicographically.
+    auto closed = text | seqan3::views::syncmer(seqan3::ungapped{4}, seqan3::ungapped{2}, seqan3::seed{0});
+    seqan3::debug_stream << closed << '\n';
+
+    // Open syncmers: The smallest 2-mer is the second 2-mer of the 4-mer.
+    auto open = text
+              | seqan3::views::syncmer(seqan3::ungapped{4},
+                                       seqan3::ungapped{2},
+                                       seqan3::syncmer_offset{1},
+                                       seqan3::seed{0});
+    seqan3::debug_stream << open << '\n';
+}
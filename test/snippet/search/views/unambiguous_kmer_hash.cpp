@@ -0,0 +1,23 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/search/views/unambiguous_kmer_hash.hpp>
+
+using namespace seqan3::literals;
+
+int main()
+{
+    std::vector<seqan3::dna5> text{"ACGTNAGCTANNACG"_dna5};
+
+    // The 3-mers GTN, TNA, NAG, TAN, ANN, NNA and NAC are skipped.
+    auto hashes = text | seqan3::views::unambiguous_kmer_hash(seqan3::ungapped{3});
+    seqan3::debug_stream << hashes << '\n'; // [6,27,9,39,28,6]
+
+    // The iterator knows the position of the k-mer in the text.
+    for (auto it = hashes.begin(); it != hashes.end(); ++it)
+        seqan3::debug_stream << it.position() << ' ';
+    seqan3::debug_stream << '\n'; // 0 1 5 6 7 12
+}
@@ -0,0 +1,31 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/configuration/all.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/utility/parallel/thread_pool.hpp>
+
+int main()
+{
+    using namespace seqan3::literals;
+
+    // The threads are spawned once and reused by all alignment calls below.
+    seqan3::thread_pool pool{4};
+
+    auto const config = seqan3::align_cfg::method_global{} | seqan3::align_cfg::edit_scheme
+                      | seqan3::align_cfg::output_score{} | seqan3::align_cfg::parallel{pool};
+
+    std::vector<std::vector<std::pair<seqan3::dna4_vector, seqan3::dna4_vector>>> batches{
+        {{"ACGTGAC"_dna4, "ACGTC"_dna4}, {"AGTC"_dna4, "AGCTG"_dna4}},
+        {{"ACGT"_dna4, "ACGA"_dna4}}};
+
+    for (auto & batch : batches)
+        for (auto const & result : seqan3::align_pairwise(batch, config))
+            seqan3::debug_stream << result.score() << '\n';
+}
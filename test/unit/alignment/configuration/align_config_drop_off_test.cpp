@@ -0,0 +1,41 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <type_traits>
+
+#include <seqan3/alignment/configuration/align_config_drop_off.hpp>
+#include <seqan3/core/configuration/configuration.hpp>
+
+TEST(align_config_drop_off, config_element)
+{
+    EXPECT_TRUE((seqan3::detail::config_element<seqan3::align_cfg::x_drop>));
+    EXPECT_TRUE((seqan3::detail::config_element<seqan3::align_cfg::z_drop>));
+}
+
+TEST(align_config_drop_off, configuration)
+{
+    {
+        seqan3::configuration cfg{seqan3::align_cfg::x_drop{30}};
+        auto x_drop = std::get<seqan3::align_cfg::x_drop>(cfg);
+        EXPECT_TRUE((std::is_same_v<decltype(x_drop.drop_score), int32_t>));
+
+        EXPECT_EQ(x_drop.drop_score, 30);
+    }
+
+    {
+        seqan3::configuration cfg{seqan3::align_cfg::z_drop{100}};
+        auto z_drop = std::get<seqan3::align_cfg::z_drop>(cfg);
+        EXPECT_TRUE((std::is_same_v<decltype(z_drop.drop_score), int32_t>));
+
+        EXPECT_EQ(z_drop.drop_score, 100);
+    }
+
+    {
+        auto cfg = seqan3::align_cfg::x_drop{30} | seqan3::align_cfg::z_drop{100};
+        EXPECT_EQ(std::get<seqan3::align_cfg::x_drop>(cfg).drop_score, 30);
+        EXPECT_EQ(std::get<seqan3::align_cfg::z_drop>(cfg).drop_score, 100);
+    }
+}
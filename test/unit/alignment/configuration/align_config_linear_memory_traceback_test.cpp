@@ -0,0 +1,38 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <type_traits>
+
+#include <seqan3/alignment/configuration/align_config_linear_memory_traceback.hpp>
+#include <seqan3/core/configuration/configuration.hpp>
+
+TEST(align_config_linear_memory_traceback, config_element)
+{
+    EXPECT_TRUE((seqan3::detail::config_element<seqan3::align_cfg::linear_memory_traceback>));
+}
+
+TEST(align_config_linear_memory_traceback, configuration)
+{
+    {
+        seqan3::configuration cfg{seqan3::align_cfg::linear_memory_traceback{}};
+        auto linear_memory = std::get<seqan3::align_cfg::linear_memory_traceback>(cfg);
+        EXPECT_TRUE((std::is_same_v<decltype(linear_memory.min_matrix_size), uint64_t>));
+
+        EXPECT_EQ(linear_memory.min_matrix_size, 0u);
+    }
+
+    {
+        seqan3::configuration cfg{seqan3::align_cfg::linear_memory_traceback{1000u}};
+        EXPECT_EQ(std::get<seqan3::align_cfg::linear_memory_traceback>(cfg).min_matrix_size, 1000u);
+    }
+
+    {
+        auto cfg = seqan3::configuration{}.get_or(
+            seqan3::align_cfg::linear_memory_traceback{
+                seqan3::align_cfg::linear_memory_traceback::default_min_matrix_size});
+        EXPECT_EQ(cfg.min_matrix_size, uint64_t{1} << 30);
+    }
+}
@@ -10,6 +10,7 @@
 
 #include <seqan3/alignment/configuration/align_config_parallel.hpp>
 #include <seqan3/core/configuration/configuration.hpp>
+#include <seqan3/utility/parallel/thread_pool.hpp>
 
 // ---------------------------------------------------------------------------------------------------------------------
 // individual tests
@@ -39,3 +40,57 @@ TEST(align_config_parallel, configuration)
         EXPECT_EQ(cfg_value, 2u);
     }
 }
+
+TEST(align_config_parallel, buffer_size_and_result_order)
+{
+    { // defaults
+        seqan3::align_cfg::parallel elem{2};
+        EXPECT_FALSE(elem.buffer_size);
+        EXPECT_EQ(elem.order, seqan3::align_cfg::parallel::result_order::input);
+    }
+
+    { // construct with buffer size
+        seqan3::configuration cfg{seqan3::align_cfg::parallel{2, 64u}};
+        auto const & elem = std::get<seqan3::align_cfg::parallel>(cfg);
+
+        EXPECT_EQ(elem.thread_count, 2u);
+        EXPECT_EQ(elem.buffer_size, 64u);
+        EXPECT_EQ(elem.order, seqan3::align_cfg::parallel::result_order::input);
+    }
+
+    { // construct with buffer size and result order
+        seqan3::configuration cfg{
+            seqan3::align_cfg::parallel{2, 64u, seqan3::align_cfg::parallel::result_order::completion}};
+
+        EXPECT_EQ(std::get<seqan3::align_cfg::parallel>(cfg).order,
+                  seqan3::align_cfg::parallel::result_order::completion);
+    }
+}
+
+TEST(align_config_parallel, thread_pool)
+{
+    seqan3::thread_pool pool{3};
+
+    { // defaults
+        seqan3::align_cfg::parallel elem{2};
+        EXPECT_EQ(elem.pool, nullptr);
+    }
+
+    { // construct from pool
+        seqan3::configuration cfg{seqan3::align_cfg::parallel{pool}};
+        auto const & elem = std::get<seqan3::align_cfg::parallel>(cfg);
+
+        EXPECT_EQ(elem.pool, &pool);
+        EXPECT_EQ(elem.thread_count, 3u);
+        EXPECT_FALSE(elem.buffer_size);
+    }
+
+    { // construct from pool with buffer size and result order
+        seqan3::align_cfg::parallel elem{pool, 64u, seqan3::align_cfg::parallel::result_order::completion};
+
+        EXPECT_EQ(elem.pool, &pool);
+        EXPECT_EQ(elem.thread_count, 3u);
+        EXPECT_EQ(elem.buffer_size, 64u);
+        EXPECT_EQ(elem.order, seqan3::align_cfg::parallel::result_order::completion);
+    }
+}
@@ -0,0 +1,23 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <type_traits>
+
+#include <seqan3/alignment/configuration/align_config_query_profile.hpp>
+#include <seqan3/alignment/configuration/align_config_vectorised.hpp>
+#include <seqan3/core/configuration/configuration.hpp>
+
+TEST(align_config_query_profile, config_element)
+{
+    EXPECT_TRUE((seqan3::detail::config_element<seqan3::align_cfg::query_profile>));
+    EXPECT_TRUE(std::is_nothrow_default_constructible_v<seqan3::align_cfg::query_profile>);
+}
+
+TEST(align_config_query_profile, configuration)
+{
+    seqan3::configuration cfg = seqan3::align_cfg::vectorised{} | seqan3::align_cfg::query_profile{};
+    EXPECT_TRUE(decltype(cfg)::exists<seqan3::align_cfg::query_profile>());
+}
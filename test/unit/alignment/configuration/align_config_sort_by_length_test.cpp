@@ -0,0 +1,32 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <type_traits>
+
+#include <seqan3/alignment/configuration/align_config_sort_by_length.hpp>
+#include <seqan3/core/configuration/configuration.hpp>
+
+TEST(align_config_sort_by_length, config_element)
+{
+    EXPECT_TRUE((seqan3::detail::config_element<seqan3::align_cfg::sort_by_length>));
+}
+
+TEST(align_config_sort_by_length, configuration)
+{
+    {
+        seqan3::configuration cfg{seqan3::align_cfg::sort_by_length{}};
+        auto sort_by_length = std::get<seqan3::align_cfg::sort_by_length>(cfg);
+        EXPECT_TRUE((std::is_same_v<decltype(sort_by_length.window_size), size_t>));
+
+        EXPECT_EQ(sort_by_length.window_size, seqan3::align_cfg::sort_by_length::default_window_size);
+        EXPECT_EQ(sort_by_length.window_size, 1024u);
+    }
+
+    {
+        seqan3::configuration cfg{seqan3::align_cfg::sort_by_length{100u}};
+        EXPECT_EQ(std::get<seqan3::align_cfg::sort_by_length>(cfg).window_size, 100u);
+    }
+}
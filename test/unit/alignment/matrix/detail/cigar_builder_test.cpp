@@ -0,0 +1,153 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <seqan3/alignment/cigar_conversion/cigar_from_alignment.hpp>
+#include <seqan3/alignment/matrix/detail/aligned_sequence_builder.hpp>
+#include <seqan3/alignment/matrix/detail/cigar_builder.hpp>
+#include <seqan3/alignment/matrix/detail/trace_directions.hpp>
+#include <seqan3/alignment/matrix/detail/trace_iterator.hpp>
+#include <seqan3/alignment/matrix/detail/two_dimensional_matrix.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/test/expect_range_eq.hpp>
+
+using seqan3::operator|;
+using seqan3::operator""_cigar_operation;
+using seqan3::operator""_dna4;
+
+struct cigar_builder_test : public ::testing::Test
+{
+    static constexpr seqan3::detail::trace_directions N = seqan3::detail::trace_directions::none;
+    static constexpr seqan3::detail::trace_directions D = seqan3::detail::trace_directions::diagonal;
+    static constexpr seqan3::detail::trace_directions U = seqan3::detail::trace_directions::up;
+    static constexpr seqan3::detail::trace_directions UO = seqan3::detail::trace_directions::up_open;
+    static constexpr seqan3::detail::trace_directions L = seqan3::detail::trace_directions::left;
+    static constexpr seqan3::detail::trace_directions LO = seqan3::detail::trace_directions::left_open;
+
+    // The same trace matrix as in the aligned_sequence_builder_test over the sequences ACG and AG.
+    seqan3::detail::two_dimensional_matrix<seqan3::detail::trace_directions> matrix{
+        seqan3::detail::number_rows{3},
+        seqan3::detail::number_cols{4},
+        std::vector{N, LO, L, L, UO, D | LO | UO, L, D | L | UO, U, LO | U, D, L}};
+
+    auto path(std::ptrdiff_t const row, std::ptrdiff_t const column)
+    {
+        seqan3::detail::matrix_offset const offset{seqan3::detail::row_index_type{row},
+                                                   seqan3::detail::column_index_type{column}};
+        using iterator_t = decltype(seqan3::detail::trace_iterator{matrix.begin() + offset});
+        return std::ranges::subrange<iterator_t, std::default_sentinel_t>{
+            seqan3::detail::trace_iterator{matrix.begin() + offset},
+            std::default_sentinel};
+    }
+
+    seqan3::detail::cigar_builder builder{};
+};
+
+TEST_F(cigar_builder_test, construction)
+{
+    EXPECT_TRUE(std::is_default_constructible_v<seqan3::detail::cigar_builder>);
+    EXPECT_TRUE(std::is_copy_constructible_v<seqan3::detail::cigar_builder>);
+    EXPECT_TRUE(std::is_move_constructible_v<seqan3::detail::cigar_builder>);
+    EXPECT_TRUE(std::is_copy_assignable_v<seqan3::detail::cigar_builder>);
+    EXPECT_TRUE(std::is_move_assignable_v<seqan3::detail::cigar_builder>);
+    EXPECT_TRUE(std::is_destructible_v<seqan3::detail::cigar_builder>);
+}
+
+TEST_F(cigar_builder_test, build_from_2_3)
+{
+    auto [first_sequence_slice_positions, second_sequence_slice_positions, cigar_sequence] = builder(path(2, 3));
+
+    EXPECT_EQ(first_sequence_slice_positions, (std::pair<size_t, size_t>{0u, 3u}));
+    EXPECT_EQ(second_sequence_slice_positions, (std::pair<size_t, size_t>{0u, 2u}));
+    EXPECT_RANGE_EQ(cigar_sequence,
+                    (std::vector<seqan3::cigar>{{2, 'I'_cigar_operation}, {3, 'D'_cigar_operation}})); // --ACG/AG---
+}
+
+TEST_F(cigar_builder_test, build_from_2_2)
+{
+    auto [first_sequence_slice_positions, second_sequence_slice_positions, cigar_sequence] = builder(path(2, 2));
+
+    EXPECT_EQ(first_sequence_slice_positions, (std::pair<size_t, size_t>{0u, 2u}));
+    EXPECT_EQ(second_sequence_slice_positions, (std::pair<size_t, size_t>{0u, 2u}));
+    EXPECT_RANGE_EQ(cigar_sequence, (std::vector<seqan3::cigar>{{2, 'M'_cigar_operation}})); // AC/AG
+}
+
+TEST_F(cigar_builder_test, build_from_2_1)
+{
+    auto [first_sequence_slice_positions, second_sequence_slice_positions, cigar_sequence] = builder(path(2, 1));
+
+    EXPECT_EQ(first_sequence_slice_positions, (std::pair<size_t, size_t>{0u, 1u}));
+    EXPECT_EQ(second_sequence_slice_positions, (std::pair<size_t, size_t>{0u, 2u}));
+    EXPECT_RANGE_EQ(cigar_sequence,
+                    (std::vector<seqan3::cigar>{{1, 'D'_cigar_operation}, {2, 'I'_cigar_operation}})); // A--/-AG
+}
+
+TEST_F(cigar_builder_test, build_from_1_2)
+{
+    auto [first_sequence_slice_positions, second_sequence_slice_positions, cigar_sequence] = builder(path(1, 2));
+
+    EXPECT_EQ(first_sequence_slice_positions, (std::pair<size_t, size_t>{0u, 2u}));
+    EXPECT_EQ(second_sequence_slice_positions, (std::pair<size_t, size_t>{0u, 1u}));
+    EXPECT_RANGE_EQ(cigar_sequence,
+                    (std::vector<seqan3::cigar>{{1, 'I'_cigar_operation}, {2, 'D'_cigar_operation}})); // -AC/A--
+}
+
+TEST_F(cigar_builder_test, build_from_1_3)
+{
+    auto [first_sequence_slice_positions, second_sequence_slice_positions, cigar_sequence] = builder(path(1, 3));
+
+    EXPECT_EQ(first_sequence_slice_positions, (std::pair<size_t, size_t>{0u, 3u}));
+    EXPECT_EQ(second_sequence_slice_positions, (std::pair<size_t, size_t>{0u, 1u}));
+    EXPECT_RANGE_EQ(cigar_sequence,
+                    (std::vector<seqan3::cigar>{{2, 'D'_cigar_operation}, {1, 'M'_cigar_operation}})); // ACG/--A
+}
+
+TEST_F(cigar_builder_test, build_from_0_3)
+{
+    auto [first_sequence_slice_positions, second_sequence_slice_positions, cigar_sequence] = builder(path(0, 3));
+
+    EXPECT_EQ(first_sequence_slice_positions, (std::pair<size_t, size_t>{0u, 3u}));
+    EXPECT_EQ(second_sequence_slice_positions, (std::pair<size_t, size_t>{0u, 0u}));
+    EXPECT_RANGE_EQ(cigar_sequence, (std::vector<seqan3::cigar>{{3, 'D'_cigar_operation}})); // ACG/---
+}
+
+TEST_F(cigar_builder_test, build_from_0_0)
+{
+    auto [first_sequence_slice_positions, second_sequence_slice_positions, cigar_sequence] = builder(path(0, 0));
+
+    EXPECT_EQ(first_sequence_slice_positions, (std::pair<size_t, size_t>{0u, 0u}));
+    EXPECT_EQ(second_sequence_slice_positions, (std::pair<size_t, size_t>{0u, 0u}));
+    EXPECT_TRUE(cigar_sequence.empty());
+}
+
+TEST_F(cigar_builder_test, reuse_builder)
+{
+    // The internal buffer must not leak operations of the previous trace path into the next one.
+    EXPECT_EQ(builder(path(2, 3)).cigar_sequence.size(), 2u);
+    EXPECT_RANGE_EQ(builder(path(1, 1)).cigar_sequence, (std::vector<seqan3::cigar>{{1, 'M'_cigar_operation}}));
+    EXPECT_TRUE(builder(path(0, 0)).cigar_sequence.empty());
+    EXPECT_RANGE_EQ(builder(path(2, 0)).cigar_sequence, (std::vector<seqan3::cigar>{{2, 'I'_cigar_operation}}));
+}
+
+TEST_F(cigar_builder_test, same_as_cigar_from_alignment)
+{
+    seqan3::dna4_vector first = "ACG"_dna4;
+    seqan3::dna4_vector second = "AG"_dna4;
+    seqan3::detail::aligned_sequence_builder alignment_builder{first, second};
+
+    for (std::ptrdiff_t row = 0; row < 3; ++row)
+    {
+        for (std::ptrdiff_t column = 0; column < 4; ++column)
+        {
+            if (row == 0 && column == 0) // cigar_from_alignment rejects empty alignments.
+                continue;
+
+            EXPECT_RANGE_EQ(builder(path(row, column)).cigar_sequence,
+                            seqan3::cigar_from_alignment(alignment_builder(path(row, column)).alignment));
+        }
+    }
+}
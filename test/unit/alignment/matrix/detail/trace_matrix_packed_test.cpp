@@ -0,0 +1,198 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include <seqan3/alignment/matrix/detail/trace_iterator_banded.hpp>
+#include <seqan3/alignment/matrix/detail/trace_matrix_packed.hpp>
+
+#include "../../../range/iterator_test_template.hpp"
+
+using seqan3::operator|;
+
+using trace_t = seqan3::detail::trace_directions;
+using matrix_t = seqan3::detail::trace_matrix_packed<trace_t>;
+using matrix_iterator_t = std::ranges::iterator_t<matrix_t>;
+
+template <>
+struct iterator_fixture<matrix_iterator_t> : public ::testing::Test
+{
+    using materialised_column_t = std::vector<std::tuple<trace_t, trace_t, trace_t>>;
+
+    using iterator_tag = std::input_iterator_tag;
+    static constexpr bool const_iterable = false;
+
+    static constexpr seqan3::detail::trace_directions none = seqan3::detail::trace_directions::none;
+
+    // Single column with 5 entries as the seq2 has size 4 (need one more for the initialisation row).
+    materialised_column_t column = materialised_column_t{5, std::tuple{none, none, none}};
+    std::vector<materialised_column_t> expected_range{column, column, column, column};
+    matrix_t test_range;
+
+    void SetUp()
+    {
+        std::string seq1 = "abc";
+        std::string seq2 = "abcd";
+
+        test_range.resize(seqan3::detail::column_index_type<size_t>{4}, seqan3::detail::row_index_type<size_t>{5});
+    }
+
+    template <typename actual_column_t, typename expected_column_t>
+    static void expect_eq(actual_column_t && actual_column, expected_column_t && expected_column)
+    {
+        auto actual_it = actual_column.begin();
+        auto expected_it = expected_column.begin();
+        for (; actual_it != actual_column.end(); ++actual_it, ++expected_it)
+        {
+            using std::get;
+            auto actual_cell = *actual_it;
+            auto expected_cell = *expected_it;
+
+            EXPECT_EQ(get<0>(actual_cell), get<0>(expected_cell));
+            EXPECT_EQ(get<1>(actual_cell), get<1>(expected_cell));
+            EXPECT_EQ(get<2>(actual_cell), get<2>(expected_cell));
+        }
+    }
+};
+
+INSTANTIATE_TYPED_TEST_SUITE_P(trace_matrix_packed_test, iterator_fixture, matrix_iterator_t, );
+
+TEST(trace_matrix_packed_test, viewable_range_proxy)
+{
+    EXPECT_TRUE(std::ranges::view<std::iter_reference_t<matrix_iterator_t>>);
+}
+
+// Extracts the two-dimensional matrix iterator that is wrapped by the trace iterator of the trace path.
+template <typename trace_iterator_t>
+struct matrix_iterator_of;
+
+template <typename matrix_iter_t>
+struct matrix_iterator_of<seqan3::detail::trace_iterator<matrix_iter_t>>
+{
+    using type = matrix_iter_t;
+};
+
+TEST(trace_matrix_packed_test, matrix_iterator)
+{
+    using trace_path_t = decltype(std::declval<matrix_t const &>().trace_path(seqan3::detail::matrix_coordinate{}));
+    using matrix_iter_t = typename matrix_iterator_of<std::ranges::iterator_t<trace_path_t>>::type;
+
+    EXPECT_TRUE(seqan3::detail::two_dimensional_matrix_iterator<matrix_iter_t>);
+    EXPECT_TRUE((std::same_as<std::iter_value_t<matrix_iter_t>, trace_t>));
+    EXPECT_TRUE(std::forward_iterator<seqan3::detail::trace_iterator_banded<matrix_iter_t>>);
+}
+
+TEST(trace_matrix_packed_test, trace_path)
+{
+    matrix_t matrix{};
+    matrix.resize(seqan3::detail::column_index_type<size_t>{4}, seqan3::detail::row_index_type<size_t>{3});
+    auto trace_column_it = matrix.begin();
+    auto trace_column = *trace_column_it;
+
+    // Initialise column 0
+    auto trace_cell_it = trace_column.begin();
+    *trace_cell_it = std::tuple{trace_t::none, trace_t::none, trace_t::none};
+    *++trace_cell_it = std::tuple{trace_t::up_open, trace_t::none, trace_t::none};
+    *++trace_cell_it = std::tuple{trace_t::up, trace_t::none, trace_t::none};
+
+    // Initialise column 1
+    trace_column = *++trace_column_it;
+    trace_cell_it = trace_column.begin();
+    *trace_cell_it = std::tuple{trace_t::left_open, trace_t::none, trace_t::none};
+    *++trace_cell_it = std::tuple{trace_t::diagonal, trace_t::none, trace_t::none};
+    *++trace_cell_it = std::tuple{trace_t::up_open, trace_t::none, trace_t::none};
+
+    // Initialise column 2
+    trace_column = *++trace_column_it;
+    trace_cell_it = trace_column.begin();
+    *trace_cell_it = std::tuple{trace_t::left, trace_t::none, trace_t::none};
+    *++trace_cell_it = std::tuple{trace_t::diagonal, trace_t::none, trace_t::none};
+    *++trace_cell_it = std::tuple{trace_t::left_open, trace_t::none, trace_t::none};
+
+    // Initialise column 3
+    trace_column = *++trace_column_it;
+    trace_cell_it = trace_column.begin();
+    *trace_cell_it = std::tuple{trace_t::left, trace_t::none, trace_t::none};
+    *++trace_cell_it = std::tuple{trace_t::up_open, trace_t::none, trace_t::none};
+    *++trace_cell_it = std::tuple{trace_t::left, trace_t::none, trace_t::none};
+
+    EXPECT_TRUE(++trace_cell_it == trace_column.end());
+    EXPECT_TRUE(++trace_column_it == matrix.end());
+
+    auto trace_path = matrix.trace_path(
+        seqan3::detail::matrix_coordinate{seqan3::detail::row_index_type{2u}, seqan3::detail::column_index_type{3u}});
+
+    auto trace_path_it = trace_path.begin();
+    EXPECT_EQ(*trace_path_it, trace_t::left);
+    EXPECT_EQ(*++trace_path_it, trace_t::left);
+    EXPECT_EQ(*++trace_path_it, trace_t::up);
+    EXPECT_EQ(*++trace_path_it, trace_t::diagonal);
+    EXPECT_EQ(*++trace_path_it, trace_t::none);
+    EXPECT_TRUE(trace_path_it == trace_path.end());
+}
+
+TEST(trace_matrix_packed_test, invalid_trace_path_coordinate)
+{
+    matrix_t matrix{};
+    matrix.resize(seqan3::detail::column_index_type<size_t>{4}, seqan3::detail::row_index_type<size_t>{3});
+
+    EXPECT_THROW((matrix.trace_path(seqan3::detail::matrix_coordinate{seqan3::detail::row_index_type{3u},
+                                                                      seqan3::detail::column_index_type{3u}})),
+                 std::invalid_argument);
+    EXPECT_THROW((matrix.trace_path(seqan3::detail::matrix_coordinate{seqan3::detail::row_index_type{2u},
+                                                                      seqan3::detail::column_index_type{4u}})),
+                 std::invalid_argument);
+}
+
+TEST(trace_matrix_packed_test, trace_path_from_current_column)
+{
+    matrix_t matrix{};
+    matrix.resize(seqan3::detail::column_index_type<size_t>{3}, seqan3::detail::row_index_type<size_t>{3});
+    auto trace_column_it = matrix.begin();
+    auto trace_column = *trace_column_it;
+
+    // Initialise column 0
+    auto trace_cell_it = trace_column.begin();
+    *trace_cell_it = std::tuple{trace_t::none, trace_t::none, trace_t::none};
+    *++trace_cell_it = std::tuple{trace_t::up_open, trace_t::none, trace_t::none};
+    *++trace_cell_it = std::tuple{trace_t::up, trace_t::none, trace_t::none};
+
+    // Initialise column 1: stores more than one direction per cell.
+    trace_column = *++trace_column_it;
+    trace_cell_it = trace_column.begin();
+    *trace_cell_it = std::tuple{trace_t::left_open, trace_t::none, trace_t::none};
+    *++trace_cell_it =
+        std::tuple{trace_t::diagonal | trace_t::up_open | trace_t::left_open, trace_t::none, trace_t::none};
+    *++trace_cell_it = std::tuple{trace_t::up_open | trace_t::left, trace_t::none, trace_t::none};
+
+    // Initialise column 2, which is not packed as the iterator is not advanced.
+    trace_column = *++trace_column_it;
+    trace_cell_it = trace_column.begin();
+    *trace_cell_it = std::tuple{trace_t::left, trace_t::none, trace_t::none};
+    *++trace_cell_it = std::tuple{trace_t::up_open, trace_t::none, trace_t::none};
+    *++trace_cell_it = std::tuple{trace_t::left_open | trace_t::up, trace_t::none, trace_t::none};
+
+    auto trace_path = matrix.trace_path(
+        seqan3::detail::matrix_coordinate{seqan3::detail::row_index_type{2u}, seqan3::detail::column_index_type{2u}});
+
+    auto trace_path_it = trace_path.begin();
+    EXPECT_EQ(*trace_path_it, trace_t::up);
+    EXPECT_EQ(*++trace_path_it, trace_t::up);
+    EXPECT_EQ(*++trace_path_it, trace_t::left);
+    EXPECT_EQ(*++trace_path_it, trace_t::left);
+    EXPECT_EQ(*++trace_path_it, trace_t::none);
+    EXPECT_TRUE(trace_path_it == trace_path.end());
+
+    trace_path = matrix.trace_path(
+        seqan3::detail::matrix_coordinate{seqan3::detail::row_index_type{2u}, seqan3::detail::column_index_type{1u}});
+
+    trace_path_it = trace_path.begin();
+    EXPECT_EQ(*trace_path_it, trace_t::up);
+    EXPECT_EQ(*++trace_path_it, trace_t::diagonal);
+    EXPECT_EQ(*++trace_path_it, trace_t::none);
+    EXPECT_TRUE(trace_path_it == trace_path.end());
+}
@@ -0,0 +1,332 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_adaptive_score_width.hpp>
+#include <seqan3/alignment/configuration/align_config_band.hpp>
+#include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_method.hpp>
+#include <seqan3/alignment/configuration/align_config_output.hpp>
+#include <seqan3/alignment/configuration/align_config_score_type.hpp>
+#include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
+#include <seqan3/alignment/configuration/align_config_vectorised.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/pairwise/detail/pairwise_alignment_algorithm_adaptive_width.hpp>
+#include <seqan3/alignment/scoring/aminoacid_scoring_scheme.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/aminoacid/aa27.hpp>
+#include <seqan3/alphabet/nucleotide/dna15.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+
+template <typename alphabet_t>
+std::vector<alphabet_t> random_sequence(std::mt19937_64 & engine, size_t const size)
+{
+    std::uniform_int_distribution<size_t> rank_distribution{0, seqan3::alphabet_size<alphabet_t> - 1};
+    std::vector<alphabet_t> sequence(size);
+    for (auto & letter : sequence)
+        seqan3::assign_rank_to(rank_distribution(engine), letter);
+    return sequence;
+}
+
+// The sequence lengths are drawn such that every chunk contains pairs of every score width.
+template <typename alphabet_t>
+std::vector<std::pair<std::vector<alphabet_t>, std::vector<alphabet_t>>>
+random_sequence_pairs(std::mt19937_64 & engine, size_t const count)
+{
+    std::uniform_int_distribution<size_t> width_distribution{0, 2};
+    std::array<std::uniform_int_distribution<size_t>, 3> size_distributions{
+        std::uniform_int_distribution<size_t>{0, 20},
+        std::uniform_int_distribution<size_t>{10, 300},
+        std::uniform_int_distribution<size_t>{4000, 4500}};
+
+    std::vector<std::pair<std::vector<alphabet_t>, std::vector<alphabet_t>>> sequences{};
+    for (size_t i = 0; i < count; ++i)
+    {
+        auto & size_distribution = size_distributions[width_distribution(engine)];
+        std::vector<alphabet_t> sequence1 = random_sequence<alphabet_t>(engine, size_distribution(engine));
+        std::vector<alphabet_t> sequence2 = random_sequence<alphabet_t>(engine, size_distribution(engine));
+
+        // Similar sequences to obtain large scores.
+        for (size_t j = 0; j < std::min(sequence1.size(), sequence2.size()); j += 5)
+            sequence2[j] = sequence1[j];
+
+        sequences.emplace_back(std::move(sequence1), std::move(sequence2));
+    }
+    return sequences;
+}
+
+// The results must be identical to the reference alignment and be reported in input order.
+// The vectorised alignment selects the score width per pair, unless a score type is configured.
+template <typename sequences_t, typename config_t, typename reference_config_t>
+void check_same_as(sequences_t & sequences, config_t const & cfg, reference_config_t const & reference_cfg)
+{
+    auto const output_cfg = seqan3::align_cfg::output_score{} | seqan3::align_cfg::output_end_position{}
+                          | seqan3::align_cfg::output_sequence1_id{} | seqan3::align_cfg::output_sequence2_id{};
+    auto const vectorised_cfg = [&]()
+    {
+        if constexpr (config_t::template exists<seqan3::align_cfg::score_type>())
+            return cfg | output_cfg | seqan3::align_cfg::vectorised{};
+        else
+            return cfg | output_cfg | seqan3::align_cfg::vectorised{} | seqan3::align_cfg::adaptive_score_width{};
+    }();
+
+    auto reference_results = seqan3::align_pairwise(sequences, reference_cfg | output_cfg);
+    auto adaptive_results = seqan3::align_pairwise(sequences, vectorised_cfg);
+
+    size_t id = 0;
+    auto reference_it = reference_results.begin();
+    for (auto && result : adaptive_results)
+    {
+        ASSERT_TRUE(reference_it != reference_results.end());
+        auto && expected = *reference_it;
+
+        EXPECT_EQ(result.sequence1_id(), id);
+        EXPECT_EQ(result.sequence2_id(), id);
+        EXPECT_EQ(result.score(), expected.score()) << "id " << id;
+        EXPECT_EQ(result.sequence1_end_position(), expected.sequence1_end_position()) << "id " << id;
+        EXPECT_EQ(result.sequence2_end_position(), expected.sequence2_end_position()) << "id " << id;
+        ++reference_it;
+        ++id;
+    }
+    EXPECT_EQ(id, sequences.size());
+}
+
+template <typename sequences_t, typename config_t>
+void check_same_as_scalar(sequences_t & sequences, config_t const & cfg)
+{
+    check_same_as(sequences, cfg, cfg);
+}
+
+auto dna4_scheme()
+{
+    return seqan3::align_cfg::scoring_scheme{
+        seqan3::nucleotide_scoring_scheme{seqan3::match_score{4}, seqan3::mismatch_score{-5}}};
+}
+
+auto gap_costs()
+{
+    return seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-10},
+                                              seqan3::align_cfg::extension_score{-1}};
+}
+
+TEST(affine_adaptive_score_width, chunk_size)
+{
+    using config_t = decltype(seqan3::align_cfg::method_global{} | dna4_scheme() | seqan3::align_cfg::vectorised{}
+                              | seqan3::align_cfg::output_score{});
+    using traits_t = seqan3::detail::alignment_configuration_traits<config_t>;
+    using adaptive_traits_t = seqan3::detail::alignment_configuration_traits<decltype(
+        config_t{} | seqan3::align_cfg::adaptive_score_width{})>;
+
+    // The score width is only selected per sequence pair if it is requested.
+    EXPECT_FALSE(traits_t::is_adaptive_score_width);
+    EXPECT_TRUE(adaptive_traits_t::is_adaptive_score_width);
+    EXPECT_EQ(traits_t::alignments_per_vector, seqan3::simd::simd_traits<seqan3::simd::simd_type_t<int32_t>>::length);
+    EXPECT_EQ(adaptive_traits_t::alignments_per_vector,
+              seqan3::simd::simd_traits<seqan3::simd::simd_type_t<int8_t>>::length);
+}
+
+template <typename config_t>
+using adaptive_algorithm_t = seqan3::detail::pairwise_alignment_algorithm_adaptive_width<
+    config_t,
+    std::function<void(
+        std::vector<std::tuple<std::tuple<std::vector<seqan3::dna4> &, std::vector<seqan3::dna4> &>, int>>,
+        std::function<void(int)>)>>;
+
+template <typename score_t, typename gap_cost_t>
+int64_t max_sequence_length(gap_cost_t const & gap_cost)
+{
+    auto const cfg = seqan3::align_cfg::method_global{} | dna4_scheme() | gap_cost | seqan3::align_cfg::vectorised{}
+                   | seqan3::align_cfg::adaptive_score_width{} | seqan3::align_cfg::output_score{};
+    return adaptive_algorithm_t<std::remove_cvref_t<decltype(cfg)>>::template max_sequence_length<score_t>(cfg);
+}
+
+TEST(affine_adaptive_score_width, max_sequence_length)
+{
+    // 63 / 4 and min(16383 / 4, (16383 - 33) / 2)
+    EXPECT_EQ(max_sequence_length<int8_t>(gap_costs()), 15);
+    EXPECT_EQ(max_sequence_length<int16_t>(gap_costs()), 4095);
+
+    // The gap scores do not fit into 8 bit.
+    auto const large_gap_costs = seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-30},
+                                                                    seqan3::align_cfg::extension_score{-1}};
+    EXPECT_EQ(max_sequence_length<int8_t>(large_gap_costs), -1);
+    EXPECT_EQ(max_sequence_length<int16_t>(large_gap_costs), 4095);
+
+    // The index of a letter pair within the linearised scoring matrix does not fit into 8 bit.
+    auto const aminoacid_cfg =
+        seqan3::align_cfg::method_global{}
+        | seqan3::align_cfg::scoring_scheme{seqan3::aminoacid_scoring_scheme{
+            seqan3::aminoacid_similarity_matrix::blosum62}}
+        | gap_costs() | seqan3::align_cfg::vectorised{} | seqan3::align_cfg::adaptive_score_width{}
+        | seqan3::align_cfg::output_score{};
+    using aminoacid_algorithm_t = adaptive_algorithm_t<std::remove_cvref_t<decltype(aminoacid_cfg)>>;
+    EXPECT_EQ(aminoacid_algorithm_t::max_sequence_length<int8_t>(aminoacid_cfg), -1);
+    EXPECT_EQ(aminoacid_algorithm_t::max_sequence_length<int16_t>(aminoacid_cfg), 1489); // 16383 / 11 (W-W)
+}
+
+TEST(affine_adaptive_score_width, global)
+{
+    std::mt19937_64 engine{23};
+    auto sequences = random_sequence_pairs<seqan3::dna4>(engine, 150);
+
+    check_same_as_scalar(sequences, seqan3::align_cfg::method_global{} | dna4_scheme() | gap_costs());
+}
+
+TEST(affine_adaptive_score_width, semi_global)
+{
+    std::mt19937_64 engine{29};
+    auto sequences = random_sequence_pairs<seqan3::dna4>(engine, 100);
+    seqan3::align_cfg::method_global semi_global{seqan3::align_cfg::free_end_gaps_sequence1_leading{true},
+                                                 seqan3::align_cfg::free_end_gaps_sequence2_leading{false},
+                                                 seqan3::align_cfg::free_end_gaps_sequence1_trailing{true},
+                                                 seqan3::align_cfg::free_end_gaps_sequence2_trailing{false}};
+
+    // The vectorised alignment does not compute the free end gaps, hence the reference is the vectorised alignment
+    // with 32-bit scores.
+    auto const cfg = semi_global | dna4_scheme() | gap_costs();
+    check_same_as(sequences,
+                  cfg,
+                  cfg | seqan3::align_cfg::vectorised{} | seqan3::align_cfg::score_type<int32_t>{});
+}
+
+TEST(affine_adaptive_score_width, local)
+{
+    std::mt19937_64 engine{31};
+    auto sequences = random_sequence_pairs<seqan3::dna4>(engine, 100);
+
+    check_same_as_scalar(sequences, seqan3::align_cfg::method_local{} | dna4_scheme() | gap_costs());
+}
+
+TEST(affine_adaptive_score_width, aminoacid)
+{
+    std::mt19937_64 engine{37};
+    auto sequences = random_sequence_pairs<seqan3::aa27>(engine, 60);
+    auto const scheme = seqan3::align_cfg::scoring_scheme{
+        seqan3::aminoacid_scoring_scheme{seqan3::aminoacid_similarity_matrix::blosum62}};
+
+    check_same_as_scalar(sequences, seqan3::align_cfg::method_global{} | scheme | gap_costs());
+    check_same_as_scalar(sequences, seqan3::align_cfg::method_local{} | scheme | gap_costs());
+}
+
+// The score of the long pair does not fit into 16 bit, the short pairs are computed with narrower scores.
+TEST(affine_adaptive_score_width, overflowing_narrow_width)
+{
+    std::mt19937_64 engine{41};
+    std::vector<std::pair<std::vector<seqan3::dna4>, std::vector<seqan3::dna4>>> sequences{};
+    for (size_t size : {15u, 16u, 4095u, 4096u, 10000u, 3u, 0u})
+    {
+        std::vector<seqan3::dna4> sequence = random_sequence<seqan3::dna4>(engine, size);
+        sequences.emplace_back(sequence, sequence);
+    }
+
+    auto const cfg = seqan3::align_cfg::method_global{} | dna4_scheme() | gap_costs() | seqan3::align_cfg::vectorised{}
+                   | seqan3::align_cfg::adaptive_score_width{} | seqan3::align_cfg::output_score{};
+
+    size_t id = 0;
+    for (auto && result : seqan3::align_pairwise(sequences, cfg))
+    {
+        EXPECT_EQ(result.score(), 4 * static_cast<int>(sequences[id].first.size())) << "id " << id;
+        ++id;
+    }
+    EXPECT_EQ(id, sequences.size());
+}
+
+// A short pair computed together with long pairs must not align the padded parts of its matrix.
+TEST(affine_adaptive_score_width, local_padding)
+{
+    std::mt19937_64 engine{43};
+    std::vector<std::pair<std::vector<seqan3::dna4>, std::vector<seqan3::dna4>>> sequences{};
+    sequences.emplace_back(random_sequence<seqan3::dna4>(engine, 7), random_sequence<seqan3::dna4>(engine, 10));
+    for (size_t i = 0; i < 7; ++i)
+    {
+        std::vector<seqan3::dna4> sequence = random_sequence<seqan3::dna4>(engine, 256);
+        sequences.emplace_back(sequence, sequence);
+    }
+
+    auto const cfg = seqan3::align_cfg::method_local{} | dna4_scheme() | gap_costs();
+    check_same_as_scalar(sequences, cfg);
+    check_same_as_scalar(sequences, cfg | seqan3::align_cfg::score_type<int32_t>{});
+}
+
+// Scores overlapping IUPAC symbols with 1, equal symbols with 5 and all other pairs with -4.
+auto iupac_scheme()
+{
+    // The bases represented by the symbols of seqan3::dna15 in rank order (A = 1, C = 2, G = 4, T = 8).
+    constexpr std::array<int, 15> bases{1, 14, 2, 13, 4, 11, 12, 3, 15, 5, 6, 8, 7, 9, 10};
+
+    seqan3::nucleotide_scoring_scheme<int8_t>::matrix_type matrix{};
+    for (size_t rank1 = 0; rank1 < bases.size(); ++rank1)
+        for (size_t rank2 = 0; rank2 < bases.size(); ++rank2)
+            matrix[rank1][rank2] = (rank1 == rank2) ? 5 : ((bases[rank1] & bases[rank2]) ? 1 : -4);
+
+    return seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{matrix}};
+}
+
+// Nucleotide scoring schemes with more than one match or mismatch score are looked up in a scoring matrix.
+TEST(affine_adaptive_score_width, nucleotide_matrix)
+{
+    std::mt19937_64 engine{47};
+    auto sequences = random_sequence_pairs<seqan3::dna15>(engine, 100);
+
+    check_same_as_scalar(sequences, seqan3::align_cfg::method_global{} | iupac_scheme() | gap_costs());
+    check_same_as_scalar(sequences, seqan3::align_cfg::method_local{} | iupac_scheme() | gap_costs());
+    check_same_as_scalar(sequences,
+                         seqan3::align_cfg::method_global{} | iupac_scheme() | gap_costs()
+                             | seqan3::align_cfg::score_type<int32_t>{});
+
+    // Transitions score -1, transversions -4.
+    using seqan3::operator""_dna4;
+    seqan3::nucleotide_scoring_scheme scheme{seqan3::match_score{5}, seqan3::mismatch_score{-4}};
+    scheme.score('A'_dna4, 'G'_dna4) = scheme.score('G'_dna4, 'A'_dna4) = -1;
+    scheme.score('C'_dna4, 'T'_dna4) = scheme.score('T'_dna4, 'C'_dna4) = -1;
+    auto dna4_sequences = random_sequence_pairs<seqan3::dna4>(engine, 100);
+    check_same_as_scalar(dna4_sequences,
+                         seqan3::align_cfg::method_global{} | seqan3::align_cfg::scoring_scheme{scheme} | gap_costs());
+}
+
+TEST(affine_adaptive_score_width, nucleotide_matrix_banded)
+{
+    std::mt19937_64 engine{53};
+    std::vector<std::pair<std::vector<seqan3::dna15>, std::vector<seqan3::dna15>>> sequences{};
+    for (size_t i = 0; i < 40; ++i)
+    {
+        std::vector<seqan3::dna15> sequence = random_sequence<seqan3::dna15>(engine, 50 + i);
+        sequences.emplace_back(sequence, random_sequence<seqan3::dna15>(engine, 40 + i));
+    }
+
+    auto const band = seqan3::align_cfg::band_fixed_size{seqan3::align_cfg::lower_diagonal{-15},
+                                                         seqan3::align_cfg::upper_diagonal{15}};
+    auto const cfg = seqan3::align_cfg::method_global{} | iupac_scheme() | gap_costs() | band
+                   | seqan3::align_cfg::score_type<int16_t>{} | seqan3::align_cfg::output_score{};
+
+    auto reference_results = seqan3::align_pairwise(sequences, cfg);
+    auto reference_it = reference_results.begin();
+    for (auto && result : seqan3::align_pairwise(sequences, cfg | seqan3::align_cfg::vectorised{}))
+    {
+        ASSERT_TRUE(reference_it != reference_results.end());
+        EXPECT_EQ(result.score(), (*reference_it).score());
+        ++reference_it;
+    }
+}
+
+TEST(affine_adaptive_score_width, invalid_configuration)
+{
+    std::vector<std::pair<std::vector<seqan3::dna4>, std::vector<seqan3::dna4>>> sequences(10);
+    auto const cfg = seqan3::align_cfg::method_global{} | dna4_scheme() | gap_costs()
+                   | seqan3::align_cfg::adaptive_score_width{};
+
+    EXPECT_THROW(seqan3::align_pairwise(sequences, cfg | seqan3::align_cfg::output_score{}),
+                 seqan3::invalid_alignment_configuration);
+
+    auto const local_cfg = seqan3::align_cfg::method_local{} | dna4_scheme() | gap_costs()
+                         | seqan3::align_cfg::adaptive_score_width{} | seqan3::align_cfg::vectorised{};
+    EXPECT_THROW(seqan3::align_pairwise(sequences, local_cfg | seqan3::align_cfg::output_begin_position{}),
+                 seqan3::invalid_alignment_configuration);
+}
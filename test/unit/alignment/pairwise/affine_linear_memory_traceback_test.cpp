@@ -0,0 +1,288 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <ranges>
+#include <tuple>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_linear_memory_traceback.hpp>
+#include <seqan3/alignment/configuration/align_config_method.hpp>
+#include <seqan3/alignment/configuration/align_config_output.hpp>
+#include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
+#include <seqan3/alignment/configuration/align_config_vectorised.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/aminoacid_scoring_scheme.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/aminoacid/aa27.hpp>
+#include <seqan3/alphabet/gap/gap.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+
+using seqan3::operator""_dna4;
+
+template <typename alphabet_t>
+std::vector<alphabet_t> random_sequence(std::mt19937_64 & engine, size_t const size)
+{
+    std::uniform_int_distribution<size_t> rank_distribution{0, seqan3::alphabet_size<alphabet_t> - 1};
+    std::vector<alphabet_t> sequence(size);
+    for (auto & letter : sequence)
+        seqan3::assign_rank_to(rank_distribution(engine), letter);
+    return sequence;
+}
+
+// The second sequence is a mutated copy of a part of the first sequence so that the alignments contain gaps.
+template <typename alphabet_t>
+std::pair<std::vector<alphabet_t>, std::vector<alphabet_t>> random_sequence_pair(std::mt19937_64 & engine,
+                                                                                 size_t const size1,
+                                                                                 size_t const size2)
+{
+    std::vector<alphabet_t> sequence1 = random_sequence<alphabet_t>(engine, size1);
+    std::vector<alphabet_t> sequence2;
+    std::uniform_int_distribution<int> operation_distribution{0, 19};
+
+    for (size_t i = size1 / 5; i < size1 && sequence2.size() < size2; ++i)
+    {
+        int const operation = operation_distribution(engine);
+        if (operation == 0) // deletion
+            i += operation_distribution(engine) % 4;
+        else if (operation == 1) // insertion
+            sequence2.push_back(sequence1[(i * 7) % size1]);
+        else if (operation == 2) // substitution
+            sequence2.push_back(sequence1[(i + 1) % size1]);
+        else
+            sequence2.push_back(sequence1[i]);
+    }
+
+    while (sequence2.size() < size2)
+        sequence2.push_back(random_sequence<alphabet_t>(engine, 1)[0]);
+
+    return {std::move(sequence1), std::move(sequence2)};
+}
+
+// Recomputes the score of the alignment with affine gap costs.
+template <typename alignment_t, typename scheme_t>
+int alignment_score(alignment_t const & alignment, scheme_t const & scheme, int const open, int const extension)
+{
+    auto const & [gapped_sequence1, gapped_sequence2] = alignment;
+    EXPECT_EQ(std::ranges::distance(gapped_sequence1), std::ranges::distance(gapped_sequence2));
+
+    int score = 0;
+    bool gap_in_sequence1 = false;
+    bool gap_in_sequence2 = false;
+    auto it2 = std::ranges::begin(gapped_sequence2);
+    for (auto it1 = std::ranges::begin(gapped_sequence1); it1 != std::ranges::end(gapped_sequence1); ++it1, ++it2)
+    {
+        bool const is_gap1 = (*it1 == seqan3::gap{});
+        bool const is_gap2 = (*it2 == seqan3::gap{});
+        EXPECT_FALSE(is_gap1 && is_gap2);
+
+        if (is_gap1)
+            score += (gap_in_sequence1 ? 0 : open) + extension;
+        else if (is_gap2)
+            score += (gap_in_sequence2 ? 0 : open) + extension;
+        else
+            score += scheme.score((*it1).template convert_to<0>(),
+                                  (*it2).template convert_to<0>());
+
+        gap_in_sequence1 = is_gap1;
+        gap_in_sequence2 = is_gap2;
+    }
+
+    return score;
+}
+
+// The linear memory traceback must compute the same score and positions as the full trace matrix and an alignment
+// between these positions with the optimal score.
+template <typename sequence_t, typename scheme_t, typename config_t>
+void check_same_as_full_matrix(sequence_t & sequence1,
+                               sequence_t & sequence2,
+                               scheme_t const & scheme,
+                               config_t const & cfg,
+                               int const open = -10,
+                               int const extension = -1)
+{
+    auto const output = seqan3::align_cfg::output_score{} | seqan3::align_cfg::output_end_position{}
+                      | seqan3::align_cfg::output_begin_position{} | seqan3::align_cfg::output_alignment{}
+                      | seqan3::align_cfg::output_sequence1_id{} | seqan3::align_cfg::output_sequence2_id{};
+    auto const gap = seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{open},
+                                                        seqan3::align_cfg::extension_score{extension}};
+    auto const full_cfg = cfg | seqan3::align_cfg::scoring_scheme{scheme} | gap | output;
+
+    auto full_results = seqan3::align_pairwise(std::tie(sequence1, sequence2), full_cfg);
+    auto linear_results = seqan3::align_pairwise(std::tie(sequence1, sequence2),
+                                                 full_cfg | seqan3::align_cfg::linear_memory_traceback{});
+
+    auto full_result = *full_results.begin();
+    auto linear_result = *linear_results.begin();
+
+    EXPECT_EQ(linear_result.sequence1_id(), 0u);
+    EXPECT_EQ(linear_result.sequence2_id(), 0u);
+    EXPECT_EQ(linear_result.score(), full_result.score());
+    EXPECT_EQ(linear_result.sequence1_end_position(), full_result.sequence1_end_position());
+    EXPECT_EQ(linear_result.sequence2_end_position(), full_result.sequence2_end_position());
+    EXPECT_EQ(linear_result.sequence1_begin_position(), full_result.sequence1_begin_position());
+    EXPECT_EQ(linear_result.sequence2_begin_position(), full_result.sequence2_begin_position());
+    EXPECT_EQ(alignment_score(linear_result.alignment(), scheme, open, extension), linear_result.score());
+}
+
+auto dna4_scheme()
+{
+    return seqan3::nucleotide_scoring_scheme{seqan3::match_score{4}, seqan3::mismatch_score{-5}};
+}
+
+TEST(affine_linear_memory_traceback, global)
+{
+    std::mt19937_64 engine{23};
+    std::uniform_int_distribution<size_t> size_distribution{0, 120};
+
+    for (size_t round = 0; round < 50; ++round)
+    {
+        auto [sequence1, sequence2] =
+            random_sequence_pair<seqan3::dna4>(engine, size_distribution(engine), size_distribution(engine));
+
+        SCOPED_TRACE(testing::Message() << "round " << round);
+        check_same_as_full_matrix(sequence1, sequence2, dna4_scheme(), seqan3::align_cfg::method_global{});
+    }
+}
+
+TEST(affine_linear_memory_traceback, global_free_end_gaps)
+{
+    std::mt19937_64 engine{29};
+    std::uniform_int_distribution<size_t> size_distribution{1, 100};
+
+    for (size_t round = 0; round < 10; ++round)
+    {
+        auto [sequence1, sequence2] =
+            random_sequence_pair<seqan3::dna4>(engine, size_distribution(engine), size_distribution(engine));
+
+        for (unsigned free_ends = 0; free_ends < 16; ++free_ends)
+        {
+            seqan3::align_cfg::method_global method{
+                seqan3::align_cfg::free_end_gaps_sequence1_leading{static_cast<bool>(free_ends & 1)},
+                seqan3::align_cfg::free_end_gaps_sequence2_leading{static_cast<bool>(free_ends & 2)},
+                seqan3::align_cfg::free_end_gaps_sequence1_trailing{static_cast<bool>(free_ends & 4)},
+                seqan3::align_cfg::free_end_gaps_sequence2_trailing{static_cast<bool>(free_ends & 8)}};
+
+            SCOPED_TRACE(testing::Message() << "round " << round << ", free ends " << free_ends);
+            check_same_as_full_matrix(sequence1, sequence2, dna4_scheme(), method);
+        }
+    }
+}
+
+TEST(affine_linear_memory_traceback, local)
+{
+    std::mt19937_64 engine{31};
+    std::uniform_int_distribution<size_t> size_distribution{0, 150};
+
+    for (size_t round = 0; round < 50; ++round)
+    {
+        auto [sequence1, sequence2] =
+            random_sequence_pair<seqan3::dna4>(engine, size_distribution(engine), size_distribution(engine));
+
+        SCOPED_TRACE(testing::Message() << "round " << round);
+        check_same_as_full_matrix(sequence1, sequence2, dna4_scheme(), seqan3::align_cfg::method_local{});
+    }
+}
+
+TEST(affine_linear_memory_traceback, gap_costs)
+{
+    std::mt19937_64 engine{37};
+    auto [sequence1, sequence2] = random_sequence_pair<seqan3::dna4>(engine, 130, 110);
+
+    for (auto [open, extension] : std::vector<std::pair<int, int>>{{0, -1}, {-2, -1}, {-4, -2}, {-20, -3}})
+    {
+        SCOPED_TRACE(testing::Message() << "open " << open << ", extension " << extension);
+        check_same_as_full_matrix(sequence1,
+                                  sequence2,
+                                  dna4_scheme(),
+                                  seqan3::align_cfg::method_global{},
+                                  open,
+                                  extension);
+        check_same_as_full_matrix(sequence1,
+                                  sequence2,
+                                  dna4_scheme(),
+                                  seqan3::align_cfg::method_local{},
+                                  open,
+                                  extension);
+    }
+}
+
+TEST(affine_linear_memory_traceback, aminoacid)
+{
+    std::mt19937_64 engine{41};
+    seqan3::aminoacid_scoring_scheme scheme{seqan3::aminoacid_similarity_matrix::blosum62};
+
+    for (size_t round = 0; round < 10; ++round)
+    {
+        auto [sequence1, sequence2] = random_sequence_pair<seqan3::aa27>(engine, 40 + 10 * round, 120 - 5 * round);
+
+        SCOPED_TRACE(testing::Message() << "round " << round);
+        check_same_as_full_matrix(sequence1, sequence2, scheme, seqan3::align_cfg::method_global{});
+        check_same_as_full_matrix(sequence1, sequence2, scheme, seqan3::align_cfg::method_local{});
+    }
+}
+
+TEST(affine_linear_memory_traceback, vectorised)
+{
+    std::mt19937_64 engine{43};
+    auto [sequence1, sequence2] = random_sequence_pair<seqan3::dna4>(engine, 90, 70);
+
+    check_same_as_full_matrix(sequence1,
+                              sequence2,
+                              dna4_scheme(),
+                              seqan3::align_cfg::method_global{} | seqan3::align_cfg::vectorised{});
+}
+
+TEST(affine_linear_memory_traceback, long_sequences)
+{
+    std::mt19937_64 engine{47};
+    auto [sequence1, sequence2] = random_sequence_pair<seqan3::dna4>(engine, 2000, 1500);
+
+    check_same_as_full_matrix(sequence1, sequence2, dna4_scheme(), seqan3::align_cfg::method_global{});
+    check_same_as_full_matrix(sequence1, sequence2, dna4_scheme(), seqan3::align_cfg::method_local{});
+}
+
+TEST(affine_linear_memory_traceback, repeats)
+{
+    std::vector<seqan3::dna4> sequence1 = "ACGTACGTACGTACGTACGTACGTACGTACGTACGTACGTACGTACGT"_dna4;
+    std::vector<seqan3::dna4> sequence2 = "ACGTACGTACGTACGTACGT"_dna4;
+    seqan3::align_cfg::method_global semi_global{seqan3::align_cfg::free_end_gaps_sequence1_leading{true},
+                                                 seqan3::align_cfg::free_end_gaps_sequence2_leading{false},
+                                                 seqan3::align_cfg::free_end_gaps_sequence1_trailing{true},
+                                                 seqan3::align_cfg::free_end_gaps_sequence2_trailing{false}};
+
+    check_same_as_full_matrix(sequence1, sequence2, dna4_scheme(), semi_global);
+    check_same_as_full_matrix(sequence1, sequence2, dna4_scheme(), seqan3::align_cfg::method_local{});
+    check_same_as_full_matrix(sequence2, sequence1, dna4_scheme(), seqan3::align_cfg::method_global{});
+}
+
+// Pairs with matrices below the threshold are computed with the full trace matrix, the others in linear memory.
+TEST(affine_linear_memory_traceback, threshold)
+{
+    std::vector<seqan3::dna4> sequence1 = "ACGTTGACCAGTAGATTACAGGAT"_dna4;
+    std::vector<seqan3::dna4> sequence2 = "ACGTGACCAGTTAGATACAGAT"_dna4;
+    std::vector<std::pair<std::vector<seqan3::dna4>, std::vector<seqan3::dna4>>> sequences{{sequence1, sequence2},
+                                                                                           {sequence2, sequence1}};
+
+    auto const cfg = seqan3::align_cfg::method_global{} | seqan3::align_cfg::scoring_scheme{dna4_scheme()}
+                   | seqan3::align_cfg::output_score{} | seqan3::align_cfg::output_begin_position{}
+                   | seqan3::align_cfg::output_end_position{};
+
+    std::vector<int> expected_scores{};
+    for (auto && result : seqan3::align_pairwise(sequences, cfg))
+        expected_scores.push_back(result.score());
+
+    for (uint64_t threshold : {uint64_t{0}, uint64_t{24 * 26}, uint64_t{1000}})
+    {
+        std::vector<int> scores{};
+        for (auto && result :
+             seqan3::align_pairwise(sequences, cfg | seqan3::align_cfg::linear_memory_traceback{threshold}))
+            scores.push_back(result.score());
+
+        EXPECT_EQ(scores, expected_scores);
+    }
+}
@@ -0,0 +1,260 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/configuration/all.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/aminoacid_scoring_scheme.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/aminoacid/aa27.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+
+using seqan3::operator""_dna4;
+
+template <typename alphabet_t>
+std::vector<alphabet_t> random_sequence(std::mt19937_64 & engine, size_t const size)
+{
+    std::uniform_int_distribution<size_t> rank_distribution{0, seqan3::alphabet_size<alphabet_t> - 1};
+    std::vector<alphabet_t> sequence(size);
+    for (auto & letter : sequence)
+        seqan3::assign_rank_to(rank_distribution(engine), letter);
+    return sequence;
+}
+
+// One query against many references, which are partly mutated copies of a part of the query.
+template <typename alphabet_t>
+std::vector<std::pair<std::vector<alphabet_t>, std::vector<alphabet_t>>>
+query_against_references(std::mt19937_64 & engine, size_t const query_size, size_t const reference_count)
+{
+    std::vector<alphabet_t> query = random_sequence<alphabet_t>(engine, query_size);
+    std::uniform_int_distribution<size_t> size_distribution{1, 2 * query_size};
+    std::uniform_int_distribution<int> operation_distribution{0, 9};
+
+    std::vector<std::pair<std::vector<alphabet_t>, std::vector<alphabet_t>>> sequence_pairs{};
+    for (size_t i = 0; i < reference_count; ++i)
+    {
+        std::vector<alphabet_t> reference = random_sequence<alphabet_t>(engine, size_distribution(engine));
+        size_t const offset = i % query_size;
+        for (size_t j = 0; j < std::min(query_size, reference.size()); ++j)
+        {
+            if (operation_distribution(engine) > 1)
+                reference[j] = query[(j + offset) % query_size];
+        }
+        sequence_pairs.emplace_back(query, std::move(reference));
+    }
+    return sequence_pairs;
+}
+
+auto const output_cfg = seqan3::align_cfg::output_score{} | seqan3::align_cfg::output_end_position{}
+                      | seqan3::align_cfg::output_sequence1_id{} | seqan3::align_cfg::output_sequence2_id{};
+
+// The alignments against the query profile must give the same results in the same order as the scalar algorithm.
+// The profile configuration is only added to the vectorised run.
+template <typename sequence_pairs_t, typename config_t, typename profile_config_t = seqan3::align_cfg::query_profile>
+void check_same_as_scalar(sequence_pairs_t & sequence_pairs,
+                          config_t const & cfg,
+                          profile_config_t const & profile_cfg = seqan3::align_cfg::query_profile{})
+{
+    auto scalar_results = seqan3::align_pairwise(sequence_pairs, cfg | output_cfg);
+    auto profile_results =
+        seqan3::align_pairwise(sequence_pairs, cfg | output_cfg | seqan3::align_cfg::vectorised{} | profile_cfg);
+
+    size_t id = 0;
+    auto scalar_it = scalar_results.begin();
+    for (auto && result : profile_results)
+    {
+        ASSERT_TRUE(scalar_it != scalar_results.end());
+        auto && expected = *scalar_it;
+
+        EXPECT_EQ(result.sequence1_id(), id);
+        EXPECT_EQ(result.sequence2_id(), id);
+        EXPECT_EQ(result.score(), expected.score()) << "id " << id;
+        EXPECT_EQ(result.sequence1_end_position(), expected.sequence1_end_position()) << "id " << id;
+        EXPECT_EQ(result.sequence2_end_position(), expected.sequence2_end_position()) << "id " << id;
+        ++scalar_it;
+        ++id;
+    }
+    EXPECT_EQ(id, sequence_pairs.size());
+}
+
+auto dna4_scheme()
+{
+    return seqan3::align_cfg::scoring_scheme{
+        seqan3::nucleotide_scoring_scheme{seqan3::match_score{4}, seqan3::mismatch_score{-5}}};
+}
+
+auto aa27_scheme()
+{
+    return seqan3::align_cfg::scoring_scheme{
+        seqan3::aminoacid_scoring_scheme{seqan3::aminoacid_similarity_matrix::blosum62}};
+}
+
+// The scalar local alignment has different default gap costs, hence they are always given explicitly.
+auto gap_costs()
+{
+    return seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-10},
+                                              seqan3::align_cfg::extension_score{-1}};
+}
+
+TEST(affine_unbanded_query_profile, global_free_end_gaps)
+{
+    std::mt19937_64 engine{7};
+    auto sequence_pairs = query_against_references<seqan3::dna4>(engine, 67, 40);
+
+    for (unsigned free_ends = 0; free_ends < 16; ++free_ends)
+    {
+        seqan3::align_cfg::method_global method{
+            seqan3::align_cfg::free_end_gaps_sequence1_leading{static_cast<bool>(free_ends & 1)},
+            seqan3::align_cfg::free_end_gaps_sequence2_leading{static_cast<bool>(free_ends & 2)},
+            seqan3::align_cfg::free_end_gaps_sequence1_trailing{static_cast<bool>(free_ends & 4)},
+            seqan3::align_cfg::free_end_gaps_sequence2_trailing{static_cast<bool>(free_ends & 8)}};
+
+        SCOPED_TRACE(testing::Message() << "free ends " << free_ends);
+        check_same_as_scalar(sequence_pairs, method | dna4_scheme() | gap_costs());
+    }
+}
+
+TEST(affine_unbanded_query_profile, local)
+{
+    std::mt19937_64 engine{11};
+    auto sequence_pairs = query_against_references<seqan3::dna4>(engine, 150, 100);
+
+    check_same_as_scalar(sequence_pairs, seqan3::align_cfg::method_local{} | dna4_scheme() | gap_costs());
+}
+
+TEST(affine_unbanded_query_profile, aminoacid)
+{
+    std::mt19937_64 engine{19};
+
+    for (size_t query_size : {1u, 15u, 64u, 333u})
+    {
+        auto sequence_pairs = query_against_references<seqan3::aa27>(engine, query_size, 50);
+
+        SCOPED_TRACE(testing::Message() << "query size " << query_size);
+        check_same_as_scalar(sequence_pairs, seqan3::align_cfg::method_global{} | aa27_scheme() | gap_costs());
+        check_same_as_scalar(sequence_pairs, seqan3::align_cfg::method_local{} | aa27_scheme() | gap_costs());
+    }
+}
+
+TEST(affine_unbanded_query_profile, custom_gap_costs)
+{
+    std::mt19937_64 engine{13};
+    auto sequence_pairs = query_against_references<seqan3::dna4>(engine, 97, 30);
+    auto const gap = seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-2},
+                                                        seqan3::align_cfg::extension_score{-1}};
+
+    check_same_as_scalar(sequence_pairs, seqan3::align_cfg::method_global{} | dna4_scheme() | gap);
+    check_same_as_scalar(sequence_pairs, seqan3::align_cfg::method_local{} | dna4_scheme() | gap);
+}
+
+// The profile is computed anew whenever the first sequence changes.
+TEST(affine_unbanded_query_profile, changing_query)
+{
+    std::mt19937_64 engine{23};
+    auto query_pairs = query_against_references<seqan3::aa27>(engine, 40, 20);
+    auto other_pairs = query_against_references<seqan3::aa27>(engine, 90, 20);
+
+    // Alternate between runs of both queries of different lengths.
+    decltype(query_pairs) sequence_pairs{};
+    for (size_t i = 0; i < query_pairs.size(); ++i)
+        sequence_pairs.push_back((i % 7 < 4) ? query_pairs[i] : other_pairs[i]);
+    sequence_pairs.insert(sequence_pairs.end(), other_pairs.begin(), other_pairs.end());
+
+    check_same_as_scalar(sequence_pairs, seqan3::align_cfg::method_global{} | aa27_scheme() | gap_costs());
+    check_same_as_scalar(sequence_pairs, seqan3::align_cfg::method_local{} | aa27_scheme() | gap_costs());
+}
+
+// Ties are resolved like in the scalar algorithm.
+TEST(affine_unbanded_query_profile, repeats)
+{
+    std::vector<seqan3::dna4> repeat = "ACGTACGTACGTACGTACGTACGTACGTACGTACGTACGTACGTACGT"_dna4;
+    std::vector<std::pair<std::vector<seqan3::dna4>, std::vector<seqan3::dna4>>> sequence_pairs{
+        {repeat, "ACGTACGTACGTACGTACGT"_dna4},
+        {repeat, repeat},
+        {repeat, "TACGTACGTAC"_dna4},
+        {"ACGTACGTACGTACGTACGT"_dna4, repeat}};
+    seqan3::align_cfg::method_global semi_global{seqan3::align_cfg::free_end_gaps_sequence1_leading{true},
+                                                 seqan3::align_cfg::free_end_gaps_sequence2_leading{false},
+                                                 seqan3::align_cfg::free_end_gaps_sequence1_trailing{true},
+                                                 seqan3::align_cfg::free_end_gaps_sequence2_trailing{false}};
+
+    check_same_as_scalar(sequence_pairs, semi_global | dna4_scheme() | gap_costs());
+    check_same_as_scalar(sequence_pairs, seqan3::align_cfg::method_local{} | dna4_scheme() | gap_costs());
+}
+
+// Only mismatches: the local optimum is the empty alignment at the origin.
+TEST(affine_unbanded_query_profile, no_positive_cell)
+{
+    std::vector<std::pair<std::vector<seqan3::dna4>, std::vector<seqan3::dna4>>> sequence_pairs{
+        {"AAAAAAAAAAAAAAAAAAAAAAAA"_dna4, "CCCCCCCCCCCCCCCCCCC"_dna4},
+        {"AAAAAAAAAAAAAAAAAAAAAAAA"_dna4, "GGG"_dna4}};
+
+    check_same_as_scalar(sequence_pairs, seqan3::align_cfg::method_local{} | dna4_scheme() | gap_costs());
+    check_same_as_scalar(sequence_pairs, seqan3::align_cfg::method_global{} | dna4_scheme() | gap_costs());
+}
+
+// Chunks with an empty sequence are computed with the inter-sequence algorithm.
+TEST(affine_unbanded_query_profile, empty_sequence)
+{
+    std::mt19937_64 engine{29};
+    auto sequence_pairs = query_against_references<seqan3::dna4>(engine, 30, 10);
+    sequence_pairs[4].second.clear();
+
+    check_same_as_scalar(sequence_pairs, seqan3::align_cfg::method_global{} | dna4_scheme() | gap_costs());
+    check_same_as_scalar(sequence_pairs, seqan3::align_cfg::method_local{} | dna4_scheme() | gap_costs());
+}
+
+TEST(affine_unbanded_query_profile, score_type)
+{
+    std::mt19937_64 engine{31};
+    auto sequence_pairs = query_against_references<seqan3::aa27>(engine, 100, 30);
+
+    check_same_as_scalar(sequence_pairs,
+                         seqan3::align_cfg::method_global{} | aa27_scheme() | gap_costs()
+                             | seqan3::align_cfg::score_type<int16_t>{});
+}
+
+TEST(affine_unbanded_query_profile, adaptive_score_width)
+{
+    std::mt19937_64 engine{41};
+    auto sequence_pairs = query_against_references<seqan3::dna4>(engine, 100, 30);
+
+    check_same_as_scalar(sequence_pairs,
+                         seqan3::align_cfg::method_global{} | dna4_scheme() | gap_costs(),
+                         seqan3::align_cfg::query_profile{} | seqan3::align_cfg::adaptive_score_width{});
+}
+
+TEST(affine_unbanded_query_profile, parallel)
+{
+    std::mt19937_64 engine{37};
+    auto sequence_pairs = query_against_references<seqan3::aa27>(engine, 120, 300);
+
+    check_same_as_scalar(sequence_pairs,
+                         seqan3::align_cfg::method_local{} | aa27_scheme() | gap_costs()
+                             | seqan3::align_cfg::parallel{4});
+}
+
+TEST(affine_unbanded_query_profile, invalid_configuration)
+{
+    std::mt19937_64 engine{41};
+    auto sequence_pairs = query_against_references<seqan3::dna4>(engine, 10, 3);
+    auto const cfg = seqan3::align_cfg::method_global{} | dna4_scheme() | gap_costs() | output_cfg
+                   | seqan3::align_cfg::query_profile{};
+
+    EXPECT_THROW(seqan3::align_pairwise(sequence_pairs, cfg), seqan3::invalid_alignment_configuration);
+    EXPECT_THROW(seqan3::align_pairwise(sequence_pairs,
+                                        cfg | seqan3::align_cfg::vectorised{}
+                                            | seqan3::align_cfg::output_begin_position{}),
+                 seqan3::invalid_alignment_configuration);
+    // The default output contains the alignment.
+    EXPECT_THROW(seqan3::align_pairwise(sequence_pairs,
+                                        seqan3::align_cfg::method_global{} | dna4_scheme() | gap_costs()
+                                            | seqan3::align_cfg::vectorised{} | seqan3::align_cfg::query_profile{}),
+                 seqan3::invalid_alignment_configuration);
+}
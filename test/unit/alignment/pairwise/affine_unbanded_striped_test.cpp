@@ -0,0 +1,185 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_method.hpp>
+#include <seqan3/alignment/configuration/align_config_output.hpp>
+#include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
+#include <seqan3/alignment/configuration/align_config_vectorised.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/aminoacid_scoring_scheme.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/aminoacid/aa27.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+
+using seqan3::operator""_dna4;
+
+template <typename alphabet_t>
+std::vector<alphabet_t> random_sequence(std::mt19937_64 & engine, size_t const size)
+{
+    std::uniform_int_distribution<size_t> rank_distribution{0, seqan3::alphabet_size<alphabet_t> - 1};
+    std::vector<alphabet_t> sequence(size);
+    for (auto & letter : sequence)
+        seqan3::assign_rank_to(rank_distribution(engine), letter);
+    return sequence;
+}
+
+// The second sequence is a mutated copy of a part of the first sequence so that the alignments are non-trivial.
+template <typename alphabet_t>
+std::pair<std::vector<alphabet_t>, std::vector<alphabet_t>> random_sequence_pair(std::mt19937_64 & engine,
+                                                                                 size_t const size1,
+                                                                                 size_t const size2)
+{
+    std::vector<alphabet_t> sequence1 = random_sequence<alphabet_t>(engine, size1);
+    std::vector<alphabet_t> sequence2 = random_sequence<alphabet_t>(engine, size2);
+    std::uniform_int_distribution<int> operation_distribution{0, 9};
+
+    for (size_t i = 0; i < std::min(size1, size2); ++i)
+    {
+        if (operation_distribution(engine) > 1)
+            sequence2[i] = sequence1[(i + size1 / 4) % size1];
+    }
+
+    return {std::move(sequence1), std::move(sequence2)};
+}
+
+// The single pair is computed by the striped kernel and must give the same result as the scalar algorithm.
+template <typename sequence_t, typename config_t>
+void check_same_as_scalar(sequence_t & sequence1, sequence_t & sequence2, config_t const & cfg)
+{
+    auto const output = seqan3::align_cfg::output_score{} | seqan3::align_cfg::output_end_position{}
+                      | seqan3::align_cfg::output_sequence1_id{} | seqan3::align_cfg::output_sequence2_id{};
+
+    auto scalar_results = seqan3::align_pairwise(std::tie(sequence1, sequence2), cfg | output);
+    auto simd_results =
+        seqan3::align_pairwise(std::tie(sequence1, sequence2), cfg | output | seqan3::align_cfg::vectorised{});
+
+    auto scalar_result = *scalar_results.begin();
+    auto simd_result = *simd_results.begin();
+
+    EXPECT_EQ(simd_result.sequence1_id(), 0u);
+    EXPECT_EQ(simd_result.sequence2_id(), 0u);
+    EXPECT_EQ(simd_result.score(), scalar_result.score());
+    EXPECT_EQ(simd_result.sequence1_end_position(), scalar_result.sequence1_end_position());
+    EXPECT_EQ(simd_result.sequence2_end_position(), scalar_result.sequence2_end_position());
+}
+
+auto dna4_scheme()
+{
+    return seqan3::align_cfg::scoring_scheme{
+        seqan3::nucleotide_scoring_scheme{seqan3::match_score{4}, seqan3::mismatch_score{-5}}};
+}
+
+// The scalar local alignment has different default gap costs, hence they are always given explicitly.
+auto gap_costs()
+{
+    return seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-10},
+                                              seqan3::align_cfg::extension_score{-1}};
+}
+
+TEST(affine_unbanded_striped, global_free_end_gaps)
+{
+    std::mt19937_64 engine{7};
+    std::uniform_int_distribution<size_t> size_distribution{1, 150};
+
+    for (size_t round = 0; round < 20; ++round)
+    {
+        auto [sequence1, sequence2] =
+            random_sequence_pair<seqan3::dna4>(engine, size_distribution(engine), size_distribution(engine));
+
+        for (unsigned free_ends = 0; free_ends < 16; ++free_ends)
+        {
+            seqan3::align_cfg::method_global method{
+                seqan3::align_cfg::free_end_gaps_sequence1_leading{static_cast<bool>(free_ends & 1)},
+                seqan3::align_cfg::free_end_gaps_sequence2_leading{static_cast<bool>(free_ends & 2)},
+                seqan3::align_cfg::free_end_gaps_sequence1_trailing{static_cast<bool>(free_ends & 4)},
+                seqan3::align_cfg::free_end_gaps_sequence2_trailing{static_cast<bool>(free_ends & 8)}};
+
+            SCOPED_TRACE(testing::Message() << "round " << round << ", free ends " << free_ends);
+            check_same_as_scalar(sequence1, sequence2, method | dna4_scheme() | gap_costs());
+        }
+    }
+}
+
+TEST(affine_unbanded_striped, local)
+{
+    std::mt19937_64 engine{11};
+    std::uniform_int_distribution<size_t> size_distribution{1, 300};
+
+    for (size_t round = 0; round < 50; ++round)
+    {
+        auto [sequence1, sequence2] =
+            random_sequence_pair<seqan3::dna4>(engine, size_distribution(engine), size_distribution(engine));
+
+        SCOPED_TRACE(testing::Message() << "round " << round);
+        check_same_as_scalar(sequence1, sequence2, seqan3::align_cfg::method_local{} | dna4_scheme() | gap_costs());
+    }
+}
+
+TEST(affine_unbanded_striped, custom_gap_costs)
+{
+    std::mt19937_64 engine{13};
+    auto [sequence1, sequence2] = random_sequence_pair<seqan3::dna4>(engine, 120, 97);
+    auto const gap = seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-2},
+                                                        seqan3::align_cfg::extension_score{-1}};
+
+    check_same_as_scalar(sequence1, sequence2, seqan3::align_cfg::method_global{} | dna4_scheme() | gap);
+    check_same_as_scalar(sequence1, sequence2, seqan3::align_cfg::method_local{} | dna4_scheme() | gap);
+}
+
+TEST(affine_unbanded_striped, long_sequences)
+{
+    std::mt19937_64 engine{17};
+    auto [sequence1, sequence2] = random_sequence_pair<seqan3::dna4>(engine, 3000, 2500);
+
+    check_same_as_scalar(sequence1, sequence2, seqan3::align_cfg::method_global{} | dna4_scheme() | gap_costs());
+    check_same_as_scalar(sequence1, sequence2, seqan3::align_cfg::method_local{} | dna4_scheme() | gap_costs());
+}
+
+TEST(affine_unbanded_striped, aminoacid)
+{
+    std::mt19937_64 engine{19};
+    auto const scheme = seqan3::align_cfg::scoring_scheme{
+        seqan3::aminoacid_scoring_scheme{seqan3::aminoacid_similarity_matrix::blosum62}};
+
+    for (size_t round = 0; round < 10; ++round)
+    {
+        auto [sequence1, sequence2] = random_sequence_pair<seqan3::aa27>(engine, 50 + 20 * round, 180 - 10 * round);
+
+        SCOPED_TRACE(testing::Message() << "round " << round);
+        check_same_as_scalar(sequence1, sequence2, seqan3::align_cfg::method_global{} | scheme | gap_costs());
+        check_same_as_scalar(sequence1, sequence2, seqan3::align_cfg::method_local{} | scheme | gap_costs());
+    }
+}
+
+// Ties are resolved like in the scalar algorithm.
+TEST(affine_unbanded_striped, repeats)
+{
+    std::vector<seqan3::dna4> sequence1 = "ACGTACGTACGTACGTACGTACGTACGTACGTACGTACGTACGTACGT"_dna4;
+    std::vector<seqan3::dna4> sequence2 = "ACGTACGTACGTACGTACGT"_dna4;
+    seqan3::align_cfg::method_global semi_global{seqan3::align_cfg::free_end_gaps_sequence1_leading{true},
+                                                 seqan3::align_cfg::free_end_gaps_sequence2_leading{false},
+                                                 seqan3::align_cfg::free_end_gaps_sequence1_trailing{true},
+                                                 seqan3::align_cfg::free_end_gaps_sequence2_trailing{false}};
+
+    check_same_as_scalar(sequence1, sequence2, semi_global | dna4_scheme() | gap_costs());
+    check_same_as_scalar(sequence1, sequence2, seqan3::align_cfg::method_local{} | dna4_scheme() | gap_costs());
+    check_same_as_scalar(sequence2, sequence1, seqan3::align_cfg::method_local{} | dna4_scheme() | gap_costs());
+}
+
+// Only mismatches: the local optimum is the empty alignment at the origin.
+TEST(affine_unbanded_striped, no_positive_cell)
+{
+    std::vector<seqan3::dna4> sequence1 = "AAAAAAAAAAAAAAAAAAAAAAAA"_dna4;
+    std::vector<seqan3::dna4> sequence2 = "CCCCCCCCCCCCCCCCCCC"_dna4;
+
+    check_same_as_scalar(sequence1, sequence2, seqan3::align_cfg::method_local{} | dna4_scheme() | gap_costs());
+    check_same_as_scalar(sequence1, sequence2, seqan3::align_cfg::method_global{} | dna4_scheme() | gap_costs());
+}
@@ -0,0 +1,315 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_drop_off.hpp>
+#include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_method.hpp>
+#include <seqan3/alignment/configuration/align_config_output.hpp>
+#include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
+#include <seqan3/alignment/configuration/align_config_vectorised.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/aminoacid_scoring_scheme.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/aminoacid/aa27.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+
+using seqan3::operator""_dna4;
+
+template <typename alphabet_t>
+std::vector<alphabet_t> random_sequence(std::mt19937_64 & engine, size_t const size)
+{
+    std::uniform_int_distribution<size_t> rank_distribution{0, seqan3::alphabet_size<alphabet_t> - 1};
+    std::vector<alphabet_t> sequence(size);
+    for (auto & letter : sequence)
+        seqan3::assign_rank_to(rank_distribution(engine), letter);
+    return sequence;
+}
+
+// The second sequence is a mutated copy of the first one that becomes random after a while.
+template <typename alphabet_t>
+std::pair<std::vector<alphabet_t>, std::vector<alphabet_t>>
+random_extension_pair(std::mt19937_64 & engine, size_t const size1, size_t const size2)
+{
+    std::vector<alphabet_t> sequence1 = random_sequence<alphabet_t>(engine, size1);
+    std::vector<alphabet_t> sequence2 = random_sequence<alphabet_t>(engine, size2);
+    std::uniform_int_distribution<int> operation_distribution{0, 19};
+    size_t const similar_size = std::min(size1, size2) / 2;
+
+    for (size_t i = 0, j = 0; i < similar_size && j < size1; ++i, ++j)
+    {
+        int const operation = operation_distribution(engine);
+        if (operation == 0) // deletion
+            j += 2;
+        else if (operation == 1) // insertion
+            --j;
+
+        if (operation != 2 && j < size1)
+            sequence2[i] = sequence1[j];
+    }
+
+    return {std::move(sequence1), std::move(sequence2)};
+}
+
+struct extension_result
+{
+    int score{};
+    size_t end1{};
+    size_t end2{};
+
+    bool operator==(extension_result const &) const = default;
+};
+
+std::ostream & operator<<(std::ostream & stream, extension_result const & result)
+{
+    return stream << "{score: " << result.score << ", end: (" << result.end1 << ',' << result.end2 << ")}";
+}
+
+// Full matrix reference: the best cell of the global matrix anchored in the origin, the first one in antidiagonal
+// order if several cells share the best score.
+template <typename sequence_t, typename scheme_t>
+extension_result
+full_matrix_extension(sequence_t const & sequence1, sequence_t const & sequence2, scheme_t const & scheme)
+{
+    int const open = -10 - 1;
+    int const extension = -1;
+    int const minus_infinity = std::numeric_limits<int>::lowest() / 4;
+    size_t const size1 = sequence1.size();
+    size_t const size2 = sequence2.size();
+
+    std::vector<std::vector<int>> h(size2 + 1, std::vector<int>(size1 + 1, minus_infinity));
+    std::vector<std::vector<int>> e = h;
+    std::vector<std::vector<int>> f = h;
+    h[0][0] = 0;
+
+    for (size_t i = 0; i <= size2; ++i)
+    {
+        for (size_t j = 0; j <= size1; ++j)
+        {
+            if (i == 0 && j == 0)
+                continue;
+            if (j > 0)
+                e[i][j] = std::max(h[i][j - 1] + open, e[i][j - 1] + extension);
+            if (i > 0)
+                f[i][j] = std::max(h[i - 1][j] + open, f[i - 1][j] + extension);
+            h[i][j] = std::max(e[i][j], f[i][j]);
+            if (i > 0 && j > 0)
+                h[i][j] = std::max(h[i][j], h[i - 1][j - 1] + scheme.score(sequence1[j - 1], sequence2[i - 1]));
+        }
+    }
+
+    extension_result best{};
+    for (size_t antidiagonal = 0; antidiagonal <= size1 + size2; ++antidiagonal)
+    {
+        for (size_t i = antidiagonal - std::min(antidiagonal, size1); i <= std::min(antidiagonal, size2); ++i)
+        {
+            if (h[i][antidiagonal - i] > best.score)
+                best = extension_result{h[i][antidiagonal - i], antidiagonal - i, i};
+        }
+    }
+
+    return best;
+}
+
+template <typename sequence_t, typename config_t>
+extension_result extend(sequence_t & sequence1, sequence_t & sequence2, config_t const & cfg)
+{
+    auto const output = seqan3::align_cfg::output_score{} | seqan3::align_cfg::output_end_position{}
+                      | seqan3::align_cfg::output_begin_position{};
+
+    auto results = seqan3::align_pairwise(std::tie(sequence1, sequence2), cfg | output);
+    auto result = *results.begin();
+
+    EXPECT_EQ(result.sequence1_begin_position(), 0u);
+    EXPECT_EQ(result.sequence2_begin_position(), 0u);
+    return {result.score(), result.sequence1_end_position(), result.sequence2_end_position()};
+}
+
+auto dna4_scheme()
+{
+    return seqan3::nucleotide_scoring_scheme{seqan3::match_score{2}, seqan3::mismatch_score{-3}};
+}
+
+auto base_config()
+{
+    return seqan3::align_cfg::method_global{} | seqan3::align_cfg::scoring_scheme{dna4_scheme()}
+         | seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-10},
+                                              seqan3::align_cfg::extension_score{-1}};
+}
+
+// Without pruning, the extension ends in the best cell of the full matrix.
+TEST(affine_x_drop, no_pruning_equals_full_matrix)
+{
+    std::mt19937_64 engine{53};
+    std::uniform_int_distribution<size_t> size_distribution{0, 80};
+
+    for (size_t round = 0; round < 40; ++round)
+    {
+        auto [sequence1, sequence2] =
+            random_extension_pair<seqan3::dna4>(engine, size_distribution(engine), size_distribution(engine));
+        extension_result const expected = full_matrix_extension(sequence1, sequence2, dna4_scheme());
+
+        SCOPED_TRACE(testing::Message() << "round " << round);
+        auto const x_drop = seqan3::align_cfg::x_drop{1'000'000};
+        EXPECT_EQ(extend(sequence1, sequence2, base_config() | x_drop), expected);
+        EXPECT_EQ(extend(sequence1, sequence2, base_config() | x_drop | seqan3::align_cfg::vectorised{}), expected);
+        EXPECT_EQ(extend(sequence1, sequence2, base_config() | seqan3::align_cfg::z_drop{1'000'000}), expected);
+    }
+}
+
+// Pruning can only lose cells.
+TEST(affine_x_drop, pruning_never_exceeds_full_matrix)
+{
+    std::mt19937_64 engine{59};
+    std::uniform_int_distribution<size_t> size_distribution{1, 200};
+
+    for (size_t round = 0; round < 40; ++round)
+    {
+        auto [sequence1, sequence2] =
+            random_extension_pair<seqan3::dna4>(engine, size_distribution(engine), size_distribution(engine));
+        extension_result const full = full_matrix_extension(sequence1, sequence2, dna4_scheme());
+
+        for (int32_t drop : {0, 5, 20, 50})
+        {
+            SCOPED_TRACE(testing::Message() << "round " << round << ", drop " << drop);
+            EXPECT_LE(extend(sequence1, sequence2, base_config() | seqan3::align_cfg::x_drop{drop}).score, full.score);
+        }
+    }
+}
+
+// The vectorised kernel computes the same antidiagonals as the scalar one.
+TEST(affine_x_drop, vectorised_equals_scalar)
+{
+    std::mt19937_64 engine{61};
+    std::uniform_int_distribution<size_t> size_distribution{0, 300};
+
+    for (size_t round = 0; round < 30; ++round)
+    {
+        auto [sequence1, sequence2] =
+            random_extension_pair<seqan3::dna4>(engine, size_distribution(engine), size_distribution(engine));
+
+        for (int32_t drop : {0, 3, 10, 25, 60})
+        {
+            SCOPED_TRACE(testing::Message() << "round " << round << ", drop " << drop);
+            auto const x_drop = base_config() | seqan3::align_cfg::x_drop{drop};
+            EXPECT_EQ(extend(sequence1, sequence2, x_drop | seqan3::align_cfg::vectorised{}),
+                      extend(sequence1, sequence2, x_drop));
+
+            auto const z_drop = base_config() | seqan3::align_cfg::z_drop{drop};
+            EXPECT_EQ(extend(sequence1, sequence2, z_drop | seqan3::align_cfg::vectorised{}),
+                      extend(sequence1, sequence2, z_drop));
+        }
+    }
+}
+
+TEST(affine_x_drop, aminoacid)
+{
+    std::mt19937_64 engine{67};
+    auto const scheme = seqan3::aminoacid_scoring_scheme{seqan3::aminoacid_similarity_matrix::blosum62};
+    auto const cfg = seqan3::align_cfg::method_global{} | seqan3::align_cfg::scoring_scheme{scheme}
+                   | seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-10},
+                                                        seqan3::align_cfg::extension_score{-1}};
+
+    for (size_t round = 0; round < 10; ++round)
+    {
+        auto [sequence1, sequence2] = random_extension_pair<seqan3::aa27>(engine, 60 + 10 * round, 150 - 5 * round);
+        extension_result const expected = full_matrix_extension(sequence1, sequence2, scheme);
+
+        SCOPED_TRACE(testing::Message() << "round " << round);
+        EXPECT_EQ(extend(sequence1, sequence2, cfg | seqan3::align_cfg::x_drop{1'000'000}), expected);
+
+        auto const x_drop = cfg | seqan3::align_cfg::x_drop{15};
+        EXPECT_EQ(extend(sequence1, sequence2, x_drop | seqan3::align_cfg::vectorised{}),
+                  extend(sequence1, sequence2, x_drop));
+    }
+}
+
+// The extension stops in the random region and reports the end of the identical prefix.
+TEST(affine_x_drop, stops_after_similar_region)
+{
+    std::mt19937_64 engine{71};
+    std::vector<seqan3::dna4> prefix = random_sequence<seqan3::dna4>(engine, 50);
+    std::vector<seqan3::dna4> sequence1 = prefix;
+    std::vector<seqan3::dna4> sequence2 = prefix;
+    sequence1.resize(2000, 'A'_dna4);
+    sequence2.resize(2000, 'C'_dna4);
+
+    auto const x_drop = base_config() | seqan3::align_cfg::x_drop{20};
+    EXPECT_EQ(extend(sequence1, sequence2, x_drop), (extension_result{100, 50, 50}));
+    EXPECT_EQ(extend(sequence1, sequence2, x_drop | seqan3::align_cfg::vectorised{}), (extension_result{100, 50, 50}));
+    EXPECT_EQ(extend(sequence1, sequence2, base_config() | seqan3::align_cfg::z_drop{20}),
+              (extension_result{100, 50, 50}));
+}
+
+// A long gap stops the X-drop extension, but not the Z-drop extension. The first sequence contains no T, hence the
+// gap is the best path through the inserted T's.
+TEST(affine_x_drop, z_drop_bridges_long_gap)
+{
+    std::vector<seqan3::dna4> sequence1 = "ACGAGGCAAGCCCAGCCGAGAACGAACGGAACCAGGCACGGCAAGCAGGCACCGCAGC"_dna4;
+    std::vector<seqan3::dna4> sequence2 = sequence1;
+    std::vector<seqan3::dna4> const insertion(30, 'T'_dna4);
+    sequence2.insert(sequence2.begin() + 20, insertion.begin(), insertion.end());
+    size_t const size1 = sequence1.size();
+    size_t const size2 = sequence2.size();
+    int const full_score = 2 * static_cast<int>(size1) - 10 - 30;
+
+    EXPECT_EQ(extend(sequence1, sequence2, base_config() | seqan3::align_cfg::x_drop{30}),
+              (extension_result{40, 20, 20}));
+    EXPECT_EQ(extend(sequence1, sequence2, base_config() | seqan3::align_cfg::z_drop{30}),
+              (extension_result{full_score, size1, size2}));
+    EXPECT_EQ(
+        extend(sequence1, sequence2, base_config() | seqan3::align_cfg::z_drop{30} | seqan3::align_cfg::vectorised{}),
+        (extension_result{full_score, size1, size2}));
+}
+
+TEST(affine_x_drop, empty_sequences)
+{
+    std::vector<seqan3::dna4> empty{};
+    std::vector<seqan3::dna4> sequence = "ACGT"_dna4;
+
+    EXPECT_EQ(extend(empty, empty, base_config() | seqan3::align_cfg::x_drop{10}), (extension_result{0, 0, 0}));
+    EXPECT_EQ(extend(empty, sequence, base_config() | seqan3::align_cfg::x_drop{10}), (extension_result{0, 0, 0}));
+    EXPECT_EQ(extend(sequence, empty, base_config() | seqan3::align_cfg::x_drop{10}), (extension_result{0, 0, 0}));
+}
+
+TEST(affine_x_drop, collection)
+{
+    std::mt19937_64 engine{73};
+    std::vector<std::pair<std::vector<seqan3::dna4>, std::vector<seqan3::dna4>>> sequences{};
+    for (size_t i = 0; i < 20; ++i)
+        sequences.push_back(random_extension_pair<seqan3::dna4>(engine, 50 + 7 * i, 120 - 3 * i));
+
+    auto const cfg = base_config() | seqan3::align_cfg::x_drop{15} | seqan3::align_cfg::output_score{}
+                   | seqan3::align_cfg::output_end_position{} | seqan3::align_cfg::output_sequence1_id{};
+
+    size_t count = 0;
+    for (auto && result : seqan3::align_pairwise(sequences, cfg | seqan3::align_cfg::vectorised{}))
+    {
+        auto & [sequence1, sequence2] = sequences[result.sequence1_id()];
+        EXPECT_EQ((extension_result{result.score(), result.sequence1_end_position(), result.sequence2_end_position()}),
+                  extend(sequence1, sequence2, base_config() | seqan3::align_cfg::x_drop{15}));
+        ++count;
+    }
+    EXPECT_EQ(count, sequences.size());
+}
+
+TEST(affine_x_drop, invalid_configuration)
+{
+    std::vector<seqan3::dna4> sequence = "ACGT"_dna4;
+
+    auto with_alignment = base_config() | seqan3::align_cfg::x_drop{10} | seqan3::align_cfg::output_alignment{};
+    EXPECT_THROW(seqan3::align_pairwise(std::tie(sequence, sequence), with_alignment),
+                 seqan3::invalid_alignment_configuration);
+
+    auto negative_drop = base_config() | seqan3::align_cfg::z_drop{-1} | seqan3::align_cfg::output_score{};
+    EXPECT_THROW(seqan3::align_pairwise(std::tie(sequence, sequence), negative_drop),
+                 seqan3::invalid_alignment_configuration);
+}
@@ -0,0 +1,180 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include <seqan3/alignment/cigar_conversion/cigar_from_alignment.hpp>
+#include <seqan3/alignment/configuration/align_config_band.hpp>
+#include <seqan3/alignment/configuration/align_config_edit.hpp>
+#include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_linear_memory_traceback.hpp>
+#include <seqan3/alignment/configuration/align_config_method.hpp>
+#include <seqan3/alignment/configuration/align_config_min_score.hpp>
+#include <seqan3/alignment/configuration/align_config_output.hpp>
+#include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
+#include <seqan3/alignment/configuration/align_config_wavefront.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/test/expect_range_eq.hpp>
+
+using seqan3::operator""_cigar_operation;
+using seqan3::operator""_dna4;
+
+// The second sequence is a copy of the first sequence with some substitutions, insertions and deletions.
+std::pair<seqan3::dna4_vector, seqan3::dna4_vector> random_sequence_pair(std::mt19937_64 & engine, size_t const size)
+{
+    std::uniform_int_distribution<size_t> rank_distribution{0, 3};
+    std::uniform_int_distribution<int> operation_distribution{0, 19};
+
+    seqan3::dna4_vector sequence1(size);
+    for (auto & letter : sequence1)
+        seqan3::assign_rank_to(rank_distribution(engine), letter);
+
+    seqan3::dna4_vector sequence2{};
+    for (size_t i = 0; i < size; ++i)
+    {
+        int const operation = operation_distribution(engine);
+        if (operation == 0) // deletion
+            continue;
+        else if (operation == 1) // insertion
+            sequence2.push_back(sequence1[(i * 7) % size]);
+        else if (operation == 2) // substitution
+            sequence2.push_back(seqan3::assign_rank_to(rank_distribution(engine), seqan3::dna4{}));
+
+        sequence2.push_back(sequence1[i]);
+    }
+
+    return {std::move(sequence1), std::move(sequence2)};
+}
+
+// The CIGAR sequence must be the one of the alignment computed with the same configuration. Requesting only the
+// CIGAR sequence must neither change the score nor the begin and end positions of the alignment.
+template <typename config_t>
+void check_same_as_cigar_from_alignment(config_t const & cfg)
+{
+    auto const alignment_output = seqan3::align_cfg::output_score{} | seqan3::align_cfg::output_end_position{}
+                                | seqan3::align_cfg::output_begin_position{} | seqan3::align_cfg::output_alignment{};
+    auto const cigar_output = seqan3::align_cfg::output_score{} | seqan3::align_cfg::output_end_position{}
+                            | seqan3::align_cfg::output_begin_position{} | seqan3::align_cfg::output_cigar{};
+
+    std::mt19937_64 engine{42};
+    for (size_t size : {1u, 5u, 30u, 150u})
+    {
+        auto [sequence1, sequence2] = random_sequence_pair(engine, size);
+        auto sequences = std::tie(sequence1, sequence2);
+
+        auto alignment_result = *seqan3::align_pairwise(sequences, cfg | alignment_output).begin();
+        auto cigar_result = *seqan3::align_pairwise(sequences, cfg | cigar_output).begin();
+        auto both_result =
+            *seqan3::align_pairwise(sequences, cfg | alignment_output | seqan3::align_cfg::output_cigar{}).begin();
+        auto only_cigar_result = *seqan3::align_pairwise(sequences, cfg | seqan3::align_cfg::output_cigar{}).begin();
+
+        auto expected = seqan3::cigar_from_alignment(alignment_result.alignment());
+
+        EXPECT_EQ(cigar_result.score(), alignment_result.score());
+        EXPECT_EQ(cigar_result.sequence1_end_position(), alignment_result.sequence1_end_position());
+        EXPECT_EQ(cigar_result.sequence2_end_position(), alignment_result.sequence2_end_position());
+        EXPECT_EQ(cigar_result.sequence1_begin_position(), alignment_result.sequence1_begin_position());
+        EXPECT_EQ(cigar_result.sequence2_begin_position(), alignment_result.sequence2_begin_position());
+        EXPECT_RANGE_EQ(cigar_result.cigar_sequence(), expected);
+
+        EXPECT_RANGE_EQ(seqan3::cigar_from_alignment(both_result.alignment()), expected);
+        EXPECT_RANGE_EQ(both_result.cigar_sequence(), expected);
+
+        EXPECT_RANGE_EQ(only_cigar_result.cigar_sequence(), expected);
+    }
+}
+
+static auto const affine_scoring =
+    seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{seqan3::match_score{4},
+                                                                         seqan3::mismatch_score{-5}}}
+    | seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-10}, seqan3::align_cfg::extension_score{-1}};
+
+TEST(align_pairwise_output_cigar, global_affine)
+{
+    check_same_as_cigar_from_alignment(seqan3::align_cfg::method_global{} | affine_scoring);
+}
+
+TEST(align_pairwise_output_cigar, global_affine_banded)
+{
+    check_same_as_cigar_from_alignment(
+        seqan3::align_cfg::method_global{} | affine_scoring
+        | seqan3::align_cfg::band_fixed_size{seqan3::align_cfg::lower_diagonal{-40},
+                                             seqan3::align_cfg::upper_diagonal{40}});
+}
+
+TEST(align_pairwise_output_cigar, semi_global_affine)
+{
+    check_same_as_cigar_from_alignment(
+        seqan3::align_cfg::method_global{seqan3::align_cfg::free_end_gaps_sequence1_leading{true},
+                                         seqan3::align_cfg::free_end_gaps_sequence2_leading{false},
+                                         seqan3::align_cfg::free_end_gaps_sequence1_trailing{true},
+                                         seqan3::align_cfg::free_end_gaps_sequence2_trailing{false}}
+        | affine_scoring);
+}
+
+TEST(align_pairwise_output_cigar, local_affine)
+{
+    check_same_as_cigar_from_alignment(seqan3::align_cfg::method_local{} | affine_scoring);
+}
+
+TEST(align_pairwise_output_cigar, global_affine_linear_memory_traceback)
+{
+    check_same_as_cigar_from_alignment(seqan3::align_cfg::method_global{} | affine_scoring
+                                       | seqan3::align_cfg::linear_memory_traceback{});
+}
+
+TEST(align_pairwise_output_cigar, global_affine_wavefront)
+{
+    check_same_as_cigar_from_alignment(seqan3::align_cfg::method_global{} | affine_scoring
+                                       | seqan3::align_cfg::wavefront{});
+}
+
+TEST(align_pairwise_output_cigar, global_edit_distance)
+{
+    check_same_as_cigar_from_alignment(seqan3::align_cfg::method_global{} | seqan3::align_cfg::edit_scheme);
+}
+
+TEST(align_pairwise_output_cigar, semi_global_edit_distance)
+{
+    check_same_as_cigar_from_alignment(
+        seqan3::align_cfg::method_global{seqan3::align_cfg::free_end_gaps_sequence1_leading{true},
+                                         seqan3::align_cfg::free_end_gaps_sequence2_leading{false},
+                                         seqan3::align_cfg::free_end_gaps_sequence1_trailing{true},
+                                         seqan3::align_cfg::free_end_gaps_sequence2_trailing{false}}
+        | seqan3::align_cfg::edit_scheme);
+}
+
+TEST(align_pairwise_output_cigar, global_edit_distance_max_errors)
+{
+    check_same_as_cigar_from_alignment(seqan3::align_cfg::method_global{} | seqan3::align_cfg::edit_scheme
+                                       | seqan3::align_cfg::min_score{-30});
+}
+
+TEST(align_pairwise_output_cigar, example)
+{
+    seqan3::dna4_vector sequence1 = "ACGTGAACTGACT"_dna4;
+    seqan3::dna4_vector sequence2 = "ACGAAGACCGAT"_dna4;
+
+    auto result = *seqan3::align_pairwise(std::tie(sequence1, sequence2),
+                                          seqan3::align_cfg::method_global{} | seqan3::align_cfg::edit_scheme
+                                              | seqan3::align_cfg::output_score{}
+                                              | seqan3::align_cfg::output_cigar{})
+                       .begin();
+
+    EXPECT_EQ(result.score(), -5);
+    EXPECT_RANGE_EQ(result.cigar_sequence(),
+                    (std::vector<seqan3::cigar>{{4, 'M'_cigar_operation},
+                                                {1, 'I'_cigar_operation},
+                                                {4, 'M'_cigar_operation},
+                                                {1, 'D'_cigar_operation},
+                                                {2, 'M'_cigar_operation},
+                                                {1, 'D'_cigar_operation},
+                                                {1, 'M'_cigar_operation}}));
+}
@@ -0,0 +1,172 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/configuration/all.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+
+using sequence_pairs_t = std::vector<std::pair<std::vector<seqan3::dna4>, std::vector<seqan3::dna4>>>;
+
+// Similar sequences whose lengths vary between 1 and 300, such that unsorted batches are padded a lot.
+sequence_pairs_t random_sequence_pairs(size_t const count)
+{
+    std::mt19937_64 engine{count};
+    std::uniform_int_distribution<size_t> size_distribution{1, 300};
+    std::uniform_int_distribution<size_t> rank_distribution{0, 3};
+
+    sequence_pairs_t sequences{};
+    for (size_t i = 0; i < count; ++i)
+    {
+        std::vector<seqan3::dna4> sequence1(size_distribution(engine));
+        for (seqan3::dna4 & letter : sequence1)
+            seqan3::assign_rank_to(rank_distribution(engine), letter);
+
+        // The second sequence is up to 9 letters shorter, but contains at least one letter.
+        size_t const shortening = std::min(sequence1.size() - 1, i % 10);
+        size_t const size2 = sequence1.size() - shortening;
+
+        std::vector<seqan3::dna4> sequence2(sequence1.begin(), sequence1.begin() + size2);
+        for (size_t j = 0; j < sequence2.size(); j += 7)
+            seqan3::assign_rank_to(rank_distribution(engine), sequence2[j]);
+
+        sequences.emplace_back(std::move(sequence1), std::move(sequence2));
+    }
+    return sequences;
+}
+
+// Sorting by length must not change the results nor the order in which they are reported.
+template <typename config_t>
+void check_same_as_unsorted(sequence_pairs_t & sequences,
+                            config_t const & cfg,
+                            seqan3::align_cfg::sort_by_length const sort_by_length)
+{
+    auto unsorted_results = seqan3::align_pairwise(sequences, cfg);
+    auto sorted_results = seqan3::align_pairwise(sequences, cfg | sort_by_length);
+
+    size_t id = 0;
+    auto unsorted_it = unsorted_results.begin();
+    for (auto && result : sorted_results)
+    {
+        ASSERT_TRUE(unsorted_it != unsorted_results.end());
+        auto && expected = *unsorted_it;
+
+        EXPECT_EQ(result.sequence1_id(), id);
+        EXPECT_EQ(result.sequence2_id(), id);
+        EXPECT_EQ(result.score(), expected.score()) << "id " << id;
+        EXPECT_EQ(result.sequence1_end_position(), expected.sequence1_end_position()) << "id " << id;
+        EXPECT_EQ(result.sequence2_end_position(), expected.sequence2_end_position()) << "id " << id;
+        ++unsorted_it;
+        ++id;
+    }
+    EXPECT_EQ(id, sequences.size());
+}
+
+auto const output_cfg = seqan3::align_cfg::output_score{} | seqan3::align_cfg::output_end_position{}
+                      | seqan3::align_cfg::output_sequence1_id{} | seqan3::align_cfg::output_sequence2_id{};
+
+auto const affine_cfg =
+    seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{seqan3::match_score{4},
+                                                                        seqan3::mismatch_score{-5}}}
+    | seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-10}, seqan3::align_cfg::extension_score{-1}};
+
+TEST(align_pairwise_sort_by_length, global)
+{
+    sequence_pairs_t sequences = random_sequence_pairs(300);
+    auto const cfg = seqan3::align_cfg::method_global{} | affine_cfg | output_cfg | seqan3::align_cfg::vectorised{};
+
+    check_same_as_unsorted(sequences, cfg, seqan3::align_cfg::sort_by_length{});
+    // A window that is not a multiple of the simd length.
+    check_same_as_unsorted(sequences, cfg, seqan3::align_cfg::sort_by_length{100u});
+    check_same_as_unsorted(sequences, cfg, seqan3::align_cfg::sort_by_length{1u});
+    check_same_as_unsorted(sequences, cfg | seqan3::align_cfg::score_type<int16_t>{},
+                           seqan3::align_cfg::sort_by_length{});
+    check_same_as_unsorted(sequences, cfg | seqan3::align_cfg::adaptive_score_width{},
+                           seqan3::align_cfg::sort_by_length{});
+}
+
+TEST(align_pairwise_sort_by_length, local)
+{
+    sequence_pairs_t sequences = random_sequence_pairs(200);
+    auto const cfg = seqan3::align_cfg::method_local{} | affine_cfg | output_cfg | seqan3::align_cfg::vectorised{};
+
+    check_same_as_unsorted(sequences, cfg, seqan3::align_cfg::sort_by_length{64u});
+    check_same_as_unsorted(sequences, cfg | seqan3::align_cfg::adaptive_score_width{},
+                           seqan3::align_cfg::sort_by_length{64u});
+}
+
+TEST(align_pairwise_sort_by_length, begin_position)
+{
+    sequence_pairs_t sequences = random_sequence_pairs(100);
+    auto const cfg = seqan3::align_cfg::method_local{} | affine_cfg | output_cfg
+                   | seqan3::align_cfg::output_begin_position{} | seqan3::align_cfg::vectorised{};
+
+    check_same_as_unsorted(sequences, cfg, seqan3::align_cfg::sort_by_length{});
+
+    auto unsorted_results = seqan3::align_pairwise(sequences, cfg);
+    auto unsorted_it = unsorted_results.begin();
+    for (auto && result : seqan3::align_pairwise(sequences, cfg | seqan3::align_cfg::sort_by_length{}))
+    {
+        ASSERT_TRUE(unsorted_it != unsorted_results.end());
+        EXPECT_EQ(result.sequence1_begin_position(), (*unsorted_it).sequence1_begin_position());
+        EXPECT_EQ(result.sequence2_begin_position(), (*unsorted_it).sequence2_begin_position());
+        ++unsorted_it;
+    }
+}
+
+TEST(align_pairwise_sort_by_length, edit_distance)
+{
+    sequence_pairs_t sequences = random_sequence_pairs(200);
+    auto const cfg = seqan3::align_cfg::method_global{} | seqan3::align_cfg::edit_scheme | output_cfg
+                   | seqan3::align_cfg::vectorised{};
+
+    check_same_as_unsorted(sequences, cfg, seqan3::align_cfg::sort_by_length{});
+}
+
+TEST(align_pairwise_sort_by_length, parallel)
+{
+    sequence_pairs_t sequences = random_sequence_pairs(500);
+    auto const cfg = seqan3::align_cfg::method_global{} | affine_cfg | output_cfg | seqan3::align_cfg::vectorised{}
+                   | seqan3::align_cfg::parallel{4};
+
+    check_same_as_unsorted(sequences, cfg, seqan3::align_cfg::sort_by_length{100u});
+}
+
+TEST(align_pairwise_sort_by_length, on_result)
+{
+    sequence_pairs_t sequences = random_sequence_pairs(100);
+    std::vector<int> ids{};
+    auto const cfg = seqan3::align_cfg::method_global{} | affine_cfg | output_cfg | seqan3::align_cfg::vectorised{}
+                   | seqan3::align_cfg::sort_by_length{}
+                   | seqan3::align_cfg::on_result{[&](auto && result)
+                                                  {
+                                                      ids.push_back(result.sequence1_id());
+                                                  }};
+
+    seqan3::align_pairwise(sequences, cfg);
+
+    std::vector<int> expected_ids(sequences.size());
+    std::iota(expected_ids.begin(), expected_ids.end(), 0);
+    EXPECT_EQ(ids, expected_ids);
+}
+
+TEST(align_pairwise_sort_by_length, invalid_configuration)
+{
+    sequence_pairs_t sequences = random_sequence_pairs(10);
+    auto const cfg = seqan3::align_cfg::method_global{} | affine_cfg | output_cfg;
+
+    EXPECT_THROW(seqan3::align_pairwise(sequences, cfg | seqan3::align_cfg::sort_by_length{}),
+                 seqan3::invalid_alignment_configuration);
+    EXPECT_THROW(seqan3::align_pairwise(sequences,
+                                        cfg | seqan3::align_cfg::vectorised{} | seqan3::align_cfg::sort_by_length{0u}),
+                 seqan3::invalid_alignment_configuration);
+}
@@ -4,11 +4,17 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <mutex>
 #include <ranges>
 #include <stdexcept>
 #include <string_view>
+#include <thread>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include <seqan3/alignment/pairwise/align_pairwise.hpp>
 #include <seqan3/alphabet/gap/gapped.hpp>
@@ -16,6 +22,7 @@
 #include <seqan3/alphabet/views/to_char.hpp>
 #include <seqan3/test/expect_range_eq.hpp>
 #include <seqan3/test/expect_same_type.hpp>
+#include <seqan3/utility/parallel/thread_pool.hpp>
 #include <seqan3/utility/tuple/concept.hpp>
 
 using seqan3::operator""_dna4;
@@ -280,6 +287,111 @@ TYPED_TEST(align_pairwise_test, bug_1598)
     auto results = seqan3::align_pairwise(std::tie(s1, s2), cfg);
 }
 
+TEST(align_pairwise_test, parallel_streaming)
+{
+    std::vector<std::pair<seqan3::dna4_vector, seqan3::dna4_vector>> sequences{};
+    for (size_t i = 0; i < 100; ++i)
+        sequences.emplace_back("ACGTGATG"_dna4, seqan3::dna4_vector(i % 10, 'A'_dna4));
+
+    auto cfg = seqan3::align_cfg::method_global{} | seqan3::align_cfg::edit_scheme | seqan3::align_cfg::output_score{}
+             | seqan3::align_cfg::output_sequence1_id{};
+
+    std::vector<int> expected_scores{};
+    for (auto && result : seqan3::align_pairwise(sequences, cfg))
+        expected_scores.push_back(result.score());
+
+    { // Buffer fewer alignments than are computed.
+        std::vector<int> scores{};
+        size_t id = 0;
+        for (auto && result : seqan3::align_pairwise(sequences, cfg | seqan3::align_cfg::parallel{4, 3u}))
+        {
+            EXPECT_EQ(result.sequence1_id(), id++);
+            scores.push_back(result.score());
+        }
+        EXPECT_EQ(scores, expected_scores);
+    }
+
+    { // Report the results as soon as they are computed.
+        std::vector<int> scores(sequences.size());
+        std::vector<size_t> ids{};
+        auto completion_cfg =
+            cfg | seqan3::align_cfg::parallel{4, 8u, seqan3::align_cfg::parallel::result_order::completion};
+        for (auto && result : seqan3::align_pairwise(sequences, completion_cfg))
+        {
+            ids.push_back(result.sequence1_id());
+            scores[result.sequence1_id()] = result.score();
+        }
+
+        std::ranges::sort(ids);
+        EXPECT_TRUE(std::ranges::equal(ids, std::views::iota(0u, sequences.size())));
+        EXPECT_EQ(scores, expected_scores);
+    }
+
+    EXPECT_THROW(seqan3::align_pairwise(sequences, cfg | seqan3::align_cfg::parallel{4, 0u}), std::invalid_argument);
+}
+
+TEST(align_pairwise_test, parallel_thread_pool)
+{
+    std::vector<std::pair<seqan3::dna4_vector, seqan3::dna4_vector>> sequences{};
+    for (size_t i = 0; i < 100; ++i)
+        sequences.emplace_back("ACGTGATG"_dna4, seqan3::dna4_vector(i % 10, 'A'_dna4));
+
+    auto cfg = seqan3::align_cfg::method_global{} | seqan3::align_cfg::edit_scheme | seqan3::align_cfg::output_score{};
+
+    std::vector<int> expected_scores{};
+    for (auto && result : seqan3::align_pairwise(sequences, cfg))
+        expected_scores.push_back(result.score());
+
+    seqan3::thread_pool pool{2};
+    auto pool_cfg = cfg | seqan3::align_cfg::parallel{pool, 5u};
+
+    // Consecutive calls reuse the threads of the pool.
+    for (size_t run = 0; run < 2; ++run)
+    {
+        std::vector<int> scores{};
+        for (auto && result : seqan3::align_pairwise(sequences, pool_cfg))
+            scores.push_back(result.score());
+        EXPECT_EQ(scores, expected_scores);
+    }
+
+    { // The results are reported via the callback.
+        std::mutex mutex{};
+        std::vector<int> scores(sequences.size());
+        seqan3::align_pairwise(sequences,
+                               pool_cfg | seqan3::align_cfg::output_sequence1_id{}
+                                   | seqan3::align_cfg::on_result{[&](auto && result)
+                                                                  {
+                                                                      std::lock_guard lock{mutex};
+                                                                      scores[result.sequence1_id()] = result.score();
+                                                                  }});
+        EXPECT_EQ(scores, expected_scores);
+    }
+
+    { // Alignments computed within the tasks of the same pool.
+        std::vector<std::vector<int>> scores(4);
+        std::atomic<size_t> finished{0};
+
+        std::vector<std::function<void()>> outer_tasks{};
+        for (size_t i = 0; i < scores.size(); ++i)
+            outer_tasks.emplace_back(
+                [&, i]()
+                {
+                    for (auto && result : seqan3::align_pairwise(sequences, pool_cfg))
+                        scores[i].push_back(result.score());
+                    ++finished;
+                });
+
+        for (std::function<void()> & outer_task : outer_tasks)
+            pool.submit(outer_task);
+
+        while (finished < outer_tasks.size())
+            std::this_thread::yield();
+
+        for (std::vector<int> const & task_scores : scores)
+            EXPECT_EQ(task_scores, expected_scores);
+    }
+}
+
 TEST(align_pairwise_test, parallel_without_parameter)
 {
     auto seq1 = "ACGTGATG"_dna4;
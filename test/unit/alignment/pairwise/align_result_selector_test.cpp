@@ -14,6 +14,7 @@
 #include <seqan3/alignment/configuration/align_config_output.hpp>
 #include <seqan3/alignment/configuration/align_config_score_type.hpp>
 #include <seqan3/alignment/pairwise/align_result_selector.hpp>
+#include <seqan3/alphabet/cigar/cigar.hpp>
 #include <seqan3/alphabet/gap/gapped.hpp>
 #include <seqan3/alphabet/nucleotide/dna4.hpp>
 #include <seqan3/utility/tuple/concept.hpp>
@@ -110,6 +111,16 @@ TEST_F(alignment_selector_test, output_alignment_only)
     EXPECT_TRUE((std::is_same_v<decltype(std::declval<result_t>().alignment()), alignment_t const &>));
 }
 
+TEST_F(alignment_selector_test, output_cigar_only)
+{
+    auto cfg = base_config | seqan3::align_cfg::output_cigar{};
+
+    using result_t = alignment_result_t<decltype(cfg)>;
+
+    EXPECT_TRUE(
+        (std::is_same_v<decltype(std::declval<result_t>().cigar_sequence()), std::vector<seqan3::cigar> const &>));
+}
+
 TEST_F(alignment_selector_test, output_sequence1_id_only)
 {
     auto cfg = base_config | seqan3::align_cfg::output_sequence1_id{};
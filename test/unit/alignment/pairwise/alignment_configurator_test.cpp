@@ -86,10 +86,24 @@ TEST(alignment_configurator, configure_edit_semi)
 
 TEST(alignment_configurator, configure_edit_banded)
 {
-    EXPECT_THROW((run_test(seqan3::align_cfg::method_global{} | seqan3::align_cfg::edit_scheme
-                           | seqan3::align_cfg::band_fixed_size{seqan3::align_cfg::lower_diagonal{-1},
-                                                                seqan3::align_cfg::upper_diagonal{1}})),
-                 seqan3::invalid_alignment_configuration);
+    EXPECT_EQ(run_test(seqan3::align_cfg::method_global{} | seqan3::align_cfg::edit_scheme
+                       | seqan3::align_cfg::band_fixed_size{seqan3::align_cfg::lower_diagonal{-1},
+                                                            seqan3::align_cfg::upper_diagonal{1}})
+                  .score(),
+              0);
+
+    { // invalid band
+        auto cfg_base = seqan3::align_cfg::method_global{} | seqan3::align_cfg::edit_scheme;
+        auto cfg_lower = cfg_base
+                       | seqan3::align_cfg::band_fixed_size{seqan3::align_cfg::lower_diagonal{-10},
+                                                            seqan3::align_cfg::upper_diagonal{-5}};
+        auto cfg_upper = cfg_base
+                       | seqan3::align_cfg::band_fixed_size{seqan3::align_cfg::lower_diagonal{5},
+                                                            seqan3::align_cfg::upper_diagonal{6}};
+
+        EXPECT_THROW(run_test(cfg_lower), seqan3::invalid_alignment_configuration);
+        EXPECT_THROW(run_test(cfg_upper), seqan3::invalid_alignment_configuration);
+    }
 }
 
 TEST(alignment_configurator, configure_edit_max_error)
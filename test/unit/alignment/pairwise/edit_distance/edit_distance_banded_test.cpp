@@ -0,0 +1,425 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_band.hpp>
+#include <seqan3/alignment/configuration/align_config_edit.hpp>
+#include <seqan3/alignment/configuration/align_config_min_score.hpp>
+#include <seqan3/alignment/configuration/align_config_result_type.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/pairwise/edit_distance_banded.hpp>
+#include <seqan3/alignment/pairwise/edit_distance_unbanded.hpp>
+#include <seqan3/alphabet/gap/gapped.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/test/expect_range_eq.hpp>
+
+using seqan3::operator""_dna4;
+
+// The best score in the last row of the banded matrix. Ties are resolved towards the last column.
+struct naive_result
+{
+    int score;
+    size_t end_column;
+};
+
+naive_result naive_banded_edit_distance(std::vector<seqan3::dna4> const & database,
+                                        std::vector<seqan3::dna4> const & query,
+                                        int64_t const lower,
+                                        int64_t const upper,
+                                        bool const is_semi_global)
+{
+    int const inf = std::numeric_limits<int>::max() / 2;
+    int64_t const n = database.size();
+    int64_t const m = query.size();
+    std::vector<std::vector<int>> matrix(m + 1, std::vector<int>(n + 1, inf));
+
+    auto in_band = [&](int64_t row, int64_t col)
+    {
+        return col - row >= lower && col - row <= upper;
+    };
+
+    for (int64_t col = 0; col <= n; ++col)
+    {
+        for (int64_t row = 0; row <= m; ++row)
+        {
+            if (!in_band(row, col))
+                continue;
+
+            if (row == 0)
+            {
+                matrix[row][col] = is_semi_global ? 0 : col;
+                continue;
+            }
+
+            int best = inf;
+            if (col > 0 && in_band(row - 1, col - 1))
+                best = std::min(best, matrix[row - 1][col - 1] + (database[col - 1] == query[row - 1] ? 0 : 1));
+            if (col > 0 && in_band(row, col - 1))
+                best = std::min(best, matrix[row][col - 1] + 1);
+            if (in_band(row - 1, col))
+                best = std::min(best, matrix[row - 1][col] + 1);
+            matrix[row][col] = best;
+        }
+    }
+
+    if (!is_semi_global)
+        return {matrix[m][n], static_cast<size_t>(n)};
+
+    naive_result result{inf, 0u};
+    for (int64_t col = 0; col <= n; ++col)
+    {
+        if (in_band(m, col) && matrix[m][col] <= result.score)
+            result = {matrix[m][col], static_cast<size_t>(col)};
+    }
+    return result;
+}
+
+// Returns the number of errors of the alignment or -1 if the alignment leaves the band.
+template <typename alignment_t>
+int alignment_errors(alignment_t const & alignment,
+                     size_t row,
+                     size_t col,
+                     int64_t const lower,
+                     int64_t const upper)
+{
+    auto in_band = [&]()
+    {
+        int64_t const diagonal = static_cast<int64_t>(col) - static_cast<int64_t>(row);
+        return diagonal >= lower && diagonal <= upper;
+    };
+
+    if (!in_band())
+        return -1;
+
+    auto const & [gapped_database, gapped_query] = alignment;
+    int errors = 0;
+
+    for (size_t i = 0; i < std::ranges::size(gapped_database); ++i)
+    {
+        bool const database_gap = gapped_database[i] == seqan3::gap{};
+        bool const query_gap = gapped_query[i] == seqan3::gap{};
+
+        errors += (database_gap || query_gap || gapped_database[i] != gapped_query[i]) ? 1 : 0;
+        row += query_gap ? 0 : 1;
+        col += database_gap ? 0 : 1;
+
+        if (!in_band())
+            return -1;
+    }
+
+    return errors;
+}
+
+auto global_config()
+{
+    return seqan3::align_cfg::method_global{} | seqan3::align_cfg::edit_scheme;
+}
+
+auto semi_global_config()
+{
+    return seqan3::align_cfg::method_global{seqan3::align_cfg::free_end_gaps_sequence1_leading{true},
+                                            seqan3::align_cfg::free_end_gaps_sequence2_leading{false},
+                                            seqan3::align_cfg::free_end_gaps_sequence1_trailing{true},
+                                            seqan3::align_cfg::free_end_gaps_sequence2_trailing{false}}
+         | seqan3::align_cfg::edit_scheme;
+}
+
+auto band(int64_t const lower, int64_t const upper)
+{
+    return seqan3::align_cfg::band_fixed_size{seqan3::align_cfg::lower_diagonal{static_cast<int32_t>(lower)},
+                                              seqan3::align_cfg::upper_diagonal{static_cast<int32_t>(upper)}};
+}
+
+std::vector<seqan3::dna4> random_sequence(std::mt19937_64 & engine, size_t const size)
+{
+    std::uniform_int_distribution<uint8_t> rank_distribution{0, 3};
+    std::vector<seqan3::dna4> sequence(size);
+    for (auto & letter : sequence)
+        letter.assign_rank(rank_distribution(engine));
+    return sequence;
+}
+
+// Mutates roughly every eighth letter.
+std::vector<seqan3::dna4> mutate(std::mt19937_64 & engine, std::vector<seqan3::dna4> sequence)
+{
+    std::uniform_int_distribution<int> operation_distribution{0, 23};
+    std::vector<seqan3::dna4> mutated{};
+    for (seqan3::dna4 letter : sequence)
+    {
+        int const operation = operation_distribution(engine);
+        if (operation == 0) // deletion
+            continue;
+        else if (operation == 1) // substitution
+            letter.assign_rank((letter.to_rank() + 1) % 4);
+        else if (operation == 2) // insertion
+            mutated.push_back(letter);
+        mutated.push_back(letter);
+    }
+    return mutated;
+}
+
+template <typename word_t, bool is_semi_global, typename config_t>
+auto banded_edit_distance(std::vector<seqan3::dna4> const & database,
+                          std::vector<seqan3::dna4> const & query,
+                          config_t const & cfg)
+{
+    using database_t = std::vector<seqan3::dna4> const &;
+    using query_t = std::vector<seqan3::dna4> const &;
+    using result_value_t = typename seqan3::detail::align_result_selector<database_t, query_t, config_t>::type;
+    using result_t = seqan3::alignment_result<result_value_t>;
+    auto cfg_with_result_type = cfg | seqan3::align_cfg::detail::result_type<result_t>{};
+    using cfg_with_result_type_t = decltype(cfg_with_result_type);
+    using edit_traits = seqan3::detail::default_edit_distance_trait_type<database_t,
+                                                                         query_t,
+                                                                         cfg_with_result_type_t,
+                                                                         std::bool_constant<is_semi_global>,
+                                                                         word_t>;
+
+    seqan3::detail::edit_distance_banded algorithm{database, query, cfg_with_result_type, edit_traits{}};
+    result_t result{};
+    algorithm(0u,
+              [&](auto && res)
+              {
+                  result = std::move(res);
+              });
+    return result;
+}
+
+template <bool is_semi_global>
+void check_random_alignments(std::mt19937_64 & engine)
+{
+    auto const method_cfg = []()
+    {
+        if constexpr (is_semi_global)
+            return semi_global_config();
+        else
+            return global_config();
+    }();
+    auto const cfg = method_cfg | seqan3::align_cfg::output_score{} | seqan3::align_cfg::output_end_position{}
+                   | seqan3::align_cfg::output_begin_position{} | seqan3::align_cfg::output_alignment{};
+
+    std::uniform_int_distribution<size_t> size_distribution{0, 150};
+
+    for (size_t iteration = 0; iteration < 300; ++iteration)
+    {
+        std::vector<seqan3::dna4> query = random_sequence(engine, size_distribution(engine));
+        std::vector<seqan3::dna4> database = mutate(engine, query);
+
+        if constexpr (is_semi_global)
+        {
+            std::vector<seqan3::dna4> prefix = random_sequence(engine, size_distribution(engine) / 4);
+            database.insert(database.begin(), prefix.begin(), prefix.end());
+            std::vector<seqan3::dna4> suffix = random_sequence(engine, size_distribution(engine) / 4);
+            database.insert(database.end(), suffix.begin(), suffix.end());
+        }
+
+        int64_t const n = database.size();
+        int64_t const m = query.size();
+
+        if (is_semi_global && m > n)
+            std::swap(query, database);
+
+        int64_t const size_difference = static_cast<int64_t>(database.size()) - static_cast<int64_t>(query.size());
+
+        // A band that contains the origin and the sink (global) or touches the last row (semi-global).
+        std::uniform_int_distribution<int64_t> width_distribution{0, 80};
+        int64_t lower = std::min<int64_t>(0, size_difference) - width_distribution(engine);
+        int64_t upper = std::max<int64_t>(0, is_semi_global ? 0 : size_difference) + width_distribution(engine);
+
+        if (is_semi_global && iteration % 3 == 0) // A band that does not contain the origin.
+        {
+            lower = std::uniform_int_distribution<int64_t>{0, size_difference}(engine);
+            upper = lower + width_distribution(engine);
+        }
+
+        auto const band_cfg = cfg | band(lower, upper);
+        auto const expected = naive_banded_edit_distance(database, query, lower, upper, is_semi_global);
+
+        auto check = [&](auto const & result)
+        {
+            EXPECT_EQ(result.score(), -expected.score);
+            EXPECT_EQ(result.sequence1_end_position(), expected.end_column);
+            EXPECT_EQ(result.sequence2_end_position(), query.size());
+            EXPECT_EQ(alignment_errors(result.alignment(),
+                                       result.sequence2_begin_position(),
+                                       result.sequence1_begin_position(),
+                                       lower,
+                                       upper),
+                      expected.score);
+            EXPECT_EQ(result.sequence2_begin_position(), 0u);
+
+            if constexpr (!is_semi_global)
+            {
+                EXPECT_EQ(result.sequence1_begin_position(), 0u);
+            }
+        };
+
+        for (auto const & result : seqan3::align_pairwise(std::tie(database, query), band_cfg))
+            check(result);
+
+        check(banded_edit_distance<uint8_t, is_semi_global>(database, query, band_cfg));
+    }
+}
+
+TEST(edit_distance_banded, global_random)
+{
+    std::mt19937_64 engine{42};
+    check_random_alignments<false>(engine);
+}
+
+TEST(edit_distance_banded, semi_global_random)
+{
+    std::mt19937_64 engine{42};
+    check_random_alignments<true>(engine);
+}
+
+TEST(edit_distance_banded, same_as_unbanded_for_covering_band)
+{
+    std::mt19937_64 engine{7};
+    auto const cfg = semi_global_config() | seqan3::align_cfg::output_score{}
+                   | seqan3::align_cfg::output_end_position{} | seqan3::align_cfg::output_alignment{};
+
+    for (size_t iteration = 0; iteration < 50; ++iteration)
+    {
+        std::vector<seqan3::dna4> query = random_sequence(engine, 20 + iteration);
+        std::vector<seqan3::dna4> database = random_sequence(engine, 30 + 2 * iteration);
+        int64_t const n = database.size();
+        int64_t const m = query.size();
+
+        auto banded = banded_edit_distance<uint64_t, true>(database, query, cfg | band(-m, n));
+
+        for (auto const & unbanded : seqan3::align_pairwise(std::tie(database, query), cfg))
+        {
+            EXPECT_EQ(banded.score(), unbanded.score());
+            EXPECT_EQ(banded.sequence1_end_position(), unbanded.sequence1_end_position());
+            EXPECT_RANGE_EQ(std::get<0>(banded.alignment()), std::get<0>(unbanded.alignment()));
+            EXPECT_RANGE_EQ(std::get<1>(banded.alignment()), std::get<1>(unbanded.alignment()));
+        }
+    }
+}
+
+TEST(edit_distance_banded, same_score_as_banded_dynamic_programming)
+{
+    std::mt19937_64 engine{13};
+    // The same costs as the edit distance, but computed with the general banded algorithm.
+    auto const dp_cfg = seqan3::align_cfg::method_global{}
+                      | seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{
+                          seqan3::match_score{0},
+                          seqan3::mismatch_score{-1}}}
+                      | seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{0},
+                                                           seqan3::align_cfg::extension_score{-1}}
+                      | seqan3::align_cfg::output_score{};
+
+    for (size_t iteration = 0; iteration < 50; ++iteration)
+    {
+        std::vector<seqan3::dna4> query = random_sequence(engine, 100);
+        std::vector<seqan3::dna4> database = mutate(engine, query);
+        int64_t const size_difference = static_cast<int64_t>(database.size()) - static_cast<int64_t>(query.size());
+        auto const band_cfg =
+            band(std::min<int64_t>(0, size_difference) - 3, std::max<int64_t>(0, size_difference) + 3);
+
+        auto edit_results = seqan3::align_pairwise(std::tie(database, query),
+                                                   global_config() | seqan3::align_cfg::output_score{} | band_cfg);
+        auto dp_results = seqan3::align_pairwise(std::tie(database, query), dp_cfg | band_cfg);
+
+        EXPECT_EQ((*edit_results.begin()).score(), (*dp_results.begin()).score());
+    }
+}
+
+TEST(edit_distance_banded, single_diagonal)
+{
+    std::vector database = "ACGTACGTAC"_dna4;
+    std::vector query = "ACCTACGAAC"_dna4;
+
+    auto cfg = global_config() | band(0, 0) | seqan3::align_cfg::output_score{} | seqan3::align_cfg::output_alignment{};
+    for (auto const & result : seqan3::align_pairwise(std::tie(database, query), cfg))
+    {
+        EXPECT_EQ(result.score(), -2);
+        EXPECT_RANGE_EQ(std::get<0>(result.alignment()), database);
+        EXPECT_RANGE_EQ(std::get<1>(result.alignment()), query);
+    }
+}
+
+TEST(edit_distance_banded, band_restricts_alignment)
+{
+    // The query only matches at the beginning of the database, which is outside of the band.
+    std::vector database = "ACGTTTTTTTTT"_dna4;
+    std::vector query = "ACGT"_dna4;
+
+    auto cfg = semi_global_config() | seqan3::align_cfg::output_score{} | seqan3::align_cfg::output_end_position{};
+    for (auto const & result : seqan3::align_pairwise(std::tie(database, query), cfg))
+        EXPECT_EQ(result.score(), 0);
+
+    naive_result const expected = naive_banded_edit_distance(database, query, 4, 8, true);
+    EXPECT_EQ(expected.score, 3);
+    for (auto const & result : seqan3::align_pairwise(std::tie(database, query), cfg | band(4, 8)))
+    {
+        EXPECT_EQ(result.score(), -expected.score);
+        EXPECT_EQ(result.sequence1_end_position(), expected.end_column);
+    }
+}
+
+TEST(edit_distance_banded, min_score)
+{
+    std::vector database = "AACCGGTTAACCGGTT"_dna4;
+    std::vector query = "ACGTACGT"_dna4;
+
+    auto cfg = semi_global_config() | band(0, 8) | seqan3::align_cfg::output_score{}
+             | seqan3::align_cfg::output_end_position{};
+
+    int expected = naive_banded_edit_distance(database, query, 0, 8, true).score;
+    for (auto const & result : seqan3::align_pairwise(std::tie(database, query),
+                                                      cfg | seqan3::align_cfg::min_score{-expected}))
+        EXPECT_EQ(result.score(), -expected);
+
+    for (auto const & result : seqan3::align_pairwise(std::tie(database, query),
+                                                      cfg | seqan3::align_cfg::min_score{-expected + 1}))
+        EXPECT_EQ(result.score(), std::numeric_limits<int>::max());
+}
+
+TEST(edit_distance_banded, empty_sequences)
+{
+    std::vector<seqan3::dna4> empty{};
+    std::vector database = "ACGT"_dna4;
+
+    auto cfg = seqan3::align_cfg::output_score{} | seqan3::align_cfg::output_alignment{};
+    for (auto const & result : seqan3::align_pairwise(std::tie(database, empty), global_config() | band(0, 4) | cfg))
+        EXPECT_EQ(result.score(), -4);
+
+    for (auto const & result : seqan3::align_pairwise(std::tie(empty, database), global_config() | band(-4, 0) | cfg))
+        EXPECT_EQ(result.score(), -4);
+
+    for (auto const & result :
+         seqan3::align_pairwise(std::tie(database, empty), semi_global_config() | band(1, 2) | cfg))
+        EXPECT_EQ(result.score(), 0);
+}
+
+TEST(edit_distance_banded, invalid_band)
+{
+    std::vector database = "ACGTACGT"_dna4;
+    std::vector query = "ACGTAC"_dna4;
+    auto run = [&](auto const & cfg)
+    {
+        for (auto const & result : seqan3::align_pairwise(std::tie(database, query), cfg))
+            static_cast<void>(result.score());
+    };
+
+    // The upper diagonal is smaller than the lower diagonal.
+    EXPECT_THROW(run(global_config() | band(2, 1)), seqan3::invalid_alignment_configuration);
+    // The band does not contain the first column.
+    EXPECT_THROW(run(semi_global_config() | band(-3, -1)), seqan3::invalid_alignment_configuration);
+    // The band does not contain the origin.
+    EXPECT_THROW(run(global_config() | band(1, 4)), seqan3::invalid_alignment_configuration);
+    // The band does not contain the sink.
+    EXPECT_THROW(run(global_config() | band(-2, 1)), seqan3::invalid_alignment_configuration);
+    // The band does not reach the last row.
+    EXPECT_THROW(run(semi_global_config() | band(3, 5)), seqan3::invalid_alignment_configuration);
+    EXPECT_NO_THROW(run(semi_global_config() | band(2, 5)));
+}
@@ -0,0 +1,200 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_edit.hpp>
+#include <seqan3/alignment/configuration/align_config_min_score.hpp>
+#include <seqan3/alignment/configuration/align_config_result_type.hpp>
+#include <seqan3/alignment/configuration/align_config_vectorised.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/pairwise/edit_distance_simd.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+
+using seqan3::operator""_dna4;
+
+using sequence_pairs_t = std::vector<std::pair<std::vector<seqan3::dna4>, std::vector<seqan3::dna4>>>;
+
+auto global_config()
+{
+    return seqan3::align_cfg::method_global{} | seqan3::align_cfg::edit_scheme;
+}
+
+auto semi_global_config()
+{
+    return seqan3::align_cfg::method_global{seqan3::align_cfg::free_end_gaps_sequence1_leading{true},
+                                            seqan3::align_cfg::free_end_gaps_sequence2_leading{false},
+                                            seqan3::align_cfg::free_end_gaps_sequence1_trailing{true},
+                                            seqan3::align_cfg::free_end_gaps_sequence2_trailing{false}}
+         | seqan3::align_cfg::edit_scheme;
+}
+
+auto output_config()
+{
+    return seqan3::align_cfg::output_score{} | seqan3::align_cfg::output_end_position{}
+         | seqan3::align_cfg::output_sequence1_id{} | seqan3::align_cfg::output_sequence2_id{};
+}
+
+std::vector<seqan3::dna4> random_sequence(std::mt19937_64 & engine, size_t const size)
+{
+    std::uniform_int_distribution<uint8_t> rank_distribution{0, 3};
+    std::vector<seqan3::dna4> sequence(size);
+    for (auto & letter : sequence)
+        letter.assign_rank(rank_distribution(engine));
+    return sequence;
+}
+
+// Candidate verifications: the database is a mutated copy of the query within some flanking sequence.
+sequence_pairs_t random_sequence_pairs(size_t const min_query_size, size_t const max_query_size)
+{
+    std::mt19937_64 engine{max_query_size};
+    std::uniform_int_distribution<size_t> query_size_distribution{min_query_size, max_query_size};
+    std::uniform_int_distribution<size_t> flank_size_distribution{0, 10};
+    std::uniform_int_distribution<int> operation_distribution{0, 15};
+    sequence_pairs_t sequence_pairs{};
+
+    for (size_t i = 0; i < 500; ++i)
+    {
+        std::vector<seqan3::dna4> query = random_sequence(engine, query_size_distribution(engine));
+        std::vector<seqan3::dna4> database = random_sequence(engine, flank_size_distribution(engine));
+
+        for (seqan3::dna4 letter : query)
+        {
+            int const operation = operation_distribution(engine);
+            if (operation == 0) // deletion
+                continue;
+            else if (operation == 1) // substitution
+                letter.assign_rank((letter.to_rank() + 1) % 4);
+            else if (operation == 2) // insertion
+                database.push_back(letter);
+            database.push_back(letter);
+        }
+
+        std::vector<seqan3::dna4> suffix = random_sequence(engine, flank_size_distribution(engine));
+        database.insert(database.end(), suffix.begin(), suffix.end());
+        sequence_pairs.emplace_back(std::move(database), std::move(query));
+    }
+
+    return sequence_pairs;
+}
+
+// The vectorised edit distance must produce the same results in the same order as the scalar one.
+template <typename config_t>
+void check_same_as_scalar(sequence_pairs_t & sequence_pairs, config_t const & cfg)
+{
+    auto scalar_results = seqan3::align_pairwise(sequence_pairs, cfg);
+    auto simd_results = seqan3::align_pairwise(sequence_pairs, cfg | seqan3::align_cfg::vectorised{});
+    auto scalar_it = scalar_results.begin();
+    size_t count = 0;
+
+    for (auto && simd_result : simd_results)
+    {
+        ASSERT_NE(scalar_it, scalar_results.end());
+        auto && scalar_result = *scalar_it;
+
+        EXPECT_EQ(simd_result.sequence1_id(), count);
+        EXPECT_EQ(simd_result.sequence2_id(), count);
+        EXPECT_EQ(simd_result.score(), scalar_result.score()) << "pair " << count;
+        EXPECT_EQ(simd_result.sequence1_end_position(), scalar_result.sequence1_end_position()) << "pair " << count;
+        EXPECT_EQ(simd_result.sequence2_end_position(), scalar_result.sequence2_end_position()) << "pair " << count;
+
+        ++scalar_it;
+        ++count;
+    }
+
+    EXPECT_EQ(count, sequence_pairs.size());
+}
+
+TEST(edit_distance_simd, global)
+{
+    for (size_t max_query_size : {8u, 32u, 64u})
+    {
+        sequence_pairs_t sequence_pairs = random_sequence_pairs(1u, max_query_size);
+        check_same_as_scalar(sequence_pairs, global_config() | output_config());
+    }
+}
+
+TEST(edit_distance_simd, semi_global)
+{
+    for (size_t max_query_size : {8u, 32u, 64u})
+    {
+        sequence_pairs_t sequence_pairs = random_sequence_pairs(1u, max_query_size);
+        check_same_as_scalar(sequence_pairs, semi_global_config() | output_config());
+    }
+}
+
+TEST(edit_distance_simd, min_score)
+{
+    auto const min_score = seqan3::align_cfg::min_score{-3};
+
+    for (size_t max_query_size : {32u, 64u})
+    {
+        sequence_pairs_t sequence_pairs = random_sequence_pairs(1u, max_query_size);
+        check_same_as_scalar(sequence_pairs, global_config() | output_config() | min_score);
+        check_same_as_scalar(sequence_pairs, semi_global_config() | output_config() | min_score);
+    }
+}
+
+// Batches with empty or long queries are computed by the scalar algorithm.
+TEST(edit_distance_simd, mixed_query_sizes)
+{
+    sequence_pairs_t sequence_pairs = random_sequence_pairs(0u, 100u);
+    check_same_as_scalar(sequence_pairs, global_config() | output_config());
+    check_same_as_scalar(sequence_pairs, semi_global_config() | output_config());
+}
+
+TEST(edit_distance_simd, empty_database)
+{
+    sequence_pairs_t sequence_pairs{{{}, "ACGT"_dna4}, {"ACGT"_dna4, "ACG"_dna4}, {{}, "A"_dna4}};
+    check_same_as_scalar(sequence_pairs, global_config() | output_config());
+    check_same_as_scalar(sequence_pairs, semi_global_config() | output_config());
+}
+
+TEST(edit_distance_simd, partial_batch)
+{
+    using database_t = std::vector<seqan3::dna4> const &;
+    using query_t = std::vector<seqan3::dna4> const &;
+    using config_t = decltype(semi_global_config() | output_config());
+    using result_value_t = typename seqan3::detail::align_result_selector<database_t, query_t, config_t>::type;
+    using result_t = seqan3::alignment_result<result_value_t>;
+    using config_with_result_type_t = decltype(semi_global_config() | output_config()
+                                               | seqan3::align_cfg::detail::result_type<result_t>{});
+    using algorithm_t =
+        seqan3::detail::edit_distance_simd<uint8_t, seqan3::dna4, config_with_result_type_t, std::true_type>;
+
+    algorithm_t algorithm{config_with_result_type_t{}};
+    EXPECT_TRUE(algorithm.empty());
+
+    std::vector<result_t> results{};
+    auto callback = [&](auto && result)
+    {
+        results.push_back(std::move(result));
+    };
+
+    // Without simd instructions there is only one lane.
+    std::vector<seqan3::dna4> const database{"AACGTTTTTACGAAAA"_dna4};
+    algorithm.add(7u, database, "ACGT"_dna4);
+    if (algorithm.full())
+        algorithm(callback);
+
+    algorithm.add(3u, database, "ACGAAAAC"_dna4);
+    EXPECT_FALSE(algorithm.empty());
+    EXPECT_EQ(algorithm.full(), algorithm_t::lanes <= 2u);
+    algorithm(callback);
+
+    EXPECT_TRUE(algorithm.empty());
+    ASSERT_EQ(results.size(), 2u);
+    EXPECT_EQ(results[0].sequence1_id(), 7u);
+    EXPECT_EQ(results[0].score(), 0);
+    EXPECT_EQ(results[0].sequence1_end_position(), 5u);
+    EXPECT_EQ(results[0].sequence2_end_position(), 4u);
+    EXPECT_EQ(results[1].sequence1_id(), 3u);
+    EXPECT_EQ(results[1].score(), -1);
+    EXPECT_EQ(results[1].sequence1_end_position(), 16u);
+    EXPECT_EQ(results[1].sequence2_end_position(), 8u);
+}
@@ -0,0 +1,267 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include <seqan3/alignment/pairwise/extend_ungapped.hpp>
+#include <seqan3/alphabet/aminoacid/aa27.hpp>
+#include <seqan3/alphabet/container/bitpacked_sequence.hpp>
+#include <seqan3/alphabet/nucleotide/dna15.hpp>
+#include <seqan3/alphabet/nucleotide/dna16sam.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+
+using seqan3::operator""_dna4;
+
+// Extends letter by letter in both directions.
+template <typename sequence1_t, typename sequence2_t>
+seqan3::ungapped_extension_result naive_extend_ungapped(sequence1_t const & sequence1,
+                                                        sequence2_t const & sequence2,
+                                                        size_t const position1,
+                                                        size_t const position2,
+                                                        int32_t const match,
+                                                        int32_t const mismatch,
+                                                        int32_t const drop_score)
+{
+    auto extend = [&](auto && letters_match, size_t const max_length)
+    {
+        int32_t score{};
+        int32_t best_score{};
+        size_t best_length{};
+        for (size_t length = 1; length <= max_length; ++length)
+        {
+            score += letters_match(length - 1u) ? match : mismatch;
+            if (score > best_score)
+            {
+                best_score = score;
+                best_length = length;
+            }
+
+            if (best_score - score > drop_score)
+                break;
+        }
+        return std::pair{best_score, best_length};
+    };
+
+    auto [right_score, right_length] = extend(
+        [&](size_t const i)
+        {
+            return sequence1[position1 + i] == sequence2[position2 + i];
+        },
+        std::min(sequence1.size() - position1, sequence2.size() - position2));
+    auto [left_score, left_length] = extend(
+        [&](size_t const i)
+        {
+            return sequence1[position1 - 1u - i] == sequence2[position2 - 1u - i];
+        },
+        std::min(position1, position2));
+
+    return {.score = left_score + right_score,
+            .sequence1_begin_position = position1 - left_length,
+            .sequence1_end_position = position1 + right_length,
+            .sequence2_begin_position = position2 - left_length,
+            .sequence2_end_position = position2 + right_length};
+}
+
+// The second sequence is a copy of the first one with the given fraction of substituted letters.
+template <typename alphabet_t>
+std::pair<std::vector<alphabet_t>, std::vector<alphabet_t>>
+random_sequence_pair(std::mt19937_64 & engine, size_t const size, double const substitution_rate)
+{
+    std::uniform_int_distribution<size_t> rank_distribution{0, seqan3::alphabet_size<alphabet_t> - 1};
+    std::bernoulli_distribution substitution_distribution{substitution_rate};
+
+    std::vector<alphabet_t> sequence1(size);
+    for (auto & letter : sequence1)
+        seqan3::assign_rank_to(rank_distribution(engine), letter);
+
+    std::vector<alphabet_t> sequence2{sequence1};
+    for (auto & letter : sequence2)
+        if (substitution_distribution(engine))
+            seqan3::assign_rank_to(rank_distribution(engine), letter);
+
+    return {std::move(sequence1), std::move(sequence2)};
+}
+
+template <typename t>
+struct extend_ungapped_test : public ::testing::Test
+{};
+
+using test_types = ::testing::Types<std::vector<seqan3::dna4>,
+                                    seqan3::bitpacked_sequence<seqan3::dna4>,
+                                    seqan3::bitpacked_sequence<seqan3::dna5>,
+                                    seqan3::bitpacked_sequence<seqan3::dna15>,
+                                    seqan3::bitpacked_sequence<seqan3::dna16sam>,
+                                    std::vector<seqan3::aa27>,
+                                    seqan3::bitpacked_sequence<seqan3::aa27>>;
+
+TYPED_TEST_SUITE(extend_ungapped_test, test_types, );
+
+TYPED_TEST(extend_ungapped_test, same_as_naive)
+{
+    using alphabet_t = std::ranges::range_value_t<TypeParam>;
+
+    std::mt19937_64 engine{42};
+    for (double const substitution_rate : {0.0, 0.02, 0.1, 0.3, 0.75})
+    {
+        auto [vector1, vector2] = random_sequence_pair<alphabet_t>(engine, 500, substitution_rate);
+        TypeParam sequence1{vector1};
+        TypeParam sequence2(vector2.begin() + 37, vector2.end()); // Letters at different offsets in the words.
+
+        std::uniform_int_distribution<size_t> position_distribution{37, 500};
+        for (size_t i = 0; i < 50; ++i)
+        {
+            size_t const position1 = position_distribution(engine);
+            size_t const position2 = position1 - 37;
+
+            for (int32_t const drop_score : {0, 3, 20, 1000})
+            {
+                EXPECT_EQ(seqan3::extend_ungapped(sequence1,
+                                                  sequence2,
+                                                  position1,
+                                                  position2,
+                                                  seqan3::match_score{1},
+                                                  seqan3::mismatch_score{-3},
+                                                  drop_score),
+                          naive_extend_ungapped(vector1,
+                                                std::vector<alphabet_t>(vector2.begin() + 37, vector2.end()),
+                                                position1,
+                                                position2,
+                                                1,
+                                                -3,
+                                                drop_score));
+            }
+        }
+    }
+}
+
+TYPED_TEST(extend_ungapped_test, unrelated_positions)
+{
+    using alphabet_t = std::ranges::range_value_t<TypeParam>;
+
+    std::mt19937_64 engine{7};
+    auto [vector1, vector2] = random_sequence_pair<alphabet_t>(engine, 300, 0.05);
+    TypeParam sequence1{vector1};
+    TypeParam sequence2{vector2};
+
+    for (size_t position1 : {0u, 1u, 63u, 64u, 65u, 150u, 299u, 300u})
+    {
+        for (size_t position2 : {0u, 31u, 32u, 100u, 300u})
+        {
+            EXPECT_EQ(seqan3::extend_ungapped(sequence1,
+                                              sequence2,
+                                              position1,
+                                              position2,
+                                              seqan3::match_score{2},
+                                              seqan3::mismatch_score{-1},
+                                              5),
+                      naive_extend_ungapped(vector1, vector2, position1, position2, 2, -1, 5));
+        }
+    }
+}
+
+TEST(extend_ungapped, mixed_sequence_types)
+{
+    std::vector<seqan3::dna4> sequence1 = "ACGTACGTTTTTACGTAAAAAAA"_dna4;
+    seqan3::bitpacked_sequence<seqan3::dna4> sequence2{"ACGTACGATTTTACGTCCCCCCC"_dna4};
+
+    // ACGTACGTTTTTACGT
+    // |||||||X||||||||
+    // ACGTACGATTTTACGT
+    seqan3::ungapped_extension_result const expected{.score = 13,
+                                                     .sequence1_begin_position = 0,
+                                                     .sequence1_end_position = 16,
+                                                     .sequence2_begin_position = 0,
+                                                     .sequence2_end_position = 16};
+
+    EXPECT_EQ(seqan3::extend_ungapped(sequence1,
+                                      sequence2,
+                                      10,
+                                      10,
+                                      seqan3::match_score{1},
+                                      seqan3::mismatch_score{-2},
+                                      3),
+              expected);
+    EXPECT_EQ(seqan3::extend_ungapped(sequence2,
+                                      sequence1,
+                                      10,
+                                      10,
+                                      seqan3::match_score{1},
+                                      seqan3::mismatch_score{-2},
+                                      3),
+              expected);
+}
+
+TEST(extend_ungapped, drop_off)
+{
+    std::vector<seqan3::dna4> sequence1 = "AAAAAAAAAACCCCAAAAAAAAAA"_dna4;
+    std::vector<seqan3::dna4> sequence2 = "AAAAAAAAAAGGGGAAAAAAAAAA"_dna4;
+
+    // Four mismatches drop the score by 8 below the best score of 10.
+    EXPECT_EQ(
+        seqan3::extend_ungapped(sequence1, sequence2, 0, 0, seqan3::match_score{1}, seqan3::mismatch_score{-2}, 7),
+        (seqan3::ungapped_extension_result{.score = 10,
+                                           .sequence1_begin_position = 0,
+                                           .sequence1_end_position = 10,
+                                           .sequence2_begin_position = 0,
+                                           .sequence2_end_position = 10}));
+    EXPECT_EQ(
+        seqan3::extend_ungapped(sequence1, sequence2, 0, 0, seqan3::match_score{1}, seqan3::mismatch_score{-2}, 8),
+        (seqan3::ungapped_extension_result{.score = 12,
+                                           .sequence1_begin_position = 0,
+                                           .sequence1_end_position = 24,
+                                           .sequence2_begin_position = 0,
+                                           .sequence2_end_position = 24}));
+
+    // Extending to the left from the end behaves the same.
+    EXPECT_EQ(
+        seqan3::extend_ungapped(sequence1, sequence2, 24, 24, seqan3::match_score{1}, seqan3::mismatch_score{-2}, 7),
+        (seqan3::ungapped_extension_result{.score = 10,
+                                           .sequence1_begin_position = 14,
+                                           .sequence1_end_position = 24,
+                                           .sequence2_begin_position = 14,
+                                           .sequence2_end_position = 24}));
+}
+
+TEST(extend_ungapped, mismatching_anchor)
+{
+    std::vector<seqan3::dna4> sequence1 = "ACGT"_dna4;
+    std::vector<seqan3::dna4> sequence2 = "TTTT"_dna4;
+
+    // The anchor itself is part of the extension to the right and does not need to match.
+    EXPECT_EQ(
+        seqan3::extend_ungapped(sequence1, sequence2, 2, 2, seqan3::match_score{2}, seqan3::mismatch_score{-1}, 10),
+        (seqan3::ungapped_extension_result{.score = 1,
+                                           .sequence1_begin_position = 2,
+                                           .sequence1_end_position = 4,
+                                           .sequence2_begin_position = 2,
+                                           .sequence2_end_position = 4}));
+}
+
+TEST(extend_ungapped, invalid_arguments)
+{
+    std::vector<seqan3::dna4> sequence = "ACGT"_dna4;
+
+    auto extend = [&](size_t position1, size_t position2, int32_t match, int32_t mismatch, int32_t drop_score)
+    {
+        return seqan3::extend_ungapped(sequence,
+                                       sequence,
+                                       position1,
+                                       position2,
+                                       seqan3::match_score{match},
+                                       seqan3::mismatch_score{mismatch},
+                                       drop_score);
+    };
+
+    EXPECT_THROW(extend(0, 0, 0, -1, 1), std::invalid_argument);
+    EXPECT_THROW(extend(0, 0, 1, 0, 1), std::invalid_argument);
+    EXPECT_THROW(extend(0, 0, 1, -1, -1), std::invalid_argument);
+    EXPECT_THROW(extend(5, 0, 1, -1, 1), std::out_of_range);
+    EXPECT_THROW(extend(0, 5, 1, -1, 1), std::out_of_range);
+    EXPECT_NO_THROW(extend(4, 4, 1, -1, 0));
+}
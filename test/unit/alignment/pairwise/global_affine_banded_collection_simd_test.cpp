@@ -7,6 +7,9 @@
 #include <vector>
 
 #include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/aminoacid_scoring_scheme.hpp>
+#include <seqan3/alphabet/aminoacid/aa27.hpp>
+#include <seqan3/utility/range/to.hpp>
 
 #include "fixture/global_affine_banded.hpp"
 #include "pairwise_alignment_collection_test_template.hpp"
@@ -34,3 +37,33 @@ using pairwise_collection_simd_global_affine_banded_testing_types = ::testing::T
 INSTANTIATE_TYPED_TEST_SUITE_P(pairwise_collection_simd_global_affine_banded,
                                pairwise_alignment_collection_test,
                                pairwise_collection_simd_global_affine_banded_testing_types, );
+
+// The banded vectorised algorithm must score the columns with the score profile of the scoring matrix.
+TEST(pairwise_collection_simd_global_affine_banded, aa27_scoring_matrix)
+{
+    using seqan3::operator""_aa27;
+
+    std::vector<std::pair<std::vector<seqan3::aa27>, std::vector<seqan3::aa27>>> sequences{};
+    for (size_t i = 0; i < 20; ++i)
+    {
+        sequences.emplace_back("ALIGATORCLAWHELPSTRIKEWILDTYPE"_aa27, "GALIGATORCLAWHELPSTRIKEMILD"_aa27);
+        sequences.emplace_back("WRYYHHHKKTTPMNDE"_aa27, "WRYHHHKKTTMNDE"_aa27);
+    }
+
+    auto const cfg = seqan3::align_cfg::method_global{}
+                   | seqan3::align_cfg::scoring_scheme{
+                       seqan3::aminoacid_scoring_scheme{seqan3::aminoacid_similarity_matrix::blosum62}}
+                   | seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-10},
+                                                        seqan3::align_cfg::extension_score{-1}}
+                   | seqan3::align_cfg::band_fixed_size{seqan3::align_cfg::lower_diagonal{-5},
+                                                        seqan3::align_cfg::upper_diagonal{5}}
+                   | seqan3::align_cfg::output_score{};
+
+    auto scalar_results = seqan3::align_pairwise(sequences, cfg) | seqan3::ranges::to<std::vector>();
+    auto simd_results =
+        seqan3::align_pairwise(sequences, cfg | seqan3::align_cfg::vectorised{}) | seqan3::ranges::to<std::vector>();
+
+    ASSERT_EQ(simd_results.size(), scalar_results.size());
+    for (size_t i = 0; i < simd_results.size(); ++i)
+        EXPECT_EQ(simd_results[i].score(), scalar_results[i].score()) << "pair " << i;
+}
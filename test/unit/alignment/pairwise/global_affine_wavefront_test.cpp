@@ -0,0 +1,328 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <ranges>
+#include <tuple>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_edit.hpp>
+#include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_method.hpp>
+#include <seqan3/alignment/configuration/align_config_output.hpp>
+#include <seqan3/alignment/configuration/align_config_parallel.hpp>
+#include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
+#include <seqan3/alignment/configuration/align_config_wavefront.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/aminoacid_scoring_scheme.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/aminoacid/aa27.hpp>
+#include <seqan3/alphabet/gap/gap.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/utility/views/zip.hpp>
+
+using seqan3::operator""_aa27;
+using seqan3::operator""_dna4;
+
+template <typename alphabet_t>
+std::vector<alphabet_t> random_sequence(std::mt19937_64 & engine, size_t const size)
+{
+    std::uniform_int_distribution<size_t> rank_distribution{0, seqan3::alphabet_size<alphabet_t> - 1};
+    std::vector<alphabet_t> sequence(size);
+    for (auto & letter : sequence)
+        seqan3::assign_rank_to(rank_distribution(engine), letter);
+    return sequence;
+}
+
+// The second sequence is a copy of the first sequence with some substitutions, insertions and deletions.
+template <typename alphabet_t>
+std::pair<std::vector<alphabet_t>, std::vector<alphabet_t>>
+similar_sequence_pair(std::mt19937_64 & engine, size_t const size, int const error_rate_percent)
+{
+    std::vector<alphabet_t> sequence1 = random_sequence<alphabet_t>(engine, size);
+    std::vector<alphabet_t> sequence2;
+    std::uniform_int_distribution<int> percent_distribution{0, 99};
+    std::uniform_int_distribution<int> operation_distribution{0, 2};
+
+    for (size_t i = 0; i < size; ++i)
+    {
+        if (percent_distribution(engine) >= error_rate_percent)
+        {
+            sequence2.push_back(sequence1[i]);
+            continue;
+        }
+
+        int const operation = operation_distribution(engine);
+        if (operation == 0) // substitution
+            sequence2.push_back(random_sequence<alphabet_t>(engine, 1)[0]);
+        else if (operation == 1) // insertion
+            sequence2.insert(sequence2.end(), {random_sequence<alphabet_t>(engine, 1)[0], sequence1[i]});
+        // operation == 2: deletion
+    }
+
+    return {std::move(sequence1), std::move(sequence2)};
+}
+
+// Recomputes the score of the alignment with affine gap costs.
+template <typename alignment_t, typename scheme_t>
+int alignment_score(alignment_t const & alignment, scheme_t const & scheme, int const open, int const extension)
+{
+    auto const & [gapped_sequence1, gapped_sequence2] = alignment;
+    EXPECT_EQ(std::ranges::distance(gapped_sequence1), std::ranges::distance(gapped_sequence2));
+
+    int score = 0;
+    bool gap_in_sequence1 = false;
+    bool gap_in_sequence2 = false;
+    auto it2 = std::ranges::begin(gapped_sequence2);
+    for (auto it1 = std::ranges::begin(gapped_sequence1); it1 != std::ranges::end(gapped_sequence1); ++it1, ++it2)
+    {
+        bool const is_gap1 = (*it1 == seqan3::gap{});
+        bool const is_gap2 = (*it2 == seqan3::gap{});
+        EXPECT_FALSE(is_gap1 && is_gap2);
+
+        if (is_gap1)
+            score += (gap_in_sequence1 ? 0 : open) + extension;
+        else if (is_gap2)
+            score += (gap_in_sequence2 ? 0 : open) + extension;
+        else
+            score += scheme.score((*it1).template convert_to<0>(), (*it2).template convert_to<0>());
+
+        gap_in_sequence1 = is_gap1;
+        gap_in_sequence2 = is_gap2;
+    }
+
+    return score;
+}
+
+// The wavefront alignment must compute the same score as the dynamic programming algorithm and an alignment of the
+// complete sequences with this score.
+template <typename sequence_t, typename scheme_t>
+void check_same_as_dynamic_programming(sequence_t & sequence1,
+                                       sequence_t & sequence2,
+                                       scheme_t const & scheme,
+                                       int const open = -10,
+                                       int const extension = -1)
+{
+    auto const output = seqan3::align_cfg::output_score{} | seqan3::align_cfg::output_end_position{}
+                      | seqan3::align_cfg::output_begin_position{} | seqan3::align_cfg::output_alignment{}
+                      | seqan3::align_cfg::output_sequence1_id{} | seqan3::align_cfg::output_sequence2_id{};
+    auto const gap = seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{open},
+                                                        seqan3::align_cfg::extension_score{extension}};
+    auto const cfg = seqan3::align_cfg::method_global{} | seqan3::align_cfg::scoring_scheme{scheme} | gap;
+
+    auto dp_results = seqan3::align_pairwise(std::tie(sequence1, sequence2), cfg | output);
+    auto wavefront_results =
+        seqan3::align_pairwise(std::tie(sequence1, sequence2), cfg | output | seqan3::align_cfg::wavefront{});
+    auto wavefront_score_results = seqan3::align_pairwise(std::tie(sequence1, sequence2),
+                                                          cfg | seqan3::align_cfg::output_score{}
+                                                              | seqan3::align_cfg::wavefront{});
+
+    auto dp_result = *dp_results.begin();
+    auto wavefront_result = *wavefront_results.begin();
+
+    EXPECT_EQ(wavefront_result.sequence1_id(), 0u);
+    EXPECT_EQ(wavefront_result.sequence2_id(), 0u);
+    EXPECT_EQ(wavefront_result.score(), dp_result.score());
+    EXPECT_EQ((*wavefront_score_results.begin()).score(), dp_result.score());
+    EXPECT_EQ(wavefront_result.sequence1_end_position(), sequence1.size());
+    EXPECT_EQ(wavefront_result.sequence2_end_position(), sequence2.size());
+    EXPECT_EQ(wavefront_result.sequence1_begin_position(), 0u);
+    EXPECT_EQ(wavefront_result.sequence2_begin_position(), 0u);
+    EXPECT_EQ(alignment_score(wavefront_result.alignment(), scheme, open, extension), wavefront_result.score());
+}
+
+auto dna4_scheme()
+{
+    return seqan3::nucleotide_scoring_scheme{seqan3::match_score{4}, seqan3::mismatch_score{-5}};
+}
+
+TEST(global_affine_wavefront, similar_sequences)
+{
+    std::mt19937_64 engine{42};
+    std::uniform_int_distribution<size_t> size_distribution{0, 300};
+
+    for (size_t round = 0; round < 50; ++round)
+    {
+        auto [sequence1, sequence2] = similar_sequence_pair<seqan3::dna4>(engine, size_distribution(engine), 5);
+
+        SCOPED_TRACE(testing::Message() << "round " << round);
+        check_same_as_dynamic_programming(sequence1, sequence2, dna4_scheme());
+    }
+}
+
+TEST(global_affine_wavefront, dissimilar_sequences)
+{
+    std::mt19937_64 engine{7};
+    std::uniform_int_distribution<size_t> size_distribution{0, 60};
+
+    for (size_t round = 0; round < 50; ++round)
+    {
+        auto sequence1 = random_sequence<seqan3::dna4>(engine, size_distribution(engine));
+        auto sequence2 = random_sequence<seqan3::dna4>(engine, size_distribution(engine));
+
+        SCOPED_TRACE(testing::Message() << "round " << round);
+        check_same_as_dynamic_programming(sequence1, sequence2, dna4_scheme());
+    }
+}
+
+TEST(global_affine_wavefront, gap_costs)
+{
+    std::mt19937_64 engine{11};
+
+    for (auto [open, extension] : {std::pair{0, -1}, std::pair{-10, -1}, std::pair{-5, -2}, std::pair{-1, -3}})
+    {
+        for (size_t round = 0; round < 10; ++round)
+        {
+            auto [sequence1, sequence2] = similar_sequence_pair<seqan3::dna4>(engine, 150, 10);
+
+            SCOPED_TRACE(testing::Message() << "open " << open << " extension " << extension << " round " << round);
+            check_same_as_dynamic_programming(sequence1,
+                                              sequence2,
+                                              seqan3::nucleotide_scoring_scheme{seqan3::match_score{2},
+                                                                                seqan3::mismatch_score{-3}},
+                                              open,
+                                              extension);
+        }
+    }
+}
+
+TEST(global_affine_wavefront, aa27)
+{
+    std::mt19937_64 engine{5};
+    seqan3::aminoacid_scoring_scheme scheme{seqan3::match_score{3}, seqan3::mismatch_score{-2}};
+
+    for (size_t round = 0; round < 20; ++round)
+    {
+        auto [sequence1, sequence2] = similar_sequence_pair<seqan3::aa27>(engine, 100, 5);
+
+        SCOPED_TRACE(testing::Message() << "round " << round);
+        check_same_as_dynamic_programming(sequence1, sequence2, scheme);
+    }
+}
+
+TEST(global_affine_wavefront, empty_sequences)
+{
+    std::vector<seqan3::dna4> empty{};
+    std::vector<seqan3::dna4> sequence{"ACGTACGT"_dna4};
+
+    check_same_as_dynamic_programming(empty, empty, dna4_scheme());
+    check_same_as_dynamic_programming(empty, sequence, dna4_scheme());
+    check_same_as_dynamic_programming(sequence, empty, dna4_scheme());
+}
+
+TEST(global_affine_wavefront, edit_distance)
+{
+    std::mt19937_64 engine{3};
+    std::vector<std::pair<std::vector<seqan3::dna4>, std::vector<seqan3::dna4>>> sequences{};
+    for (size_t round = 0; round < 20; ++round)
+        sequences.push_back(similar_sequence_pair<seqan3::dna4>(engine, 200, 10));
+
+    auto const cfg = seqan3::align_cfg::method_global{} | seqan3::align_cfg::edit_scheme
+                   | seqan3::align_cfg::output_score{} | seqan3::align_cfg::output_alignment{};
+
+    std::vector<int> edit_distance_scores{};
+    for (auto && result : seqan3::align_pairwise(sequences, cfg))
+        edit_distance_scores.push_back(result.score());
+
+    size_t index = 0;
+    for (auto && result : seqan3::align_pairwise(sequences, cfg | seqan3::align_cfg::wavefront{}))
+    {
+        EXPECT_EQ(result.score(), edit_distance_scores[index++]);
+
+        // Count the edit operations of the alignment.
+        int edits = 0;
+        for (auto && [letter1, letter2] : seqan3::views::zip(std::get<0>(result.alignment()),
+                                                              std::get<1>(result.alignment())))
+            edits += (letter1 != letter2);
+        EXPECT_EQ(-edits, result.score());
+    }
+    EXPECT_EQ(index, sequences.size());
+}
+
+TEST(global_affine_wavefront, parallel)
+{
+    std::mt19937_64 engine{9};
+    std::vector<std::pair<std::vector<seqan3::dna4>, std::vector<seqan3::dna4>>> sequences{};
+    for (size_t round = 0; round < 100; ++round)
+        sequences.push_back(similar_sequence_pair<seqan3::dna4>(engine, 100, 5));
+
+    auto const cfg = seqan3::align_cfg::method_global{} | seqan3::align_cfg::scoring_scheme{dna4_scheme()}
+                   | seqan3::align_cfg::output_score{} | seqan3::align_cfg::output_sequence1_id{}
+                   | seqan3::align_cfg::wavefront{};
+
+    std::vector<int> scores(sequences.size());
+    for (auto && result : seqan3::align_pairwise(sequences, cfg))
+        scores[result.sequence1_id()] = result.score();
+
+    size_t result_count = 0;
+    for (auto && result : seqan3::align_pairwise(sequences, cfg | seqan3::align_cfg::parallel{4}))
+    {
+        EXPECT_EQ(result.score(), scores[result.sequence1_id()]);
+        ++result_count;
+    }
+    EXPECT_EQ(result_count, sequences.size());
+}
+
+TEST(global_affine_wavefront, default_scoring_scheme_alphabet)
+{
+    // The nucleotide scoring scheme is defined over seqan3::dna15 and the dna4 letters are converted.
+    std::mt19937_64 engine{1};
+    auto [sequence1, sequence2] = similar_sequence_pair<seqan3::dna4>(engine, 100, 5);
+    check_same_as_dynamic_programming(sequence1, sequence2, seqan3::nucleotide_scoring_scheme<int8_t>{});
+}
+
+TEST(global_affine_wavefront, invalid_configuration)
+{
+    std::vector<seqan3::dna4> sequence1{"ACGTACGT"_dna4};
+    std::vector<seqan3::dna4> sequence2{"ACGTCGT"_dna4};
+    auto const gap = seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-10},
+                                                        seqan3::align_cfg::extension_score{-1}};
+    auto const output = seqan3::align_cfg::output_score{} | seqan3::align_cfg::wavefront{};
+
+    auto align = [&](auto const & cfg)
+    {
+        return seqan3::align_pairwise(std::tie(sequence1, sequence2), cfg);
+    };
+
+    // Free end gaps.
+    EXPECT_THROW(align(seqan3::align_cfg::method_global{seqan3::align_cfg::free_end_gaps_sequence1_leading{true},
+                                                        seqan3::align_cfg::free_end_gaps_sequence2_leading{false},
+                                                        seqan3::align_cfg::free_end_gaps_sequence1_trailing{false},
+                                                        seqan3::align_cfg::free_end_gaps_sequence2_trailing{false}}
+                       | seqan3::align_cfg::scoring_scheme{dna4_scheme()} | gap | output),
+                 seqan3::invalid_alignment_configuration);
+
+    // A scoring matrix.
+    std::vector<seqan3::aa27> protein{"ACDEFGHIKLMNPQRSTVWY"_aa27};
+    EXPECT_THROW(seqan3::align_pairwise(std::tie(protein, protein),
+                                        seqan3::align_cfg::method_global{}
+                                            | seqan3::align_cfg::scoring_scheme{seqan3::aminoacid_scoring_scheme{
+                                                seqan3::aminoacid_similarity_matrix::blosum62}}
+                                            | gap | output),
+                 seqan3::invalid_alignment_configuration);
+
+    // The mismatch score is not smaller than the match score.
+    EXPECT_THROW(align(seqan3::align_cfg::method_global{}
+                       | seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{
+                           seqan3::match_score{-1},
+                           seqan3::mismatch_score{-1}}}
+                       | gap | output),
+                 seqan3::invalid_alignment_configuration);
+
+    // A positive gap open score.
+    EXPECT_THROW(align(seqan3::align_cfg::method_global{} | seqan3::align_cfg::scoring_scheme{dna4_scheme()}
+                       | seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{1},
+                                                            seqan3::align_cfg::extension_score{-1}}
+                       | output),
+                 seqan3::invalid_alignment_configuration);
+
+    // Twice the gap extension score is not smaller than the match score.
+    EXPECT_THROW(align(seqan3::align_cfg::method_global{} | seqan3::align_cfg::scoring_scheme{dna4_scheme()}
+                       | seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-10},
+                                                            seqan3::align_cfg::extension_score{2}}
+                       | output),
+                 seqan3::invalid_alignment_configuration);
+}
@@ -0,0 +1,60 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+
+#include "fixture/local_affine_unbanded.hpp"
+#include "pairwise_alignment_collection_test_template.hpp"
+
+namespace seqan3::test::alignment::collection::simd::local::affine::unbanded
+{
+
+static auto dna4_all_same = []()
+{
+    auto base_fixture = fixture::local::affine::unbanded::dna4_01;
+    using fixture_t = decltype(base_fixture);
+
+    std::vector<fixture_t> data{};
+    for (size_t i = 0; i < 100; ++i)
+        data.push_back(base_fixture);
+
+    return alignment_fixture_collection{base_fixture.config | seqan3::align_cfg::vectorised{}, data};
+}();
+
+// The short pairs are padded to the length of the long pairs. The padded parts must not form a local alignment.
+static auto dna4_different_length = []()
+{
+    auto base_fixture_01 = fixture::local::affine::unbanded::dna4_01;
+    auto base_fixture_02 = fixture::local::affine::unbanded::dna4_02;
+    auto base_fixture_03 = fixture::local::affine::unbanded::dna4_04;
+    auto base_fixture_04 = fixture::local::affine::unbanded::dna4_05;
+
+    using fixture_t = decltype(base_fixture_01);
+
+    std::vector<fixture_t> data{};
+    for (size_t i = 0; i < 25; ++i)
+    {
+        data.push_back(base_fixture_01);
+        data.push_back(base_fixture_02);
+        data.push_back(base_fixture_03);
+        data.push_back(base_fixture_04);
+    }
+
+    return alignment_fixture_collection{base_fixture_01.config | seqan3::align_cfg::vectorised{}, data};
+}();
+
+} // namespace seqan3::test::alignment::collection::simd::local::affine::unbanded
+
+using pairwise_collection_simd_local_affine_unbanded_testing_types = ::testing::Types<
+    pairwise_alignment_fixture<&seqan3::test::alignment::collection::simd::local::affine::unbanded::dna4_all_same>,
+    pairwise_alignment_fixture<
+        &seqan3::test::alignment::collection::simd::local::affine::unbanded::dna4_different_length>>;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(pairwise_collection_simd_local_affine_unbanded,
+                               pairwise_alignment_collection_test,
+                               pairwise_collection_simd_local_affine_unbanded_testing_types, );
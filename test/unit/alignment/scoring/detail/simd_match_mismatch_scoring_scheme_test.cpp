@@ -4,8 +4,11 @@
 
 #include <gtest/gtest.h>
 
+#include <array>
+
 #include <seqan3/alignment/scoring/detail/simd_match_mismatch_scoring_scheme.hpp>
 #include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/nucleotide/dna15.hpp>
 #include <seqan3/alphabet/nucleotide/dna4.hpp>
 #include <seqan3/core/debug_stream/range.hpp>
 #include <seqan3/test/pretty_printing.hpp>
@@ -200,3 +203,37 @@ TYPED_TEST(simd_match_mismatch_scoring_scheme_test, score_local_with_padding)
     simd_value2[0] = 3;
     SIMD_EQ(scheme.score(simd_value1, simd_value2), result);
 }
+
+// Scores overlapping IUPAC symbols with 1, equal symbols with 5 and all other pairs with -4.
+seqan3::nucleotide_scoring_scheme<int8_t> iupac_scoring_scheme()
+{
+    // The bases represented by the symbols of seqan3::dna15 in rank order (A = 1, C = 2, G = 4, T = 8).
+    constexpr std::array<int, 15> bases{1, 14, 2, 13, 4, 11, 12, 3, 15, 5, 6, 8, 7, 9, 10};
+
+    seqan3::nucleotide_scoring_scheme<int8_t>::matrix_type matrix{};
+    for (size_t rank1 = 0; rank1 < bases.size(); ++rank1)
+        for (size_t rank2 = 0; rank2 < bases.size(); ++rank2)
+            matrix[rank1][rank2] = (rank1 == rank2) ? 5 : ((bases[rank1] & bases[rank2]) ? 1 : -4);
+
+    return seqan3::nucleotide_scoring_scheme{matrix};
+}
+
+TYPED_TEST(simd_match_mismatch_scoring_scheme_test, has_only_match_and_mismatch_scores)
+{
+    using scheme_t =
+        seqan3::detail::simd_match_mismatch_scoring_scheme<TypeParam, seqan3::dna15, seqan3::align_cfg::method_global>;
+
+    EXPECT_TRUE(scheme_t::has_only_match_and_mismatch_scores(
+        seqan3::nucleotide_scoring_scheme{seqan3::match_score{4}, seqan3::mismatch_score{-5}}));
+    EXPECT_FALSE(scheme_t::has_only_match_and_mismatch_scores(iupac_scoring_scheme()));
+    EXPECT_FALSE(scheme_t::uses_scoring_matrix());
+}
+
+TYPED_TEST(simd_match_mismatch_scoring_scheme_test, construct_from_scoring_matrix_throw)
+{
+    // A scoring scheme with more than one match or mismatch score needs seqan3::detail::simd_matrix_scoring_scheme.
+    using scheme_t =
+        seqan3::detail::simd_match_mismatch_scoring_scheme<TypeParam, seqan3::dna15, seqan3::align_cfg::method_global>;
+
+    EXPECT_THROW(scheme_t{iupac_scoring_scheme()}, std::invalid_argument);
+}
@@ -4,9 +4,13 @@
 
 #include <gtest/gtest.h>
 
+#include <array>
+
 #include <seqan3/alignment/scoring/aminoacid_scoring_scheme.hpp>
 #include <seqan3/alignment/scoring/detail/simd_matrix_scoring_scheme.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
 #include <seqan3/alphabet/aminoacid/aa27.hpp>
+#include <seqan3/alphabet/nucleotide/dna15.hpp>
 #include <seqan3/core/debug_stream/range.hpp>
 #include <seqan3/test/pretty_printing.hpp>
 #include <seqan3/test/simd_utility.hpp>
@@ -227,3 +231,52 @@ TYPED_TEST(simd_matrix_scoring_scheme_test, score_local_with_padding)
         SIMD_EQ(scheme.score(scheme.make_score_profile(simd_value1), simd_value2), result);
     }
 }
+
+// Scores overlapping IUPAC symbols with 1, equal symbols with 5 and all other pairs with -4.
+seqan3::nucleotide_scoring_scheme<int8_t> iupac_scoring_scheme()
+{
+    // The bases represented by the symbols of seqan3::dna15 in rank order (A = 1, C = 2, G = 4, T = 8).
+    constexpr std::array<int, 15> bases{1, 14, 2, 13, 4, 11, 12, 3, 15, 5, 6, 8, 7, 9, 10};
+
+    seqan3::nucleotide_scoring_scheme<int8_t>::matrix_type matrix{};
+    for (size_t rank1 = 0; rank1 < bases.size(); ++rank1)
+        for (size_t rank2 = 0; rank2 < bases.size(); ++rank2)
+            matrix[rank1][rank2] = (rank1 == rank2) ? 5 : ((bases[rank1] & bases[rank2]) ? 1 : -4);
+
+    return seqan3::nucleotide_scoring_scheme{matrix};
+}
+
+TYPED_TEST(simd_matrix_scoring_scheme_test, score_small_alphabet)
+{
+    // The scores of small alphabets are looked up with byte shuffles if possible.
+    auto const scalar_scheme = iupac_scoring_scheme();
+    constexpr size_t simd_length = seqan3::simd_traits<TypeParam>::length;
+    constexpr size_t symbol_count = seqan3::alphabet_size<seqan3::dna15> + 1; // including the padding symbol
+
+    auto check = [&]<typename alignment_t>(alignment_t, int8_t const padding_score)
+    {
+        using scheme_t = seqan3::detail::simd_matrix_scoring_scheme<TypeParam, seqan3::dna15, alignment_t>;
+        scheme_t scheme{scalar_scheme};
+
+        for (size_t rank1 = 0; rank1 < symbol_count; ++rank1)
+        {
+            TypeParam simd_value1 = seqan3::simd::fill<TypeParam>(rank1);
+            TypeParam simd_value2{};
+            TypeParam result{};
+            for (size_t i = 0; i < simd_length; ++i)
+            {
+                size_t const rank2 = (rank1 + i) % symbol_count;
+                simd_value2[i] = rank2;
+                result[i] = (rank1 == scheme.padding_symbol || rank2 == scheme.padding_symbol)
+                              ? padding_score
+                              : scalar_scheme.score(seqan3::assign_rank_to(rank1, seqan3::dna15{}),
+                                                    seqan3::assign_rank_to(rank2, seqan3::dna15{}));
+            }
+
+            SIMD_EQ(scheme.score(scheme.make_score_profile(simd_value1), simd_value2), result);
+        }
+    };
+
+    check(seqan3::align_cfg::method_global{}, 1);
+    check(seqan3::align_cfg::method_local{}, -1);
+}
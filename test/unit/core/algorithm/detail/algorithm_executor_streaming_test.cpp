@@ -0,0 +1,218 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <numeric>
+#include <ranges>
+#include <string>
+#include <thread>
+
+#include <seqan3/core/algorithm/detail/algorithm_executor_streaming.hpp>
+#include <seqan3/test/pretty_printing.hpp>
+#include <seqan3/utility/views/zip.hpp>
+
+// A dummy algorithm that just counts the number of equal characters in two sequences.
+struct dummy_algorithm
+{
+    template <typename sequences_t, typename callback_t>
+    constexpr void operator()(sequences_t && sequence_pairs, callback_t && callback) const
+    {
+        auto && [first_seq, second_seq] = sequence_pairs;
+
+        size_t count = 0;
+        for (auto && [lhs, rhs] : seqan3::views::zip(first_seq, second_seq))
+            if (lhs == rhs)
+                ++count;
+
+        if (count != 0) // Simulating not to call the callback without a result.
+            callback(count);
+    }
+};
+
+using sequence_pair_t = std::pair<std::string, std::string>;
+using sequence_pairs_t = std::vector<sequence_pair_t>;
+using algorithm_t = std::function<void(sequence_pair_t &, std::function<void(size_t)>)>;
+using executor_t = seqan3::detail::algorithm_executor_streaming<sequence_pairs_t &, algorithm_t, size_t>;
+
+struct algorithm_executor_streaming_test : public ::testing::Test
+{
+    sequence_pair_t sequence_pair{"AACGTACGT", "ATCGTCCGT"}; // Hamming distance is 7
+    sequence_pairs_t sequence_pairs{5, sequence_pair};
+
+    // Do not use more than 4 threads.
+    seqan3::detail::execution_handler_parallel execution_handler()
+    {
+        return seqan3::detail::execution_handler_parallel{std::min<uint32_t>(4, std::thread::hardware_concurrency())};
+    }
+};
+
+TEST_F(algorithm_executor_streaming_test, construction)
+{
+    EXPECT_FALSE(std::is_default_constructible_v<executor_t>);
+    EXPECT_FALSE(std::is_copy_constructible_v<executor_t>);
+    EXPECT_TRUE(std::is_move_constructible_v<executor_t>);
+    EXPECT_FALSE(std::is_copy_assignable_v<executor_t>);
+    EXPECT_TRUE(std::is_move_assignable_v<executor_t>);
+
+    EXPECT_THROW((executor_t{this->sequence_pairs, algorithm_t{dummy_algorithm{}}, 0u, this->execution_handler(), 0u}),
+                 std::invalid_argument);
+}
+
+TEST_F(algorithm_executor_streaming_test, type_deduction)
+{
+    seqan3::detail::algorithm_executor_streaming exec{this->sequence_pairs,
+                                                      algorithm_t{dummy_algorithm{}},
+                                                      size_t{},
+                                                      this->execution_handler(),
+                                                      2u};
+    EXPECT_TRUE((std::same_as<decltype(exec), executor_t>));
+    EXPECT_FALSE(exec.is_eof());
+}
+
+TEST_F(algorithm_executor_streaming_test, next_result)
+{
+    // The buffer is smaller than the resource.
+    executor_t exec{this->sequence_pairs, algorithm_t{dummy_algorithm{}}, 0u, this->execution_handler(), 2u};
+
+    EXPECT_EQ(exec.next_result().value(), 7u);
+    EXPECT_EQ(exec.next_result().value(), 7u);
+    EXPECT_EQ(exec.next_result().value(), 7u);
+    EXPECT_EQ(exec.next_result().value(), 7u);
+    EXPECT_EQ(exec.next_result().value(), 7u);
+    EXPECT_FALSE(static_cast<bool>(exec.next_result()));
+    EXPECT_TRUE(exec.is_eof());
+}
+
+TEST_F(algorithm_executor_streaming_test, move_assignment)
+{
+    executor_t exec{this->sequence_pairs, algorithm_t{dummy_algorithm{}}, 0u, this->execution_handler(), 2u};
+    executor_t exec_move_assigned{this->sequence_pairs,
+                                  algorithm_t{dummy_algorithm{}},
+                                  0u,
+                                  this->execution_handler(),
+                                  3u};
+
+    EXPECT_EQ(exec.next_result().value(), 7u); // Moves with running invocations.
+    exec_move_assigned = std::move(exec);
+
+    EXPECT_EQ(exec_move_assigned.next_result().value(), 7u);
+    EXPECT_EQ(exec_move_assigned.next_result().value(), 7u);
+
+    executor_t exec_move_constructed{std::move(exec_move_assigned)};
+    EXPECT_EQ(exec_move_constructed.next_result().value(), 7u);
+    EXPECT_EQ(exec_move_constructed.next_result().value(), 7u);
+    EXPECT_FALSE(static_cast<bool>(exec_move_constructed.next_result()));
+}
+
+TEST_F(algorithm_executor_streaming_test, empty_result_bucket)
+{
+    this->sequence_pairs[0].first = "";
+    this->sequence_pairs[3].first = "";
+    executor_t exec{this->sequence_pairs, algorithm_t{dummy_algorithm{}}, 0u, this->execution_handler(), 1u};
+
+    EXPECT_EQ(exec.next_result().value(), 7u);
+    EXPECT_EQ(exec.next_result().value(), 7u);
+    EXPECT_EQ(exec.next_result().value(), 7u);
+    EXPECT_FALSE(static_cast<bool>(exec.next_result()));
+}
+
+TEST_F(algorithm_executor_streaming_test, input_order)
+{
+    std::vector<size_t> input(1000);
+    std::iota(input.begin(), input.end(), 0u);
+
+    using callback_t = std::function<void(size_t)>;
+    std::function algorithm = [](size_t const value, callback_t && callback)
+    {
+        if (value % 3 != 0)
+        {
+            callback(value);
+            callback(value);
+        }
+    };
+
+    seqan3::detail::algorithm_executor_streaming exec{input, algorithm, size_t{}, this->execution_handler(), 7u};
+
+    std::vector<size_t> results{};
+    for (auto result = exec.next_result(); result.has_value(); result = exec.next_result())
+        results.push_back(*result);
+
+    std::vector<size_t> expected{};
+    for (size_t value : input)
+        if (value % 3 != 0)
+            expected.insert(expected.end(), 2, value);
+
+    EXPECT_EQ(results, expected);
+}
+
+TEST_F(algorithm_executor_streaming_test, completion_order)
+{
+    std::vector<size_t> input(100);
+    std::iota(input.begin(), input.end(), 0u);
+
+    // The first invocation blocks one thread until the other thread computed two further invocations. Hence, the
+    // invocation computed first by the other thread has finished before the first one.
+    std::atomic<size_t> computed{0};
+    using callback_t = std::function<void(size_t)>;
+    std::function algorithm = [&computed](size_t const value, callback_t && callback)
+    {
+        if (value == 0)
+            while (computed < 2)
+                std::this_thread::sleep_for(std::chrono::milliseconds{1});
+
+        callback(value);
+        ++computed;
+    };
+
+    seqan3::detail::algorithm_executor_streaming exec{input,
+                                                      algorithm,
+                                                      size_t{},
+                                                      seqan3::detail::execution_handler_parallel{2u},
+                                                      4u,
+                                                      seqan3::detail::parallel_result_order::completion};
+
+    std::vector<size_t> results{};
+    for (auto result = exec.next_result(); result.has_value(); result = exec.next_result())
+        results.push_back(*result);
+
+    EXPECT_NE(results.front(), 0u);
+    std::ranges::sort(results);
+    EXPECT_EQ(results, input);
+}
+
+TEST_F(algorithm_executor_streaming_test, bounded_buffer)
+{
+    std::vector<size_t> input(1000);
+    std::iota(input.begin(), input.end(), 0u);
+
+    // Counts the invocations that have been started but whose results were not consumed.
+    std::atomic<size_t> unconsumed{0};
+    std::atomic<size_t> max_unconsumed{0};
+    using callback_t = std::function<void(size_t)>;
+    std::function algorithm = [&](size_t const value, callback_t && callback)
+    {
+        size_t const current = ++unconsumed;
+        size_t expected = max_unconsumed.load();
+        while (current > expected && !max_unconsumed.compare_exchange_weak(expected, current))
+        {}
+
+        callback(value);
+    };
+
+    seqan3::detail::algorithm_executor_streaming exec{input, algorithm, size_t{}, this->execution_handler(), 8u};
+
+    size_t count = 0;
+    for (auto result = exec.next_result(); result.has_value(); result = exec.next_result())
+    {
+        EXPECT_EQ(*result, count++);
+        --unconsumed;
+    }
+
+    EXPECT_EQ(count, input.size());
+    EXPECT_LE(max_unconsumed.load(), 8u);
+}
@@ -8,6 +8,7 @@
 
 #include <seqan3/core/configuration/configuration.hpp>
 #include <seqan3/search/configuration/parallel.hpp>
+#include <seqan3/utility/parallel/thread_pool.hpp>
 
 TEST(search_config_parallel, member_variable)
 {
@@ -27,6 +28,27 @@ TEST(search_config_parallel, member_variable)
         cfg.thread_count = 4;
         EXPECT_EQ(cfg.thread_count.value(), 4u);
     }
+
+    { // default buffer size and result order
+        seqan3::search_cfg::parallel cfg{4};
+        EXPECT_FALSE(cfg.buffer_size);
+        EXPECT_EQ(cfg.order, seqan3::search_cfg::parallel::result_order::input);
+    }
+
+    { // construct with buffer size and result order
+        seqan3::search_cfg::parallel cfg{4, 32u, seqan3::search_cfg::parallel::result_order::completion};
+        EXPECT_EQ(cfg.thread_count.value(), 4u);
+        EXPECT_EQ(cfg.buffer_size.value(), 32u);
+        EXPECT_EQ(cfg.order, seqan3::search_cfg::parallel::result_order::completion);
+    }
+
+    { // construct from thread pool
+        seqan3::thread_pool pool{2};
+        seqan3::search_cfg::parallel cfg{pool, 32u};
+        EXPECT_EQ(cfg.pool, &pool);
+        EXPECT_EQ(cfg.thread_count.value(), 2u);
+        EXPECT_EQ(cfg.buffer_size.value(), 32u);
+    }
 }
 
 TEST(search_config_parallel, config_element)
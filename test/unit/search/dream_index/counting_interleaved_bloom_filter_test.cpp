@@ -0,0 +1,207 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include <seqan3/search/dream_index/counting_interleaved_bloom_filter.hpp>
+#include <seqan3/test/cereal.hpp>
+#include <seqan3/test/expect_range_eq.hpp>
+
+template <typename cibf_type>
+struct counting_interleaved_bloom_filter_test : public ::testing::Test
+{};
+
+using cibf_types = ::testing::Types<seqan3::counting_interleaved_bloom_filter<4>,
+                                    seqan3::counting_interleaved_bloom_filter<8>>;
+
+TYPED_TEST_SUITE(counting_interleaved_bloom_filter_test, cibf_types, );
+
+TYPED_TEST(counting_interleaved_bloom_filter_test, construction)
+{
+    EXPECT_TRUE(std::is_default_constructible_v<TypeParam>);
+    EXPECT_TRUE(std::is_copy_constructible_v<TypeParam>);
+    EXPECT_TRUE(std::is_move_constructible_v<TypeParam>);
+    EXPECT_TRUE(std::is_copy_assignable_v<TypeParam>);
+    EXPECT_TRUE(std::is_move_assignable_v<TypeParam>);
+    EXPECT_TRUE(std::is_destructible_v<TypeParam>);
+
+    // num hash functions defaults to two
+    TypeParam cibf1{seqan3::bin_count{64u}, seqan3::bin_size{1024u}};
+    TypeParam cibf2{seqan3::bin_count{64u}, seqan3::bin_size{1024u}, seqan3::hash_function_count{2u}};
+    EXPECT_TRUE(cibf1 == cibf2);
+
+    // bin_size parameter is too small
+    EXPECT_THROW((TypeParam{seqan3::bin_count{64u}, seqan3::bin_size{0u}}), std::logic_error);
+    // not enough bins
+    EXPECT_THROW((TypeParam{seqan3::bin_count{0u}, seqan3::bin_size{32u}}), std::logic_error);
+    // not enough hash functions
+    EXPECT_THROW((TypeParam{seqan3::bin_count{64u}, seqan3::bin_size{32u}, seqan3::hash_function_count{0u}}),
+                 std::logic_error);
+    // too many hash functions
+    EXPECT_THROW((TypeParam{seqan3::bin_count{64u}, seqan3::bin_size{32u}, seqan3::hash_function_count{6u}}),
+                 std::logic_error);
+}
+
+TYPED_TEST(counting_interleaved_bloom_filter_test, member_getter)
+{
+    constexpr size_t width = TypeParam::counter_width;
+
+    TypeParam t1{seqan3::bin_count{64u}, seqan3::bin_size{1024u}};
+    EXPECT_EQ(t1.bin_count(), 64u);
+    EXPECT_EQ(t1.bin_size(), 1024u);
+    EXPECT_EQ(t1.bit_size(), 65536ull * width);
+    EXPECT_EQ(t1.hash_function_count(), 2u);
+
+    TypeParam t2{seqan3::bin_count{73u}, seqan3::bin_size{1019u}, seqan3::hash_function_count{3u}};
+    EXPECT_EQ(t2.bin_count(), 73u);
+    EXPECT_EQ(t2.bin_size(), 1019u);
+    EXPECT_EQ(t2.bit_size(), 130432ull * width);
+    EXPECT_EQ(t2.hash_function_count(), 3u);
+}
+
+TYPED_TEST(counting_interleaved_bloom_filter_test, count_empty)
+{
+    TypeParam cibf{seqan3::bin_count{73u}, seqan3::bin_size{1024u}};
+    std::vector<uint8_t> expected(73, 0u);
+    auto agent = cibf.counting_agent();
+
+    for (size_t hash : std::views::iota(0, 64))
+        EXPECT_RANGE_EQ(agent.count(hash), expected);
+}
+
+TYPED_TEST(counting_interleaved_bloom_filter_test, emplace)
+{
+    TypeParam cibf{seqan3::bin_count{64u}, seqan3::bin_size{8192u}, seqan3::hash_function_count{2u}};
+
+    // Bin `b` contains each value `b % 8` times.
+    for (size_t bin_idx : std::views::iota(0, 64))
+        for (size_t count = 0; count < bin_idx % 8; ++count)
+            for (size_t hash : std::views::iota(0, 64))
+                cibf.emplace(hash, seqan3::bin_index{bin_idx});
+
+    auto agent = cibf.counting_agent();
+    std::vector<uint8_t> expected(64);
+    for (size_t bin_idx = 0; bin_idx < 64; ++bin_idx)
+        expected[bin_idx] = bin_idx % 8;
+
+    for (size_t hash : std::views::iota(0, 64))
+        EXPECT_RANGE_EQ(agent.count(hash), expected);
+}
+
+TYPED_TEST(counting_interleaved_bloom_filter_test, saturation)
+{
+    constexpr size_t counter_max = (1u << TypeParam::counter_width) - 1u;
+
+    TypeParam cibf{seqan3::bin_count{8u}, seqan3::bin_size{1024u}};
+
+    for (size_t count = 0; count < counter_max + 10u; ++count)
+        cibf.emplace(42u, seqan3::bin_index{3u});
+
+    auto agent = cibf.counting_agent();
+    EXPECT_RANGE_EQ(agent.count(42u), (std::vector<uint8_t>{0, 0, 0, counter_max, 0, 0, 0, 0}));
+}
+
+// The vectorised minimum must agree with the minimum over the raw counters.
+TYPED_TEST(counting_interleaved_bloom_filter_test, count_matches_counters)
+{
+    std::mt19937_64 engine{42u};
+
+    for (size_t bins : {1u, 73u, 200u})
+    {
+        for (size_t hash_funs = 1; hash_funs <= 5; ++hash_funs)
+        {
+            // A small bin size provokes collisions, i.e. counts that depend on the minimum.
+            TypeParam cibf{seqan3::bin_count{bins}, seqan3::bin_size{61u}, seqan3::hash_function_count{hash_funs}};
+            size_t const technical_bins = cibf.bit_size() / TypeParam::counter_width / cibf.bin_size();
+
+            for (size_t i = 0; i < 20 * bins; ++i)
+                cibf.emplace(engine() % 100u, seqan3::bin_index{engine() % bins});
+
+            // Recover the positions of each value by inserting it into an otherwise empty filter.
+            TypeParam probe{seqan3::bin_count{bins}, seqan3::bin_size{61u}, seqan3::hash_function_count{hash_funs}};
+            auto agent = cibf.counting_agent();
+
+            for (size_t value = 0; value < 100u; ++value)
+            {
+                probe.emplace(value, seqan3::bin_index{0u});
+
+                std::vector<uint8_t> expected(bins, std::numeric_limits<uint8_t>::max());
+                for (size_t row = 0; row < cibf.bin_size(); ++row)
+                {
+                    if (probe.raw_data()[row * technical_bins] == 0u)
+                        continue;
+
+                    for (size_t bin = 0; bin < bins; ++bin)
+                        expected[bin] =
+                            std::min<uint8_t>(expected[bin], cibf.raw_data()[row * technical_bins + bin]);
+                }
+
+                EXPECT_RANGE_EQ(agent.count(value), expected);
+                probe.clear(seqan3::bin_index{0u});
+            }
+        }
+    }
+}
+
+TYPED_TEST(counting_interleaved_bloom_filter_test, clear)
+{
+    TypeParam cibf{seqan3::bin_count{64u}, seqan3::bin_size{8192u}, seqan3::hash_function_count{2u}};
+
+    for (size_t bin_idx : std::views::iota(0, 64))
+        for (size_t hash : std::views::iota(0, 64))
+            cibf.emplace(hash, seqan3::bin_index{bin_idx});
+
+    cibf.clear(seqan3::bin_index{17u});
+
+    auto agent = cibf.counting_agent();
+    std::vector<uint8_t> expected(64, 1u);
+    expected[17] = 0u;
+    for (size_t hash : std::views::iota(0, 64))
+        EXPECT_RANGE_EQ(agent.count(hash), expected);
+}
+
+TYPED_TEST(counting_interleaved_bloom_filter_test, clear_range)
+{
+    TypeParam cibf{seqan3::bin_count{64u}, seqan3::bin_size{8192u}, seqan3::hash_function_count{2u}};
+
+    for (size_t bin_idx : std::views::iota(0, 64))
+        for (size_t hash : std::views::iota(0, 64))
+            cibf.emplace(hash, seqan3::bin_index{bin_idx});
+
+    std::vector<seqan3::bin_index> bin_range{seqan3::bin_index{0u},
+                                             seqan3::bin_index{3u},
+                                             seqan3::bin_index{9u},
+                                             seqan3::bin_index{12u}};
+    cibf.clear(bin_range);
+
+    auto agent = cibf.counting_agent();
+    std::vector<uint8_t> expected(64, 1u);
+    expected[0] = expected[3] = expected[9] = expected[12] = 0u;
+    for (size_t hash : std::views::iota(0, 64))
+        EXPECT_RANGE_EQ(agent.count(hash), expected);
+}
+
+TYPED_TEST(counting_interleaved_bloom_filter_test, counting_agent)
+{
+    TypeParam cibf{seqan3::bin_count{73u}, seqan3::bin_size{1024u}};
+    cibf.emplace(7u, seqan3::bin_index{72u});
+
+    auto agent = cibf.counting_agent();
+    auto agent2 = agent; // Copies are independent.
+    std::vector<uint8_t> expected(73, 0u);
+    expected[72] = 1u;
+    EXPECT_RANGE_EQ(agent.count(7u), expected);
+    EXPECT_RANGE_EQ(agent2.count(7u), expected);
+}
+
+TYPED_TEST(counting_interleaved_bloom_filter_test, serialisation)
+{
+    TypeParam cibf{seqan3::bin_count{73u}, seqan3::bin_size{1024u}, seqan3::hash_function_count{3u}};
+    cibf.emplace(1u, seqan3::bin_index{3u});
+    cibf.emplace(1u, seqan3::bin_index{3u});
+    cibf.emplace(9u, seqan3::bin_index{70u});
+    seqan3::test::do_serialisation(cibf);
+}
@@ -7,6 +7,7 @@
 #include <seqan3/search/dream_index/interleaved_bloom_filter.hpp>
 #include <seqan3/test/cereal.hpp>
 #include <seqan3/test/expect_range_eq.hpp>
+#include <seqan3/test/tmp_directory.hpp>
 
 template <typename ibf_type>
 struct interleaved_bloom_filter_test : public ::testing::Test
@@ -302,6 +303,41 @@ TYPED_TEST(interleaved_bloom_filter_test, counting_agent_no_ub)
     EXPECT_RANGE_EQ(agent2.bulk_count(std::views::iota(0u, 128u)), expected);
 }
 
+TYPED_TEST(interleaved_bloom_filter_test, counting_agent_membership_for)
+{
+    // 1. Test uncompressed interleaved_bloom_filter directly because the compressed one is not mutable.
+    seqan3::interleaved_bloom_filter ibf{seqan3::bin_count{130u},
+                                         seqan3::bin_size{8192u},
+                                         seqan3::hash_function_count{2u}};
+
+    // Bin `i` contains every value `v` with `v % (i % 7 + 1) == 0`, i.e. the bins contain different numbers of values.
+    for (size_t bin_idx : std::views::iota(0, 130))
+        for (size_t hash : std::views::iota(0, 200))
+            if (hash % (bin_idx % 7 + 1) == 0)
+                ibf.emplace(hash, seqan3::bin_index{bin_idx});
+
+    // 2. Construct either the uncompressed or compressed interleaved_bloom_filter and compare membership_for to
+    //    filtering the result of bulk_count.
+    TypeParam ibf2{ibf};
+    auto agent = ibf2.template counting_agent<size_t>();
+    auto threshold_agent = ibf2.template counting_agent<size_t>();
+
+    for (auto && values : {std::views::iota(0u, 100u), std::views::iota(50u, 250u), std::views::iota(0u, 0u)})
+    {
+        auto & counts = agent.bulk_count(values);
+
+        for (size_t threshold : {0u, 1u, 10u, 20u, 34u, 50u, 99u, 100u, 101u, 200u, 201u})
+        {
+            std::vector<size_t> expected{};
+            for (size_t bin = 0; bin < counts.size(); ++bin)
+                if (counts[bin] >= threshold)
+                    expected.push_back(bin);
+
+            EXPECT_RANGE_EQ(threshold_agent.membership_for(values, threshold), expected);
+        }
+    }
+}
+
 TYPED_TEST(interleaved_bloom_filter_test, increase_bin_number_to)
 {
     seqan3::interleaved_bloom_filter ibf1{seqan3::bin_count{73u}, seqan3::bin_size{1024u}};
@@ -375,3 +411,79 @@ TEST(interleaved_bloom_filter_test, decompression)
 
     EXPECT_TRUE(ibf == ibf_decompressed);
 }
+
+TYPED_TEST(interleaved_bloom_filter_test, mapped)
+{
+    seqan3::interleaved_bloom_filter ibf{seqan3::bin_count{73u},
+                                         seqan3::bin_size{1019u},
+                                         seqan3::hash_function_count{3u}};
+
+    for (size_t bin_idx : std::views::iota(0, 73))
+        for (size_t hash : std::views::iota(0, 64))
+            if ((hash + bin_idx) % 3 == 0)
+                ibf.emplace(hash, seqan3::bin_index{bin_idx});
+
+    // 1. Store either the uncompressed or compressed interleaved_bloom_filter and map it.
+    TypeParam ibf2{ibf};
+    seqan3::test::tmp_directory tmp{};
+    auto const filename = tmp.path() / "ibf.mapped";
+    ibf2.store(filename);
+
+    seqan3::interleaved_bloom_filter<seqan3::data_layout::mapped> mapped{filename};
+    EXPECT_EQ(mapped.bin_count(), 73u);
+    EXPECT_EQ(mapped.bin_size(), 1019u);
+    EXPECT_EQ(mapped.bit_size(), ibf.bit_size());
+    EXPECT_EQ(mapped.hash_function_count(), 3u);
+
+    // 2. Both agents yield the same results as for the original interleaved_bloom_filter.
+    auto expected_agent = ibf.membership_agent();
+    auto mapped_agent = mapped.membership_agent();
+    for (size_t hash : std::views::iota(0, 128))
+        EXPECT_RANGE_EQ(mapped_agent.bulk_contains(hash), expected_agent.bulk_contains(hash));
+
+    auto expected_counting_agent = ibf.counting_agent();
+    auto mapped_counting_agent = mapped.counting_agent();
+    EXPECT_RANGE_EQ(mapped_counting_agent.bulk_count(std::views::iota(0u, 128u)),
+                    expected_counting_agent.bulk_count(std::views::iota(0u, 128u)));
+
+    // 3. Copies share the mapping.
+    auto mapped_copy = mapped;
+    EXPECT_TRUE(mapped_copy == mapped);
+    EXPECT_EQ(mapped_copy.raw_data().data(), mapped.raw_data().data());
+
+    // 4. Mapping the same file twice yields equal interleaved_bloom_filters.
+    seqan3::interleaved_bloom_filter<seqan3::data_layout::mapped> mapped2{filename};
+    EXPECT_TRUE(mapped2 == mapped);
+
+    // 5. A mapped interleaved_bloom_filter can be copied into memory and stored again.
+    seqan3::interleaved_bloom_filter ibf_from_mapped{mapped};
+    EXPECT_TRUE(ibf_from_mapped == ibf);
+
+    auto const filename2 = tmp.path() / "ibf2.mapped";
+    mapped.store(filename2);
+    EXPECT_TRUE(seqan3::interleaved_bloom_filter<seqan3::data_layout::mapped>{filename2} == mapped);
+}
+
+TEST(interleaved_bloom_filter_test, mapped_errors)
+{
+    using mapped_ibf_t = seqan3::interleaved_bloom_filter<seqan3::data_layout::mapped>;
+
+    seqan3::test::tmp_directory tmp{};
+
+    // File does not exist.
+    EXPECT_THROW(mapped_ibf_t{tmp.path() / "does_not_exist"}, seqan3::file_open_error);
+
+    // File is not an interleaved_bloom_filter.
+    auto const filename = tmp.path() / "not_an_ibf";
+    {
+        std::ofstream out{filename};
+        out << "Not an Interleaved Bloom Filter, but long enough to contain a header of 64 bytes.";
+    }
+    EXPECT_THROW(mapped_ibf_t{filename}, seqan3::file_open_error);
+
+    // File is truncated.
+    seqan3::interleaved_bloom_filter ibf{seqan3::bin_count{64u}, seqan3::bin_size{1024u}};
+    ibf.store(filename);
+    std::filesystem::resize_file(filename, 64u + 8u);
+    EXPECT_THROW(mapped_ibf_t{filename}, seqan3::file_open_error);
+}
@@ -0,0 +1,136 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/search/kmer_index/minimiser_sketch.hpp>
+#include <seqan3/test/expect_range_eq.hpp>
+#include <seqan3/test/expect_throw_msg.hpp>
+#include <seqan3/utility/range/to.hpp>
+
+using seqan3::operator""_dna4;
+using seqan3::operator""_shape;
+
+class minimiser_sketch_test : public ::testing::Test
+{
+protected:
+    // Sequences of different lengths, including empty sequences and sequences shorter than the window.
+    template <typename alphabet_t>
+    static seqan3::concatenated_sequences<std::vector<alphabet_t>> random_sequences(size_t const count)
+    {
+        std::mt19937_64 engine{42};
+        seqan3::concatenated_sequences<std::vector<alphabet_t>> sequences{};
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            std::vector<alphabet_t> sequence(engine() % 300);
+            for (auto & letter : sequence)
+                letter.assign_rank(engine() % seqan3::alphabet_size<alphabet_t>);
+            sequences.push_back(sequence);
+        }
+
+        return sequences;
+    }
+
+    seqan3::shape const ungapped_shape{seqan3::ungapped{7}};
+    seqan3::shape const gapped_shape{0b1011011_shape};
+    seqan3::window_size const window{20};
+    seqan3::seed const seed{0x8F'3F'73'B5'CF'1C'9A'DE};
+};
+
+TEST_F(minimiser_sketch_test, matches_minimiser_hash)
+{
+    auto sequences = random_sequences<seqan3::dna4>(1000);
+
+    for (seqan3::shape const & shape : {ungapped_shape, gapped_shape})
+    {
+        for (size_t thread_count : {1u, 2u, 4u, 7u})
+        {
+            auto hashes = seqan3::bulk_minimiser_hash(sequences, shape, window, seed, thread_count);
+
+            ASSERT_EQ(hashes.size(), sequences.size());
+            for (size_t i = 0; i < sequences.size(); ++i)
+                EXPECT_RANGE_EQ(hashes[i], sequences[i] | seqan3::views::minimiser_hash(shape, window, seed));
+        }
+    }
+}
+
+TEST_F(minimiser_sketch_test, non_power_of_two_alphabet)
+{
+    auto sequences = random_sequences<seqan3::dna5>(200);
+    auto hashes = seqan3::bulk_minimiser_hash(sequences, ungapped_shape, window, seed, 3u);
+
+    ASSERT_EQ(hashes.size(), sequences.size());
+    for (size_t i = 0; i < sequences.size(); ++i)
+        EXPECT_RANGE_EQ(hashes[i], sequences[i] | seqan3::views::minimiser_hash(ungapped_shape, window, seed));
+}
+
+TEST_F(minimiser_sketch_test, vector_of_sequences)
+{
+    std::vector<std::vector<seqan3::dna4>> sequences{"ACGTAGCTTAGCATTTGCAGGCCAT"_dna4, ""_dna4, "ACGTAGC"_dna4};
+    auto hashes = seqan3::bulk_minimiser_hash(sequences, seqan3::ungapped{4}, seqan3::window_size{6});
+
+    ASSERT_EQ(hashes.size(), 3u);
+    EXPECT_RANGE_EQ(hashes[0],
+                    sequences[0] | seqan3::views::minimiser_hash(seqan3::ungapped{4}, seqan3::window_size{6}));
+    EXPECT_TRUE(hashes[1].empty());
+    EXPECT_RANGE_EQ(hashes[2],
+                    sequences[2] | seqan3::views::minimiser_hash(seqan3::ungapped{4}, seqan3::window_size{6}));
+}
+
+TEST_F(minimiser_sketch_test, positions)
+{
+    auto sequences = random_sequences<seqan3::dna4>(500);
+
+    for (seqan3::shape const & shape : {ungapped_shape, gapped_shape})
+    {
+        auto sketch = seqan3::bulk_minimiser_hash_with_positions(sequences, shape, window, seed, 4u);
+        auto hashes = seqan3::bulk_minimiser_hash(sequences, shape, window, seed, 4u);
+
+        ASSERT_EQ(sketch.hashes.size(), sequences.size());
+        ASSERT_EQ(sketch.positions.size(), sequences.size());
+        EXPECT_TRUE(std::ranges::equal(sketch.hashes, hashes, std::ranges::equal));
+
+        for (size_t i = 0; i < sequences.size(); ++i)
+        {
+            // The canonical hash of every k-mer, skewed with the seed.
+            auto kmer_hashes = seqan3::detail::canonical_kmer_hash_view{sequences[i], shape, seed.get()}
+                             | seqan3::ranges::to<std::vector>();
+
+            ASSERT_EQ(sketch.positions[i].size(), sketch.hashes[i].size());
+            for (size_t j = 0; j < sketch.hashes[i].size(); ++j)
+            {
+                EXPECT_EQ(kmer_hashes[sketch.positions[i][j]], sketch.hashes[i][j]);
+
+                if (j > 0u)
+                {
+                    EXPECT_LT(sketch.positions[i][j - 1], sketch.positions[i][j]);
+                }
+            }
+        }
+    }
+}
+
+TEST_F(minimiser_sketch_test, empty_collection)
+{
+    seqan3::concatenated_sequences<std::vector<seqan3::dna4>> sequences{};
+
+    EXPECT_TRUE(seqan3::bulk_minimiser_hash(sequences, ungapped_shape, window, seed, 4u).empty());
+    EXPECT_TRUE(seqan3::bulk_minimiser_hash_with_positions(sequences, ungapped_shape, window, seed, 4u).hashes.empty());
+}
+
+TEST_F(minimiser_sketch_test, invalid_arguments)
+{
+    auto sequences = random_sequences<seqan3::dna4>(10);
+
+    EXPECT_THROW_MSG(seqan3::bulk_minimiser_hash(sequences, ungapped_shape, window, seed, 0u),
+                     std::invalid_argument,
+                     "The number of threads must be greater than 0.");
+    EXPECT_THROW(seqan3::bulk_minimiser_hash(sequences, ungapped_shape, seqan3::window_size{5}, seed, 4u),
+                 std::invalid_argument);
+}
@@ -15,6 +15,7 @@
 #include <seqan3/search/fm_index/fm_index.hpp>
 #include <seqan3/search/search.hpp>
 #include <seqan3/test/expect_range_eq.hpp>
+#include <seqan3/utility/parallel/thread_pool.hpp>
 
 #include "helper.hpp"
 
@@ -204,6 +205,56 @@ TYPED_TEST(search_test, parallel_queries)
     EXPECT_RANGE_EQ(search(queries, this->index, cfg) | query_id, expected_query_ids);
 }
 
+TYPED_TEST(search_test, parallel_queries_streaming)
+{
+    constexpr size_t num_queries{100u};
+    std::vector<std::vector<seqan3::dna4>> const queries{num_queries, {"ACGTACGTACGT"_dna4}};
+
+    // Buffer fewer queries than are searched.
+    seqan3::configuration const cfg =
+        seqan3::search_cfg::max_error_total{seqan3::search_cfg::error_rate{.0}}
+        | seqan3::search_cfg::parallel{std::min<uint32_t>(2, std::thread::hardware_concurrency()), 3u};
+
+    std::vector<size_t> expected_query_ids{};
+    for (size_t i = 0; i < num_queries; ++i)
+        expected_query_ids.insert(expected_query_ids.end(), 2, i);
+
+    EXPECT_RANGE_EQ(search(queries, this->index, cfg) | query_id, expected_query_ids);
+
+    // The results are reported in any order.
+    auto completion_cfg = cfg;
+    auto & parallel = std::get<seqan3::search_cfg::parallel>(completion_cfg);
+    parallel.order = seqan3::search_cfg::parallel::result_order::completion;
+
+    std::vector<size_t> query_ids{};
+    for (auto && hit : search(queries, this->index, completion_cfg))
+        query_ids.push_back(hit.query_id());
+
+    std::ranges::sort(query_ids);
+    EXPECT_EQ(query_ids, expected_query_ids);
+
+    parallel.buffer_size = 0u;
+    EXPECT_THROW(search(queries, this->index, completion_cfg), std::invalid_argument);
+}
+
+TYPED_TEST(search_test, parallel_queries_thread_pool)
+{
+    constexpr size_t num_queries{100u};
+    std::vector<std::vector<seqan3::dna4>> const queries{num_queries, {"ACGTACGTACGT"_dna4}};
+
+    std::vector<size_t> expected_query_ids{};
+    for (size_t i = 0; i < num_queries; ++i)
+        expected_query_ids.insert(expected_query_ids.end(), 2, i);
+
+    // Consecutive searches reuse the threads of the pool.
+    seqan3::thread_pool pool{2};
+    seqan3::configuration const cfg = seqan3::search_cfg::max_error_total{seqan3::search_cfg::error_rate{.0}}
+                                    | seqan3::search_cfg::parallel{pool};
+
+    EXPECT_RANGE_EQ(search(queries, this->index, cfg) | query_id, expected_query_ids);
+    EXPECT_RANGE_EQ(search(queries, this->index, cfg) | query_id, expected_query_ids);
+}
+
 TYPED_TEST(search_test, parallel_without_parameter)
 {
     seqan3::configuration cfg = seqan3::search_cfg::parallel{};
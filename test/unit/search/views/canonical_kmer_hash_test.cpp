@@ -0,0 +1,205 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <forward_list>
+#include <list>
+#include <random>
+#include <sstream>
+
+#include <seqan3/alphabet/container/bitpacked_sequence.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/alphabet/views/char_to.hpp>
+#include <seqan3/alphabet/views/complement.hpp>
+#include <seqan3/search/views/canonical_kmer_hash.hpp>
+#include <seqan3/test/expect_range_eq.hpp>
+#include <seqan3/test/expect_throw_msg.hpp>
+#include <seqan3/utility/views/zip.hpp>
+
+using seqan3::operator""_dna4;
+using seqan3::operator""_shape;
+using result_t = std::vector<size_t>;
+
+static constexpr auto ungapped_view = seqan3::views::canonical_kmer_hash(seqan3::ungapped{3});
+static constexpr auto gapped_view = seqan3::views::canonical_kmer_hash(0b101_shape);
+
+// Minimum of the forward hash and the hash of the reverse complement, computed with views::kmer_hash.
+result_t expected_hashes(std::vector<seqan3::dna4> const & text, seqan3::shape const & shape)
+{
+    auto forward = text | seqan3::views::kmer_hash(shape);
+    auto reverse = text | seqan3::views::complement | std::views::reverse | seqan3::views::kmer_hash(shape)
+                 | std::views::reverse;
+
+    result_t result{};
+    for (auto && [f, r] : seqan3::views::zip(forward, reverse))
+        result.push_back(std::min(f, r));
+
+    return result;
+}
+
+template <typename T>
+class canonical_kmer_hash_test : public ::testing::Test
+{};
+
+using underlying_range_types = ::testing::Types<std::vector<seqan3::dna4>,
+                                                std::vector<seqan3::dna4> const,
+                                                seqan3::bitpacked_sequence<seqan3::dna4>,
+                                                seqan3::bitpacked_sequence<seqan3::dna4> const,
+                                                std::list<seqan3::dna4>,
+                                                std::list<seqan3::dna4> const,
+                                                std::forward_list<seqan3::dna4>,
+                                                std::forward_list<seqan3::dna4> const>;
+
+TYPED_TEST_SUITE(canonical_kmer_hash_test, underlying_range_types, );
+
+TYPED_TEST(canonical_kmer_hash_test, combined_with_container)
+{
+    {
+        TypeParam text{'A'_dna4, 'C'_dna4, 'G'_dna4, 'T'_dna4, 'A'_dna4, 'G'_dna4, 'C'_dna4}; // ACGTAGC
+        // ACG/CGT, CGT/ACG, GTA/TAC, TAG/CTA, AGC/GCT
+        EXPECT_RANGE_EQ((result_t{6, 6, 44, 28, 9}), text | ungapped_view);
+        // A.G/C.T, C.T/A.G, G.A/T.C, T.G/C.A, A.C/G.T
+        EXPECT_RANGE_EQ((result_t{2, 2, 8, 4, 1}), text | gapped_view);
+    }
+    {
+        TypeParam text{'A'_dna4, 'A'_dna4, 'A'_dna4, 'A'_dna4, 'A'_dna4}; // AAAAA
+        EXPECT_RANGE_EQ((result_t{0, 0, 0}), text | ungapped_view);
+        EXPECT_RANGE_EQ((result_t{0, 0, 0}), text | gapped_view);
+    }
+    {
+        TypeParam text{'A'_dna4, 'C'_dna4}; // AC
+        EXPECT_RANGE_EQ(result_t{}, text | ungapped_view);
+        EXPECT_RANGE_EQ(result_t{}, text | gapped_view);
+    }
+    {
+        TypeParam text{};
+        EXPECT_RANGE_EQ(result_t{}, text | ungapped_view);
+    }
+}
+
+TYPED_TEST(canonical_kmer_hash_test, concepts)
+{
+    TypeParam text{'A'_dna4, 'C'_dna4, 'G'_dna4, 'T'_dna4}; // ACGT
+    auto v = text | ungapped_view;
+    EXPECT_TRUE(std::ranges::input_range<decltype(v)>);
+    EXPECT_TRUE(std::ranges::forward_range<decltype(v)>);
+    EXPECT_FALSE(std::ranges::bidirectional_range<decltype(v)>);
+    EXPECT_TRUE(std::ranges::view<decltype(v)>);
+    EXPECT_EQ(std::ranges::sized_range<decltype(text)>, std::ranges::sized_range<decltype(v)>);
+    EXPECT_FALSE(std::ranges::common_range<decltype(v)>);
+    EXPECT_TRUE(seqan3::const_iterable_range<decltype(v)>);
+    EXPECT_FALSE((std::ranges::output_range<decltype(v), size_t>));
+
+    if constexpr (std::ranges::sized_range<TypeParam>)
+    {
+        EXPECT_EQ(v.size(), 2u);
+        EXPECT_EQ(std::ranges::distance(v), 2);
+        EXPECT_EQ((text | seqan3::views::canonical_kmer_hash(seqan3::ungapped{5})).size(), 0u);
+    }
+}
+
+TEST(canonical_kmer_hash_test, matches_both_strands_of_kmer_hash)
+{
+    std::mt19937_64 engine{42};
+    std::vector<seqan3::dna4> text(1000);
+    for (seqan3::dna4 & letter : text)
+        letter.assign_rank(engine() % 4);
+
+    for (seqan3::shape const & shape : {seqan3::shape{seqan3::ungapped{1}},
+                                        seqan3::shape{seqan3::ungapped{20}},
+                                        seqan3::shape{seqan3::ungapped{32}},
+                                        0b101_shape,
+                                        0b1100'1101'0111_shape})
+    {
+        EXPECT_RANGE_EQ(expected_hashes(text, shape), text | seqan3::views::canonical_kmer_hash(shape));
+    }
+}
+
+TEST(canonical_kmer_hash_test, seed)
+{
+    std::vector<seqan3::dna4> text{"ACGTAGC"_dna4};
+    uint64_t const seed{0x8F'3F'73'B5'CF'1C'9A'DE};
+
+    auto forward = text | seqan3::views::kmer_hash(seqan3::ungapped{3});
+    auto reverse = text | seqan3::views::complement | std::views::reverse
+                 | seqan3::views::kmer_hash(seqan3::ungapped{3}) | std::views::reverse;
+
+    result_t expected{};
+    for (auto && [f, r] : seqan3::views::zip(forward, reverse))
+        expected.push_back(std::min(f ^ seed, r ^ seed));
+
+    EXPECT_RANGE_EQ(expected, (seqan3::detail::canonical_kmer_hash_view{text, seqan3::ungapped{3}, seed}));
+}
+
+TEST(canonical_kmer_hash_test, single_pass_input)
+{
+    std::istringstream stream{"ACGTAGC"};
+    auto text = std::views::istream<char>(stream) | seqan3::views::char_to<seqan3::dna4>;
+    auto v = text | ungapped_view;
+
+    EXPECT_TRUE(std::ranges::input_range<decltype(v)>);
+    EXPECT_FALSE(std::ranges::forward_range<decltype(v)>);
+    EXPECT_RANGE_EQ((result_t{6, 6, 44, 28, 9}), v);
+}
+
+TEST(canonical_kmer_hash_test, long_span)
+{
+    std::mt19937_64 engine{42};
+    std::vector<seqan3::dna4> text(1000);
+    for (seqan3::dna4 & letter : text)
+        letter.assign_rank(engine() % 4);
+
+    std::list<seqan3::dna4> list_text{text.begin(), text.end()};
+
+    // views::kmer_hash cannot be used here, because computing its rolling factor overflows in Debug mode.
+    auto naive_hashes = [&text](seqan3::shape const & shape)
+    {
+        result_t result{};
+        for (size_t i = 0; i + shape.size() <= text.size(); ++i)
+        {
+            uint64_t forward{};
+            uint64_t reverse{};
+            for (size_t j = 0; j < shape.size(); ++j)
+            {
+                if (shape[j])
+                {
+                    forward = (forward << 2) | text[i + j].to_rank();
+                    reverse = (reverse << 2) | seqan3::complement(text[i + shape.size() - 1 - j]).to_rank();
+                }
+            }
+            result.push_back(std::min(forward, reverse));
+        }
+        return result;
+    };
+
+    for (seqan3::shape const & shape : {0b1'0000'0000'0000'0000'0000'0000'0000'0001_shape,
+                                        0b1011'0000'0000'0000'0000'0000'0000'0000'0000'0000'1101_shape})
+    {
+        EXPECT_RANGE_EQ(naive_hashes(shape), text | seqan3::views::canonical_kmer_hash(shape));
+        EXPECT_RANGE_EQ(naive_hashes(shape), list_text | seqan3::views::canonical_kmer_hash(shape));
+    }
+
+    std::vector<seqan3::dna4> short_text(32);
+    EXPECT_TRUE(std::ranges::empty(short_text | seqan3::views::canonical_kmer_hash(
+                                                    0b1'0000'0000'0000'0000'0000'0000'0000'0001_shape)));
+}
+
+TEST(canonical_kmer_hash_test, invalid_sizes)
+{
+    std::vector<seqan3::dna4> text{};
+    EXPECT_NO_THROW(text | seqan3::views::canonical_kmer_hash(seqan3::ungapped{32}));
+    EXPECT_NO_THROW(text | seqan3::views::canonical_kmer_hash(0b1'0000'0000'0000'0000'0000'0000'0000'0001_shape));
+    EXPECT_THROW_MSG(text | seqan3::views::canonical_kmer_hash(seqan3::ungapped{33}),
+                     std::invalid_argument,
+                     "The shape is too long for the given alphabet.\nAlphabet: seqan3::dna4\n"
+                     "Maximum shape count: 32\nGiven shape count: 33");
+
+    std::istringstream stream{"ACGTAGC"};
+    auto single_pass = std::views::istream<char>(stream) | seqan3::views::char_to<seqan3::dna4>;
+    EXPECT_THROW_MSG(single_pass | seqan3::views::canonical_kmer_hash(0b1'0000'0000'0000'0000'0000'0000'0000'0001_shape),
+                     std::invalid_argument,
+                     "The shape is too long for the given alphabet.\nAlphabet: seqan3::dna4\n"
+                     "Maximum shape size: 32\nGiven shape size: 33\nLonger shapes require a forward range.");
+}
@@ -6,6 +6,7 @@
 
 #include <forward_list>
 #include <list>
+#include <random>
 #include <type_traits>
 
 #include <seqan3/alphabet/container/bitpacked_sequence.hpp>
@@ -356,3 +357,47 @@ TYPED_TEST(kmer_hash_gapped_test, issue2415)
         EXPECT_RANGE_EQ(gapped, v);
     }
 }
+
+TEST(kmer_hash_test, bitpacked_sequence)
+{
+    std::mt19937_64 engine{42};
+    std::vector<seqan3::dna4> text(1000);
+    for (seqan3::dna4 & letter : text)
+        letter.assign_rank(engine() % 4);
+
+    seqan3::bitpacked_sequence<seqan3::dna4> const packed_text{text};
+
+    for (seqan3::shape const & shape : {seqan3::shape{seqan3::ungapped{1}},
+                                        seqan3::shape{seqan3::ungapped{19}},
+                                        seqan3::shape{seqan3::ungapped{32}},
+                                        0b101_shape,
+                                        0b1100'1101'0111_shape,
+                                        0xF'FF'FF'FF'E0'01_shape}) // span 48 does not fit into 64 bit
+    {
+        result_t expected{};
+        for (size_t i = 0; i + shape.size() <= text.size(); ++i)
+        {
+            size_t hash{0};
+            for (size_t j = 0; j < shape.size(); ++j)
+                if (shape[j])
+                    hash = hash * 4u + text[i + j].to_rank();
+            expected.push_back(hash);
+        }
+
+        auto packed = packed_text | seqan3::views::kmer_hash(shape);
+        EXPECT_TRUE((std::same_as<decltype(packed),
+                                  seqan3::detail::packed_kmer_hash_view<
+                                      std::ranges::ref_view<seqan3::bitpacked_sequence<seqan3::dna4> const>>>));
+
+        EXPECT_RANGE_EQ(expected, packed);
+        EXPECT_RANGE_EQ(expected | std::views::reverse, packed | std::views::reverse);
+
+        for (size_t i = 0; i < expected.size(); i += 97)
+            EXPECT_EQ(expected[i], packed[i]);
+
+        if (shape.size() <= 32u) // Otherwise, the rolling hash of the generic view overflows.
+        {
+            EXPECT_RANGE_EQ(text | seqan3::views::kmer_hash(shape), packed);
+        }
+    }
+}
@@ -6,9 +6,11 @@
 
 #include <forward_list>
 #include <list>
+#include <random>
 
 #include <seqan3/alphabet/container/bitpacked_sequence.hpp>
 #include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/search/views/minimiser.hpp>
 #include <seqan3/search/views/minimiser_hash.hpp>
 #include <seqan3/test/expect_range_eq.hpp>
 
@@ -53,7 +55,9 @@ using underlying_range_types = ::testing::Types<std::vector<seqan3::dna4>,
                                                 seqan3::bitpacked_sequence<seqan3::dna4>,
                                                 seqan3::bitpacked_sequence<seqan3::dna4> const,
                                                 std::list<seqan3::dna4>,
-                                                std::list<seqan3::dna4> const>;
+                                                std::list<seqan3::dna4> const,
+                                                std::forward_list<seqan3::dna4>,
+                                                std::forward_list<seqan3::dna4> const>;
 
 TYPED_TEST_SUITE(minimiser_hash_properties_test, underlying_range_types, );
 class minimiser_hash_test : public ::testing::Test
@@ -137,3 +141,36 @@ TEST_F(minimiser_hash_test, shape_bigger_than_window)
     EXPECT_THROW(text1 | seqan3::views::minimiser_hash(ungapped_shape, seqan3::window_size{3}), std::invalid_argument);
     EXPECT_THROW(text1 | seqan3::views::minimiser_hash(gapped_shape, seqan3::window_size{3}), std::invalid_argument);
 }
+
+// The span of the shape does not fit into 64 bits, but its count does.
+TEST_F(minimiser_hash_test, gapped_long_span)
+{
+    std::mt19937_64 engine{42};
+    std::vector<seqan3::dna4> text(200);
+    for (seqan3::dna4 & letter : text)
+        letter.assign_rank(engine() % 4);
+
+    seqan3::shape const shape = 0b1'0000'0000'0000'0000'0000'0000'0000'0000'0000'1101_shape;
+    ASSERT_GT(shape.size(), 32u);
+    uint64_t const seed{0x8F'3F'73'B5'CF'1C'9A'DE};
+
+    // views::kmer_hash cannot be used here, because computing its rolling factor overflows in Debug mode.
+    result_t canonical{};
+    for (size_t i = 0; i + shape.size() <= text.size(); ++i)
+    {
+        uint64_t forward{};
+        uint64_t reverse{};
+        for (size_t j = 0; j < shape.size(); ++j)
+        {
+            if (shape[j])
+            {
+                forward = (forward << 2) | text[i + j].to_rank();
+                reverse = (reverse << 2) | seqan3::complement(text[i + shape.size() - 1 - j]).to_rank();
+            }
+        }
+        canonical.push_back(std::min(forward ^ seed, reverse ^ seed));
+    }
+
+    EXPECT_RANGE_EQ(canonical | seqan3::views::minimiser(50 - shape.size() + 1),
+                    text | seqan3::views::minimiser_hash(shape, seqan3::window_size{50}));
+}
@@ -6,6 +6,9 @@
 
 #include <forward_list>
 #include <list>
+#include <numeric>
+#include <random>
+#include <span>
 #include <type_traits>
 
 #include <seqan3/alphabet/container/bitpacked_sequence.hpp>
@@ -283,6 +286,7 @@ TEST_F(minimiser_test, iterator_base)
     //                      ^
     EXPECT_EQ(minimiser_it.base() - hash_first_window_end, 0u);    // window start position
     EXPECT_EQ(minimiser_it.base() - hash_begin, window_size - 1u); // window end position
+    EXPECT_EQ(minimiser_it.position(), 0u);                         // minimiser position
 
     // After incrementing, points to the last element in the new window
     // index:  0,  1, 2, 3, 4, 5,  6, 7, 8, 9
@@ -291,6 +295,7 @@ TEST_F(minimiser_test, iterator_base)
     ++minimiser_it;
     EXPECT_EQ(minimiser_it.base() - hash_first_window_end, 1u); // window start position
     EXPECT_EQ(minimiser_it.base() - hash_begin, 5u);            // window end position
+    EXPECT_EQ(minimiser_it.position(), 5u);                     // minimiser position (rightmost 4)
 
     // After incrementing, points to the last element in the new window
     // index:  0, 1, 2,  3, 4, 5, 6, 7,  8, 9
@@ -299,9 +304,77 @@ TEST_F(minimiser_test, iterator_base)
     ++minimiser_it;
     EXPECT_EQ(minimiser_it.base() - hash_first_window_end, 3u); // window start position
     EXPECT_EQ(minimiser_it.base() - hash_begin, 7u);            // window end position
+    EXPECT_EQ(minimiser_it.position(), 7u);                     // minimiser position
 
     // if minimiser reached end, underlying iterator reached end too
     ++minimiser_it;
     EXPECT_EQ(minimiser_it, minimiser.end());
     EXPECT_EQ(minimiser_it.base(), hash_end);
 }
+
+// Recomputes the minimum of each window from scratch, following the robust winnowing rules.
+result_t naive_minimiser(std::vector<size_t> const & values, size_t const window_size)
+{
+    result_t result{};
+
+    if (values.size() < window_size)
+        return result;
+
+    auto rightmost_minimum = [&](size_t const begin)
+    {
+        auto window = std::span{values}.subspan(begin, window_size);
+        return begin + (std::ranges::min_element(window, std::less_equal<size_t>{}) - window.begin());
+    };
+
+    size_t minimiser_position = rightmost_minimum(0u);
+    result.push_back(values[minimiser_position]);
+
+    for (size_t begin = 1u; begin + window_size <= values.size(); ++begin)
+    {
+        size_t const new_position = begin + window_size - 1u;
+
+        if (minimiser_position < begin)
+            minimiser_position = rightmost_minimum(begin);
+        else if (values[new_position] < values[minimiser_position])
+            minimiser_position = new_position;
+        else
+            continue;
+
+        result.push_back(values[minimiser_position]);
+    }
+
+    return result;
+}
+
+TEST_F(minimiser_test, matches_naive)
+{
+    std::mt19937_64 engine{42u};
+
+    for (size_t max_value : {3u, 1000u})
+    {
+        std::vector<size_t> first(2000);
+        std::vector<size_t> second(2000);
+        std::vector<size_t> both(2000);
+
+        for (size_t i = 0; i < first.size(); ++i)
+        {
+            first[i] = engine() % max_value;
+            second[i] = engine() % max_value;
+            both[i] = std::min(first[i], second[i]);
+        }
+
+        for (size_t window_size : {2u, 3u, 7u, 64u, 500u, 2000u})
+        {
+            EXPECT_RANGE_EQ(first | seqan3::views::minimiser(window_size), naive_minimiser(first, window_size));
+            EXPECT_RANGE_EQ((seqan3::detail::minimiser_view{first, second, window_size}),
+                            naive_minimiser(both, window_size));
+        }
+
+        EXPECT_RANGE_EQ((seqan3::detail::minimiser_view{first, second, 1u}), both);
+    }
+
+    // Strictly increasing values: The minimiser leaves the window in every step.
+    std::vector<size_t> increasing(1000);
+    std::iota(increasing.begin(), increasing.end(), 0u);
+    EXPECT_RANGE_EQ(increasing | seqan3::views::minimiser(100u), std::views::iota(0u, 901u));
+}
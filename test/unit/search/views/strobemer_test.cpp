@@ -0,0 +1,185 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <forward_list>
+#include <list>
+#include <random>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/search/views/strobemer.hpp>
+#include <seqan3/test/expect_range_eq.hpp>
+#include <seqan3/test/expect_throw_msg.hpp>
+#include <seqan3/utility/range/to.hpp>
+
+#include "../../range/iterator_test_template.hpp"
+
+using seqan3::operator""_dna4;
+using seqan3::operator""_shape;
+using result_t = std::vector<uint64_t>;
+
+static constexpr uint64_t default_seed = 0x8F'3F'73'B5'CF'1C'9A'DE;
+
+// Scans the whole window for every first strobe.
+result_t naive_strobemer(std::vector<seqan3::dna4> const & text,
+                         seqan3::shape const & shape,
+                         seqan3::strobe_window const window,
+                         uint64_t const seed = default_seed)
+{
+    result_t kmers = text | seqan3::views::kmer_hash(shape) | seqan3::ranges::to<result_t>();
+
+    result_t result{};
+    for (size_t i = 0; i + window.min_offset < kmers.size(); ++i)
+    {
+        size_t second = i + window.min_offset;
+        for (size_t j = second + 1; j <= std::min(i + window.max_offset, kmers.size() - 1); ++j)
+            if ((kmers[i] ^ kmers[j] ^ seed) < (kmers[i] ^ kmers[second] ^ seed))
+                second = j;
+
+        result.push_back(kmers[i] / 2 + kmers[second] / 3);
+    }
+
+    return result;
+}
+
+using iterator_type = std::ranges::iterator_t<
+    decltype(std::declval<std::vector<seqan3::dna4> &>()
+             | seqan3::views::strobemer(seqan3::ungapped{3}, seqan3::strobe_window{2, 4}))>;
+
+template <>
+struct iterator_fixture<iterator_type> : public ::testing::Test
+{
+    using iterator_tag = std::forward_iterator_tag;
+    static constexpr bool const_iterable = true;
+
+    std::vector<seqan3::dna4> text{"ACGGCGACGTTTAG"_dna4};
+    result_t expected_range = naive_strobemer(text, seqan3::ungapped{3}, {2, 4});
+
+    using test_range_t = decltype(text | seqan3::views::strobemer(seqan3::ungapped{3}, seqan3::strobe_window{2, 4}));
+    test_range_t test_range = text | seqan3::views::strobemer(seqan3::ungapped{3}, seqan3::strobe_window{2, 4});
+};
+
+using test_type = ::testing::Types<iterator_type>;
+INSTANTIATE_TYPED_TEST_SUITE_P(iterator_fixture, iterator_fixture, test_type, );
+
+template <typename T>
+class strobemer_view_properties_test : public ::testing::Test
+{};
+
+using underlying_range_types = ::testing::Types<std::vector<seqan3::dna4>,
+                                                std::vector<seqan3::dna4> const,
+                                                std::list<seqan3::dna4>,
+                                                std::list<seqan3::dna4> const,
+                                                std::forward_list<seqan3::dna4>,
+                                                std::forward_list<seqan3::dna4> const>;
+
+TYPED_TEST_SUITE(strobemer_view_properties_test, underlying_range_types, );
+
+TYPED_TEST(strobemer_view_properties_test, concepts)
+{
+    TypeParam text{'A'_dna4, 'C'_dna4, 'G'_dna4, 'T'_dna4, 'A'_dna4, 'C'_dna4};
+    auto v = text | seqan3::views::strobemer(seqan3::ungapped{3}, seqan3::strobe_window{1, 2});
+
+    EXPECT_TRUE(std::ranges::forward_range<decltype(v)>);
+    EXPECT_FALSE(std::ranges::bidirectional_range<decltype(v)>);
+    EXPECT_TRUE(std::ranges::view<decltype(v)>);
+    EXPECT_EQ(std::ranges::sized_range<decltype(v)>, std::ranges::sized_range<TypeParam>);
+    EXPECT_FALSE(std::ranges::common_range<decltype(v)>);
+    EXPECT_TRUE(seqan3::const_iterable_range<decltype(v)>);
+    EXPECT_FALSE((std::ranges::output_range<decltype(v), uint64_t>));
+}
+
+TYPED_TEST(strobemer_view_properties_test, different_inputs)
+{
+    std::vector<seqan3::dna4> const sequence{"ACGGCGACGTTTAGCTTAGCA"_dna4};
+    TypeParam text(sequence.begin(), sequence.end());
+
+    EXPECT_RANGE_EQ(text | seqan3::views::strobemer(seqan3::ungapped{3}, seqan3::strobe_window{2, 5}),
+                    naive_strobemer(sequence, seqan3::ungapped{3}, {2, 5}));
+    EXPECT_RANGE_EQ(text | seqan3::views::strobemer(0b1101_shape, seqan3::strobe_window{1, 3}),
+                    naive_strobemer(sequence, 0b1101_shape, {1, 3}));
+}
+
+TEST(strobemer_test, size)
+{
+    std::vector<seqan3::dna4> text{"ACGGCGACGTTTAG"_dna4};
+
+    // 12 k-mers, the last 3 have no second strobe.
+    auto v = text | seqan3::views::strobemer(seqan3::ungapped{3}, seqan3::strobe_window{3, 6});
+    EXPECT_EQ(v.size(), 9u);
+    EXPECT_EQ(std::ranges::distance(v), 9);
+
+    auto too_short = text | seqan3::views::strobemer(seqan3::ungapped{3}, seqan3::strobe_window{12, 14});
+    EXPECT_EQ(too_short.size(), 0u);
+    EXPECT_RANGE_EQ(too_short, result_t{});
+
+    std::vector<seqan3::dna4> empty{};
+    EXPECT_RANGE_EQ(empty | seqan3::views::strobemer(seqan3::ungapped{3}, seqan3::strobe_window{1, 2}), result_t{});
+}
+
+TEST(strobemer_test, fixed_offset)
+{
+    // With min_offset == max_offset, the second strobe is always at the same offset.
+    std::vector<seqan3::dna4> text{"ACGGCGACGTTTAG"_dna4};
+    result_t kmers = text | seqan3::views::kmer_hash(seqan3::ungapped{3}) | seqan3::ranges::to<result_t>();
+
+    result_t expected{};
+    for (size_t i = 0; i + 4 < kmers.size(); ++i)
+        expected.push_back(kmers[i] / 2 + kmers[i + 4] / 3);
+
+    EXPECT_RANGE_EQ(text | seqan3::views::strobemer(seqan3::ungapped{3}, seqan3::strobe_window{4, 4}), expected);
+}
+
+TEST(strobemer_test, seed)
+{
+    std::vector<seqan3::dna4> text{"ACGGCGACGTTTAGCTTAGCA"_dna4};
+    EXPECT_RANGE_EQ(text | seqan3::views::strobemer(seqan3::ungapped{3}, seqan3::strobe_window{2, 6}, seqan3::seed{0}),
+                    naive_strobemer(text, seqan3::ungapped{3}, {2, 6}, 0));
+}
+
+TEST(strobemer_test, matches_naive)
+{
+    std::mt19937_64 engine{42};
+    std::vector<seqan3::dna4> text(2000);
+    for (auto & c : text)
+        c.assign_rank(engine() % 4);
+
+    for (uint8_t k : {5, 15, 31})
+    {
+        for (seqan3::strobe_window window : {seqan3::strobe_window{1, 1},
+                                              seqan3::strobe_window{1, 10},
+                                              seqan3::strobe_window{20, 70},
+                                              seqan3::strobe_window{1990, 2100}})
+        {
+            EXPECT_RANGE_EQ(text | seqan3::views::strobemer(seqan3::ungapped{k}, window),
+                            naive_strobemer(text, seqan3::ungapped{k}, window));
+        }
+    }
+}
+
+TEST(strobemer_test, combinability)
+{
+    std::vector<seqan3::dna4> text{"ACGGCGACGTTTAGCTTAGCA"_dna4};
+    auto stop_at_t = std::views::take_while(
+        [](seqan3::dna4 const x)
+        {
+            return x != 'T'_dna4;
+        });
+
+    EXPECT_RANGE_EQ(text | stop_at_t | seqan3::views::strobemer(seqan3::ungapped{3}, seqan3::strobe_window{1, 3}),
+                    naive_strobemer(std::vector<seqan3::dna4>{"ACGGCGACG"_dna4}, seqan3::ungapped{3}, {1, 3}));
+}
+
+TEST(strobemer_test, invalid_window)
+{
+    std::vector<seqan3::dna4> text{"ACGT"_dna4};
+
+    EXPECT_THROW_MSG(text | seqan3::views::strobemer(seqan3::ungapped{3}, seqan3::strobe_window{0, 3}),
+                     std::invalid_argument,
+                     "The strobe window must satisfy 0 < min_offset <= max_offset.");
+    EXPECT_THROW_MSG(text | seqan3::views::strobemer(seqan3::ungapped{3}, seqan3::strobe_window{4, 3}),
+                     std::invalid_argument,
+                     "The strobe window must satisfy 0 < min_offset <= max_offset.");
+}
@@ -0,0 +1,204 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <forward_list>
+#include <list>
+#include <random>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/search/views/syncmer.hpp>
+#include <seqan3/test/expect_range_eq.hpp>
+#include <seqan3/test/expect_throw_msg.hpp>
+#include <seqan3/utility/range/to.hpp>
+
+#include "../../range/iterator_test_template.hpp"
+
+using seqan3::operator""_dna4;
+using result_t = std::vector<size_t>;
+
+static constexpr uint64_t default_seed = 0x8F'3F'73'B5'CF'1C'9A'DE;
+
+// Checks every k-mer independently: Is the leftmost smallest s-mer at one of the offsets?
+result_t naive_syncmer(std::vector<seqan3::dna4> const & text,
+                       uint8_t const k,
+                       uint8_t const s,
+                       std::vector<size_t> const & offsets,
+                       uint64_t const seed = default_seed)
+{
+    result_t kmers = text | seqan3::views::kmer_hash(seqan3::ungapped{k}) | seqan3::ranges::to<result_t>();
+    result_t smers = text | seqan3::views::kmer_hash(seqan3::ungapped{s}) | seqan3::ranges::to<result_t>();
+
+    result_t result{};
+    for (size_t i = 0; i < kmers.size(); ++i)
+    {
+        size_t min_offset = 0;
+        for (size_t j = 1; j <= static_cast<size_t>(k - s); ++j)
+            if ((smers[i + j] ^ seed) < (smers[i + min_offset] ^ seed))
+                min_offset = j;
+
+        if (std::ranges::find(offsets, min_offset) != offsets.end())
+            result.push_back(kmers[i]);
+    }
+
+    return result;
+}
+
+using iterator_type = std::ranges::iterator_t<
+    decltype(std::declval<std::vector<seqan3::dna4> &>() | seqan3::views::syncmer(seqan3::ungapped{4},
+                                                                                  seqan3::ungapped{2}))>;
+
+template <>
+struct iterator_fixture<iterator_type> : public ::testing::Test
+{
+    using iterator_tag = std::forward_iterator_tag;
+    static constexpr bool const_iterable = true;
+
+    std::vector<seqan3::dna4> text{"ACGGCGACGTTTAG"_dna4};
+    result_t expected_range = naive_syncmer(text, 4, 2, {0, 2});
+
+    using test_range_t = decltype(text | seqan3::views::syncmer(seqan3::ungapped{4}, seqan3::ungapped{2}));
+    test_range_t test_range = text | seqan3::views::syncmer(seqan3::ungapped{4}, seqan3::ungapped{2});
+};
+
+using test_type = ::testing::Types<iterator_type>;
+INSTANTIATE_TYPED_TEST_SUITE_P(iterator_fixture, iterator_fixture, test_type, );
+
+template <typename T>
+class syncmer_view_properties_test : public ::testing::Test
+{};
+
+using underlying_range_types = ::testing::Types<std::vector<seqan3::dna4>,
+                                                std::vector<seqan3::dna4> const,
+                                                std::list<seqan3::dna4>,
+                                                std::list<seqan3::dna4> const,
+                                                std::forward_list<seqan3::dna4>,
+                                                std::forward_list<seqan3::dna4> const>;
+
+TYPED_TEST_SUITE(syncmer_view_properties_test, underlying_range_types, );
+
+TYPED_TEST(syncmer_view_properties_test, concepts)
+{
+    TypeParam text{'A'_dna4, 'C'_dna4, 'G'_dna4, 'T'_dna4, 'A'_dna4, 'C'_dna4};
+    auto v = text | seqan3::views::syncmer(seqan3::ungapped{4}, seqan3::ungapped{2});
+
+    EXPECT_TRUE(std::ranges::forward_range<decltype(v)>);
+    EXPECT_FALSE(std::ranges::bidirectional_range<decltype(v)>);
+    EXPECT_TRUE(std::ranges::view<decltype(v)>);
+    EXPECT_FALSE(std::ranges::sized_range<decltype(v)>);
+    EXPECT_FALSE(std::ranges::common_range<decltype(v)>);
+    EXPECT_TRUE(seqan3::const_iterable_range<decltype(v)>);
+    EXPECT_FALSE((std::ranges::output_range<decltype(v), size_t>));
+}
+
+TYPED_TEST(syncmer_view_properties_test, different_inputs)
+{
+    std::vector<seqan3::dna4> const sequence{"ACGGCGACGTTTAGCTTAGCA"_dna4};
+    TypeParam text(sequence.begin(), sequence.end());
+
+    EXPECT_RANGE_EQ(text | seqan3::views::syncmer(seqan3::ungapped{5}, seqan3::ungapped{2}),
+                    naive_syncmer(sequence, 5, 2, {0, 3}));
+    EXPECT_RANGE_EQ(text | seqan3::views::syncmer(seqan3::ungapped{5}, seqan3::ungapped{2}, seqan3::syncmer_offset{1}),
+                    naive_syncmer(sequence, 5, 2, {1}));
+}
+
+TEST(syncmer_test, small_sequence)
+{
+    std::vector<seqan3::dna4> text{"ACG"_dna4};
+    EXPECT_RANGE_EQ(text | seqan3::views::syncmer(seqan3::ungapped{4}, seqan3::ungapped{2}), result_t{});
+
+    text = "ACGT"_dna4;
+    EXPECT_RANGE_EQ(text | seqan3::views::syncmer(seqan3::ungapped{4}, seqan3::ungapped{2}),
+                    naive_syncmer(text, 4, 2, {0, 2}));
+}
+
+TEST(syncmer_test, every_kmer_is_a_closed_syncmer_if_s_equals_k)
+{
+    std::vector<seqan3::dna4> text{"ACGGCGACGTTTAG"_dna4};
+    EXPECT_RANGE_EQ(text | seqan3::views::syncmer(seqan3::ungapped{4}, seqan3::ungapped{4}),
+                    text | seqan3::views::kmer_hash(seqan3::ungapped{4}));
+}
+
+TEST(syncmer_test, leftmost_minimum)
+{
+    // All s-mers are equal, hence the smallest one is always at offset 0.
+    std::vector<seqan3::dna4> text{"AAAAAAAA"_dna4};
+    auto closed = text | seqan3::views::syncmer(seqan3::ungapped{4}, seqan3::ungapped{2});
+    EXPECT_EQ(std::ranges::distance(closed), 5);
+
+    auto open = text | seqan3::views::syncmer(seqan3::ungapped{4}, seqan3::ungapped{2}, seqan3::syncmer_offset{2});
+    EXPECT_EQ(std::ranges::distance(open), 0);
+}
+
+TEST(syncmer_test, seed)
+{
+    std::vector<seqan3::dna4> text{"ACGGCGACGTTTAGCTTAGCA"_dna4};
+    EXPECT_RANGE_EQ(text | seqan3::views::syncmer(seqan3::ungapped{5}, seqan3::ungapped{2}, seqan3::seed{0}),
+                    naive_syncmer(text, 5, 2, {0, 3}, 0));
+    EXPECT_RANGE_EQ(text
+                        | seqan3::views::syncmer(seqan3::ungapped{5},
+                                                 seqan3::ungapped{2},
+                                                 seqan3::syncmer_offset{2},
+                                                 seqan3::seed{0}),
+                    naive_syncmer(text, 5, 2, {2}, 0));
+}
+
+TEST(syncmer_test, matches_naive)
+{
+    std::mt19937_64 engine{42};
+    std::vector<seqan3::dna4> text(2000);
+    for (auto & c : text)
+        c.assign_rank(engine() % 4);
+
+    for (uint8_t k : {5, 11, 21, 31})
+    {
+        for (uint8_t s : {1, 3, 8, 15})
+        {
+            if (s > k)
+                continue;
+
+            EXPECT_RANGE_EQ(text | seqan3::views::syncmer(seqan3::ungapped{k}, seqan3::ungapped{s}),
+                            naive_syncmer(text, k, s, {0u, static_cast<size_t>(k - s)}));
+
+            for (uint8_t t : {0, 1, (k - s) / 2})
+            {
+                if (t > k - s)
+                    continue;
+
+                EXPECT_RANGE_EQ(
+                    text | seqan3::views::syncmer(seqan3::ungapped{k}, seqan3::ungapped{s}, seqan3::syncmer_offset{t}),
+                    naive_syncmer(text, k, s, {t}));
+            }
+        }
+    }
+}
+
+TEST(syncmer_test, combinability)
+{
+    std::vector<seqan3::dna4> text{"ACGGCGACGTTTAGCTTAGCA"_dna4};
+    auto stop_at_t = std::views::take_while(
+        [](seqan3::dna4 const x)
+        {
+            return x != 'T'_dna4;
+        });
+
+    EXPECT_RANGE_EQ(text | stop_at_t | seqan3::views::syncmer(seqan3::ungapped{4}, seqan3::ungapped{2}),
+                    naive_syncmer(std::vector<seqan3::dna4>{"ACGGCGACG"_dna4}, 4, 2, {0, 2}));
+}
+
+TEST(syncmer_test, invalid_sizes)
+{
+    std::vector<seqan3::dna4> text{"ACGT"_dna4};
+
+    EXPECT_THROW_MSG(text | seqan3::views::syncmer(seqan3::ungapped{4}, seqan3::ungapped{5}),
+                     std::invalid_argument,
+                     "The s-mer size must be in [1, k].");
+    EXPECT_THROW_MSG(text | seqan3::views::syncmer(seqan3::ungapped{4}, seqan3::ungapped{0}),
+                     std::invalid_argument,
+                     "The s-mer size must be in [1, k].");
+    EXPECT_THROW_MSG(text | seqan3::views::syncmer(seqan3::ungapped{4}, seqan3::ungapped{2}, seqan3::syncmer_offset{3}),
+                     std::invalid_argument,
+                     "The offset of an open syncmer must not be greater than k - s.");
+}
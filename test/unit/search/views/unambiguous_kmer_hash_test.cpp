@@ -0,0 +1,223 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <forward_list>
+#include <list>
+#include <random>
+#include <sstream>
+
+#include <seqan3/alphabet/nucleotide/dna15.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/alphabet/nucleotide/rna5.hpp>
+#include <seqan3/alphabet/views/char_to.hpp>
+#include <seqan3/alphabet/views/to_char.hpp>
+#include <seqan3/search/views/minimiser.hpp>
+#include <seqan3/search/views/unambiguous_kmer_hash.hpp>
+#include <seqan3/test/expect_range_eq.hpp>
+#include <seqan3/test/expect_throw_msg.hpp>
+#include <seqan3/utility/range/to.hpp>
+
+#include "../../range/iterator_test_template.hpp"
+
+using seqan3::operator""_dna4;
+using seqan3::operator""_dna5;
+using seqan3::operator""_shape;
+
+// The hash values and positions of all k-mers without an N, computed with views::kmer_hash on seqan3::dna4.
+template <typename alphabet_t>
+std::pair<std::vector<size_t>, std::vector<size_t>> expected_hashes(std::vector<alphabet_t> const & text,
+                                                                    seqan3::shape const & shape)
+{
+    auto as_dna4 = text | seqan3::views::to_char | seqan3::views::char_to<seqan3::dna4>;
+    std::vector<size_t> all = as_dna4 | seqan3::views::kmer_hash(shape) | seqan3::ranges::to<std::vector>();
+
+    std::pair<std::vector<size_t>, std::vector<size_t>> result{};
+    for (size_t i = 0; i < all.size(); ++i)
+    {
+        auto kmer = text | std::views::drop(i) | std::views::take(shape.size()) | seqan3::views::to_char;
+        if (std::ranges::find_if_not(kmer,
+                                     [](char const c)
+                                     {
+                                         return c == 'A' || c == 'C' || c == 'G' || c == 'T' || c == 'U';
+                                     })
+            == kmer.end())
+        {
+            result.first.push_back(all[i]);
+            result.second.push_back(i);
+        }
+    }
+
+    return result;
+}
+
+template <typename range_t>
+std::vector<size_t> positions(range_t && range)
+{
+    std::vector<size_t> result{};
+    for (auto it = range.begin(); it != range.end(); ++it)
+        result.push_back(it.position());
+    return result;
+}
+
+using iterator_type = std::ranges::iterator_t<
+    decltype(std::declval<std::vector<seqan3::dna5> &>() | seqan3::views::unambiguous_kmer_hash(seqan3::ungapped{3}))>;
+
+template <>
+struct iterator_fixture<iterator_type> : public ::testing::Test
+{
+    using iterator_tag = std::forward_iterator_tag;
+    static constexpr bool const_iterable = true;
+
+    std::vector<seqan3::dna5> text{"ACGTNAGCTANNACGNT"_dna5};
+    std::vector<size_t> expected_range = expected_hashes(text, seqan3::ungapped{3}).first;
+
+    using test_range_t = decltype(text | seqan3::views::unambiguous_kmer_hash(seqan3::ungapped{3}));
+    test_range_t test_range = text | seqan3::views::unambiguous_kmer_hash(seqan3::ungapped{3});
+};
+
+using test_type = ::testing::Types<iterator_type>;
+INSTANTIATE_TYPED_TEST_SUITE_P(iterator_fixture, iterator_fixture, test_type, );
+
+template <typename T>
+class unambiguous_kmer_hash_view_properties_test : public ::testing::Test
+{};
+
+using underlying_range_types = ::testing::Types<std::vector<seqan3::dna5>,
+                                                std::vector<seqan3::dna5> const,
+                                                std::list<seqan3::dna5>,
+                                                std::list<seqan3::dna5> const,
+                                                std::forward_list<seqan3::dna5>,
+                                                std::forward_list<seqan3::dna5> const>;
+
+TYPED_TEST_SUITE(unambiguous_kmer_hash_view_properties_test, underlying_range_types, );
+
+TYPED_TEST(unambiguous_kmer_hash_view_properties_test, concepts)
+{
+    TypeParam text{'A'_dna5, 'C'_dna5, 'N'_dna5, 'T'_dna5, 'A'_dna5, 'C'_dna5};
+    auto v = text | seqan3::views::unambiguous_kmer_hash(seqan3::ungapped{2});
+
+    EXPECT_TRUE(std::ranges::forward_range<decltype(v)>);
+    EXPECT_FALSE(std::ranges::bidirectional_range<decltype(v)>);
+    EXPECT_TRUE(std::ranges::view<decltype(v)>);
+    EXPECT_FALSE(std::ranges::sized_range<decltype(v)>);
+    EXPECT_FALSE(std::ranges::common_range<decltype(v)>);
+    EXPECT_TRUE(seqan3::const_iterable_range<decltype(v)>);
+    EXPECT_FALSE((std::ranges::output_range<decltype(v), size_t>));
+}
+
+TYPED_TEST(unambiguous_kmer_hash_view_properties_test, different_inputs)
+{
+    std::vector<seqan3::dna5> const sequence{"NACGTNAGCTANNACGNTTACG"_dna5};
+    TypeParam text(sequence.begin(), sequence.end());
+
+    for (seqan3::shape const & shape : {seqan3::shape{seqan3::ungapped{3}}, 0b1101_shape})
+    {
+        auto [hashes, starts] = expected_hashes(sequence, shape);
+        EXPECT_RANGE_EQ(text | seqan3::views::unambiguous_kmer_hash(shape), hashes);
+        EXPECT_RANGE_EQ(positions(text | seqan3::views::unambiguous_kmer_hash(shape)), starts);
+    }
+}
+
+TEST(unambiguous_kmer_hash_test, example)
+{
+    std::vector<seqan3::dna5> text{"ACGTNAGCTANNACGNT"_dna5};
+    auto v = text | seqan3::views::unambiguous_kmer_hash(seqan3::ungapped{3});
+
+    // ACG, CGT, AGC, GCT, CTA, ACG
+    EXPECT_RANGE_EQ(v, (std::vector<size_t>{6, 27, 9, 39, 28, 6}));
+    EXPECT_RANGE_EQ(positions(v), (std::vector<size_t>{0, 1, 5, 6, 7, 12}));
+}
+
+TEST(unambiguous_kmer_hash_test, same_hash_as_dna4)
+{
+    std::vector<seqan3::dna4> text{"ACGTAGCTTAGCATTTGCAGGCCAT"_dna4};
+    std::vector<seqan3::dna5> text5 = text | seqan3::views::to_char | seqan3::views::char_to<seqan3::dna5>
+                                    | seqan3::ranges::to<std::vector>();
+
+    for (seqan3::shape const & shape : {seqan3::shape{seqan3::ungapped{5}}, 0b1001101_shape})
+    {
+        EXPECT_RANGE_EQ(text | seqan3::views::unambiguous_kmer_hash(shape), text | seqan3::views::kmer_hash(shape));
+        EXPECT_RANGE_EQ(text5 | seqan3::views::unambiguous_kmer_hash(shape), text | seqan3::views::kmer_hash(shape));
+    }
+}
+
+TEST(unambiguous_kmer_hash_test, other_alphabets)
+{
+    using seqan3::operator""_dna15;
+    using seqan3::operator""_rna5;
+
+    std::vector<seqan3::dna15> text15{"ACGTRACGYTTACGSS"_dna15};
+    auto [hashes15, starts15] = expected_hashes(text15, seqan3::ungapped{3});
+    EXPECT_RANGE_EQ(text15 | seqan3::views::unambiguous_kmer_hash(seqan3::ungapped{3}), hashes15);
+    EXPECT_RANGE_EQ(positions(text15 | seqan3::views::unambiguous_kmer_hash(seqan3::ungapped{3})), starts15);
+
+    // U is hashed like T.
+    std::vector<seqan3::rna5> text_rna{"ACGUNACGU"_rna5};
+    EXPECT_RANGE_EQ(text_rna | seqan3::views::unambiguous_kmer_hash(seqan3::ungapped{4}),
+                    (std::vector<size_t>{27, 27}));
+}
+
+TEST(unambiguous_kmer_hash_test, no_unambiguous_kmer)
+{
+    std::vector<seqan3::dna5> text{"ACNGTNA"_dna5};
+    EXPECT_RANGE_EQ(text | seqan3::views::unambiguous_kmer_hash(seqan3::ungapped{3}), std::vector<size_t>{});
+
+    text = "NNNNNNN"_dna5;
+    EXPECT_RANGE_EQ(text | seqan3::views::unambiguous_kmer_hash(seqan3::ungapped{1}), std::vector<size_t>{});
+
+    text.clear();
+    EXPECT_RANGE_EQ(text | seqan3::views::unambiguous_kmer_hash(seqan3::ungapped{1}), std::vector<size_t>{});
+}
+
+TEST(unambiguous_kmer_hash_test, input_range)
+{
+    std::istringstream stream{"ACGTNAGCTANNACGNT"};
+    auto text = std::views::istream<char>(stream) | seqan3::views::char_to<seqan3::dna5>;
+
+    auto v = text | seqan3::views::unambiguous_kmer_hash(seqan3::ungapped{3});
+    EXPECT_TRUE(std::ranges::input_range<decltype(v)>);
+    EXPECT_FALSE(std::ranges::forward_range<decltype(v)>);
+    EXPECT_RANGE_EQ(v, (std::vector<size_t>{6, 27, 9, 39, 28, 6}));
+}
+
+TEST(unambiguous_kmer_hash_test, matches_naive)
+{
+    std::mt19937_64 engine{42};
+    std::vector<seqan3::dna5> text(5000);
+    for (auto & c : text)
+    {
+        // 1 in 50 letters is an N.
+        uint64_t const r = engine() % 200;
+        c = (r < 4) ? 'N'_dna5 : seqan3::dna5{}.assign_char("ACGT"[r % 4]);
+    }
+
+    for (seqan3::shape const & shape :
+         {seqan3::shape{seqan3::ungapped{1}}, seqan3::shape{seqan3::ungapped{15}}, seqan3::shape{seqan3::ungapped{32}},
+          0b1100110111_shape, 0b1111'0000'1111'0000'1111'0000'1111'0001_shape})
+    {
+        auto [hashes, starts] = expected_hashes(text, shape);
+        EXPECT_RANGE_EQ(text | seqan3::views::unambiguous_kmer_hash(shape), hashes);
+        EXPECT_RANGE_EQ(positions(text | seqan3::views::unambiguous_kmer_hash(shape)), starts);
+    }
+}
+
+TEST(unambiguous_kmer_hash_test, minimiser)
+{
+    std::vector<seqan3::dna5> text{"ACGTNAGCTANNACGNTTACGGT"_dna5};
+    auto [hashes, starts] = expected_hashes(text, seqan3::ungapped{3});
+
+    EXPECT_RANGE_EQ(text | seqan3::views::unambiguous_kmer_hash(seqan3::ungapped{3}) | seqan3::views::minimiser(2),
+                    hashes | seqan3::views::minimiser(2));
+}
+
+TEST(unambiguous_kmer_hash_test, invalid_shape)
+{
+    std::vector<seqan3::dna5> text{"ACGT"_dna5};
+    EXPECT_THROW_MSG(text | seqan3::views::unambiguous_kmer_hash(seqan3::ungapped{33}),
+                     std::invalid_argument,
+                     "The shape is too long for 2-bit hashing.\nMaximum shape size: 32\nGiven shape size: 33");
+}
@@ -0,0 +1,165 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <bit>
+#include <memory>
+#include <numeric>
+#include <ranges>
+#include <span>
+
+#include <seqan3/test/cereal.hpp>
+#include <seqan3/test/expect_range_eq.hpp>
+#include <seqan3/utility/bloom_filter/blocked_bloom_filter.hpp>
+
+TEST(blocked_bloom_filter_test, construction)
+{
+    EXPECT_TRUE(std::is_default_constructible_v<seqan3::blocked_bloom_filter>);
+    EXPECT_TRUE(std::is_copy_constructible_v<seqan3::blocked_bloom_filter>);
+    EXPECT_TRUE(std::is_move_constructible_v<seqan3::blocked_bloom_filter>);
+    EXPECT_TRUE(std::is_copy_assignable_v<seqan3::blocked_bloom_filter>);
+    EXPECT_TRUE(std::is_move_assignable_v<seqan3::blocked_bloom_filter>);
+    EXPECT_TRUE(std::is_destructible_v<seqan3::blocked_bloom_filter>);
+
+    // num hash functions defaults to two
+    seqan3::blocked_bloom_filter bf1{seqan3::bin_size{1024u}};
+    seqan3::blocked_bloom_filter bf2{seqan3::bin_size{1024u}, seqan3::hash_function_count{2u}};
+    EXPECT_TRUE(bf1 == bf2);
+
+    // bin_size parameter is too small
+    EXPECT_THROW((seqan3::blocked_bloom_filter{seqan3::bin_size{0u}}), std::logic_error);
+    // not enough hash functions
+    EXPECT_THROW((seqan3::blocked_bloom_filter{seqan3::bin_size{32u}, seqan3::hash_function_count{0u}}),
+                 std::logic_error);
+    // too many hash functions
+    EXPECT_THROW((seqan3::blocked_bloom_filter{seqan3::bin_size{32u}, seqan3::hash_function_count{6u}}),
+                 std::logic_error);
+}
+
+TEST(blocked_bloom_filter_test, member_getter)
+{
+    seqan3::blocked_bloom_filter t1{seqan3::bin_size{1024u}};
+    EXPECT_EQ(t1.bit_size(), 1024u);
+    EXPECT_EQ(t1.hash_function_count(), 2u);
+
+    // The size is rounded up to a multiple of 64.
+    seqan3::blocked_bloom_filter t2{seqan3::bin_size{1019u}, seqan3::hash_function_count{3u}};
+    EXPECT_EQ(t2.bit_size(), 1024u);
+    EXPECT_EQ(t2.raw_data().size(), 1024u);
+    EXPECT_EQ(t2.hash_function_count(), 3u);
+
+    seqan3::blocked_bloom_filter t3{seqan3::bin_size{1u}};
+    EXPECT_EQ(t3.bit_size(), 64u);
+}
+
+TEST(blocked_bloom_filter_test, contains)
+{
+    seqan3::blocked_bloom_filter bf{seqan3::bin_size{1024u}};
+
+    for (size_t hash : std::views::iota(0u, 64u))
+        EXPECT_FALSE(bf.contains(hash));
+}
+
+TEST(blocked_bloom_filter_test, emplace)
+{
+    for (size_t hash_funs = 1; hash_funs <= 5; ++hash_funs)
+    {
+        seqan3::blocked_bloom_filter bf{seqan3::bin_size{1019u}, seqan3::hash_function_count{hash_funs}};
+
+        for (size_t hash : std::views::iota(0u, 64u))
+            bf.emplace(hash);
+
+        // There are no false negatives.
+        for (size_t hash : std::views::iota(0u, 64u))
+            EXPECT_TRUE(bf.contains(hash));
+
+        // Each value sets at most `hash_funs` bits.
+        size_t set_bits{};
+        for (uint64_t const word : std::span{bf.raw_data().data(), bf.bit_size() / 64u})
+            set_bits += std::popcount(word);
+        EXPECT_LE(set_bits, 64u * hash_funs);
+        EXPECT_GT(set_bits, 0u);
+    }
+}
+
+TEST(blocked_bloom_filter_test, false_positive_rate)
+{
+    // 16 bits per value and 3 hash functions: The classic Bloom Filter has a false positive rate of about 0.3%.
+    seqan3::blocked_bloom_filter bf{seqan3::bin_size{1u << 16}, seqan3::hash_function_count{3u}};
+
+    for (size_t hash = 0; hash < 4096u; ++hash)
+        bf.emplace(hash * 7919u);
+
+    size_t const false_positives = bf.count(std::views::iota(1u << 20, (1u << 20) + 10'000u));
+    EXPECT_LT(false_positives, 200u); // < 2%
+}
+
+TEST(blocked_bloom_filter_test, bulk_contains)
+{
+    seqan3::blocked_bloom_filter bf{seqan3::bin_size{1024u}};
+
+    for (size_t hash = 0; hash < 100u; hash += 3)
+        bf.emplace(hash);
+
+    // More values than fit into one batch.
+    std::vector<size_t> values(100);
+    std::iota(values.begin(), values.end(), 0u);
+
+    std::vector<bool> expected{};
+    for (size_t const value : values)
+        expected.push_back(bf.contains(value));
+
+    auto agent = bf.membership_agent();
+    EXPECT_RANGE_EQ(agent.bulk_contains(values), expected);
+    EXPECT_RANGE_EQ(agent.bulk_contains(std::views::iota(0u, 100u)), expected);
+    EXPECT_RANGE_EQ(agent.bulk_contains(std::views::iota(0u, 0u)), std::vector<bool>{});
+
+    // The result buffer is reused.
+    auto & result = agent.bulk_contains(values);
+    EXPECT_EQ(std::addressof(agent.bulk_contains(std::views::iota(0u, 10u))), std::addressof(result));
+    EXPECT_RANGE_EQ(result, expected | std::views::take(10));
+
+    for (size_t i = 0; i < values.size(); i += 3)
+        EXPECT_TRUE(expected[i]);
+}
+
+TEST(blocked_bloom_filter_test, count)
+{
+    seqan3::blocked_bloom_filter bf{seqan3::bin_size{1024u}};
+
+    for (size_t hash : std::views::iota(0u, 64u))
+        bf.emplace(hash);
+
+    EXPECT_EQ(bf.count(std::views::iota(0u, 64u)), 64u);
+    EXPECT_EQ(bf.count(std::views::iota(0u, 0u)), 0u);
+
+    std::vector<size_t> values(100);
+    std::iota(values.begin(), values.end(), 0u);
+    auto agent = bf.membership_agent();
+    EXPECT_EQ(bf.count(values), static_cast<size_t>(std::ranges::count(agent.bulk_contains(values), true)));
+}
+
+TEST(blocked_bloom_filter_test, reset)
+{
+    seqan3::blocked_bloom_filter bf{seqan3::bin_size{1024u}};
+
+    for (size_t hash : std::views::iota(0u, 64u))
+        bf.emplace(hash);
+
+    bf.reset();
+
+    EXPECT_EQ(bf.count(std::views::iota(0u, 64u)), 0u);
+    EXPECT_EQ(bf.bit_size(), 1024u);
+}
+
+TEST(blocked_bloom_filter_test, serialisation)
+{
+    seqan3::blocked_bloom_filter bf{seqan3::bin_size{1019u}, seqan3::hash_function_count{3u}};
+
+    for (size_t hash : std::views::iota(0u, 64u))
+        bf.emplace(hash);
+
+    seqan3::test::do_serialisation(bf);
+}
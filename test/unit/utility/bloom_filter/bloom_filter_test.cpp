@@ -6,6 +6,7 @@
 
 #include <seqan3/test/cereal.hpp>
 #include <seqan3/test/expect_range_eq.hpp>
+#include <seqan3/test/tmp_directory.hpp>
 #include <seqan3/utility/bloom_filter/bloom_filter.hpp>
 
 template <typename bf_type>
@@ -130,3 +131,53 @@ TYPED_TEST(bloom_filter_test, serialisation)
     TypeParam bf{TestFixture::make_bf(seqan3::bin_size{1024u})};
     seqan3::test::do_serialisation(bf);
 }
+
+TYPED_TEST(bloom_filter_test, mapped)
+{
+    seqan3::bloom_filter bf{seqan3::bin_size{1019u}, seqan3::hash_function_count{3u}};
+
+    for (size_t hash : std::views::iota(0u, 64u))
+        bf.emplace(hash);
+
+    // 1. Store either the uncompressed or compressed Bloom Filter and map it.
+    TypeParam bf2{bf};
+    seqan3::test::tmp_directory tmp{};
+    auto const filename = tmp.path() / "bf.mapped";
+    bf2.store(filename);
+
+    seqan3::bloom_filter<seqan3::data_layout::mapped> mapped{filename};
+    EXPECT_EQ(mapped.bit_size(), 1019u);
+    EXPECT_EQ(mapped.hash_function_count(), 3u);
+
+    // 2. Queries yield the same results as for the original Bloom Filter.
+    for (size_t hash : std::views::iota(0u, 256u))
+        EXPECT_EQ(mapped.contains(hash), bf.contains(hash));
+    EXPECT_EQ(mapped.count(std::views::iota(0u, 256u)), bf.count(std::views::iota(0u, 256u)));
+
+    // 3. Copies share the mapping.
+    auto mapped_copy = mapped;
+    EXPECT_TRUE(mapped_copy == mapped);
+    EXPECT_EQ(mapped_copy.raw_data().data(), mapped.raw_data().data());
+
+    // 4. A mapped Bloom Filter can be copied into memory.
+    seqan3::bloom_filter bf_from_mapped{mapped};
+    EXPECT_TRUE(bf_from_mapped == bf);
+}
+
+TEST(bloom_filter_test, mapped_errors)
+{
+    using mapped_bf_t = seqan3::bloom_filter<seqan3::data_layout::mapped>;
+
+    seqan3::test::tmp_directory tmp{};
+
+    // File does not exist.
+    EXPECT_THROW(mapped_bf_t{tmp.path() / "does_not_exist"}, seqan3::file_open_error);
+
+    // File is too small.
+    auto const filename = tmp.path() / "not_a_bf";
+    {
+        std::ofstream out{filename};
+        out << "Not a Bloom Filter.";
+    }
+    EXPECT_THROW(mapped_bf_t{filename}, seqan3::file_open_error);
+}
@@ -0,0 +1,110 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include <seqan3/utility/parallel/thread_pool.hpp>
+
+TEST(thread_pool, construction)
+{
+    EXPECT_FALSE(std::is_default_constructible_v<seqan3::thread_pool>);
+    EXPECT_FALSE(std::is_copy_constructible_v<seqan3::thread_pool>);
+    EXPECT_FALSE(std::is_move_constructible_v<seqan3::thread_pool>);
+    EXPECT_FALSE(std::is_copy_assignable_v<seqan3::thread_pool>);
+    EXPECT_FALSE(std::is_move_assignable_v<seqan3::thread_pool>);
+
+    EXPECT_THROW(seqan3::thread_pool{0u}, std::invalid_argument);
+
+    seqan3::thread_pool pool{3u};
+    EXPECT_EQ(pool.size(), 3u);
+}
+
+TEST(thread_pool, submit)
+{
+    std::atomic<size_t> counter{0};
+    auto task = [&counter]()
+    {
+        ++counter;
+    };
+
+    {
+        seqan3::thread_pool pool{4u};
+        for (size_t i = 0; i < 1000; ++i)
+            pool.submit(task);
+    } // The destructor executes the pending tasks.
+
+    EXPECT_EQ(counter.load(), 1000u);
+}
+
+TEST(thread_pool, executed_by_pool_threads)
+{
+    std::mutex mutex{};
+    std::set<std::thread::id> thread_ids{};
+    auto task = [&]()
+    {
+        std::lock_guard lock{mutex};
+        thread_ids.insert(std::this_thread::get_id());
+    };
+
+    {
+        seqan3::thread_pool pool{2u};
+        for (size_t i = 0; i < 1000; ++i)
+            pool.submit(task);
+
+        // The calling thread does not belong to the pool.
+        EXPECT_FALSE(pool.run_pending_task());
+    }
+
+    EXPECT_LE(thread_ids.size(), 2u);
+    EXPECT_EQ(thread_ids.count(std::this_thread::get_id()), 0u);
+}
+
+TEST(thread_pool, nested_submit)
+{
+    // Every outer task submits inner tasks and waits for them by executing pending tasks. With a single thread, the
+    // outer task must execute its inner tasks itself.
+    for (size_t const thread_count : {1u, 4u})
+    {
+        seqan3::thread_pool pool{thread_count};
+        std::atomic<size_t> finished_outer{0};
+
+        struct inner_task
+        {
+            std::atomic<size_t> * counter;
+
+            void operator()() const
+            {
+                ++*counter;
+            }
+        };
+
+        auto outer_task = [&]()
+        {
+            std::atomic<size_t> counter{0};
+            std::vector<inner_task> inner_tasks(10, inner_task{&counter});
+            for (inner_task & task : inner_tasks)
+                pool.submit(task);
+
+            while (counter < inner_tasks.size())
+                if (!pool.run_pending_task())
+                    std::this_thread::yield();
+
+            ++finished_outer;
+        };
+
+        std::vector<decltype(outer_task)> outer_tasks(8, outer_task);
+        for (auto & task : outer_tasks)
+            pool.submit(task);
+
+        while (finished_outer < outer_tasks.size())
+            std::this_thread::yield();
+    }
+}
@@ -242,3 +242,40 @@ TYPED_TEST(simd_algorithm_upcast, unsigned)
                 EXPECT_EQ(t[i], static_cast<target_type>(static_cast<TypeParam>(-10)));
         });
 }
+
+//-----------------------------------------------------------------------------
+// Algorithm shuffle_lookup
+//-----------------------------------------------------------------------------
+
+template <typename t>
+struct simd_algorithm_shuffle_lookup : ::testing::Test
+{};
+
+using shuffle_lookup_test_types = ::testing::Types<int8_t, int16_t, int32_t>;
+TYPED_TEST_SUITE(simd_algorithm_shuffle_lookup, shuffle_lookup_test_types, );
+
+TYPED_TEST(simd_algorithm_shuffle_lookup, lookup)
+{
+    using simd_t = seqan3::simd::simd_type_t<TypeParam>;
+    constexpr size_t table_size = sizeof(simd_t);
+
+    if constexpr (table_size >= 16) // The table needs at least 16 entries.
+    {
+        using table_simd_t = seqan3::simd::simd_type_t<int8_t, table_size>;
+
+        // The same 16 entries, including negative ones, in every block of 16 elements.
+        table_simd_t table{};
+        for (size_t i = 0; i < table_size; ++i)
+            table[i] = static_cast<int8_t>((i % 16) * 9 - 70);
+
+        // Indices of the range [0, 32), of which only the lowest 4 bits are used.
+        simd_t index{};
+        for (size_t i = 0; i < seqan3::simd::simd_traits<simd_t>::length; ++i)
+            index[i] = static_cast<TypeParam>((i * 7) % 32);
+
+        simd_t result = seqan3::detail::shuffle_lookup(table, index);
+
+        for (size_t i = 0; i < seqan3::simd::simd_traits<simd_t>::length; ++i)
+            EXPECT_EQ(result[i], static_cast<TypeParam>(static_cast<int8_t>((index[i] % 16) * 9 - 70))) << i;
+    }
+}